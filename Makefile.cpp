@@ -8,6 +8,7 @@ LIBS =
 
 # Directory structure
 BUILD_DIR = build
+GENERATED_DIR = $(BUILD_DIR)/generated
 TEST_FIXTURES = tests/fixtures
 TEST_OUTPUT = tests/output
 TEST_REPORTS = tests/reports
@@ -15,8 +16,8 @@ UNIT_TEST_DIR = testscpp/unit
 UNIT_TEST_BUILD = $(BUILD_DIR)/unit_tests
 
 # Source files
-SOURCES = srccpp/main.cpp srccpp/ast.cpp srccpp/codegen.cpp srccpp/error_handling.cpp srccpp/memory_management.cpp $(BUILD_DIR)/generated/grammar.tab.cpp $(BUILD_DIR)/generated/lex.yy.c
-OBJECTS = $(BUILD_DIR)/main.o $(BUILD_DIR)/ast.o $(BUILD_DIR)/codegen.o $(BUILD_DIR)/error_handling.o $(BUILD_DIR)/memory_management.o $(BUILD_DIR)/grammar.tab.o $(BUILD_DIR)/lex.yy.o
+SOURCES = srccpp/main.cpp srccpp/ast.cpp srccpp/codegen.cpp srccpp/error_handling.cpp srccpp/memory_management.cpp srccpp/ir_buffer.cpp srccpp/ir.cpp srccpp/llvm_backend.cpp srccpp/bitcode_writer.cpp srccpp/x86_backend.cpp srccpp/bytecode_vm.cpp srccpp/ssa.cpp srccpp/target.cpp src/string_pool.c srccpp/tinyc.cpp srccpp/driver.cpp $(GENERATED_DIR)/grammar.tab.cpp $(GENERATED_DIR)/lex.yy.c
+OBJECTS = $(BUILD_DIR)/main.o $(BUILD_DIR)/ast.o $(BUILD_DIR)/codegen.o $(BUILD_DIR)/error_handling.o $(BUILD_DIR)/memory_management.o $(BUILD_DIR)/ir_buffer.o $(BUILD_DIR)/ir.o $(BUILD_DIR)/llvm_backend.o $(BUILD_DIR)/bitcode_writer.o $(BUILD_DIR)/x86_backend.o $(BUILD_DIR)/bytecode_vm.o $(BUILD_DIR)/ssa.o $(BUILD_DIR)/target.o $(BUILD_DIR)/string_pool.o $(BUILD_DIR)/tinyc.o $(BUILD_DIR)/driver.o $(BUILD_DIR)/grammar.tab.o $(BUILD_DIR)/lex.yy.o
 
 # Unit test files
 UNIT_TEST_SOURCES = $(UNIT_TEST_DIR)/test_main.cpp $(UNIT_TEST_DIR)/simple_test.cpp $(UNIT_TEST_DIR)/main_exports.cpp $(UNIT_TEST_DIR)/test_external_decl.cpp
@@ -27,20 +28,39 @@ POINTER_STRUCT_TEST_SOURCES = $(UNIT_TEST_DIR)/test_main.cpp $(UNIT_TEST_DIR)/te
 POINTER_STRUCT_TEST_OBJECTS = $(UNIT_TEST_BUILD)/test_main.o $(UNIT_TEST_BUILD)/test_pointers_simple.o $(UNIT_TEST_BUILD)/test_structs_simple_fixed.o
 
 # Library objects (without main.o for unit tests)
-LIB_OBJECTS = $(BUILD_DIR)/ast.o $(BUILD_DIR)/codegen.o $(BUILD_DIR)/error_handling.o $(BUILD_DIR)/memory_management.o
+LIB_OBJECTS = $(BUILD_DIR)/ast.o $(BUILD_DIR)/codegen.o $(BUILD_DIR)/error_handling.o $(BUILD_DIR)/memory_management.o $(BUILD_DIR)/ir_buffer.o $(BUILD_DIR)/ir.o $(BUILD_DIR)/llvm_backend.o $(BUILD_DIR)/bitcode_writer.o $(BUILD_DIR)/x86_backend.o $(BUILD_DIR)/bytecode_vm.o $(BUILD_DIR)/ssa.o $(BUILD_DIR)/target.o $(BUILD_DIR)/string_pool.o
+
+# Driver objects linked into main.o users (the unit tests stub the parser)
+DRIVER_OBJECTS = $(BUILD_DIR)/tinyc.o $(BUILD_DIR)/driver.o
+
+# Embeddable compiler library (in-memory C API, see srccpp/tinyc.h)
+LIBRARY = ./libtinyc.a
+LIBRARY_OBJECTS = $(LIB_OBJECTS) $(BUILD_DIR)/tinyc.o $(BUILD_DIR)/grammar.tab.o $(BUILD_DIR)/lex.yy.o
+
+# Library API test files
+LIBRARY_TEST_SOURCES = $(UNIT_TEST_DIR)/test_main.cpp $(UNIT_TEST_DIR)/test_tinyc_api.cpp
+LIBRARY_TEST_OBJECTS = $(UNIT_TEST_BUILD)/test_main.o $(UNIT_TEST_BUILD)/test_tinyc_api.o
 
 # Generated files
-GENERATED = $(BUILD_DIR)/generated/grammar.tab.cpp $(BUILD_DIR)/generated/grammar.tab.hpp $(BUILD_DIR)/generated/lex.yy.c $(BUILD_DIR)/generated/grammar.output
+GENERATED = $(GENERATED_DIR)/grammar.tab.cpp $(GENERATED_DIR)/grammar.tab.hpp $(GENERATED_DIR)/lex.yy.c $(GENERATED_DIR)/grammar.output
 
 # LLVM configuration
 LLVM_CONFIG = llvm-config
 LLVM_CXXFLAGS = $(shell $(LLVM_CONFIG) --cppflags 2>/dev/null || echo "")
 LLVM_LDFLAGS = $(shell $(LLVM_CONFIG) --ldflags 2>/dev/null || echo "")
-LLVM_LIBS = $(shell $(LLVM_CONFIG) --libs core 2>/dev/null || echo "")
+LLVM_LIBS = $(shell $(LLVM_CONFIG) --libs core passes native 2>/dev/null || echo "")
+LLVM_BINDIR = $(shell $(LLVM_CONFIG) --bindir 2>/dev/null)
+LLVM_DIS = $(if $(LLVM_BINDIR),$(LLVM_BINDIR)/llvm-dis,llvm-dis)
+LLVM_AS = $(if $(LLVM_BINDIR),$(LLVM_BINDIR)/llvm-as,llvm-as)
+
+# Sanitizer flags for instrumented builds, e.g. SANITIZE=-fsanitize=address
+SANITIZE =
+CXXFLAGS += $(SANITIZE)
+CFLAGS += $(SANITIZE)
 
-# Add LLVM flags if available
+# Add LLVM flags if available; they enable --backend=llvm-api
 ifneq ($(LLVM_CXXFLAGS),)
-	CXXFLAGS += $(LLVM_CXXFLAGS)
+	CXXFLAGS += $(LLVM_CXXFLAGS) -DTINYC_HAVE_LLVM
 	LDFLAGS += $(LLVM_LDFLAGS)
 	LIBS += $(LLVM_LIBS)
 endif
@@ -89,14 +109,21 @@ all: $(TARGET)
 # Build the compiler
 $(TARGET): $(OBJECTS)
 	@echo "Linking $(TARGET)..."
-	$(CXX) $(CXXFLAGS) -o $(TARGET) $(OBJECTS) $(LDFLAGS) $(LIBS)
+	$(CXX) $(CXXFLAGS) -o $(TARGET) $(OBJECTS) $(LDFLAGS) $(LIBS) -lpthread
+
+# Build the embeddable library
+library: $(LIBRARY)
+
+$(LIBRARY): $(LIBRARY_OBJECTS)
+	@echo "Archiving $(LIBRARY)..."
+	ar rcs $(LIBRARY) $(LIBRARY_OBJECTS)
 
 # Create build directories
 $(BUILD_DIR):
 	mkdir -p $(BUILD_DIR)
 
-$(BUILD_DIR)/generated:
-	mkdir -p $(BUILD_DIR)/generated
+$(GENERATED_DIR):
+	mkdir -p $(GENERATED_DIR)
 
 $(UNIT_TEST_BUILD):
 	mkdir -p $(UNIT_TEST_BUILD)
@@ -108,13 +135,13 @@ $(TEST_REPORTS):
 	mkdir -p $(TEST_REPORTS)
 
 # Object file dependencies
-$(BUILD_DIR)/main.o: srccpp/main.cpp srccpp/ast.h srccpp/codegen.h $(BUILD_DIR)/generated/grammar.tab.hpp | $(BUILD_DIR)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c srccpp/main.cpp -o $@
+$(BUILD_DIR)/main.o: srccpp/main.cpp srccpp/ast.h srccpp/codegen.h srccpp/driver.h srccpp/llvm_backend.h srccpp/bitcode_writer.h srccpp/x86_backend.h srccpp/bytecode_vm.h $(GENERATED_DIR)/grammar.tab.hpp | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c srccpp/main.cpp -o $@
 
-$(BUILD_DIR)/ast.o: srccpp/ast.cpp srccpp/ast.h | $(BUILD_DIR)
+$(BUILD_DIR)/ast.o: srccpp/ast.cpp srccpp/ast.h src/string_pool.h | $(BUILD_DIR)
 	$(CXX) $(CXXFLAGS) -c srccpp/ast.cpp -o $@
 
-$(BUILD_DIR)/codegen.o: srccpp/codegen.cpp srccpp/codegen.h srccpp/ast.h srccpp/constants.h | $(BUILD_DIR)
+$(BUILD_DIR)/codegen.o: srccpp/codegen.cpp srccpp/codegen.h srccpp/ast.h srccpp/constants.h srccpp/ssa.h srccpp/ir.h srccpp/ir_buffer.h srccpp/target.h src/string_pool.h | $(BUILD_DIR)
 	$(CXX) $(CXXFLAGS) -c srccpp/codegen.cpp -o $@
 
 $(BUILD_DIR)/error_handling.o: srccpp/error_handling.cpp srccpp/error_handling.h srccpp/constants.h | $(BUILD_DIR)
@@ -123,41 +150,79 @@ $(BUILD_DIR)/error_handling.o: srccpp/error_handling.cpp srccpp/error_handling.h
 $(BUILD_DIR)/memory_management.o: srccpp/memory_management.cpp srccpp/memory_management.h srccpp/constants.h srccpp/error_handling.h | $(BUILD_DIR)
 	$(CXX) $(CXXFLAGS) -c srccpp/memory_management.cpp -o $@
 
-$(BUILD_DIR)/grammar.tab.o: $(BUILD_DIR)/generated/grammar.tab.cpp srccpp/ast.h srccpp/codegen.h | $(BUILD_DIR)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c $< -o $@
+$(BUILD_DIR)/ir_buffer.o: srccpp/ir_buffer.cpp srccpp/ir_buffer.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/ir_buffer.cpp -o $@
+
+$(BUILD_DIR)/ir.o: srccpp/ir.cpp srccpp/ir.h srccpp/ir_buffer.h srccpp/ast.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/ir.cpp -o $@
+
+$(BUILD_DIR)/llvm_backend.o: srccpp/llvm_backend.cpp srccpp/llvm_backend.h srccpp/codegen.h srccpp/ir.h srccpp/ast.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/llvm_backend.cpp -o $@
+
+$(BUILD_DIR)/bitcode_writer.o: srccpp/bitcode_writer.cpp srccpp/bitcode_writer.h srccpp/codegen.h srccpp/target.h srccpp/ir.h srccpp/ast.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/bitcode_writer.cpp -o $@
+
+$(BUILD_DIR)/x86_backend.o: srccpp/x86_backend.cpp srccpp/x86_backend.h srccpp/codegen.h srccpp/target.h srccpp/ir.h srccpp/ast.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/x86_backend.cpp -o $@
+
+$(BUILD_DIR)/bytecode_vm.o: srccpp/bytecode_vm.cpp srccpp/bytecode_vm.h srccpp/codegen.h srccpp/target.h srccpp/ir.h srccpp/ast.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/bytecode_vm.cpp -o $@
+
+$(BUILD_DIR)/ssa.o: srccpp/ssa.cpp srccpp/ssa.h srccpp/ir.h srccpp/ast.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/ssa.cpp -o $@
+
+$(BUILD_DIR)/target.o: srccpp/target.cpp srccpp/target.h srccpp/ast.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/target.cpp -o $@
 
-$(BUILD_DIR)/lex.yy.o: $(BUILD_DIR)/generated/lex.yy.c $(BUILD_DIR)/generated/grammar.tab.hpp | $(BUILD_DIR)
-	$(CC) $(CFLAGS) -Wno-sign-compare -I$(BUILD_DIR)/generated -c $< -o $@
+# String literal decoding and pooling, shared with the C port
+$(BUILD_DIR)/string_pool.o: src/string_pool.c src/string_pool.h | $(BUILD_DIR)
+	$(CC) $(CFLAGS) -std=c99 -c src/string_pool.c -o $@
+
+$(BUILD_DIR)/tinyc.o: srccpp/tinyc.cpp srccpp/tinyc.h srccpp/ast.h srccpp/codegen.h srccpp/error_handling.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/tinyc.cpp -o $@
+
+$(BUILD_DIR)/driver.o: srccpp/driver.cpp srccpp/driver.h srccpp/tinyc.h srccpp/error_handling.h srccpp/constants.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -c srccpp/driver.cpp -o $@
+
+$(BUILD_DIR)/grammar.tab.o: $(GENERATED_DIR)/grammar.tab.cpp srccpp/ast.h srccpp/codegen.h | $(BUILD_DIR)
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c $< -o $@
+
+$(BUILD_DIR)/lex.yy.o: $(GENERATED_DIR)/lex.yy.c $(GENERATED_DIR)/grammar.tab.hpp | $(BUILD_DIR)
+	$(CC) $(CFLAGS) -Wno-sign-compare -I$(GENERATED_DIR) -c $< -o $@
 
 # Generate parser from grammar
-$(BUILD_DIR)/generated/grammar.tab.cpp $(BUILD_DIR)/generated/grammar.tab.hpp: srccpp/grammar.y | $(BUILD_DIR)/generated
+$(GENERATED_DIR)/grammar.tab.cpp $(GENERATED_DIR)/grammar.tab.hpp: srccpp/grammar.y | $(GENERATED_DIR)
 	@echo "Generating parser..."
-	bison -d -v -t -o $(BUILD_DIR)/generated/grammar.tab.cpp srccpp/grammar.y
+	bison -d -v -t -o $(GENERATED_DIR)/grammar.tab.cpp srccpp/grammar.y
 
 # Generate lexer from specification
-$(BUILD_DIR)/generated/lex.yy.c: srccpp/lexer.l $(BUILD_DIR)/generated/grammar.tab.hpp | $(BUILD_DIR)/generated
+$(GENERATED_DIR)/lex.yy.c: srccpp/lexer.l $(GENERATED_DIR)/grammar.tab.hpp | $(GENERATED_DIR)
 	@echo "Generating lexer..."
 	flex -o $@ srccpp/lexer.l
 
 # Unit test object files
 $(UNIT_TEST_BUILD)/test_main.o: $(UNIT_TEST_DIR)/test_main.cpp | $(UNIT_TEST_BUILD)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c $< -o $@
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c $< -o $@
 
-$(UNIT_TEST_BUILD)/simple_test.o: $(UNIT_TEST_DIR)/simple_test.cpp srccpp/ast.h srccpp/error_handling.h srccpp/memory_management.h srccpp/codegen.h srccpp/constants.h | $(UNIT_TEST_BUILD)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c $< -o $@
+$(UNIT_TEST_BUILD)/simple_test.o: $(UNIT_TEST_DIR)/simple_test.cpp srccpp/driver.h srccpp/ast.h srccpp/error_handling.h srccpp/memory_management.h srccpp/codegen.h srccpp/constants.h srccpp/ir.h srccpp/ir_buffer.h srccpp/llvm_backend.h srccpp/ssa.h | $(UNIT_TEST_BUILD)
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c $< -o $@
 
 $(UNIT_TEST_BUILD)/main_exports.o: $(UNIT_TEST_DIR)/main_exports.cpp srccpp/main.cpp | $(UNIT_TEST_BUILD)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c $< -o $@
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c $< -o $@
 
 $(UNIT_TEST_BUILD)/test_external_decl.o: $(UNIT_TEST_DIR)/test_external_decl.cpp srccpp/ast.h srccpp/codegen.h | $(UNIT_TEST_BUILD)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c $< -o $@
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c $< -o $@
 
 # Pointer/Struct test object files
 $(UNIT_TEST_BUILD)/test_pointers_simple.o: $(UNIT_TEST_DIR)/test_pointers_simple.cpp srccpp/ast.h srccpp/codegen.h srccpp/memory_management.h srccpp/constants.h | $(UNIT_TEST_BUILD)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c $< -o $@
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c $< -o $@
 
 $(UNIT_TEST_BUILD)/test_structs_simple_fixed.o: $(UNIT_TEST_DIR)/test_structs_simple_fixed.cpp srccpp/ast.h srccpp/codegen.h srccpp/memory_management.h srccpp/constants.h | $(UNIT_TEST_BUILD)
-	$(CXX) $(CXXFLAGS) -I$(BUILD_DIR)/generated -c $< -o $@
+	$(CXX) $(CXXFLAGS) -I$(GENERATED_DIR) -c $< -o $@
+
+# Library API test object files
+$(UNIT_TEST_BUILD)/test_tinyc_api.o: $(UNIT_TEST_DIR)/test_tinyc_api.cpp srccpp/tinyc.h | $(UNIT_TEST_BUILD)
+	$(CXX) $(CXXFLAGS) -c $< -o $@
 
 $(UNIT_TEST_BUILD)/test_pointer_struct_runner.o: $(UNIT_TEST_DIR)/test_pointer_struct_runner.cpp | $(UNIT_TEST_BUILD)
 	$(CXX) $(CXXFLAGS) -c $< -o $@
@@ -165,14 +230,14 @@ $(UNIT_TEST_BUILD)/test_pointer_struct_runner.o: $(UNIT_TEST_DIR)/test_pointer_s
 # Clean generated and object files
 clean: clean-unit-tests
 	@echo "Cleaning generated files..."
-	rm -f $(TARGET)
+	rm -f $(TARGET) $(ASAN_TARGET) $(LIBRARY)
 	rm -rf $(BUILD_DIR)
 
 # Clean unit test files
 clean-unit-tests:
 	@echo "Cleaning unit test files..."
 	rm -rf $(UNIT_TEST_BUILD)
-	rm -f ./unit_tests ./pointer_struct_tests
+	rm -f ./unit_tests ./pointer_struct_tests ./library_tests
 
 # Integration test suite
 test-integration: $(TARGET) | $(TEST_OUTPUT)
@@ -195,25 +260,183 @@ test-integration: $(TARGET) | $(TEST_OUTPUT)
 	echo "====================================================="; \
 	echo "Test Results: $$((total - failed))/$$total passed"; \
 	[ $$failed -eq 0 ]
+
+# Bitcode output: every fixture the front end accepts must read back with
+# llvm-dis
+test-bitcode: $(TARGET) | $(TEST_OUTPUT)
+	@echo "Checking --emit=bc output with $(LLVM_DIS)..."
+	@failed=0; total=0; \
+	for test_file in $(TEST_FIXTURES)/*.c; do \
+		test_name=$$(basename "$$test_file" .c); \
+		$(TARGET) --emit=bc "$$test_file" -o "$(TEST_OUTPUT)/$$test_name.bc" 2>/dev/null || continue; \
+		total=$$((total + 1)); \
+		if $(LLVM_DIS) "$(TEST_OUTPUT)/$$test_name.bc" -o /dev/null; then \
+			echo "  ✓ $$test_name: PASSED"; \
+		else \
+			echo "  ✗ $$test_name: FAILED"; \
+			failed=$$((failed + 1)); \
+		fi; \
+	done; \
+	echo "Bitcode Results: $$((total - failed))/$$total passed"; \
+	[ $$failed -eq 0 ]
+
+# Every fixture llvm-as accepts must still assemble with opaque pointers
+test-opaque-ir: $(TARGET) | $(TEST_OUTPUT)
+	@echo "Checking --opaque-pointers --compact-ir output with $(LLVM_AS)..."
+	@failed=0; total=0; \
+	for test_file in $(TEST_FIXTURES)/*.c; do \
+		test_name=$$(basename "$$test_file" .c); \
+		$(TARGET) "$$test_file" -o "$(TEST_OUTPUT)/$$test_name.ll" 2>/dev/null || continue; \
+		$(LLVM_AS) "$(TEST_OUTPUT)/$$test_name.ll" -o /dev/null 2>/dev/null || continue; \
+		total=$$((total + 1)); \
+		if $(TARGET) --opaque-pointers --compact-ir "$$test_file" -o "$(TEST_OUTPUT)/$$test_name.opaque.ll" && \
+		   $(LLVM_AS) -opaque-pointers "$(TEST_OUTPUT)/$$test_name.opaque.ll" -o /dev/null; then \
+			echo "  ✓ $$test_name: PASSED"; \
+		else \
+			echo "  ✗ $$test_name: FAILED"; \
+			failed=$$((failed + 1)); \
+		fi; \
+	done; \
+	echo "Opaque IR Results: $$((total - failed))/$$total passed"; \
+	[ $$failed -eq 0 ]
+
+# Native objects: every fixture the llvm-api backend compiles must link
+# the same way, and programs must print the same output and exit status.
+# Status that changes between runs of the reference (main returning an
+# address) is not compared.
+test-x86-64: $(TARGET) | $(TEST_OUTPUT)
+	@echo "Checking --backend=x86-64 objects against --backend=llvm-api..."
+	@failed=0; total=0; out="$(TEST_OUTPUT)"; \
+	for test_file in $(TEST_FIXTURES)/*.c; do \
+		test_name=$$(basename "$$test_file" .c); \
+		$(TARGET) --backend=llvm-api "$$test_file" -o "$$out/$$test_name.ref.o" 2>/dev/null || continue; \
+		total=$$((total + 1)); \
+		ok=0; \
+		if $(TARGET) --backend=x86-64 "$$test_file" -o "$$out/$$test_name.x86.o"; then \
+			if $(CC) "$$out/$$test_name.ref.o" -o "$$out/$$test_name.ref" 2>/dev/null; then \
+				if $(CC) "$$out/$$test_name.x86.o" -o "$$out/$$test_name.x86"; then \
+					statuses=""; \
+					for run in 1 2 3 4; do \
+						"$$out/$$test_name.ref" >"$$out/$$test_name.ref.out" 2>/dev/null; \
+						statuses="$$statuses $$?"; \
+					done; \
+					"$$out/$$test_name.x86" >"$$out/$$test_name.x86.out" 2>/dev/null; \
+					status=$$?; \
+					set -- $$statuses; \
+					if cmp -s "$$out/$$test_name.ref.out" "$$out/$$test_name.x86.out" && \
+					   { [ "$$statuses" != " $$1 $$1 $$1 $$1" ] || [ $$status -eq $$1 ]; }; then \
+						ok=1; \
+					fi; \
+				fi; \
+			elif $(CC) -r -nostdlib "$$out/$$test_name.x86.o" -o "$$out/$$test_name.x86.r.o"; then \
+				ok=1; \
+			fi; \
+		fi; \
+		if [ $$ok -eq 1 ]; then \
+			echo "  ✓ $$test_name: PASSED"; \
+		else \
+			echo "  ✗ $$test_name: FAILED"; \
+			failed=$$((failed + 1)); \
+		fi; \
+	done; \
+	echo "x86-64 Results: $$((total - failed))/$$total passed"; \
+	[ $$failed -eq 0 ]
+
+test-interp: $(TARGET) | $(TEST_OUTPUT)
+	@echo "Checking --interp against --backend=llvm-api executables..."
+	@failed=0; total=0; out="$(TEST_OUTPUT)"; \
+	for test_file in $(TEST_FIXTURES)/*.c; do \
+		test_name=$$(basename "$$test_file" .c); \
+		$(TARGET) --backend=llvm-api "$$test_file" -o "$$out/$$test_name.ref.o" 2>/dev/null || continue; \
+		$(CC) "$$out/$$test_name.ref.o" -o "$$out/$$test_name.ref" 2>/dev/null || continue; \
+		statuses=""; \
+		for run in 1 2 3 4; do \
+			"$$out/$$test_name.ref" >"$$out/$$test_name.ref.out" 2>/dev/null; \
+			statuses="$$statuses $$?"; \
+		done; \
+		set -- $$statuses; \
+		[ $$1 -ge 128 ] && continue; \
+		total=$$((total + 1)); \
+		$(TARGET) --interp "$$test_file" >"$$out/$$test_name.interp.out" 2>/dev/null; \
+		status=$$?; \
+		if cmp -s "$$out/$$test_name.ref.out" "$$out/$$test_name.interp.out" && \
+		   { [ "$$statuses" != " $$1 $$1 $$1 $$1" ] || [ $$status -eq $$1 ]; }; then \
+			echo "  ✓ $$test_name: PASSED"; \
+		else \
+			echo "  ✗ $$test_name: FAILED"; \
+			failed=$$((failed + 1)); \
+		fi; \
+	done; \
+	echo "Interpreter Results: $$((total - failed))/$$total passed"; \
+	[ $$failed -eq 0 ]
+
+# The interpreter checks again on a compiler built with AddressSanitizer in
+# its own build directory; a memory error fails the run with status 86
+ASAN_BUILD_DIR = $(BUILD_DIR)/asan
+ASAN_TARGET = ./ccompiler_asan
+
+test-interp-asan: $(GENERATED_DIR)/grammar.tab.cpp $(GENERATED_DIR)/lex.yy.c
+	@echo "Building $(ASAN_TARGET) with AddressSanitizer..."
+	@$(MAKE) -f Makefile.cpp --no-print-directory BUILD_DIR=$(ASAN_BUILD_DIR) GENERATED_DIR=$(GENERATED_DIR) TARGET=$(ASAN_TARGET) \
+		SANITIZE="-fsanitize=address -fno-omit-frame-pointer -g" $(ASAN_TARGET)
+	@ASAN_OPTIONS=detect_leaks=0:exitcode=86 $(MAKE) -f Makefile.cpp --no-print-directory BUILD_DIR=$(ASAN_BUILD_DIR) \
+		GENERATED_DIR=$(GENERATED_DIR) TARGET=$(ASAN_TARGET) SANITIZE="-fsanitize=address -fno-omit-frame-pointer -g" test-interp
+
+# SSA promotion: every fixture whose IR assembles must still assemble with
+# -fssa, and must run the same on the interpreter with and without it.
+test-ssa: $(TARGET) | $(TEST_OUTPUT)
+	@echo "Checking -fssa against stack slots..."
+	@failed=0; total=0; out="$(TEST_OUTPUT)"; \
+	for test_file in $(TEST_FIXTURES)/*.c; do \
+		test_name=$$(basename "$$test_file" .c); \
+		$(TARGET) "$$test_file" -o "$$out/$$test_name.ll" 2>/dev/null || continue; \
+		$(LLVM_AS) "$$out/$$test_name.ll" -o /dev/null 2>/dev/null || continue; \
+		total=$$((total + 1)); \
+		$(TARGET) --interp "$$test_file" >"$$out/$$test_name.interp.out" 2>/dev/null; \
+		status=$$?; \
+		$(TARGET) -fssa --interp "$$test_file" >"$$out/$$test_name.ssa.out" 2>/dev/null; \
+		ssa_status=$$?; \
+		if $(TARGET) -fssa "$$test_file" -o "$$out/$$test_name.ssa.ll" 2>/dev/null && \
+		   $(LLVM_AS) "$$out/$$test_name.ssa.ll" -o /dev/null 2>/dev/null && \
+		   cmp -s "$$out/$$test_name.interp.out" "$$out/$$test_name.ssa.out" && \
+		   [ $$status -eq $$ssa_status ]; then \
+			echo "  ✓ $$test_name: PASSED"; \
+		else \
+			echo "  ✗ $$test_name: FAILED"; \
+			failed=$$((failed + 1)); \
+		fi; \
+	done; \
+	echo "SSA Results: $$((total - failed))/$$total passed"; \
+	[ $$failed -eq 0 ]
+
 # Unit tests
-unit-tests: $(UNIT_TEST_OBJECTS) $(LIB_OBJECTS)
+unit-tests: $(UNIT_TEST_OBJECTS) $(LIB_OBJECTS) $(DRIVER_OBJECTS)
 	@echo "Building unit tests..."
-	$(CXX) $(CXXFLAGS) -o ./unit_tests $(UNIT_TEST_OBJECTS) $(LIB_OBJECTS) $(LDFLAGS) $(LIBS) --coverage
+	$(CXX) $(CXXFLAGS) -o ./unit_tests $(UNIT_TEST_OBJECTS) $(LIB_OBJECTS) $(DRIVER_OBJECTS) $(LDFLAGS) $(LIBS) -lpthread --coverage
 
 # Pointer/Struct tests
 pointer-struct-tests: $(POINTER_STRUCT_TEST_OBJECTS) $(LIB_OBJECTS)
 	@echo "Building pointer and struct tests..."
 	$(CXX) $(CXXFLAGS) -o ./pointer_struct_tests $(POINTER_STRUCT_TEST_OBJECTS) $(LIB_OBJECTS) $(LDFLAGS) $(LIBS) --coverage
 
-# Run unit tests (includes pointer/struct tests)
-test-unit: unit-tests pointer-struct-tests
+# Library API tests
+library-tests: $(LIBRARY_TEST_OBJECTS) $(LIBRARY)
+	@echo "Building library API tests..."
+	$(CXX) $(CXXFLAGS) -o ./library_tests $(LIBRARY_TEST_OBJECTS) $(LIBRARY) $(LDFLAGS) $(LIBS) -lpthread
+
+# Run unit tests (includes pointer/struct and library tests)
+test-unit: unit-tests pointer-struct-tests library-tests
 	@echo "Running comprehensive unit tests..."
 	@echo "=== Standard Unit Tests ==="
 	./unit_tests
 	@echo ""
 	@echo "=== Pointer/Struct Unit Tests ==="
 	@./pointer_struct_tests || (echo "Note: Some pointer/struct tests failed due to incomplete implementation" && true)
+	@echo ""
+	@echo "=== Library API Tests ==="
+	./library_tests
 
-test: test-integration test-unit
+# Everything, including every backend and IR output mode against the fixtures
+test: test-integration test-unit test-bitcode test-opaque-ir test-x86-64 test-interp test-interp-asan test-ssa
 
-.PHONY: all clean clean-unit-tests test test-integration test-unit
\ No newline at end of file
+.PHONY: all library library-tests clean clean-unit-tests test test-bitcode test-integration test-opaque-ir test-unit test-x86-64 test-interp test-interp-asan test-ssa
\ No newline at end of file
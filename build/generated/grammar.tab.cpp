@@ -0,0 +1,3526 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "srccpp/grammar.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ast.h"
+#include "codegen.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int yylex(void);
+extern int yyparse(void);
+#ifdef __cplusplus
+}
+#endif
+extern char* yytext;
+extern int column;
+extern FILE* yyin;
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int yylineno;
+#ifdef __cplusplus
+}
+#endif
+
+/* Global variables */
+ASTNode* program_ast = NULL;
+CodeGenContext* codegen_ctx = NULL;
+
+/* Enum specifiers define constants but yield only a type; their AST_ENUM_DECL
+ * nodes wait here for the enclosing declaration to pick them up */
+static ASTNode* pending_enums = NULL;
+
+static void queue_enum(const char* name, ASTNode* enumerators) {
+	ASTNode* decl = create_ast_node(AST_ENUM_DECL);
+	decl->data.enum_decl.name = name ? strdup(name) : NULL;
+	decl->data.enum_decl.enumerators = enumerators;
+	if (!pending_enums) {
+		pending_enums = decl;
+		return;
+	}
+	ASTNode* last = pending_enums;
+	while (last->next) last = last->next;
+	last->next = decl;
+}
+
+/* Put the pending enum declarations in front of list */
+static ASTNode* take_pending_enums(ASTNode* list) {
+	if (!pending_enums)
+		return list;
+	ASTNode* head = pending_enums;
+	ASTNode* last = head;
+	while (last->next) last = last->next;
+	last->next = list;
+	pending_enums = NULL;
+	return head;
+}
+
+/* Error handling */
+#ifdef __cplusplus
+extern "C" {
+#endif
+int yyerror(const char* s);
+#ifdef __cplusplus
+}
+#endif
+
+#line 140 "build/generated/grammar.tab.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "grammar.tab.hpp"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENTIFIER = 3,                 /* IDENTIFIER  */
+  YYSYMBOL_CONSTANT = 4,                   /* CONSTANT  */
+  YYSYMBOL_STRING_LITERAL = 5,             /* STRING_LITERAL  */
+  YYSYMBOL_SIZEOF = 6,                     /* SIZEOF  */
+  YYSYMBOL_PTR_OP = 7,                     /* PTR_OP  */
+  YYSYMBOL_INC_OP = 8,                     /* INC_OP  */
+  YYSYMBOL_DEC_OP = 9,                     /* DEC_OP  */
+  YYSYMBOL_LEFT_OP = 10,                   /* LEFT_OP  */
+  YYSYMBOL_RIGHT_OP = 11,                  /* RIGHT_OP  */
+  YYSYMBOL_LE_OP = 12,                     /* LE_OP  */
+  YYSYMBOL_GE_OP = 13,                     /* GE_OP  */
+  YYSYMBOL_EQ_OP = 14,                     /* EQ_OP  */
+  YYSYMBOL_NE_OP = 15,                     /* NE_OP  */
+  YYSYMBOL_AND_OP = 16,                    /* AND_OP  */
+  YYSYMBOL_OR_OP = 17,                     /* OR_OP  */
+  YYSYMBOL_MUL_ASSIGN = 18,                /* MUL_ASSIGN  */
+  YYSYMBOL_DIV_ASSIGN = 19,                /* DIV_ASSIGN  */
+  YYSYMBOL_MOD_ASSIGN = 20,                /* MOD_ASSIGN  */
+  YYSYMBOL_ADD_ASSIGN = 21,                /* ADD_ASSIGN  */
+  YYSYMBOL_SUB_ASSIGN = 22,                /* SUB_ASSIGN  */
+  YYSYMBOL_LEFT_ASSIGN = 23,               /* LEFT_ASSIGN  */
+  YYSYMBOL_RIGHT_ASSIGN = 24,              /* RIGHT_ASSIGN  */
+  YYSYMBOL_AND_ASSIGN = 25,                /* AND_ASSIGN  */
+  YYSYMBOL_XOR_ASSIGN = 26,                /* XOR_ASSIGN  */
+  YYSYMBOL_OR_ASSIGN = 27,                 /* OR_ASSIGN  */
+  YYSYMBOL_TYPE_NAME = 28,                 /* TYPE_NAME  */
+  YYSYMBOL_TYPEDEF = 29,                   /* TYPEDEF  */
+  YYSYMBOL_EXTERN = 30,                    /* EXTERN  */
+  YYSYMBOL_STATIC = 31,                    /* STATIC  */
+  YYSYMBOL_AUTO = 32,                      /* AUTO  */
+  YYSYMBOL_REGISTER = 33,                  /* REGISTER  */
+  YYSYMBOL_CHAR = 34,                      /* CHAR  */
+  YYSYMBOL_SHORT = 35,                     /* SHORT  */
+  YYSYMBOL_INT = 36,                       /* INT  */
+  YYSYMBOL_LONG = 37,                      /* LONG  */
+  YYSYMBOL_SIGNED = 38,                    /* SIGNED  */
+  YYSYMBOL_UNSIGNED = 39,                  /* UNSIGNED  */
+  YYSYMBOL_FLOAT = 40,                     /* FLOAT  */
+  YYSYMBOL_DOUBLE = 41,                    /* DOUBLE  */
+  YYSYMBOL_CONST = 42,                     /* CONST  */
+  YYSYMBOL_VOLATILE = 43,                  /* VOLATILE  */
+  YYSYMBOL_VOID = 44,                      /* VOID  */
+  YYSYMBOL_STRUCT = 45,                    /* STRUCT  */
+  YYSYMBOL_UNION = 46,                     /* UNION  */
+  YYSYMBOL_ENUM = 47,                      /* ENUM  */
+  YYSYMBOL_ELLIPSIS = 48,                  /* ELLIPSIS  */
+  YYSYMBOL_BOOL = 49,                      /* BOOL  */
+  YYSYMBOL_STATIC_ASSERT = 50,             /* STATIC_ASSERT  */
+  YYSYMBOL_CASE = 51,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 52,                   /* DEFAULT  */
+  YYSYMBOL_IF = 53,                        /* IF  */
+  YYSYMBOL_ELSE = 54,                      /* ELSE  */
+  YYSYMBOL_SWITCH = 55,                    /* SWITCH  */
+  YYSYMBOL_WHILE = 56,                     /* WHILE  */
+  YYSYMBOL_DO = 57,                        /* DO  */
+  YYSYMBOL_FOR = 58,                       /* FOR  */
+  YYSYMBOL_GOTO = 59,                      /* GOTO  */
+  YYSYMBOL_CONTINUE = 60,                  /* CONTINUE  */
+  YYSYMBOL_BREAK = 61,                     /* BREAK  */
+  YYSYMBOL_RETURN = 62,                    /* RETURN  */
+  YYSYMBOL_63_ = 63,                       /* '('  */
+  YYSYMBOL_64_ = 64,                       /* ')'  */
+  YYSYMBOL_65_ = 65,                       /* '['  */
+  YYSYMBOL_66_ = 66,                       /* ']'  */
+  YYSYMBOL_67_ = 67,                       /* '.'  */
+  YYSYMBOL_68_ = 68,                       /* ','  */
+  YYSYMBOL_69_ = 69,                       /* '&'  */
+  YYSYMBOL_70_ = 70,                       /* '*'  */
+  YYSYMBOL_71_ = 71,                       /* '+'  */
+  YYSYMBOL_72_ = 72,                       /* '-'  */
+  YYSYMBOL_73_ = 73,                       /* '~'  */
+  YYSYMBOL_74_ = 74,                       /* '!'  */
+  YYSYMBOL_75_ = 75,                       /* '/'  */
+  YYSYMBOL_76_ = 76,                       /* '%'  */
+  YYSYMBOL_77_ = 77,                       /* '<'  */
+  YYSYMBOL_78_ = 78,                       /* '>'  */
+  YYSYMBOL_79_ = 79,                       /* '^'  */
+  YYSYMBOL_80_ = 80,                       /* '|'  */
+  YYSYMBOL_81_ = 81,                       /* '?'  */
+  YYSYMBOL_82_ = 82,                       /* ':'  */
+  YYSYMBOL_83_ = 83,                       /* '='  */
+  YYSYMBOL_84_ = 84,                       /* ';'  */
+  YYSYMBOL_85_ = 85,                       /* '{'  */
+  YYSYMBOL_86_ = 86,                       /* '}'  */
+  YYSYMBOL_YYACCEPT = 87,                  /* $accept  */
+  YYSYMBOL_primary_expression = 88,        /* primary_expression  */
+  YYSYMBOL_postfix_expression = 89,        /* postfix_expression  */
+  YYSYMBOL_argument_expression_list = 90,  /* argument_expression_list  */
+  YYSYMBOL_unary_expression = 91,          /* unary_expression  */
+  YYSYMBOL_unary_operator = 92,            /* unary_operator  */
+  YYSYMBOL_cast_expression = 93,           /* cast_expression  */
+  YYSYMBOL_multiplicative_expression = 94, /* multiplicative_expression  */
+  YYSYMBOL_additive_expression = 95,       /* additive_expression  */
+  YYSYMBOL_shift_expression = 96,          /* shift_expression  */
+  YYSYMBOL_relational_expression = 97,     /* relational_expression  */
+  YYSYMBOL_equality_expression = 98,       /* equality_expression  */
+  YYSYMBOL_and_expression = 99,            /* and_expression  */
+  YYSYMBOL_exclusive_or_expression = 100,  /* exclusive_or_expression  */
+  YYSYMBOL_inclusive_or_expression = 101,  /* inclusive_or_expression  */
+  YYSYMBOL_logical_and_expression = 102,   /* logical_and_expression  */
+  YYSYMBOL_logical_or_expression = 103,    /* logical_or_expression  */
+  YYSYMBOL_conditional_expression = 104,   /* conditional_expression  */
+  YYSYMBOL_assignment_expression = 105,    /* assignment_expression  */
+  YYSYMBOL_assignment_operator = 106,      /* assignment_operator  */
+  YYSYMBOL_expression = 107,               /* expression  */
+  YYSYMBOL_constant_expression = 108,      /* constant_expression  */
+  YYSYMBOL_declaration = 109,              /* declaration  */
+  YYSYMBOL_declaration_specifiers = 110,   /* declaration_specifiers  */
+  YYSYMBOL_init_declarator_list = 111,     /* init_declarator_list  */
+  YYSYMBOL_init_declarator = 112,          /* init_declarator  */
+  YYSYMBOL_storage_class_specifier = 113,  /* storage_class_specifier  */
+  YYSYMBOL_type_specifier = 114,           /* type_specifier  */
+  YYSYMBOL_struct_or_union_specifier = 115, /* struct_or_union_specifier  */
+  YYSYMBOL_struct_or_union = 116,          /* struct_or_union  */
+  YYSYMBOL_struct_declaration_list = 117,  /* struct_declaration_list  */
+  YYSYMBOL_struct_declaration = 118,       /* struct_declaration  */
+  YYSYMBOL_specifier_qualifier_list = 119, /* specifier_qualifier_list  */
+  YYSYMBOL_struct_declarator_list = 120,   /* struct_declarator_list  */
+  YYSYMBOL_struct_declarator = 121,        /* struct_declarator  */
+  YYSYMBOL_enum_specifier = 122,           /* enum_specifier  */
+  YYSYMBOL_enumerator_list = 123,          /* enumerator_list  */
+  YYSYMBOL_enumerator = 124,               /* enumerator  */
+  YYSYMBOL_type_qualifier = 125,           /* type_qualifier  */
+  YYSYMBOL_declarator = 126,               /* declarator  */
+  YYSYMBOL_direct_declarator = 127,        /* direct_declarator  */
+  YYSYMBOL_pointer = 128,                  /* pointer  */
+  YYSYMBOL_type_qualifier_list = 129,      /* type_qualifier_list  */
+  YYSYMBOL_parameter_type_list = 130,      /* parameter_type_list  */
+  YYSYMBOL_parameter_list = 131,           /* parameter_list  */
+  YYSYMBOL_parameter_declaration = 132,    /* parameter_declaration  */
+  YYSYMBOL_identifier_list = 133,          /* identifier_list  */
+  YYSYMBOL_type_name = 134,                /* type_name  */
+  YYSYMBOL_abstract_declarator = 135,      /* abstract_declarator  */
+  YYSYMBOL_direct_abstract_declarator = 136, /* direct_abstract_declarator  */
+  YYSYMBOL_initializer = 137,              /* initializer  */
+  YYSYMBOL_initializer_list = 138,         /* initializer_list  */
+  YYSYMBOL_statement = 139,                /* statement  */
+  YYSYMBOL_labeled_statement = 140,        /* labeled_statement  */
+  YYSYMBOL_compound_statement = 141,       /* compound_statement  */
+  YYSYMBOL_block_item_list = 142,          /* block_item_list  */
+  YYSYMBOL_block_item = 143,               /* block_item  */
+  YYSYMBOL_declaration_list = 144,         /* declaration_list  */
+  YYSYMBOL_expression_statement = 145,     /* expression_statement  */
+  YYSYMBOL_selection_statement = 146,      /* selection_statement  */
+  YYSYMBOL_iteration_statement = 147,      /* iteration_statement  */
+  YYSYMBOL_jump_statement = 148,           /* jump_statement  */
+  YYSYMBOL_translation_unit = 149,         /* translation_unit  */
+  YYSYMBOL_external_declaration = 150,     /* external_declaration  */
+  YYSYMBOL_function_definition = 151       /* function_definition  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  64
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1362
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  87
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  65
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  218
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  366
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   317
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    74,     2,     2,     2,    76,    69,     2,
+      63,    64,    70,    71,    68,    72,    67,    75,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    82,    84,
+      77,    83,    78,    81,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    65,     2,    66,    79,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    85,    80,    86,    73,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   141,   141,   143,   145,   147,   152,   154,   160,   162,
+     164,   171,   178,   180,   185,   187,   198,   200,   202,   204,
+     206,   208,   217,   218,   219,   220,   221,   222,   226,   228,
+     237,   239,   241,   243,   248,   250,   252,   257,   259,   261,
+     266,   268,   270,   272,   274,   279,   281,   283,   288,   290,
+     295,   297,   302,   304,   309,   311,   316,   318,   323,   325,
+     335,   337,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   356,   358,   363,   368,   370,   395,   404,
+     406,   412,   414,   420,   422,   431,   433,   443,   454,   463,
+     464,   465,   466,   467,   471,   472,   473,   474,   475,   476,
+     477,   478,   479,   480,   481,   482,   483,   487,   489,   491,
+     496,   497,   501,   503,   508,   513,   519,   521,   527,   532,
+     534,   539,   541,   543,   548,   550,   552,   554,   556,   561,
+     563,   573,   575,   580,   581,   585,   590,   598,   604,   606,
+     614,   621,   627,   632,   640,   642,   644,   646,   651,   653,
+     658,   663,   671,   673,   683,   691,   693,   698,   700,   710,
+     712,   717,   719,   721,   726,   728,   730,   732,   734,   736,
+     738,   740,   742,   747,   749,   758,   770,   772,   782,   783,
+     784,   785,   786,   787,   791,   796,   802,   811,   813,   818,
+     820,   834,   836,   841,   843,   859,   864,   872,   874,   876,
+     885,   887,   893,   895,   897,   906,   918,   923,   925,   927,
+     929,   934,   939,   950,   952,   957,   959,   965,   967
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IDENTIFIER",
+  "CONSTANT", "STRING_LITERAL", "SIZEOF", "PTR_OP", "INC_OP", "DEC_OP",
+  "LEFT_OP", "RIGHT_OP", "LE_OP", "GE_OP", "EQ_OP", "NE_OP", "AND_OP",
+  "OR_OP", "MUL_ASSIGN", "DIV_ASSIGN", "MOD_ASSIGN", "ADD_ASSIGN",
+  "SUB_ASSIGN", "LEFT_ASSIGN", "RIGHT_ASSIGN", "AND_ASSIGN", "XOR_ASSIGN",
+  "OR_ASSIGN", "TYPE_NAME", "TYPEDEF", "EXTERN", "STATIC", "AUTO",
+  "REGISTER", "CHAR", "SHORT", "INT", "LONG", "SIGNED", "UNSIGNED",
+  "FLOAT", "DOUBLE", "CONST", "VOLATILE", "VOID", "STRUCT", "UNION",
+  "ENUM", "ELLIPSIS", "BOOL", "STATIC_ASSERT", "CASE", "DEFAULT", "IF",
+  "ELSE", "SWITCH", "WHILE", "DO", "FOR", "GOTO", "CONTINUE", "BREAK",
+  "RETURN", "'('", "')'", "'['", "']'", "'.'", "','", "'&'", "'*'", "'+'",
+  "'-'", "'~'", "'!'", "'/'", "'%'", "'<'", "'>'", "'^'", "'|'", "'?'",
+  "':'", "'='", "';'", "'{'", "'}'", "$accept", "primary_expression",
+  "postfix_expression", "argument_expression_list", "unary_expression",
+  "unary_operator", "cast_expression", "multiplicative_expression",
+  "additive_expression", "shift_expression", "relational_expression",
+  "equality_expression", "and_expression", "exclusive_or_expression",
+  "inclusive_or_expression", "logical_and_expression",
+  "logical_or_expression", "conditional_expression",
+  "assignment_expression", "assignment_operator", "expression",
+  "constant_expression", "declaration", "declaration_specifiers",
+  "init_declarator_list", "init_declarator", "storage_class_specifier",
+  "type_specifier", "struct_or_union_specifier", "struct_or_union",
+  "struct_declaration_list", "struct_declaration",
+  "specifier_qualifier_list", "struct_declarator_list",
+  "struct_declarator", "enum_specifier", "enumerator_list", "enumerator",
+  "type_qualifier", "declarator", "direct_declarator", "pointer",
+  "type_qualifier_list", "parameter_type_list", "parameter_list",
+  "parameter_declaration", "identifier_list", "type_name",
+  "abstract_declarator", "direct_abstract_declarator", "initializer",
+  "initializer_list", "statement", "labeled_statement",
+  "compound_statement", "block_item_list", "block_item",
+  "declaration_list", "expression_statement", "selection_statement",
+  "iteration_statement", "jump_statement", "translation_unit",
+  "external_declaration", "function_definition", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-202)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     998,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,    37,  -202,   -49,     9,    20,  -202,    41,  1313,  1313,
+    -202,    38,  -202,  1313,  1176,     3,    12,   908,  -202,  -202,
+     -68,    21,   807,    -4,  -202,  -202,    20,  -202,   -59,  -202,
+    1153,  -202,  -202,   -29,  1127,  -202,   308,  -202,    41,  -202,
+    1176,  1043,   663,     3,  -202,  -202,    21,    32,   -22,  -202,
+    -202,  -202,  -202,   833,   858,   858,   642,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,   437,  -202,   807,  -202,    54,   155,
+     218,     7,   217,    11,    47,   101,   102,    22,  -202,   115,
+    -202,  -202,  -202,     9,  -202,   471,  -202,  1176,  1127,  1127,
+    1074,  -202,    50,  1127,    87,   807,   110,   131,   138,   147,
+     454,   151,   221,   153,   161,   559,  -202,  -202,   273,  -202,
+    -202,    89,  -202,  -202,  -202,  -202,   380,  -202,  -202,  -202,
+    -202,  -202,   164,  -202,  -202,  -202,  -202,   105,   189,   190,
+    -202,   -10,  -202,   193,     2,   807,     5,  -202,   642,  -202,
+     807,  -202,  -202,   112,   114,   199,   261,  -202,  -202,   689,
+     807,   264,  -202,   807,   807,   807,   807,   807,   807,   807,
+     807,   807,   807,   807,   807,   807,   807,   807,   807,   807,
+     807,   807,   271,  -202,   471,  -202,  -202,  -202,  1094,  -202,
+    -202,  -202,   807,   103,  -202,   195,  -202,   454,   196,   454,
+     807,   807,   807,   225,   543,   203,  -202,  -202,  -202,   106,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,   807,   807,  -202,  -202,  -202,   953,   714,  -202,    24,
+    -202,   152,  -202,  1291,  -202,   280,  -202,     8,  -202,  -202,
+    -202,  -202,   224,  -202,  1211,   160,  -202,   807,  -202,  -202,
+     118,  -202,   -11,  -202,  -202,  -202,  -202,    54,    54,   155,
+     155,   218,   218,   218,   218,     7,     7,   217,    11,    47,
+     101,   102,   -23,   226,  -202,    99,  -202,  -202,    50,  -202,
+     807,  -202,   454,  -202,   129,   135,   136,   238,   591,   591,
+    -202,  -202,  -202,  -202,  -202,   239,   240,  -202,   236,   152,
+    1254,   735,  -202,  -202,  -202,  -202,  -202,  -202,  -202,   807,
+    -202,   807,   222,   398,  -202,  -202,  -202,  -202,   454,   454,
+     454,   807,   761,   786,  -202,  -202,  -202,  -202,   241,  -202,
+     242,  -202,  -202,  -202,  -202,  -202,   253,  -202,  -202,   143,
+     454,   144,   454,   145,  -202,  -202,   454,   231,  -202,   454,
+    -202,   454,  -202,  -202,  -202,  -202
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       0,   137,   106,    89,    90,    91,    92,    93,    96,    97,
+      98,    99,   102,   103,   100,   101,   133,   134,    94,   110,
+     111,     0,    95,     0,     0,   144,   214,     0,    79,    81,
+     104,     0,   105,    83,     0,   136,     0,     0,   211,   213,
+     128,     0,     0,     0,   148,   146,   145,    76,     0,    85,
+      87,    80,    82,   109,     0,    84,     0,   193,     0,   218,
+       0,     0,     0,   135,     1,   212,     0,   131,     0,   129,
+       2,     3,     4,     0,     0,     0,     0,    22,    23,    24,
+      25,    26,    27,     6,    16,    28,     0,    30,    34,    37,
+      40,    45,    48,    50,    52,    54,    56,    58,    75,     0,
+     138,   149,   147,     0,    77,     0,   216,     0,     0,   116,
+       0,   112,     0,   118,     2,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   195,   187,    28,    60,
+      73,     0,   191,   192,   178,   179,     0,   189,   180,   181,
+     182,   183,    87,   194,   217,   157,   143,   156,     0,   150,
+     152,     0,   140,     0,     0,     0,     0,   124,     0,    20,
+       0,    17,    18,     0,   159,     0,     0,    12,    13,     0,
+       0,     0,    19,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    86,     0,   173,    88,   215,     0,   115,
+     108,   113,     0,     0,   119,   121,   117,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   207,   208,   209,     0,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      62,     0,     0,   196,   188,   190,     0,     0,   154,   161,
+     155,   162,   141,     0,   142,     0,   139,     0,   126,   132,
+     125,   130,     0,     5,     0,   161,   160,     0,    11,     8,
+       0,    14,     0,    10,    31,    32,    33,    35,    36,    38,
+      39,    43,    44,    41,    42,    46,    47,    49,    51,    53,
+      55,    57,     0,     0,   176,     0,   107,   122,     0,   114,
+       0,   184,     0,   186,     0,     0,     0,     0,     0,     0,
+     206,   210,    61,    74,   169,     0,     0,   165,     0,   163,
+       0,     0,   151,   153,   158,   127,    21,    29,     9,     0,
+       7,     0,     0,     0,   174,   120,   123,   185,     0,     0,
+       0,     0,     0,     0,   170,   164,   166,   171,     0,   167,
+       0,    15,    59,    78,   175,   177,   197,   199,   200,     0,
+       0,     0,     0,     0,   172,   168,     0,     0,   204,     0,
+     202,     0,   198,   201,   205,   203
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -202,  -202,  -202,  -202,   -39,  -202,    -9,    57,    63,    39,
+      72,   123,   132,   130,   133,   134,  -202,   -41,   -73,  -202,
+     -58,   -46,    -8,     0,  -202,   220,  -202,   176,  -202,  -202,
+     212,  -105,   -27,  -202,    33,  -202,   259,  -146,    -3,   -20,
+     -34,    25,  -202,   -55,  -202,    83,  -202,   169,   -69,  -174,
+    -163,  -202,   -90,  -202,   128,  -202,   192,   279,  -201,  -202,
+    -202,  -202,  -202,   293,  -202
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    83,    84,   260,   128,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,   129,   130,   231,
+     131,    99,    26,    58,    48,    49,    28,    29,    30,    31,
+     110,   111,   112,   203,   204,    32,    68,    69,    33,    34,
+      35,    36,    46,   305,   149,   150,   151,   165,   306,   241,
+     196,   285,   133,   134,   135,   136,   137,    60,   138,   139,
+     140,   141,    37,    38,    39
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      27,    98,    63,    85,    43,   201,   148,    50,    67,   103,
+     251,    67,     1,   299,    42,     1,   153,    66,   163,   180,
+     181,    98,    44,    85,    67,   104,    57,     1,    51,    52,
+     213,   284,   195,    55,   159,   161,   162,    27,   142,   190,
+      40,    53,    57,   101,     1,   232,   156,    85,   132,   164,
+      45,   113,   143,     1,   244,   320,   108,   232,   245,   321,
+     100,   147,    16,    17,   157,   309,    61,   219,    62,   208,
+     247,   102,    24,   113,    98,    24,    85,   172,   240,    25,
+     186,   309,   199,   142,   182,   183,   206,   236,   248,   237,
+      25,   250,   205,   201,   315,   256,   261,   332,   333,   143,
+     163,   251,   163,   191,    24,   113,   113,   113,     1,   249,
+     113,    25,   262,    24,    98,   155,    85,   291,   189,   293,
+      25,   195,    41,    54,   173,    47,   187,   238,   132,   174,
+     175,   164,   202,   282,    85,    85,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
+      85,    85,   294,   295,   296,   113,   287,   232,   302,   303,
+     345,    98,    59,    85,   264,   265,   266,   323,   236,   207,
+     237,   288,   239,   233,   232,    25,   253,   254,   106,   237,
+     232,   188,   318,   192,    25,   324,   319,   289,   144,   255,
+     301,   308,   209,   328,   210,   113,    98,   232,    85,   329,
+     330,   211,   327,   232,   232,    63,   298,   357,   359,   361,
+     212,   232,   232,   232,   214,   310,    43,   311,    85,   271,
+     272,   273,   274,   254,   215,   237,   176,   177,   178,   179,
+     109,   184,   185,   267,   268,   197,   147,   216,   346,   347,
+     348,   269,   270,   147,   326,   217,   341,   105,   317,    98,
+     195,    85,   109,   242,   147,   338,   275,   276,   243,   246,
+     358,   239,   360,   257,   258,   340,   362,   263,   205,   364,
+      98,   365,    85,   349,   351,   353,   283,   290,   292,   255,
+     342,   297,    85,   314,   109,   109,   109,   300,   316,   109,
+     322,   220,   221,   222,   223,   224,   225,   226,   227,   228,
+     229,   331,   336,   334,   335,   354,   343,   356,   355,   277,
+     147,   114,    71,    72,    73,   363,    74,    75,   279,   278,
+     198,   325,   280,   193,   281,   154,   313,   252,   235,   107,
+      65,     0,     0,     0,   109,     0,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,   230,    22,    23,   115,
+     116,   117,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,    76,     0,     0,   109,     0,     0,    77,    78,    79,
+      80,    81,    82,   114,    71,    72,    73,     0,    74,    75,
+       0,     0,   126,    56,   127,     0,     0,     0,     0,     0,
+       0,    70,    71,    72,    73,     0,    74,    75,     2,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,     0,    22,
+      23,   115,   116,   117,     0,   118,   119,   120,   121,   122,
+     123,   124,   125,    76,   166,   167,   168,     0,     0,    77,
+      78,    79,    80,    81,    82,     0,     0,   114,    71,    72,
+      73,    76,    74,    75,   126,    56,   234,    77,    78,    79,
+      80,    81,    82,     0,    70,    71,    72,    73,     0,    74,
+      75,     0,     0,   194,   344,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     169,     0,   170,     0,   171,   115,   116,   117,     0,   118,
+     119,   120,   121,   122,   123,   124,   125,    76,     0,     0,
+       0,     0,     0,    77,    78,    79,    80,    81,    82,     0,
+       0,     0,     0,     0,    76,     0,     0,     0,   126,    56,
+      77,    78,    79,    80,    81,    82,    70,    71,    72,    73,
+       0,    74,    75,     0,     0,     0,   194,     0,     0,     0,
+       0,     0,    70,    71,    72,    73,     0,    74,    75,     0,
+       0,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,     0,    22,    23,    70,    71,    72,    73,     0,    74,
+      75,     0,     0,     0,     0,     0,    76,     0,     0,     0,
+       0,     0,    77,    78,    79,    80,    81,    82,     0,     0,
+       0,     0,    76,     0,     0,     0,     0,   126,    77,    78,
+      79,    80,    81,    82,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   218,     0,    70,    71,    72,    73,     0,
+      74,    75,     0,     0,    76,     0,     0,     0,     0,     0,
+      77,    78,    79,    80,    81,    82,    70,    71,    72,    73,
+       2,    74,    75,     0,     0,   126,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+       0,    22,    70,    71,    72,    73,     0,    74,    75,     0,
+       0,     0,     0,     0,     0,    76,     0,     0,     0,     0,
+       0,    77,    78,    79,    80,    81,    82,    70,    71,    72,
+      73,     0,    74,    75,     0,     0,    76,     0,     0,   152,
+       0,     0,    77,    78,    79,    80,    81,    82,    70,    71,
+      72,    73,     0,    74,    75,     0,     0,     0,     0,     0,
+       0,     0,    76,   259,     0,     0,     0,     0,    77,    78,
+      79,    80,    81,    82,    70,    71,    72,    73,     0,    74,
+      75,     0,     0,     0,     0,     0,     0,    76,     0,     0,
+     307,     0,     0,    77,    78,    79,    80,    81,    82,    70,
+      71,    72,    73,     0,    74,    75,     0,     0,    76,     0,
+       0,   339,     0,     0,    77,    78,    79,    80,    81,    82,
+      70,    71,    72,    73,     0,    74,    75,     0,     0,     0,
+       0,     0,     0,     0,    76,   350,     0,     0,     0,     0,
+      77,    78,    79,    80,    81,    82,    70,    71,    72,    73,
+       0,    74,    75,     0,     0,     0,     0,     0,     0,    76,
+     352,     0,     0,     0,     0,    77,    78,    79,    80,    81,
+      82,    70,    71,    72,    73,     0,    74,    75,     0,     0,
+      76,     0,     0,     0,     0,     0,    77,    78,    79,    80,
+      81,    82,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   158,     0,     0,     0,
+       0,     0,    77,    78,    79,    80,    81,    82,    64,     0,
+       0,     1,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   160,     0,     0,     0,     0,     0,    77,    78,    79,
+      80,    81,    82,     0,     0,     0,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,     1,    22,    23,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    24,     0,     0,     0,     0,     0,     0,    25,     0,
+       0,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,     1,    22,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   236,   304,   237,     0,
+       0,     0,     0,    25,     0,     0,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,   145,    22,    23,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    24,     0,     0,     0,     0,     0,     0,    25,     0,
+       0,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,     0,    22,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     2,     0,     0,     0,     0,   146,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,     2,    22,     0,     0,     0,     0,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,     0,    22,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     2,     0,     0,     0,     0,
+     200,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,     0,    22,     0,     0,     0,
+     286,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,     0,    22,    23,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,     0,    22,    23,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   105,     0,    56,     2,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,     0,
+      22,    56,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   254,   304,   237,     0,     0,     0,
+       0,    25,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,     0,    22,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   337,     2,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,   312,
+      22,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,     0,    22
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,    42,    36,    42,    24,   110,    61,    27,     3,    68,
+     156,     3,     3,   214,    63,     3,    62,    85,    76,    12,
+      13,    62,    25,    62,     3,    84,    34,     3,    28,    29,
+     120,   194,   105,    33,    73,    74,    75,    37,    58,    17,
+       3,     3,    50,    46,     3,    68,    68,    86,    56,    76,
+      25,    54,    60,     3,    64,    66,    85,    68,    68,    82,
+      64,    61,    42,    43,    86,   239,    63,   125,    65,   115,
+      68,    46,    63,    76,   115,    63,   115,    86,   147,    70,
+      69,   255,   109,   103,    77,    78,   113,    63,    86,    65,
+      70,    86,   112,   198,    86,   164,   169,   298,   299,   107,
+     158,   247,   160,    81,    63,   108,   109,   110,     3,   155,
+     113,    70,   170,    63,   155,    83,   155,   207,    16,   209,
+      70,   194,    85,    85,    70,    84,    79,   147,   136,    75,
+      76,   158,    82,   191,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,   190,   210,   211,   212,   158,   202,    68,   231,   232,
+     323,   202,    34,   202,   173,   174,   175,    68,    63,    82,
+      65,    68,   147,    84,    68,    70,    64,    63,    50,    65,
+      68,    80,    64,    68,    70,    86,    68,    84,    60,   164,
+      84,   237,    82,    64,    63,   198,   237,    68,   237,    64,
+      64,    63,   292,    68,    68,   239,   214,    64,    64,    64,
+      63,    68,    68,    68,    63,    63,   236,    65,   257,   180,
+     181,   182,   183,    63,     3,    65,    71,    72,    10,    11,
+      54,    14,    15,   176,   177,   107,   236,    84,   328,   329,
+     330,   178,   179,   243,   290,    84,   319,    83,   257,   290,
+     323,   290,    76,    64,   254,   310,   184,   185,    68,    66,
+     350,   236,   352,    64,     3,   311,   356,     3,   288,   359,
+     311,   361,   311,   331,   332,   333,     5,    82,    82,   254,
+     321,    56,   321,     3,   108,   109,   110,    84,    64,   113,
+      64,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    63,    66,    64,    64,    64,    84,    54,    66,   186,
+     310,     3,     4,     5,     6,    84,     8,     9,   188,   187,
+     108,   288,   189,   103,   190,    66,   243,   158,   136,    50,
+      37,    -1,    -1,    -1,   158,    -1,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    83,    49,    50,    51,
+      52,    53,    -1,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    -1,    -1,   198,    -1,    -1,    69,    70,    71,
+      72,    73,    74,     3,     4,     5,     6,    -1,     8,     9,
+      -1,    -1,    84,    85,    86,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,     6,    -1,     8,     9,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
+      50,    51,    52,    53,    -1,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,     7,     8,     9,    -1,    -1,    69,
+      70,    71,    72,    73,    74,    -1,    -1,     3,     4,     5,
+       6,    63,     8,     9,    84,    85,    86,    69,    70,    71,
+      72,    73,    74,    -1,     3,     4,     5,     6,    -1,     8,
+       9,    -1,    -1,    85,    86,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      63,    -1,    65,    -1,    67,    51,    52,    53,    -1,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    71,    72,    73,    74,    -1,
+      -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,    84,    85,
+      69,    70,    71,    72,    73,    74,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    -1,    -1,    85,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,    -1,     8,     9,    -1,
+      -1,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    -1,    49,    50,     3,     4,     5,     6,    -1,     8,
+       9,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    71,    72,    73,    74,    -1,    -1,
+      -1,    -1,    63,    -1,    -1,    -1,    -1,    84,    69,    70,
+      71,    72,    73,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    84,    -1,     3,     4,     5,     6,    -1,
+       8,     9,    -1,    -1,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    71,    72,    73,    74,     3,     4,     5,     6,
+      28,     8,     9,    -1,    -1,    84,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      -1,    49,     3,     4,     5,     6,    -1,     8,     9,    -1,
+      -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,    -1,
+      -1,    69,    70,    71,    72,    73,    74,     3,     4,     5,
+       6,    -1,     8,     9,    -1,    -1,    63,    -1,    -1,    66,
+      -1,    -1,    69,    70,    71,    72,    73,    74,     3,     4,
+       5,     6,    -1,     8,     9,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    63,    64,    -1,    -1,    -1,    -1,    69,    70,
+      71,    72,    73,    74,     3,     4,     5,     6,    -1,     8,
+       9,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,
+      66,    -1,    -1,    69,    70,    71,    72,    73,    74,     3,
+       4,     5,     6,    -1,     8,     9,    -1,    -1,    63,    -1,
+      -1,    66,    -1,    -1,    69,    70,    71,    72,    73,    74,
+       3,     4,     5,     6,    -1,     8,     9,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    63,    64,    -1,    -1,    -1,    -1,
+      69,    70,    71,    72,    73,    74,     3,     4,     5,     6,
+      -1,     8,     9,    -1,    -1,    -1,    -1,    -1,    -1,    63,
+      64,    -1,    -1,    -1,    -1,    69,    70,    71,    72,    73,
+      74,     3,     4,     5,     6,    -1,     8,     9,    -1,    -1,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,    72,
+      73,    74,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    71,    72,    73,    74,     0,    -1,
+      -1,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,
+      72,    73,    74,    -1,    -1,    -1,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,     3,    49,    50,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    -1,
+      -1,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,     3,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    63,    64,    65,    -1,
+      -1,    -1,    -1,    70,    -1,    -1,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,     3,    49,    50,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    63,    -1,    -1,    -1,    -1,    -1,    -1,    70,    -1,
+      -1,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    64,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    28,    49,    -1,    -1,    -1,    -1,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    28,    -1,    -1,    -1,    -1,
+      86,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    -1,    49,    -1,    -1,    -1,
+      86,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    -1,    49,    50,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    -1,    49,    50,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    83,    -1,    85,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
+      49,    85,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    63,    64,    65,    -1,    -1,    -1,
+      -1,    70,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    64,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    -1,    49
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,     3,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    49,    50,    63,    70,   109,   110,   113,   114,
+     115,   116,   122,   125,   126,   127,   128,   149,   150,   151,
+       3,    85,    63,   126,   125,   128,   129,    84,   111,   112,
+     126,   110,   110,     3,    85,   110,    85,   109,   110,   141,
+     144,    63,    65,   127,     0,   150,    85,     3,   123,   124,
+       3,     4,     5,     6,     8,     9,    63,    69,    70,    71,
+      72,    73,    74,    88,    89,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   108,
+      64,   125,   128,    68,    84,    83,   141,   144,    85,   114,
+     117,   118,   119,   125,     3,    51,    52,    53,    55,    56,
+      57,    58,    59,    60,    61,    62,    84,    86,    91,   104,
+     105,   107,   109,   139,   140,   141,   142,   143,   145,   146,
+     147,   148,   126,   109,   141,     3,    64,   110,   130,   131,
+     132,   133,    66,   108,   123,    83,    68,    86,    63,    91,
+      63,    91,    91,   107,   119,   134,     7,     8,     9,    63,
+      65,    67,    93,    70,    75,    76,    71,    72,    10,    11,
+      12,    13,    77,    78,    14,    15,    69,    79,    80,    16,
+      17,    81,    68,   112,    85,   105,   137,   141,   117,   119,
+      86,   118,    82,   120,   121,   126,   119,    82,   108,    82,
+      63,    63,    63,   139,    63,     3,    84,    84,    84,   107,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      83,   106,    68,    84,    86,   143,    63,    65,   126,   128,
+     135,   136,    64,    68,    64,    68,    66,    68,    86,   108,
+      86,   124,   134,    64,    63,   128,   135,    64,     3,    64,
+      90,   105,   107,     3,    93,    93,    93,    94,    94,    95,
+      95,    96,    96,    96,    96,    97,    97,    98,    99,   100,
+     101,   102,   107,     5,   137,   138,    86,   108,    68,    84,
+      82,   139,    82,   139,   107,   107,   107,    56,   109,   145,
+      84,    84,   105,   105,    64,   130,   135,    66,   108,   136,
+      63,    65,    48,   132,     3,    86,    64,    93,    64,    68,
+      66,    82,    64,    68,    86,   121,   108,   139,    64,    64,
+      64,    63,   145,   145,    64,    64,    66,    64,   130,    66,
+     108,   105,   104,    84,    86,   137,   139,   139,   139,   107,
+      64,   107,    64,   107,    64,    66,    54,    64,   139,    64,
+     139,    64,   139,    84,   139,   139
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    87,    88,    88,    88,    88,    89,    89,    89,    89,
+      89,    89,    89,    89,    90,    90,    91,    91,    91,    91,
+      91,    91,    92,    92,    92,    92,    92,    92,    93,    93,
+      94,    94,    94,    94,    95,    95,    95,    96,    96,    96,
+      97,    97,    97,    97,    97,    98,    98,    98,    99,    99,
+     100,   100,   101,   101,   102,   102,   103,   103,   104,   104,
+     105,   105,   106,   106,   106,   106,   106,   106,   106,   106,
+     106,   106,   106,   107,   107,   108,   109,   109,   109,   110,
+     110,   110,   110,   110,   110,   111,   111,   112,   112,   113,
+     113,   113,   113,   113,   114,   114,   114,   114,   114,   114,
+     114,   114,   114,   114,   114,   114,   114,   115,   115,   115,
+     116,   116,   117,   117,   118,   119,   119,   119,   119,   120,
+     120,   121,   121,   121,   122,   122,   122,   122,   122,   123,
+     123,   124,   124,   125,   125,   126,   126,   127,   127,   127,
+     127,   127,   127,   127,   128,   128,   128,   128,   129,   129,
+     130,   130,   131,   131,   132,   132,   132,   133,   133,   134,
+     134,   135,   135,   135,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   137,   137,   137,   138,   138,   139,   139,
+     139,   139,   139,   139,   140,   140,   140,   141,   141,   142,
+     142,   143,   143,   144,   144,   145,   145,   146,   146,   146,
+     147,   147,   147,   147,   147,   147,   148,   148,   148,   148,
+     148,   149,   149,   150,   150,   151,   151,   151,   151
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     3,     1,     4,     3,     4,
+       3,     3,     2,     2,     1,     3,     1,     2,     2,     2,
+       2,     4,     1,     1,     1,     1,     1,     1,     1,     4,
+       1,     3,     3,     3,     1,     3,     3,     1,     3,     3,
+       1,     3,     3,     3,     3,     1,     3,     3,     1,     3,
+       1,     3,     1,     3,     1,     3,     1,     3,     1,     5,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     2,     3,     7,     1,
+       2,     1,     2,     1,     2,     1,     3,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     5,     4,     2,
+       1,     1,     1,     2,     3,     2,     1,     2,     1,     1,
+       3,     1,     2,     3,     4,     5,     5,     6,     2,     1,
+       3,     1,     3,     1,     1,     2,     1,     1,     3,     4,
+       3,     4,     4,     3,     1,     2,     2,     3,     1,     2,
+       1,     3,     1,     3,     2,     2,     1,     1,     3,     1,
+       2,     1,     1,     2,     3,     2,     3,     3,     4,     2,
+       3,     3,     4,     1,     3,     4,     1,     3,     1,     1,
+       1,     1,     1,     1,     3,     4,     3,     2,     3,     1,
+       2,     1,     1,     1,     2,     1,     2,     5,     7,     5,
+       5,     7,     6,     7,     6,     7,     3,     2,     2,     2,
+       3,     1,     2,     1,     1,     4,     3,     3,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+
+/* User initialization code.  */
+#line 136 "srccpp/grammar.y"
+{ pending_enums = NULL; }
+
+#line 1562 "build/generated/grammar.tab.cpp"
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* primary_expression: IDENTIFIER  */
+#line 142 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_identifier_node((yyvsp[0].str_val)); }
+#line 1765 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 3: /* primary_expression: CONSTANT  */
+#line 144 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_constant_node(parse_constant_value((yyvsp[0].str_val)), constant_literal_type((yyvsp[0].str_val))); }
+#line 1771 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 4: /* primary_expression: STRING_LITERAL  */
+#line 146 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_string_literal_node((yyvsp[0].str_val)); }
+#line 1777 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 5: /* primary_expression: '(' expression ')'  */
+#line 148 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 1783 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 6: /* postfix_expression: primary_expression  */
+#line 153 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1789 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 7: /* postfix_expression: postfix_expression '[' expression ']'  */
+#line 155 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_ARRAY_ACCESS);
+			(yyval.ast_node)->data.array_access.array = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.array_access.index = (yyvsp[-1].ast_node);
+		}
+#line 1799 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 8: /* postfix_expression: postfix_expression '(' ')'  */
+#line 161 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_function_call_node((yyvsp[-2].ast_node), NULL); }
+#line 1805 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 9: /* postfix_expression: postfix_expression '(' argument_expression_list ')'  */
+#line 163 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_function_call_node((yyvsp[-3].ast_node), (yyvsp[-1].ast_node)); }
+#line 1811 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 10: /* postfix_expression: postfix_expression '.' IDENTIFIER  */
+#line 165 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_MEMBER_ACCESS);
+			(yyval.ast_node)->data.member_access.object = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.member_access.member = (yyvsp[0].str_val);
+			(yyval.ast_node)->data.member_access.is_pointer_access = 0;
+		}
+#line 1822 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 11: /* postfix_expression: postfix_expression PTR_OP IDENTIFIER  */
+#line 172 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_MEMBER_ACCESS);
+			(yyval.ast_node)->data.member_access.object = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.member_access.member = (yyvsp[0].str_val);
+			(yyval.ast_node)->data.member_access.is_pointer_access = 1;
+		}
+#line 1833 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 12: /* postfix_expression: postfix_expression INC_OP  */
+#line 179 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_POSTINC, (yyvsp[-1].ast_node)); }
+#line 1839 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 13: /* postfix_expression: postfix_expression DEC_OP  */
+#line 181 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_POSTDEC, (yyvsp[-1].ast_node)); }
+#line 1845 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 14: /* argument_expression_list: assignment_expression  */
+#line 186 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1851 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 15: /* argument_expression_list: argument_expression_list ',' assignment_expression  */
+#line 188 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			/* Add to argument list */
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 1863 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 16: /* unary_expression: postfix_expression  */
+#line 199 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1869 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 17: /* unary_expression: INC_OP unary_expression  */
+#line 201 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_PREINC, (yyvsp[0].ast_node)); }
+#line 1875 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 18: /* unary_expression: DEC_OP unary_expression  */
+#line 203 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_PREDEC, (yyvsp[0].ast_node)); }
+#line 1881 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 19: /* unary_expression: unary_operator cast_expression  */
+#line 205 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node((yyvsp[-1].unary_op), (yyvsp[0].ast_node)); }
+#line 1887 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 20: /* unary_expression: SIZEOF unary_expression  */
+#line 207 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_SIZEOF, (yyvsp[0].ast_node)); }
+#line 1893 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 21: /* unary_expression: SIZEOF '(' type_name ')'  */
+#line 209 "srccpp/grammar.y"
+                {
+			/* Sized by code generation, which knows the target */
+			(yyval.ast_node) = create_unary_op_node(UOP_SIZEOF, NULL);
+			(yyval.ast_node)->data_type = (yyvsp[-1].type_info);
+		}
+#line 1903 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 22: /* unary_operator: '&'  */
+#line 217 "srccpp/grammar.y"
+               { (yyval.unary_op) = UOP_ADDR; }
+#line 1909 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 23: /* unary_operator: '*'  */
+#line 218 "srccpp/grammar.y"
+               { (yyval.unary_op) = UOP_DEREF; }
+#line 1915 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 24: /* unary_operator: '+'  */
+#line 219 "srccpp/grammar.y"
+               { (yyval.unary_op) = UOP_PLUS; }
+#line 1921 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 25: /* unary_operator: '-'  */
+#line 220 "srccpp/grammar.y"
+               { (yyval.unary_op) = UOP_MINUS; }
+#line 1927 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 26: /* unary_operator: '~'  */
+#line 221 "srccpp/grammar.y"
+               { (yyval.unary_op) = UOP_BITNOT; }
+#line 1933 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 27: /* unary_operator: '!'  */
+#line 222 "srccpp/grammar.y"
+               { (yyval.unary_op) = UOP_NOT; }
+#line 1939 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 28: /* cast_expression: unary_expression  */
+#line 227 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1945 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 29: /* cast_expression: '(' type_name ')' cast_expression  */
+#line 229 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_CAST);
+			(yyval.ast_node)->data.cast_expr.target_type = (yyvsp[-2].type_info);
+			(yyval.ast_node)->data.cast_expr.operand = (yyvsp[0].ast_node);
+		}
+#line 1955 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 30: /* multiplicative_expression: cast_expression  */
+#line 238 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1961 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 31: /* multiplicative_expression: multiplicative_expression '*' cast_expression  */
+#line 240 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_MUL, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1967 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 32: /* multiplicative_expression: multiplicative_expression '/' cast_expression  */
+#line 242 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_DIV, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1973 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 33: /* multiplicative_expression: multiplicative_expression '%' cast_expression  */
+#line 244 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_MOD, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1979 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 34: /* additive_expression: multiplicative_expression  */
+#line 249 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1985 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 35: /* additive_expression: additive_expression '+' multiplicative_expression  */
+#line 251 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_ADD, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1991 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 36: /* additive_expression: additive_expression '-' multiplicative_expression  */
+#line 253 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_SUB, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1997 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 37: /* shift_expression: additive_expression  */
+#line 258 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2003 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 38: /* shift_expression: shift_expression LEFT_OP additive_expression  */
+#line 260 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_LSHIFT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2009 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 39: /* shift_expression: shift_expression RIGHT_OP additive_expression  */
+#line 262 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_RSHIFT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2015 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 40: /* relational_expression: shift_expression  */
+#line 267 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2021 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 41: /* relational_expression: relational_expression '<' shift_expression  */
+#line 269 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_LT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2027 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 42: /* relational_expression: relational_expression '>' shift_expression  */
+#line 271 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_GT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2033 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 43: /* relational_expression: relational_expression LE_OP shift_expression  */
+#line 273 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_LE, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2039 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 44: /* relational_expression: relational_expression GE_OP shift_expression  */
+#line 275 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_GE, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2045 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 45: /* equality_expression: relational_expression  */
+#line 280 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2051 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 46: /* equality_expression: equality_expression EQ_OP relational_expression  */
+#line 282 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_EQ, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2057 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 47: /* equality_expression: equality_expression NE_OP relational_expression  */
+#line 284 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_NE, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2063 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 48: /* and_expression: equality_expression  */
+#line 289 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2069 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 49: /* and_expression: and_expression '&' equality_expression  */
+#line 291 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_BITAND, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2075 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 50: /* exclusive_or_expression: and_expression  */
+#line 296 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2081 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 51: /* exclusive_or_expression: exclusive_or_expression '^' and_expression  */
+#line 298 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_XOR, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2087 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 52: /* inclusive_or_expression: exclusive_or_expression  */
+#line 303 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2093 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 53: /* inclusive_or_expression: inclusive_or_expression '|' exclusive_or_expression  */
+#line 305 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_BITOR, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2099 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 54: /* logical_and_expression: inclusive_or_expression  */
+#line 310 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2105 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 55: /* logical_and_expression: logical_and_expression AND_OP inclusive_or_expression  */
+#line 312 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_AND, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2111 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 56: /* logical_or_expression: logical_and_expression  */
+#line 317 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2117 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 57: /* logical_or_expression: logical_or_expression OR_OP logical_and_expression  */
+#line 319 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_OR, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2123 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 58: /* conditional_expression: logical_or_expression  */
+#line 324 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2129 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 59: /* conditional_expression: logical_or_expression '?' expression ':' conditional_expression  */
+#line 326 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_CONDITIONAL);
+			(yyval.ast_node)->data.conditional_expr.condition = (yyvsp[-4].ast_node);
+			(yyval.ast_node)->data.conditional_expr.then_expr = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.conditional_expr.else_expr = (yyvsp[0].ast_node);
+		}
+#line 2140 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 60: /* assignment_expression: conditional_expression  */
+#line 336 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2146 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 61: /* assignment_expression: unary_expression assignment_operator assignment_expression  */
+#line 338 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node((yyvsp[-1].binary_op), (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2152 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 62: /* assignment_operator: '='  */
+#line 342 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_ASSIGN; }
+#line 2158 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 63: /* assignment_operator: MUL_ASSIGN  */
+#line 343 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_MUL_ASSIGN; }
+#line 2164 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 64: /* assignment_operator: DIV_ASSIGN  */
+#line 344 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_DIV_ASSIGN; }
+#line 2170 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 65: /* assignment_operator: MOD_ASSIGN  */
+#line 345 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_MOD_ASSIGN; }
+#line 2176 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 66: /* assignment_operator: ADD_ASSIGN  */
+#line 346 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_ADD_ASSIGN; }
+#line 2182 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 67: /* assignment_operator: SUB_ASSIGN  */
+#line 347 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_SUB_ASSIGN; }
+#line 2188 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 68: /* assignment_operator: LEFT_ASSIGN  */
+#line 348 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_LSHIFT_ASSIGN; }
+#line 2194 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 69: /* assignment_operator: RIGHT_ASSIGN  */
+#line 349 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_RSHIFT_ASSIGN; }
+#line 2200 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 70: /* assignment_operator: AND_ASSIGN  */
+#line 350 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_AND_ASSIGN; }
+#line 2206 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 71: /* assignment_operator: XOR_ASSIGN  */
+#line 351 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_XOR_ASSIGN; }
+#line 2212 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 72: /* assignment_operator: OR_ASSIGN  */
+#line 352 "srccpp/grammar.y"
+                        { (yyval.binary_op) = OP_OR_ASSIGN; }
+#line 2218 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 73: /* expression: assignment_expression  */
+#line 357 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2224 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 74: /* expression: expression ',' assignment_expression  */
+#line 359 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_COMMA, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2230 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 75: /* constant_expression: conditional_expression  */
+#line 364 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2236 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 76: /* declaration: declaration_specifiers ';'  */
+#line 369 "srccpp/grammar.y"
+                { (yyval.ast_node) = take_pending_enums(NULL); /* Empty declaration */ free_type_info((yyvsp[-1].type_info)); }
+#line 2242 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 77: /* declaration: declaration_specifiers init_declarator_list ';'  */
+#line 371 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-1].ast_node);
+			ASTNode* curr = (yyval.ast_node);
+			while (curr) {
+				TypeInfo* full_type = duplicate_type_info((yyvsp[-2].type_info));
+				int p_level = 0;
+				if (curr->type == AST_VARIABLE_DECL) {
+					p_level = curr->data.variable_decl.pointer_level;
+					for (int i = 0; i < p_level; i++) {
+						full_type = create_pointer_type(full_type);
+					}
+					curr->data.variable_decl.type = full_type;
+				} else if (curr->type == AST_FUNCTION_DECL) {
+					p_level = curr->data.function_def.pointer_level;
+					for (int i = 0; i < p_level; i++) {
+						full_type = create_pointer_type(full_type);
+					}
+					curr->data.function_def.return_type = full_type;
+				}
+				curr = curr->next;
+			}
+			free_type_info((yyvsp[-2].type_info));
+			(yyval.ast_node) = take_pending_enums((yyval.ast_node));
+		}
+#line 2271 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 78: /* declaration: STATIC_ASSERT '(' constant_expression ',' STRING_LITERAL ')' ';'  */
+#line 396 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_STATIC_ASSERT);
+			(yyval.ast_node)->data.static_assert_decl.condition = (yyvsp[-4].ast_node);
+			(yyval.ast_node)->data.static_assert_decl.message = create_string_literal_node((yyvsp[-2].str_val));
+		}
+#line 2281 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 79: /* declaration_specifiers: storage_class_specifier  */
+#line 405 "srccpp/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2287 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 80: /* declaration_specifiers: storage_class_specifier declaration_specifiers  */
+#line 407 "srccpp/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[0].type_info);
+			(yyval.type_info)->storage_class = (yyvsp[-1].type_info)->storage_class;
+			free_type_info((yyvsp[-1].type_info));
+		}
+#line 2297 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 81: /* declaration_specifiers: type_specifier  */
+#line 413 "srccpp/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2303 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 82: /* declaration_specifiers: type_specifier declaration_specifiers  */
+#line 415 "srccpp/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[0].type_info);
+			(yyval.type_info)->base_type = (yyvsp[-1].type_info)->base_type;
+			free_type_info((yyvsp[-1].type_info));
+		}
+#line 2313 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 83: /* declaration_specifiers: type_qualifier  */
+#line 421 "srccpp/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2319 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 84: /* declaration_specifiers: type_qualifier declaration_specifiers  */
+#line 423 "srccpp/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[0].type_info);
+			(yyval.type_info)->qualifiers = (TypeQualifier)((yyval.type_info)->qualifiers | (yyvsp[-1].type_info)->qualifiers);
+			free_type_info((yyvsp[-1].type_info));
+		}
+#line 2329 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 85: /* init_declarator_list: init_declarator  */
+#line 432 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2335 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 86: /* init_declarator_list: init_declarator_list ',' init_declarator  */
+#line 434 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 2346 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 87: /* init_declarator: declarator  */
+#line 444 "srccpp/grammar.y"
+                {
+			if ((yyvsp[0].ast_node)->data.identifier.parameters) {
+				(yyval.ast_node) = create_function_decl_node(NULL, (yyvsp[0].ast_node)->data.identifier.name, (yyvsp[0].ast_node)->data.identifier.parameters, (yyvsp[0].ast_node)->data.identifier.is_variadic);
+				(yyval.ast_node)->data.function_def.pointer_level = (yyvsp[0].ast_node)->data.identifier.pointer_level;
+			} else {
+				(yyval.ast_node) = create_variable_decl_node(NULL, (yyvsp[0].ast_node)->data.identifier.name, NULL);
+				(yyval.ast_node)->data.variable_decl.pointer_level = (yyvsp[0].ast_node)->data.identifier.pointer_level;
+				(yyval.ast_node)->data.variable_decl.array_dimensions = (yyvsp[0].ast_node)->data.identifier.array_dimensions;
+			}
+		}
+#line 2361 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 88: /* init_declarator: declarator '=' initializer  */
+#line 455 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_variable_decl_node(NULL, (yyvsp[-2].ast_node)->data.identifier.name, (yyvsp[0].ast_node));
+			(yyval.ast_node)->data.variable_decl.pointer_level = (yyvsp[-2].ast_node)->data.identifier.pointer_level;
+			(yyval.ast_node)->data.variable_decl.array_dimensions = (yyvsp[-2].ast_node)->data.identifier.array_dimensions;
+		}
+#line 2371 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 89: /* storage_class_specifier: TYPEDEF  */
+#line 463 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_TYPEDEF; }
+#line 2377 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 90: /* storage_class_specifier: EXTERN  */
+#line 464 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_EXTERN; }
+#line 2383 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 91: /* storage_class_specifier: STATIC  */
+#line 465 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_STATIC; }
+#line 2389 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 92: /* storage_class_specifier: AUTO  */
+#line 466 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_AUTO; }
+#line 2395 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 93: /* storage_class_specifier: REGISTER  */
+#line 467 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_REGISTER; }
+#line 2401 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 94: /* type_specifier: VOID  */
+#line 471 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); }
+#line 2407 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 95: /* type_specifier: BOOL  */
+#line 472 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_BOOL); }
+#line 2413 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 96: /* type_specifier: CHAR  */
+#line 473 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_CHAR); }
+#line 2419 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 97: /* type_specifier: SHORT  */
+#line 474 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_SHORT); }
+#line 2425 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 98: /* type_specifier: INT  */
+#line 475 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_INT); }
+#line 2431 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 99: /* type_specifier: LONG  */
+#line 476 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_LONG); }
+#line 2437 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 100: /* type_specifier: FLOAT  */
+#line 477 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_FLOAT); }
+#line 2443 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 101: /* type_specifier: DOUBLE  */
+#line 478 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_DOUBLE); }
+#line 2449 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 102: /* type_specifier: SIGNED  */
+#line 479 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_SIGNED); }
+#line 2455 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 103: /* type_specifier: UNSIGNED  */
+#line 480 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_UNSIGNED); }
+#line 2461 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 104: /* type_specifier: struct_or_union_specifier  */
+#line 481 "srccpp/grammar.y"
+                                    { (yyval.type_info) = NULL; }
+#line 2467 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 105: /* type_specifier: enum_specifier  */
+#line 482 "srccpp/grammar.y"
+                                    { (yyval.type_info) = create_type_info(TYPE_INT); }
+#line 2473 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 106: /* type_specifier: TYPE_NAME  */
+#line 483 "srccpp/grammar.y"
+                                    { (yyval.type_info) = NULL; }
+#line 2479 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 107: /* struct_or_union_specifier: struct_or_union IDENTIFIER '{' struct_declaration_list '}'  */
+#line 488 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2485 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 108: /* struct_or_union_specifier: struct_or_union '{' struct_declaration_list '}'  */
+#line 490 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2491 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 109: /* struct_or_union_specifier: struct_or_union IDENTIFIER  */
+#line 492 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2497 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 110: /* struct_or_union: STRUCT  */
+#line 496 "srccpp/grammar.y"
+                  { (yyval.str_val) = (char*)"struct"; }
+#line 2503 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 111: /* struct_or_union: UNION  */
+#line 497 "srccpp/grammar.y"
+                  { (yyval.str_val) = (char*)"union"; }
+#line 2509 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 112: /* struct_declaration_list: struct_declaration  */
+#line 502 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2515 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 113: /* struct_declaration_list: struct_declaration_list struct_declaration  */
+#line 504 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); /* Chain declarations */ }
+#line 2521 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 114: /* struct_declaration: specifier_qualifier_list struct_declarator_list ';'  */
+#line 509 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 2527 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 115: /* specifier_qualifier_list: type_specifier specifier_qualifier_list  */
+#line 514 "srccpp/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[0].type_info);
+			(yyval.type_info)->base_type = (yyvsp[-1].type_info)->base_type;
+			free_type_info((yyvsp[-1].type_info));
+		}
+#line 2537 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 116: /* specifier_qualifier_list: type_specifier  */
+#line 520 "srccpp/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2543 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 117: /* specifier_qualifier_list: type_qualifier specifier_qualifier_list  */
+#line 522 "srccpp/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[0].type_info);
+			(yyval.type_info)->qualifiers = (TypeQualifier)((yyval.type_info)->qualifiers | (yyvsp[-1].type_info)->qualifiers);
+			free_type_info((yyvsp[-1].type_info));
+		}
+#line 2553 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 118: /* specifier_qualifier_list: type_qualifier  */
+#line 528 "srccpp/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2559 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 119: /* struct_declarator_list: struct_declarator  */
+#line 533 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2565 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 120: /* struct_declarator_list: struct_declarator_list ',' struct_declarator  */
+#line 535 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 2571 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 121: /* struct_declarator: declarator  */
+#line 540 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2577 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 122: /* struct_declarator: ':' constant_expression  */
+#line 542 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2583 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 123: /* struct_declarator: declarator ':' constant_expression  */
+#line 544 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 2589 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 124: /* enum_specifier: ENUM '{' enumerator_list '}'  */
+#line 549 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; queue_enum(NULL, (yyvsp[-1].ast_node)); }
+#line 2595 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 125: /* enum_specifier: ENUM '{' enumerator_list ',' '}'  */
+#line 551 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; queue_enum(NULL, (yyvsp[-2].ast_node)); }
+#line 2601 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 126: /* enum_specifier: ENUM IDENTIFIER '{' enumerator_list '}'  */
+#line 553 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; queue_enum((yyvsp[-3].str_val), (yyvsp[-1].ast_node)); }
+#line 2607 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 127: /* enum_specifier: ENUM IDENTIFIER '{' enumerator_list ',' '}'  */
+#line 555 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; queue_enum((yyvsp[-4].str_val), (yyvsp[-2].ast_node)); }
+#line 2613 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 128: /* enum_specifier: ENUM IDENTIFIER  */
+#line 557 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2619 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 129: /* enumerator_list: enumerator  */
+#line 562 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2625 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 130: /* enumerator_list: enumerator_list ',' enumerator  */
+#line 564 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 2636 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 131: /* enumerator: IDENTIFIER  */
+#line 574 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_identifier_node((yyvsp[0].str_val)); }
+#line 2642 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 132: /* enumerator: IDENTIFIER '=' constant_expression  */
+#line 576 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_ASSIGN, create_identifier_node((yyvsp[-2].str_val)), (yyvsp[0].ast_node)); }
+#line 2648 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 133: /* type_qualifier: CONST  */
+#line 580 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->qualifiers = QUAL_CONST; }
+#line 2654 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 134: /* type_qualifier: VOLATILE  */
+#line 581 "srccpp/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->qualifiers = QUAL_VOLATILE; }
+#line 2660 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 135: /* declarator: pointer direct_declarator  */
+#line 586 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[0].ast_node);
+			(yyval.ast_node)->data.identifier.pointer_level = (yyvsp[-1].int_val);
+		}
+#line 2669 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 136: /* declarator: direct_declarator  */
+#line 591 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[0].ast_node);
+			(yyval.ast_node)->data.identifier.pointer_level = 0;
+		}
+#line 2678 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 137: /* direct_declarator: IDENTIFIER  */
+#line 599 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_identifier_node((yyvsp[0].str_val));
+			(yyval.ast_node)->data.identifier.is_variadic = 0;
+			(yyval.ast_node)->data.identifier.pointer_level = 0;
+		}
+#line 2688 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 138: /* direct_declarator: '(' declarator ')'  */
+#line 605 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 2694 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 139: /* direct_declarator: direct_declarator '[' constant_expression ']'  */
+#line 607 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-3].ast_node);
+			/* Prepend array dimension to dimension list; code generation
+			 * evaluates the size */
+			(yyvsp[-1].ast_node)->next = (yyval.ast_node)->data.identifier.array_dimensions;
+			(yyval.ast_node)->data.identifier.array_dimensions = (yyvsp[-1].ast_node);
+		}
+#line 2706 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 140: /* direct_declarator: direct_declarator '[' ']'  */
+#line 615 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* zero = create_constant_node(0, TYPE_INT);
+			zero->next = (yyval.ast_node)->data.identifier.array_dimensions;
+			(yyval.ast_node)->data.identifier.array_dimensions = zero;
+		}
+#line 2717 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 141: /* direct_declarator: direct_declarator '(' parameter_type_list ')'  */
+#line 622 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.identifier.parameters = (yyvsp[-1].param_info).head;
+			(yyval.ast_node)->data.identifier.is_variadic = (yyvsp[-1].param_info).is_variadic;
+		}
+#line 2727 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 142: /* direct_declarator: direct_declarator '(' identifier_list ')'  */
+#line 628 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.identifier.is_variadic = 0;
+		}
+#line 2736 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 143: /* direct_declarator: direct_declarator '(' ')'  */
+#line 633 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.identifier.is_variadic = 0;
+		}
+#line 2745 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 144: /* pointer: '*'  */
+#line 641 "srccpp/grammar.y"
+                { (yyval.int_val) = 1; }
+#line 2751 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 145: /* pointer: '*' type_qualifier_list  */
+#line 643 "srccpp/grammar.y"
+                { (yyval.int_val) = 1; }
+#line 2757 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 146: /* pointer: '*' pointer  */
+#line 645 "srccpp/grammar.y"
+                { (yyval.int_val) = (yyvsp[0].int_val) + 1; }
+#line 2763 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 147: /* pointer: '*' type_qualifier_list pointer  */
+#line 647 "srccpp/grammar.y"
+                { (yyval.int_val) = (yyvsp[0].int_val) + 1; }
+#line 2769 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 148: /* type_qualifier_list: type_qualifier  */
+#line 652 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2775 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 149: /* type_qualifier_list: type_qualifier_list type_qualifier  */
+#line 654 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2781 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 150: /* parameter_type_list: parameter_list  */
+#line 659 "srccpp/grammar.y"
+                {
+			(yyval.param_info).head = (yyvsp[0].ast_node);
+			(yyval.param_info).is_variadic = 0;
+		}
+#line 2790 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 151: /* parameter_type_list: parameter_list ',' ELLIPSIS  */
+#line 664 "srccpp/grammar.y"
+                {
+			(yyval.param_info).head = (yyvsp[-2].ast_node);
+			(yyval.param_info).is_variadic = 1;
+		}
+#line 2799 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 152: /* parameter_list: parameter_declaration  */
+#line 672 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2805 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 153: /* parameter_list: parameter_list ',' parameter_declaration  */
+#line 674 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 2816 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 154: /* parameter_declaration: declaration_specifiers declarator  */
+#line 684 "srccpp/grammar.y"
+                {
+			TypeInfo* full_type = (yyvsp[-1].type_info);
+			for (int i = 0; i < (yyvsp[0].ast_node)->data.identifier.pointer_level; i++) {
+				full_type = create_pointer_type(full_type);
+			}
+			(yyval.ast_node) = create_variable_decl_node(full_type, (yyvsp[0].ast_node)->data.identifier.name, NULL);
+		}
+#line 2828 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 155: /* parameter_declaration: declaration_specifiers abstract_declarator  */
+#line 692 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_variable_decl_node((yyvsp[-1].type_info), (char*)"param", NULL); }
+#line 2834 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 156: /* parameter_declaration: declaration_specifiers  */
+#line 694 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_variable_decl_node((yyvsp[0].type_info), (char*)"param", NULL); }
+#line 2840 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 157: /* identifier_list: IDENTIFIER  */
+#line 699 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_identifier_node((yyvsp[0].str_val)); }
+#line 2846 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 158: /* identifier_list: identifier_list ',' IDENTIFIER  */
+#line 701 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = create_identifier_node((yyvsp[0].str_val));
+		}
+#line 2857 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 159: /* type_name: specifier_qualifier_list  */
+#line 711 "srccpp/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2863 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 160: /* type_name: specifier_qualifier_list abstract_declarator  */
+#line 713 "srccpp/grammar.y"
+                { (yyval.type_info) = (yyvsp[-1].type_info); }
+#line 2869 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 161: /* abstract_declarator: pointer  */
+#line 718 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2875 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 162: /* abstract_declarator: direct_abstract_declarator  */
+#line 720 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2881 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 163: /* abstract_declarator: pointer direct_abstract_declarator  */
+#line 722 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2887 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 164: /* direct_abstract_declarator: '(' abstract_declarator ')'  */
+#line 727 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 2893 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 165: /* direct_abstract_declarator: '[' ']'  */
+#line 729 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2899 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 166: /* direct_abstract_declarator: '[' constant_expression ']'  */
+#line 731 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2905 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 167: /* direct_abstract_declarator: direct_abstract_declarator '[' ']'  */
+#line 733 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 2911 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 168: /* direct_abstract_declarator: direct_abstract_declarator '[' constant_expression ']'  */
+#line 735 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-3].ast_node); }
+#line 2917 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 169: /* direct_abstract_declarator: '(' ')'  */
+#line 737 "srccpp/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2923 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 170: /* direct_abstract_declarator: '(' parameter_type_list ')'  */
+#line 739 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].param_info).head; }
+#line 2929 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 171: /* direct_abstract_declarator: direct_abstract_declarator '(' ')'  */
+#line 741 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 2935 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 172: /* direct_abstract_declarator: direct_abstract_declarator '(' parameter_type_list ')'  */
+#line 743 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-3].ast_node); }
+#line 2941 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 173: /* initializer: assignment_expression  */
+#line 748 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2947 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 174: /* initializer: '{' initializer_list '}'  */
+#line 750 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_INITIALIZER_LIST);
+			(yyval.ast_node)->data.initializer_list.items = (yyvsp[-1].ast_node);
+			int count = 0;
+			ASTNode* current = (yyvsp[-1].ast_node);
+			while (current) { count++; current = current->next; }
+			(yyval.ast_node)->data.initializer_list.count = count;
+		}
+#line 2960 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 175: /* initializer: '{' initializer_list ',' '}'  */
+#line 759 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_INITIALIZER_LIST);
+			(yyval.ast_node)->data.initializer_list.items = (yyvsp[-2].ast_node);
+			int count = 0;
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current) { count++; current = current->next; }
+			(yyval.ast_node)->data.initializer_list.count = count;
+		}
+#line 2973 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 176: /* initializer_list: initializer  */
+#line 771 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2979 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 177: /* initializer_list: initializer_list ',' initializer  */
+#line 773 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 2990 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 178: /* statement: labeled_statement  */
+#line 782 "srccpp/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2996 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 179: /* statement: compound_statement  */
+#line 783 "srccpp/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3002 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 180: /* statement: expression_statement  */
+#line 784 "srccpp/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3008 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 181: /* statement: selection_statement  */
+#line 785 "srccpp/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3014 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 182: /* statement: iteration_statement  */
+#line 786 "srccpp/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3020 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 183: /* statement: jump_statement  */
+#line 787 "srccpp/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3026 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 184: /* labeled_statement: IDENTIFIER ':' statement  */
+#line 792 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_LABEL_STMT);
+			/* Set label and statement */
+		}
+#line 3035 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 185: /* labeled_statement: CASE constant_expression ':' statement  */
+#line 797 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_CASE_STMT);
+			(yyval.ast_node)->data.case_stmt.value = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.case_stmt.statement = (yyvsp[0].ast_node);
+		}
+#line 3045 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 186: /* labeled_statement: DEFAULT ':' statement  */
+#line 803 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_DEFAULT_STMT);
+			(yyval.ast_node)->data.case_stmt.value = NULL;  /* no value for default */
+			(yyval.ast_node)->data.case_stmt.statement = (yyvsp[0].ast_node);
+		}
+#line 3055 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 187: /* compound_statement: '{' '}'  */
+#line 812 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_compound_stmt_node(NULL); }
+#line 3061 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 188: /* compound_statement: '{' block_item_list '}'  */
+#line 814 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_compound_stmt_node((yyvsp[-1].ast_node)); }
+#line 3067 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 189: /* block_item_list: block_item  */
+#line 819 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3073 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 190: /* block_item_list: block_item_list block_item  */
+#line 821 "srccpp/grammar.y"
+                {
+			if ((yyvsp[-1].ast_node)) {
+				(yyval.ast_node) = (yyvsp[-1].ast_node);
+				ASTNode* current = (yyvsp[-1].ast_node);
+				while (current->next) current = current->next;
+				current->next = (yyvsp[0].ast_node);
+			} else {
+				(yyval.ast_node) = (yyvsp[0].ast_node);
+			}
+		}
+#line 3088 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 191: /* block_item: declaration  */
+#line 835 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3094 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 192: /* block_item: statement  */
+#line 837 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3100 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 193: /* declaration_list: declaration  */
+#line 842 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3106 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 194: /* declaration_list: declaration_list declaration  */
+#line 844 "srccpp/grammar.y"
+                {
+			if ((yyvsp[-1].ast_node)) {
+				(yyval.ast_node) = (yyvsp[-1].ast_node);
+				ASTNode* current = (yyvsp[-1].ast_node);
+				while (current->next) current = current->next;
+				current->next = (yyvsp[0].ast_node);
+			} else {
+				(yyval.ast_node) = (yyvsp[0].ast_node);
+			}
+		}
+#line 3121 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 195: /* expression_statement: ';'  */
+#line 860 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_EXPRESSION_STMT);
+			(yyval.ast_node)->data.return_stmt.expression = NULL; /* Reuse return_stmt structure for expression */
+		}
+#line 3130 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 196: /* expression_statement: expression ';'  */
+#line 865 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_EXPRESSION_STMT);
+			(yyval.ast_node)->data.return_stmt.expression = (yyvsp[-1].ast_node); /* Store the expression */
+		}
+#line 3139 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 197: /* selection_statement: IF '(' expression ')' statement  */
+#line 873 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_if_stmt_node((yyvsp[-2].ast_node), (yyvsp[0].ast_node), NULL); }
+#line 3145 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 198: /* selection_statement: IF '(' expression ')' statement ELSE statement  */
+#line 875 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_if_stmt_node((yyvsp[-4].ast_node), (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 3151 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 199: /* selection_statement: SWITCH '(' expression ')' statement  */
+#line 877 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_SWITCH_STMT);
+			(yyval.ast_node)->data.switch_stmt.expression = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.switch_stmt.body = (yyvsp[0].ast_node);
+		}
+#line 3161 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 200: /* iteration_statement: WHILE '(' expression ')' statement  */
+#line 886 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_while_stmt_node((yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 3167 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 201: /* iteration_statement: DO statement WHILE '(' expression ')' ';'  */
+#line 888 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_DO_WHILE_STMT);
+			(yyval.ast_node)->data.while_stmt.condition = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.while_stmt.body = (yyvsp[-5].ast_node);
+		}
+#line 3177 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 202: /* iteration_statement: FOR '(' expression_statement expression_statement ')' statement  */
+#line 894 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_for_stmt_node((yyvsp[-3].ast_node), (yyvsp[-2].ast_node), NULL, (yyvsp[0].ast_node)); }
+#line 3183 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 203: /* iteration_statement: FOR '(' expression_statement expression_statement expression ')' statement  */
+#line 896 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_for_stmt_node((yyvsp[-4].ast_node), (yyvsp[-3].ast_node), (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 3189 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 204: /* iteration_statement: FOR '(' declaration expression_statement ')' statement  */
+#line 898 "srccpp/grammar.y"
+                {
+			/* C99: for (int i = 0; condition; ) body */
+			(yyval.ast_node) = create_ast_node(AST_FOR_STMT);
+			(yyval.ast_node)->data.for_stmt.init = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.for_stmt.condition = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.for_stmt.update = NULL;
+			(yyval.ast_node)->data.for_stmt.body = (yyvsp[0].ast_node);
+		}
+#line 3202 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 205: /* iteration_statement: FOR '(' declaration expression_statement expression ')' statement  */
+#line 907 "srccpp/grammar.y"
+                {
+			/* C99: for (int i = 0; condition; update) body */
+			(yyval.ast_node) = create_ast_node(AST_FOR_STMT);
+			(yyval.ast_node)->data.for_stmt.init = (yyvsp[-4].ast_node);
+			(yyval.ast_node)->data.for_stmt.condition = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.for_stmt.update = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.for_stmt.body = (yyvsp[0].ast_node);
+		}
+#line 3215 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 206: /* jump_statement: GOTO IDENTIFIER ';'  */
+#line 919 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_GOTO_STMT);
+			/* Set target label */
+		}
+#line 3224 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 207: /* jump_statement: CONTINUE ';'  */
+#line 924 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_ast_node(AST_CONTINUE_STMT); }
+#line 3230 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 208: /* jump_statement: BREAK ';'  */
+#line 926 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_ast_node(AST_BREAK_STMT); }
+#line 3236 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 209: /* jump_statement: RETURN ';'  */
+#line 928 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_return_stmt_node(NULL); }
+#line 3242 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 210: /* jump_statement: RETURN expression ';'  */
+#line 930 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_return_stmt_node((yyvsp[-1].ast_node)); }
+#line 3248 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 211: /* translation_unit: external_declaration  */
+#line 935 "srccpp/grammar.y"
+                {
+			program_ast = (yyvsp[0].ast_node);
+			(yyval.ast_node) = program_ast;
+		}
+#line 3257 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 212: /* translation_unit: translation_unit external_declaration  */
+#line 940 "srccpp/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-1].ast_node);
+			ASTNode* current = (yyvsp[-1].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+			program_ast = (yyval.ast_node);
+		}
+#line 3269 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 213: /* external_declaration: function_definition  */
+#line 951 "srccpp/grammar.y"
+                { (yyval.ast_node) = take_pending_enums((yyvsp[0].ast_node)); }
+#line 3275 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 214: /* external_declaration: declaration  */
+#line 953 "srccpp/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3281 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 215: /* function_definition: declaration_specifiers declarator declaration_list compound_statement  */
+#line 958 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_function_def_node((yyvsp[-3].type_info), (yyvsp[-2].ast_node)->data.identifier.name, (yyvsp[-1].ast_node), (yyvsp[0].ast_node), (yyvsp[-2].ast_node)->data.identifier.is_variadic); }
+#line 3287 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 216: /* function_definition: declaration_specifiers declarator compound_statement  */
+#line 960 "srccpp/grammar.y"
+                {
+			/* Check if declarator has parameters (modern C syntax) */
+			ASTNode* params = ((yyvsp[-1].ast_node)->data.identifier.parameters) ? (yyvsp[-1].ast_node)->data.identifier.parameters : NULL;
+			(yyval.ast_node) = create_function_def_node((yyvsp[-2].type_info), (yyvsp[-1].ast_node)->data.identifier.name, params, (yyvsp[0].ast_node), (yyvsp[-1].ast_node)->data.identifier.is_variadic);
+		}
+#line 3297 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 217: /* function_definition: declarator declaration_list compound_statement  */
+#line 966 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_function_def_node(create_type_info(TYPE_INT), (yyvsp[-2].ast_node)->data.identifier.name, (yyvsp[-1].ast_node), (yyvsp[0].ast_node), (yyvsp[-2].ast_node)->data.identifier.is_variadic); }
+#line 3303 "build/generated/grammar.tab.cpp"
+    break;
+
+  case 218: /* function_definition: declarator compound_statement  */
+#line 968 "srccpp/grammar.y"
+                { (yyval.ast_node) = create_function_def_node(create_type_info(TYPE_INT), (yyvsp[-1].ast_node)->data.identifier.name, NULL, (yyvsp[0].ast_node), (yyvsp[-1].ast_node)->data.identifier.is_variadic); }
+#line 3309 "build/generated/grammar.tab.cpp"
+    break;
+
+
+#line 3313 "build/generated/grammar.tab.cpp"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 971 "srccpp/grammar.y"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int yyerror(const char* s) {
+	/* Record the error on the active context, if any */
+	if (codegen_ctx) {
+		codegen_add_diagnostic(codegen_ctx, DIAGNOSTIC_ERROR, yylineno, column, s);
+		if (codegen_ctx->quiet_diagnostics)
+			return 0;
+	}
+	fflush(stdout);
+	printf("\n%*s\n%*s\n", column, "^", column, s);
+	return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,244 @@
+#define DEVLEX_CPP 1
+#define _POSIX_C_SOURCE 200809L
+/* Throwaway hand-written stand-in for flex output (sandbox has no flex).
+ * Build with -DDEVLEX_CPP (srccpp grammar) or -DDEVLEX_C (src grammar). */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef DEVLEX_C
+#include "ast.h"
+#include "symbols.h"
+#include "grammar_c.tab.h"
+#else
+typedef struct ASTNode ASTNode;
+typedef struct TypeInfo TypeInfo;
+typedef enum {
+    OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MOD,
+    OP_LT, OP_GT, OP_LE, OP_GE, OP_EQ, OP_NE,
+    OP_AND, OP_OR, OP_BITAND, OP_BITOR, OP_XOR,
+    OP_LSHIFT, OP_RSHIFT,
+    OP_ASSIGN, OP_ADD_ASSIGN, OP_SUB_ASSIGN,
+    OP_MUL_ASSIGN, OP_DIV_ASSIGN, OP_MOD_ASSIGN,
+    OP_AND_ASSIGN, OP_OR_ASSIGN, OP_XOR_ASSIGN,
+    OP_LSHIFT_ASSIGN, OP_RSHIFT_ASSIGN,
+    OP_COMMA
+} BinaryOp;
+typedef enum {
+    UOP_PLUS, UOP_MINUS, UOP_NOT, UOP_BITNOT,
+    UOP_PREINC, UOP_PREDEC, UOP_POSTINC, UOP_POSTDEC,
+    UOP_ADDR, UOP_DEREF, UOP_SIZEOF
+} UnaryOp;
+#include "grammar.tab.hpp"
+#endif
+
+FILE* yyin = NULL;
+char* yytext = NULL;
+int yylineno = 1;
+int column = 0;
+#ifndef DEVLEX_C
+int yyleng = 0;
+#endif
+
+static char* buf = NULL;
+static size_t buflen = 0, pos = 0;
+static FILE* loaded_from = NULL;
+static char tokbuf[1 << 16];
+
+static int mem_active;
+static void load(void) {
+    if (mem_active || (buf && loaded_from == yyin)) return;
+    free(buf);
+    buf = NULL; buflen = 0; pos = 0;
+    FILE* f = yyin ? yyin : stdin;
+    size_t cap = 4096;
+    buf = malloc(cap);
+    size_t n;
+    while ((n = fread(buf + buflen, 1, cap - buflen, f)) > 0) {
+        buflen += n;
+        if (buflen == cap) { cap *= 2; buf = realloc(buf, cap); }
+    }
+    loaded_from = yyin;
+}
+
+/* Reset scanner state so a new yyin is picked up. */
+void devlex_reset(void) { free(buf); buf = NULL; loaded_from = NULL; yylineno = 1; column = 0; }
+
+/* In-memory input for library use. */
+void lexer_begin_buffer(const char* src, size_t len) {
+    free(buf);
+    buf = malloc(len + 1);
+    memcpy(buf, src, len);
+    buflen = len; pos = 0; loaded_from = yyin; yylineno = 1; column = 0; mem_active = 1;
+}
+void lexer_end_buffer(void) { if (mem_active) { free(buf); buf = NULL; loaded_from = NULL; mem_active = 0; } }
+
+static int peek(size_t off) { return pos + off < buflen ? (unsigned char)buf[pos + off] : 0; }
+
+static void set_text(size_t start, size_t end) {
+    size_t n = end - start;
+    if (n >= sizeof(tokbuf)) n = sizeof(tokbuf) - 1;
+    memcpy(tokbuf, buf + start, n);
+    tokbuf[n] = 0;
+    yytext = tokbuf;
+#ifndef DEVLEX_C
+    yyleng = (int)n;
+#endif
+    for (size_t i = 0; i < n; i++) {
+        if (tokbuf[i] == '\n') { yylineno++; column = 0; }
+        else column++;
+    }
+}
+
+struct kw { const char* s; int tok; };
+static const struct kw keywords[] = {
+    {"auto", AUTO}, {"_Bool", BOOL}, {"break", BREAK}, {"case", CASE},
+    {"char", CHAR}, {"const", CONST}, {"continue", CONTINUE},
+    {"default", DEFAULT}, {"do", DO}, {"double", DOUBLE}, {"else", ELSE},
+    {"enum", ENUM}, {"extern", EXTERN}, {"float", FLOAT}, {"for", FOR},
+    {"goto", GOTO}, {"if", IF}, {"int", INT}, {"long", LONG},
+    {"register", REGISTER}, {"return", RETURN}, {"short", SHORT},
+    {"signed", SIGNED}, {"sizeof", SIZEOF}, {"static", STATIC},
+    {"struct", STRUCT}, {"switch", SWITCH}, {"typedef", TYPEDEF},
+    {"union", UNION}, {"unsigned", UNSIGNED}, {"void", VOID},
+    {"volatile", VOLATILE}, {"while", WHILE},
+#ifdef DEVLEX_CPP
+    {"_Static_assert", STATIC_ASSERT},
+#endif
+#ifdef DEVLEX_C
+    {"__restrict", CONST}, {"restrict", CONST},
+    {"__builtin_va_arg", SIZEOF}, {"__builtin_va_start", SIZEOF},
+    {"__builtin_va_end", SIZEOF}, {"__builtin_va_copy", SIZEOF},
+    {"__builtin_expect", SIZEOF},
+#endif
+    {NULL, 0}};
+
+#ifdef DEVLEX_C
+static const char* ignored[] = {"_Nullable", "_Nonnull", "__unused", "__deprecated", "__dead2",
+                                "__pure2", "__block", "__weak", "__strong",
+                                "__unsafe_unretained", "__inline", "inline",
+                                "__extension__", NULL};
+static const char* attrs[] = {"__attribute__", "__asm", "__asm__", NULL};
+#endif
+
+struct op { const char* s; int tok; };
+static const struct op ops[] = {
+    {"...", ELLIPSIS}, {">>=", RIGHT_ASSIGN}, {"<<=", LEFT_ASSIGN},
+    {"+=", ADD_ASSIGN}, {"-=", SUB_ASSIGN}, {"*=", MUL_ASSIGN},
+    {"/=", DIV_ASSIGN}, {"%=", MOD_ASSIGN}, {"&=", AND_ASSIGN},
+    {"^=", XOR_ASSIGN}, {"|=", OR_ASSIGN}, {">>", RIGHT_OP}, {"<<", LEFT_OP},
+    {"++", INC_OP}, {"--", DEC_OP}, {"->", PTR_OP}, {"&&", AND_OP},
+    {"||", OR_OP}, {"<=", LE_OP}, {">=", GE_OP}, {"==", EQ_OP}, {"!=", NE_OP},
+    {"<%", '{'}, {"%>", '}'}, {"<:", '['}, {":>", ']'},
+    {NULL, 0}};
+
+static int strdup_val(void) {
+    yylval.str_val = strdup(yytext);
+    return 1;
+}
+
+int yylex(void) {
+    load();
+    for (;;) {
+        if (pos >= buflen) return 0;
+        int c = peek(0);
+        size_t start = pos;
+        if (c == ' ' || c == '\t' || c == '\v' || c == '\n' || c == '\f' || c == '\r') {
+            pos++; set_text(start, pos); continue;
+        }
+        if (c == '/' && peek(1) == '*') {
+            pos += 2;
+            while (pos < buflen && !(peek(0) == '*' && peek(1) == '/')) pos++;
+            if (pos < buflen) pos += 2;
+            set_text(start, pos); continue;
+        }
+        if (c == '/' && peek(1) == '/') {
+            while (pos < buflen && peek(0) != '\n') pos++;
+            set_text(start, pos); continue;
+        }
+#ifdef DEVLEX_C
+        if (c == '#' && (start == 0 || buf[start - 1] == '\n')) {
+            while (pos < buflen && peek(0) != '\n') pos++;
+            set_text(start, pos); continue;
+        }
+#endif
+        if (isalpha(c) || c == '_') {
+            while (isalnum(peek(0)) || peek(0) == '_') pos++;
+            if ((c == 'L') && pos == start + 1 && (peek(0) == '"' || peek(0) == '\'')) {
+                /* wide literal: fall through to literal scanning */
+            } else {
+                set_text(start, pos);
+#ifdef DEVLEX_C
+                int skip = 0;
+                for (int i = 0; ignored[i]; i++) if (!strcmp(yytext, ignored[i])) skip = 1;
+                if (skip) continue;
+                for (int i = 0; attrs[i]; i++) if (!strcmp(yytext, attrs[i])) skip = 2;
+                if (skip == 2) {
+                    int parens = 0;
+                    while (pos < buflen) {
+                        int ch = buf[pos++];
+                        if (ch == '\n') yylineno++;
+                        if (ch == '(') parens++;
+                        else if (ch == ')') { parens--; if (parens <= 0) break; }
+                    }
+                    continue;
+                }
+#endif
+                for (int i = 0; keywords[i].s; i++)
+                    if (!strcmp(yytext, keywords[i].s)) return keywords[i].tok;
+                strdup_val();
+#ifdef DEVLEX_C
+                Symbol* sym = symbol_lookup(yytext);
+                if (sym && sym->type && sym->type->storage_class == STORAGE_TYPEDEF) return TYPE_NAME;
+#endif
+                return IDENTIFIER;
+            }
+        }
+        if (c == '"' || ((c == 'L') && peek(1) == '"') || (pos > start && peek(0) == '"')) {
+            if (peek(0) == 'L') pos++;
+            pos++;
+            while (pos < buflen && peek(0) != '"') {
+                if (peek(0) == '\\') pos++;
+                pos++;
+            }
+            pos++;
+            set_text(start, pos); strdup_val(); return STRING_LITERAL;
+        }
+        if (c == '\'' || ((c == 'L') && peek(1) == '\'') || (pos > start && peek(0) == '\'')) {
+            if (peek(0) == 'L') pos++;
+            pos++;
+            while (pos < buflen && peek(0) != '\'') {
+                if (peek(0) == '\\') pos++;
+                pos++;
+            }
+            pos++;
+            set_text(start, pos); strdup_val(); return CONSTANT;
+        }
+        if (isdigit(c) || (c == '.' && isdigit(peek(1)))) {
+            if (c == '0' && (peek(1) == 'x' || peek(1) == 'X')) {
+                pos += 2;
+                while (isxdigit(peek(0))) pos++;
+            } else {
+                while (isdigit(peek(0))) pos++;
+                if (peek(0) == '.') { pos++; while (isdigit(peek(0))) pos++; }
+                if (peek(0) == 'e' || peek(0) == 'E') {
+                    pos++;
+                    if (peek(0) == '+' || peek(0) == '-') pos++;
+                    while (isdigit(peek(0))) pos++;
+                }
+            }
+            while (strchr("uUlLfF", peek(0)) && peek(0)) pos++;
+            set_text(start, pos); strdup_val(); return CONSTANT;
+        }
+        for (int i = 0; ops[i].s; i++) {
+            size_t n = strlen(ops[i].s);
+            if (pos + n <= buflen && !memcmp(buf + pos, ops[i].s, n)) {
+                pos += n; set_text(start, pos); return ops[i].tok;
+            }
+        }
+        pos++;
+        set_text(start, pos);
+        if (strchr(";{},:=()[].&!~-+*/%<>^|?", c)) return c;
+    }
+}
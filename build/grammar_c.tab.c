@@ -0,0 +1,3919 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "src/grammar.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ast.h"
+#include "symbols.h"
+
+extern int yylex(void);
+extern char* yytext;
+extern int column;
+extern FILE* yyin;
+
+/* Global variables */
+ASTNode* program_ast = NULL;
+int g_next_enum_value = 0;
+
+/* Error handling */
+int yyerror(const char* s);
+
+#line 91 "build/grammar_c.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "grammar_c.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENTIFIER = 3,                 /* IDENTIFIER  */
+  YYSYMBOL_CONSTANT = 4,                   /* CONSTANT  */
+  YYSYMBOL_STRING_LITERAL = 5,             /* STRING_LITERAL  */
+  YYSYMBOL_SIZEOF = 6,                     /* SIZEOF  */
+  YYSYMBOL_TYPE_NAME = 7,                  /* TYPE_NAME  */
+  YYSYMBOL_PTR_OP = 8,                     /* PTR_OP  */
+  YYSYMBOL_INC_OP = 9,                     /* INC_OP  */
+  YYSYMBOL_DEC_OP = 10,                    /* DEC_OP  */
+  YYSYMBOL_LEFT_OP = 11,                   /* LEFT_OP  */
+  YYSYMBOL_RIGHT_OP = 12,                  /* RIGHT_OP  */
+  YYSYMBOL_LE_OP = 13,                     /* LE_OP  */
+  YYSYMBOL_GE_OP = 14,                     /* GE_OP  */
+  YYSYMBOL_EQ_OP = 15,                     /* EQ_OP  */
+  YYSYMBOL_NE_OP = 16,                     /* NE_OP  */
+  YYSYMBOL_AND_OP = 17,                    /* AND_OP  */
+  YYSYMBOL_OR_OP = 18,                     /* OR_OP  */
+  YYSYMBOL_MUL_ASSIGN = 19,                /* MUL_ASSIGN  */
+  YYSYMBOL_DIV_ASSIGN = 20,                /* DIV_ASSIGN  */
+  YYSYMBOL_MOD_ASSIGN = 21,                /* MOD_ASSIGN  */
+  YYSYMBOL_ADD_ASSIGN = 22,                /* ADD_ASSIGN  */
+  YYSYMBOL_SUB_ASSIGN = 23,                /* SUB_ASSIGN  */
+  YYSYMBOL_LEFT_ASSIGN = 24,               /* LEFT_ASSIGN  */
+  YYSYMBOL_RIGHT_ASSIGN = 25,              /* RIGHT_ASSIGN  */
+  YYSYMBOL_AND_ASSIGN = 26,                /* AND_ASSIGN  */
+  YYSYMBOL_XOR_ASSIGN = 27,                /* XOR_ASSIGN  */
+  YYSYMBOL_OR_ASSIGN = 28,                 /* OR_ASSIGN  */
+  YYSYMBOL_TYPEDEF = 29,                   /* TYPEDEF  */
+  YYSYMBOL_EXTERN = 30,                    /* EXTERN  */
+  YYSYMBOL_STATIC = 31,                    /* STATIC  */
+  YYSYMBOL_AUTO = 32,                      /* AUTO  */
+  YYSYMBOL_REGISTER = 33,                  /* REGISTER  */
+  YYSYMBOL_CHAR = 34,                      /* CHAR  */
+  YYSYMBOL_SHORT = 35,                     /* SHORT  */
+  YYSYMBOL_INT = 36,                       /* INT  */
+  YYSYMBOL_LONG = 37,                      /* LONG  */
+  YYSYMBOL_SIGNED = 38,                    /* SIGNED  */
+  YYSYMBOL_UNSIGNED = 39,                  /* UNSIGNED  */
+  YYSYMBOL_FLOAT = 40,                     /* FLOAT  */
+  YYSYMBOL_DOUBLE = 41,                    /* DOUBLE  */
+  YYSYMBOL_CONST = 42,                     /* CONST  */
+  YYSYMBOL_VOLATILE = 43,                  /* VOLATILE  */
+  YYSYMBOL_VOID = 44,                      /* VOID  */
+  YYSYMBOL_STRUCT = 45,                    /* STRUCT  */
+  YYSYMBOL_UNION = 46,                     /* UNION  */
+  YYSYMBOL_ENUM = 47,                      /* ENUM  */
+  YYSYMBOL_ELLIPSIS = 48,                  /* ELLIPSIS  */
+  YYSYMBOL_BOOL = 49,                      /* BOOL  */
+  YYSYMBOL_NONNULL = 50,                   /* NONNULL  */
+  YYSYMBOL_NULLABLE = 51,                  /* NULLABLE  */
+  YYSYMBOL_UNUSED = 52,                    /* UNUSED  */
+  YYSYMBOL_DEPRECATED = 53,                /* DEPRECATED  */
+  YYSYMBOL_CASE = 54,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 55,                   /* DEFAULT  */
+  YYSYMBOL_IF = 56,                        /* IF  */
+  YYSYMBOL_ELSE = 57,                      /* ELSE  */
+  YYSYMBOL_SWITCH = 58,                    /* SWITCH  */
+  YYSYMBOL_WHILE = 59,                     /* WHILE  */
+  YYSYMBOL_DO = 60,                        /* DO  */
+  YYSYMBOL_FOR = 61,                       /* FOR  */
+  YYSYMBOL_GOTO = 62,                      /* GOTO  */
+  YYSYMBOL_CONTINUE = 63,                  /* CONTINUE  */
+  YYSYMBOL_BREAK = 64,                     /* BREAK  */
+  YYSYMBOL_RETURN = 65,                    /* RETURN  */
+  YYSYMBOL_66_ = 66,                       /* '('  */
+  YYSYMBOL_67_ = 67,                       /* ')'  */
+  YYSYMBOL_68_ = 68,                       /* '['  */
+  YYSYMBOL_69_ = 69,                       /* ']'  */
+  YYSYMBOL_70_ = 70,                       /* '.'  */
+  YYSYMBOL_71_ = 71,                       /* ','  */
+  YYSYMBOL_72_ = 72,                       /* '&'  */
+  YYSYMBOL_73_ = 73,                       /* '*'  */
+  YYSYMBOL_74_ = 74,                       /* '+'  */
+  YYSYMBOL_75_ = 75,                       /* '-'  */
+  YYSYMBOL_76_ = 76,                       /* '~'  */
+  YYSYMBOL_77_ = 77,                       /* '!'  */
+  YYSYMBOL_78_ = 78,                       /* '/'  */
+  YYSYMBOL_79_ = 79,                       /* '%'  */
+  YYSYMBOL_80_ = 80,                       /* '<'  */
+  YYSYMBOL_81_ = 81,                       /* '>'  */
+  YYSYMBOL_82_ = 82,                       /* '^'  */
+  YYSYMBOL_83_ = 83,                       /* '|'  */
+  YYSYMBOL_84_ = 84,                       /* '?'  */
+  YYSYMBOL_85_ = 85,                       /* ':'  */
+  YYSYMBOL_86_ = 86,                       /* '='  */
+  YYSYMBOL_87_ = 87,                       /* ';'  */
+  YYSYMBOL_88_ = 88,                       /* '{'  */
+  YYSYMBOL_89_ = 89,                       /* '}'  */
+  YYSYMBOL_YYACCEPT = 90,                  /* $accept  */
+  YYSYMBOL_primary_expression = 91,        /* primary_expression  */
+  YYSYMBOL_postfix_expression = 92,        /* postfix_expression  */
+  YYSYMBOL_argument_expression_list = 93,  /* argument_expression_list  */
+  YYSYMBOL_unary_expression = 94,          /* unary_expression  */
+  YYSYMBOL_unary_operator = 95,            /* unary_operator  */
+  YYSYMBOL_cast_expression = 96,           /* cast_expression  */
+  YYSYMBOL_multiplicative_expression = 97, /* multiplicative_expression  */
+  YYSYMBOL_additive_expression = 98,       /* additive_expression  */
+  YYSYMBOL_shift_expression = 99,          /* shift_expression  */
+  YYSYMBOL_relational_expression = 100,    /* relational_expression  */
+  YYSYMBOL_equality_expression = 101,      /* equality_expression  */
+  YYSYMBOL_and_expression = 102,           /* and_expression  */
+  YYSYMBOL_exclusive_or_expression = 103,  /* exclusive_or_expression  */
+  YYSYMBOL_inclusive_or_expression = 104,  /* inclusive_or_expression  */
+  YYSYMBOL_logical_and_expression = 105,   /* logical_and_expression  */
+  YYSYMBOL_logical_or_expression = 106,    /* logical_or_expression  */
+  YYSYMBOL_conditional_expression = 107,   /* conditional_expression  */
+  YYSYMBOL_assignment_expression = 108,    /* assignment_expression  */
+  YYSYMBOL_assignment_operator = 109,      /* assignment_operator  */
+  YYSYMBOL_expression = 110,               /* expression  */
+  YYSYMBOL_constant_expression = 111,      /* constant_expression  */
+  YYSYMBOL_declaration = 112,              /* declaration  */
+  YYSYMBOL_declaration_specifiers = 113,   /* declaration_specifiers  */
+  YYSYMBOL_init_declarator_list = 114,     /* init_declarator_list  */
+  YYSYMBOL_init_declarator = 115,          /* init_declarator  */
+  YYSYMBOL_storage_class_specifier = 116,  /* storage_class_specifier  */
+  YYSYMBOL_type_specifier = 117,           /* type_specifier  */
+  YYSYMBOL_struct_or_union_specifier = 118, /* struct_or_union_specifier  */
+  YYSYMBOL_struct_or_union = 119,          /* struct_or_union  */
+  YYSYMBOL_struct_declaration_list = 120,  /* struct_declaration_list  */
+  YYSYMBOL_struct_declaration = 121,       /* struct_declaration  */
+  YYSYMBOL_specifier_qualifier_list = 122, /* specifier_qualifier_list  */
+  YYSYMBOL_struct_declarator_list = 123,   /* struct_declarator_list  */
+  YYSYMBOL_struct_declarator = 124,        /* struct_declarator  */
+  YYSYMBOL_enum_specifier = 125,           /* enum_specifier  */
+  YYSYMBOL_126_1 = 126,                    /* $@1  */
+  YYSYMBOL_127_2 = 127,                    /* $@2  */
+  YYSYMBOL_128_3 = 128,                    /* $@3  */
+  YYSYMBOL_enumerator_list = 129,          /* enumerator_list  */
+  YYSYMBOL_enumerator = 130,               /* enumerator  */
+  YYSYMBOL_type_qualifier = 131,           /* type_qualifier  */
+  YYSYMBOL_declarator = 132,               /* declarator  */
+  YYSYMBOL_direct_declarator = 133,        /* direct_declarator  */
+  YYSYMBOL_pointer = 134,                  /* pointer  */
+  YYSYMBOL_type_qualifier_list = 135,      /* type_qualifier_list  */
+  YYSYMBOL_parameter_type_list = 136,      /* parameter_type_list  */
+  YYSYMBOL_parameter_list = 137,           /* parameter_list  */
+  YYSYMBOL_parameter_declaration = 138,    /* parameter_declaration  */
+  YYSYMBOL_identifier_list = 139,          /* identifier_list  */
+  YYSYMBOL_type_name = 140,                /* type_name  */
+  YYSYMBOL_abstract_declarator = 141,      /* abstract_declarator  */
+  YYSYMBOL_direct_abstract_declarator = 142, /* direct_abstract_declarator  */
+  YYSYMBOL_initializer = 143,              /* initializer  */
+  YYSYMBOL_initializer_list = 144,         /* initializer_list  */
+  YYSYMBOL_statement = 145,                /* statement  */
+  YYSYMBOL_labeled_statement = 146,        /* labeled_statement  */
+  YYSYMBOL_compound_statement = 147,       /* compound_statement  */
+  YYSYMBOL_block_item_list = 148,          /* block_item_list  */
+  YYSYMBOL_block_item = 149,               /* block_item  */
+  YYSYMBOL_declaration_list = 150,         /* declaration_list  */
+  YYSYMBOL_expression_statement = 151,     /* expression_statement  */
+  YYSYMBOL_selection_statement = 152,      /* selection_statement  */
+  YYSYMBOL_iteration_statement = 153,      /* iteration_statement  */
+  YYSYMBOL_jump_statement = 154,           /* jump_statement  */
+  YYSYMBOL_translation_unit = 155,         /* translation_unit  */
+  YYSYMBOL_external_declaration = 156,     /* external_declaration  */
+  YYSYMBOL_function_definition = 157,      /* function_definition  */
+  YYSYMBOL_158_4 = 158                     /* $@4  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  69
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1477
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  90
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  69
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  230
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  376
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   320
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    77,     2,     2,     2,    79,    72,     2,
+      66,    67,    73,    74,    71,    75,    70,    78,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    85,    87,
+      80,    86,    81,    84,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    68,     2,    69,    82,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    88,    83,    89,    76,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,    91,    91,    93,    95,    97,   102,   104,   110,   112,
+     114,   121,   128,   130,   135,   137,   148,   150,   152,   154,
+     156,   160,   168,   169,   170,   171,   172,   173,   177,   179,
+     188,   190,   192,   194,   199,   201,   203,   208,   210,   212,
+     217,   219,   221,   223,   225,   230,   232,   234,   239,   241,
+     246,   248,   253,   255,   260,   262,   267,   269,   274,   276,
+     286,   288,   293,   294,   295,   296,   297,   298,   299,   300,
+     301,   302,   303,   307,   309,   314,   319,   321,   384,   386,
+     395,   397,   435,   437,   451,   453,   463,   481,   497,   498,
+     499,   500,   501,   505,   506,   507,   508,   509,   510,   511,
+     512,   513,   514,   515,   516,   517,   539,   557,   575,   588,
+     601,   616,   617,   621,   623,   637,   669,   675,   677,   683,
+     688,   690,   695,   697,   699,   704,   704,   706,   706,   712,
+     712,   718,   729,   743,   745,   747,   752,   761,   775,   776,
+     777,   778,   779,   780,   784,   789,   796,   802,   804,   806,
+     808,   821,   828,   846,   852,   861,   863,   865,   867,   872,
+     874,   879,   884,   892,   894,   904,   923,   925,   930,   932,
+     942,   944,   956,   961,   963,   971,   973,   978,   982,   984,
+     986,   990,   995,   997,  1005,  1007,  1016,  1028,  1030,  1040,
+    1041,  1042,  1043,  1044,  1045,  1049,  1054,  1060,  1069,  1071,
+    1076,  1078,  1092,  1094,  1099,  1101,  1117,  1122,  1130,  1132,
+    1134,  1143,  1145,  1151,  1153,  1155,  1164,  1176,  1181,  1183,
+    1185,  1187,  1192,  1197,  1215,  1217,  1222,  1231,  1230,  1261,
+    1269
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IDENTIFIER",
+  "CONSTANT", "STRING_LITERAL", "SIZEOF", "TYPE_NAME", "PTR_OP", "INC_OP",
+  "DEC_OP", "LEFT_OP", "RIGHT_OP", "LE_OP", "GE_OP", "EQ_OP", "NE_OP",
+  "AND_OP", "OR_OP", "MUL_ASSIGN", "DIV_ASSIGN", "MOD_ASSIGN",
+  "ADD_ASSIGN", "SUB_ASSIGN", "LEFT_ASSIGN", "RIGHT_ASSIGN", "AND_ASSIGN",
+  "XOR_ASSIGN", "OR_ASSIGN", "TYPEDEF", "EXTERN", "STATIC", "AUTO",
+  "REGISTER", "CHAR", "SHORT", "INT", "LONG", "SIGNED", "UNSIGNED",
+  "FLOAT", "DOUBLE", "CONST", "VOLATILE", "VOID", "STRUCT", "UNION",
+  "ENUM", "ELLIPSIS", "BOOL", "NONNULL", "NULLABLE", "UNUSED",
+  "DEPRECATED", "CASE", "DEFAULT", "IF", "ELSE", "SWITCH", "WHILE", "DO",
+  "FOR", "GOTO", "CONTINUE", "BREAK", "RETURN", "'('", "')'", "'['", "']'",
+  "'.'", "','", "'&'", "'*'", "'+'", "'-'", "'~'", "'!'", "'/'", "'%'",
+  "'<'", "'>'", "'^'", "'|'", "'?'", "':'", "'='", "';'", "'{'", "'}'",
+  "$accept", "primary_expression", "postfix_expression",
+  "argument_expression_list", "unary_expression", "unary_operator",
+  "cast_expression", "multiplicative_expression", "additive_expression",
+  "shift_expression", "relational_expression", "equality_expression",
+  "and_expression", "exclusive_or_expression", "inclusive_or_expression",
+  "logical_and_expression", "logical_or_expression",
+  "conditional_expression", "assignment_expression", "assignment_operator",
+  "expression", "constant_expression", "declaration",
+  "declaration_specifiers", "init_declarator_list", "init_declarator",
+  "storage_class_specifier", "type_specifier", "struct_or_union_specifier",
+  "struct_or_union", "struct_declaration_list", "struct_declaration",
+  "specifier_qualifier_list", "struct_declarator_list",
+  "struct_declarator", "enum_specifier", "$@1", "$@2", "$@3",
+  "enumerator_list", "enumerator", "type_qualifier", "declarator",
+  "direct_declarator", "pointer", "type_qualifier_list",
+  "parameter_type_list", "parameter_list", "parameter_declaration",
+  "identifier_list", "type_name", "abstract_declarator",
+  "direct_abstract_declarator", "initializer", "initializer_list",
+  "statement", "labeled_statement", "compound_statement",
+  "block_item_list", "block_item", "declaration_list",
+  "expression_statement", "selection_statement", "iteration_statement",
+  "jump_statement", "translation_unit", "external_declaration",
+  "function_definition", "$@4", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-221)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-228)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    1197,  -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,
+    -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,
+    -221,     9,  -221,  -221,  -221,  -221,  -221,    75,   222,  -221,
+       4,  1424,  1424,  -221,    17,  -221,  1424,   809,   -18,    22,
+    1146,  -221,  -221,   -54,   -51,  -221,    70,   -40,  -221,  -221,
+     222,  -221,    11,  -221,   749,  -221,  -221,   -12,    -7,  1398,
+    -221,   298,  -221,     4,  -221,   809,  1295,   738,   -18,  -221,
+    -221,  -221,  -221,   101,  -221,    32,  -221,  -221,  -221,    93,
+    -221,   466,   809,    54,  1398,  1398,  1398,   646,  -221,    27,
+    1398,   110,  -221,  -221,  1046,  1058,  1058,  1097,   112,    79,
+      89,   155,   449,   164,   204,   154,   156,   557,   920,  -221,
+    -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,    43,   463,
+    1097,  -221,   141,   114,   239,    41,    44,   191,   184,   195,
+     221,     1,  -221,  -221,    19,  -221,  -221,  -221,  -221,   373,
+    -221,  -221,  -221,  -221,  -221,   194,  -221,  -221,  -221,  -221,
+     144,   219,   223,  -221,    60,  -221,  -221,  -221,  -221,   224,
+     101,   101,   210,   -67,  -221,  -221,  -221,   466,  -221,  -221,
+    -221,  -221,   666,   687,  -221,  -221,  -221,  1097,    36,  -221,
+     212,  -221,   449,   920,  -221,  1097,  -221,  -221,   225,   449,
+    1097,  1097,  1097,   247,   541,   230,  -221,  -221,  -221,    48,
+      83,    90,   242,   315,  -221,  -221,   754,  1097,   317,  -221,
+    -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,  -221,
+    1097,  -221,  1097,  1097,  1097,  1097,  1097,  1097,  1097,  1097,
+    1097,  1097,  1097,  1097,  1097,  1097,  1097,  1097,  1097,  1097,
+    1097,  1097,  -221,  -221,  -221,   869,   935,  -221,    18,  -221,
+      66,  -221,  1377,  -221,   318,  -221,   -15,   -10,  1097,   101,
+    -221,  -221,    -6,  -221,  -221,  -221,    27,  -221,  1097,  -221,
+     256,   449,  -221,   129,   151,   160,   258,   592,   592,  -221,
+    -221,  -221,  1244,    94,  -221,  1097,  -221,  -221,   166,  -221,
+      96,  -221,  -221,  -221,  -221,  -221,   141,   141,   114,   114,
+     239,   239,   239,   239,    41,    41,    44,   191,   184,   195,
+     221,   -36,  -221,  -221,   259,   279,  -221,   286,    66,  1336,
+     971,  -221,  -221,  -221,  -221,  -221,  -221,  -221,   391,  -221,
+    -221,  -221,  -221,  -221,   449,   449,   449,  1097,  1010,  1022,
+    -221,  -221,  1097,  -221,  1097,  -221,  -221,  -221,  -221,   299,
+    -221,   296,  -221,  -221,   268,  -221,  -221,   168,   449,   173,
+     449,   175,  -221,  -221,  -221,  -221,   449,   280,  -221,   449,
+    -221,   449,  -221,  -221,  -221,  -221
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       0,   146,   105,    88,    89,    90,    91,    92,    95,    96,
+      97,    98,   101,   102,    99,   100,   138,   139,    93,   111,
+     112,     0,    94,   140,   141,   142,   143,     0,   155,   225,
+       0,    78,    80,   103,     0,   104,    82,     0,   145,     0,
+       0,   222,   224,   131,   132,   125,     0,     0,   159,   157,
+     156,    76,     0,    84,    86,    79,    81,   109,   110,     0,
+      83,     0,   204,     0,   230,     0,     0,     0,   144,     1,
+     223,   127,   129,     0,   149,     0,   147,   160,   158,     0,
+      77,     0,     0,     0,     0,     0,   117,     0,   113,     0,
+     119,     2,     3,     4,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    22,
+      23,    24,    25,    26,    27,   206,   198,     6,    16,    28,
+       0,    30,    34,    37,    40,    45,    48,    50,    52,    54,
+      56,    58,    60,    73,     0,   202,   203,   189,   190,     0,
+     200,   191,   192,   193,   194,    86,   205,   229,   168,   154,
+     167,     0,   161,   163,     0,     2,   151,    28,    75,     0,
+       0,     0,   136,     0,   133,   148,    85,     0,   184,    87,
+     226,   228,     0,     0,   116,   108,   114,     0,     0,   120,
+     122,   118,     0,     0,    21,     0,    17,    18,     0,     0,
+       0,     0,     0,     0,     0,     0,   218,   219,   220,     0,
+       0,   170,     0,     0,    12,    13,     0,     0,     0,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    62,
+       0,    19,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   207,   199,   201,     0,     0,   165,   172,   166,
+     173,   152,     0,   153,     0,   150,     0,     0,     0,   135,
+     126,   187,     0,   106,   107,   123,     0,   115,     0,   195,
+       0,     0,   197,     0,     0,     0,     0,     0,     0,   217,
+     221,     5,     0,   172,   171,     0,    11,     8,     0,    14,
+       0,    10,    61,    31,    32,    33,    35,    36,    38,    39,
+      43,    44,    41,    42,    46,    47,    49,    51,    53,    55,
+      57,     0,    74,   180,     0,     0,   176,     0,   174,     0,
+       0,   162,   164,   169,   128,   130,   137,   134,     0,   185,
+     121,   124,    20,   196,     0,     0,     0,     0,     0,     0,
+      29,     9,     0,     7,     0,   181,   175,   177,   182,     0,
+     178,     0,   186,   188,   208,   210,   211,     0,     0,     0,
+       0,     0,    15,    59,   183,   179,     0,     0,   215,     0,
+     213,     0,   209,   212,   216,   214
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -221,  -221,  -221,  -221,   -53,  -221,   -94,    34,    42,    84,
+      50,   133,   145,   132,   146,   149,  -221,   -59,   -80,  -221,
+     -39,   -52,    10,     0,  -221,   310,  -221,   139,  -221,  -221,
+     192,   -78,   -75,  -221,   124,  -221,  -221,  -221,  -221,   128,
+     134,    30,   -17,   -37,   -11,  -221,   -61,  -221,   140,  -221,
+     208,  -144,  -220,  -164,  -221,   -79,  -221,   171,  -221,   260,
+     344,  -176,  -221,  -221,  -221,  -221,   381,  -221,  -221
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,   117,   118,   288,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   220,
+     134,   159,    29,    63,    52,    53,    31,    32,    33,    34,
+      87,    88,    89,   178,   179,    35,    73,   160,   161,   163,
+     164,    36,    37,    38,    39,    50,   314,   152,   153,   154,
+     202,   315,   250,   169,   262,   136,   137,   138,   139,   140,
+      65,   141,   142,   143,   144,    40,    41,    42,    83
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      30,   168,    68,   261,   259,   151,   249,     1,   158,   176,
+      47,   174,    43,    54,   157,   181,    44,    49,   278,   239,
+      57,     1,   260,   193,    58,     1,   221,    76,   318,    75,
+       1,    55,    56,   201,    71,   241,    60,    72,   158,    78,
+      30,   184,   186,   187,   157,   188,   145,    62,    66,   344,
+      67,   203,   204,   205,   229,   230,   259,   284,    48,   233,
+     234,   259,   145,   318,    62,   328,   150,   157,   199,   200,
+      27,   135,   180,     1,   324,   146,    84,    28,     1,   325,
+      77,    85,    79,   329,   245,   240,   246,   168,    27,    90,
+     241,    51,   146,    27,   176,   176,     1,    45,    80,   165,
+      28,   338,   339,   269,   162,    59,   242,   266,   201,   206,
+     272,   207,   177,   208,    90,    90,    90,    90,   158,   241,
+      90,   231,   232,   267,   157,   265,   289,   253,   293,   294,
+     295,   254,   319,   247,   320,   280,    27,    74,    90,   248,
+     292,    27,    61,    28,   200,   190,   200,     1,    28,   135,
+     281,   273,   274,   275,   241,   191,   282,    46,   246,    27,
+     282,   312,   246,    28,   353,   343,    28,   241,   290,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   158,   225,   226,
+     283,   340,   333,   157,   317,   182,   334,   189,    86,   158,
+     241,   311,    90,    90,   277,   157,   326,   195,    64,   158,
+     245,    68,   246,    90,   222,   157,   331,    28,   335,   223,
+     224,   192,   241,    86,    86,    86,    86,   336,    47,    86,
+     194,   241,   157,   341,   248,   367,   147,   342,   238,   241,
+     369,   196,   371,   197,   241,   150,   241,    86,   168,   180,
+     227,   228,   150,   170,   171,   354,   355,   356,   349,   296,
+     297,   158,   362,   235,    16,    17,   236,   157,   351,   298,
+     299,   283,    23,    24,    25,    26,   172,   173,   237,   368,
+      81,   370,   150,   304,   305,   363,   251,   372,   256,   257,
+     374,   157,   375,   255,   252,    28,   258,   268,   357,   359,
+     361,    91,    92,    93,    94,     2,   276,    95,    96,   285,
+     271,    86,    86,   300,   301,   302,   303,   279,   286,   150,
+     291,   323,    86,   332,   337,   366,   345,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,   346,    22,    23,    24,
+      25,    26,    97,    98,    99,   347,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   365,   364,   373,   306,   308,
+     109,   110,   111,   112,   113,   114,    91,    92,    93,    94,
+       2,   307,    95,    96,   309,   115,    61,   116,   310,   166,
+     330,   270,   322,   327,   155,    92,    93,    94,    82,   244,
+      95,    96,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    70,    22,    23,    24,    25,    26,    97,    98,    99,
+       0,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+       0,     0,     0,     0,     0,   109,   110,   111,   112,   113,
+     114,     0,    91,    92,    93,    94,     0,   108,    95,    96,
+     115,    61,   243,   109,   110,   111,   112,   113,   114,   155,
+      92,    93,    94,     0,     0,    95,    96,     0,     0,   167,
+     352,     0,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    97,    98,    99,     0,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,     0,     0,     0,     0,
+       0,   109,   110,   111,   112,   113,   114,     0,     0,     0,
+       0,     0,   108,     0,     0,     0,   115,    61,   109,   110,
+     111,   112,   113,   114,   155,    92,    93,    94,     2,   219,
+      95,    96,     0,     0,   167,     0,     0,     0,     0,     0,
+     155,    92,    93,    94,     0,     0,    95,    96,     0,     0,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,     0,
+      22,    23,    24,    25,    26,   155,    92,    93,    94,     0,
+       0,    95,    96,     0,     0,     0,     0,   108,     0,     0,
+       0,     0,     0,   109,   110,   111,   112,   113,   114,     0,
+       0,     0,     0,   108,     0,     0,     0,     0,   115,   109,
+     110,   111,   112,   113,   114,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   198,     0,     0,     0,     0,     0,
+       0,     0,     0,     2,     0,     0,     0,     0,   108,     0,
+       0,     0,     0,     0,   109,   110,   111,   112,   113,   114,
+       0,     0,     0,     2,     0,     0,     0,     0,     0,   115,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,     2,    22,    23,    24,    25,    26,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,     0,    22,    23,    24,    25,    26,
+       0,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,   175,    22,    23,    24,    25,
+      26,   155,    92,    93,    94,     0,     0,    95,    96,     0,
+       0,     0,     0,     0,     0,   263,     2,   155,    92,    93,
+      94,     0,     0,    95,    96,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   264,     0,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,     0,    22,    23,
+      24,    25,    26,     0,   108,     0,     0,   156,     0,     0,
+     109,   110,   111,   112,   113,   114,     2,     0,     0,     0,
+     108,   287,     0,     0,     0,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,     0,    81,     0,  -227,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,     0,    22,    23,
+      24,    25,    26,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     1,     0,     0,     0,     2,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    61,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,     0,    22,    23,
+      24,    25,    26,   155,    92,    93,    94,     2,     0,    95,
+      96,     0,     0,     0,     0,   245,   313,   246,   155,    92,
+      93,    94,    28,     0,    95,    96,     0,     0,     0,     0,
+       0,    46,     0,     0,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,     0,    22,
+      23,    24,    25,    26,   155,    92,    93,    94,     0,     0,
+      95,    96,     0,     0,     0,     0,   108,     0,     0,     0,
+       0,     0,   109,   110,   111,   112,   113,   114,     0,     0,
+       0,   108,     0,     0,   316,     0,     0,   109,   110,   111,
+     112,   113,   114,   155,    92,    93,    94,     0,     0,    95,
+      96,     0,     0,     0,     0,   155,    92,    93,    94,     0,
+       0,    95,    96,     0,     0,     0,     0,   108,     0,     0,
+     350,     0,     0,   109,   110,   111,   112,   113,   114,   155,
+      92,    93,    94,     0,     0,    95,    96,     0,     0,     0,
+       0,   155,    92,    93,    94,     0,     0,    95,    96,     0,
+       0,     0,     0,     0,     0,     0,   108,   358,     0,     0,
+       0,     0,   109,   110,   111,   112,   113,   114,   108,   360,
+       0,     0,     0,     0,   109,   110,   111,   112,   113,   114,
+     155,    92,    93,    94,     0,     0,    95,    96,     0,     0,
+       0,     0,   183,     0,     0,     0,     0,     0,   109,   110,
+     111,   112,   113,   114,   185,     0,     0,     0,     0,     0,
+     109,   110,   111,   112,   113,   114,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,     1,
+       0,     0,     0,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   108,     0,     0,     0,     0,     0,   109,
+     110,   111,   112,   113,   114,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,     0,    22,    23,    24,    25,    26,
+       1,     0,     0,     0,     2,     0,     0,     0,     0,     0,
+       0,     0,    27,     0,     0,     0,     0,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,     0,    22,    23,    24,    25,
+      26,     2,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    27,     0,     0,     0,     0,     0,     0,
+      28,     0,     0,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,     0,    22,    23,    24,    25,    26,   148,     0,
+       0,     0,     2,     0,     0,     0,     0,     0,     0,     0,
+     282,   313,   246,     0,     0,     0,     0,    28,     0,     0,
+       0,     0,     0,     0,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,     2,    22,    23,    24,    25,    26,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   149,     0,     0,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,     2,    22,    23,    24,    25,    26,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   348,     0,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,   321,    22,    23,    24,    25,
+      26,     2,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,     0,    22,    23,    24,
+      25,    26,     0,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,     0,    22,    23,    24,    25,    26
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,    81,    39,   167,    71,    66,   150,     3,    67,    87,
+      27,    86,     3,    30,    67,    90,     7,    28,   194,    18,
+       3,     3,    89,   102,     7,     3,   120,    67,   248,    46,
+       3,    31,    32,   108,    88,    71,    36,    88,    97,    50,
+      40,    94,    95,    96,    97,    97,    63,    37,    66,    85,
+      68,     8,     9,    10,    13,    14,    71,   201,    28,    15,
+      16,    71,    79,   283,    54,    71,    66,   120,   107,   108,
+      66,    61,    89,     3,    89,    65,    88,    73,     3,    89,
+      50,    88,    71,    89,    66,    84,    68,   167,    66,    59,
+      71,    87,    82,    66,   172,   173,     3,    88,    87,    67,
+      73,   277,   278,   182,     3,    88,    87,    71,   183,    66,
+     189,    68,    85,    70,    84,    85,    86,    87,   177,    71,
+      90,    80,    81,    87,   177,   177,   206,    67,   222,   223,
+     224,    71,    66,   150,    68,    87,    66,    67,   108,   150,
+     220,    66,    88,    73,   183,    66,   185,     3,    73,   139,
+      67,   190,   191,   192,    71,    66,    66,    82,    68,    66,
+      66,   241,    68,    73,   328,    69,    73,    71,   207,   222,
+     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   246,    74,    75,
+     201,   285,   271,   246,   246,    85,    67,    85,    59,   258,
+      71,   240,   172,   173,   194,   258,   258,     3,    37,   268,
+      66,   248,    68,   183,    73,   268,   268,    73,    67,    78,
+      79,    66,    71,    84,    85,    86,    87,    67,   245,    90,
+      66,    71,   285,    67,   245,    67,    65,    71,    17,    71,
+      67,    87,    67,    87,    71,   245,    71,   108,   328,   266,
+      11,    12,   252,    82,    83,   334,   335,   336,   319,   225,
+     226,   320,   342,    72,    42,    43,    82,   320,   320,   227,
+     228,   282,    50,    51,    52,    53,    84,    85,    83,   358,
+      86,   360,   282,   233,   234,   344,    67,   366,   160,   161,
+     369,   344,   371,    69,    71,    73,    86,    85,   337,   338,
+     339,     3,     4,     5,     6,     7,    59,     9,    10,    67,
+      85,   172,   173,   229,   230,   231,   232,    87,     3,   319,
+       3,     3,   183,    67,    66,    57,    67,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    67,    49,    50,    51,
+      52,    53,    54,    55,    56,    69,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    69,    67,    87,   235,   237,
+      72,    73,    74,    75,    76,    77,     3,     4,     5,     6,
+       7,   236,     9,    10,   238,    87,    88,    89,   239,    79,
+     266,   183,   252,   259,     3,     4,     5,     6,    54,   139,
+       9,    10,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    40,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      -1,    -1,    -1,    -1,    -1,    72,    73,    74,    75,    76,
+      77,    -1,     3,     4,     5,     6,    -1,    66,     9,    10,
+      87,    88,    89,    72,    73,    74,    75,    76,    77,     3,
+       4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,    88,
+      89,    -1,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    54,    55,    56,    -1,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    -1,    -1,    -1,    -1,
+      -1,    72,    73,    74,    75,    76,    77,    -1,    -1,    -1,
+      -1,    -1,    66,    -1,    -1,    -1,    87,    88,    72,    73,
+      74,    75,    76,    77,     3,     4,     5,     6,     7,    86,
+       9,    10,    -1,    -1,    88,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    -1,
+      49,    50,    51,    52,    53,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    -1,    -1,    -1,    -1,    66,    -1,    -1,
+      -1,    -1,    -1,    72,    73,    74,    75,    76,    77,    -1,
+      -1,    -1,    -1,    66,    -1,    -1,    -1,    -1,    87,    72,
+      73,    74,    75,    76,    77,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    66,    -1,
+      -1,    -1,    -1,    -1,    72,    73,    74,    75,    76,    77,
+      -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    87,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,     7,    49,    50,    51,    52,    53,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    -1,    49,    50,    51,    52,    53,
+      -1,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    89,    49,    50,    51,    52,
+      53,     3,     4,     5,     6,    -1,    -1,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,    89,     7,     3,     4,     5,
+       6,    -1,    -1,     9,    10,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    -1,    49,    50,
+      51,    52,    53,    -1,    66,    -1,    -1,    69,    -1,    -1,
+      72,    73,    74,    75,    76,    77,     7,    -1,    -1,    -1,
+      66,    67,    -1,    -1,    -1,    -1,    72,    73,    74,    75,
+      76,    77,    -1,    -1,    -1,    86,    -1,    88,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    -1,    49,    50,
+      51,    52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,    -1,    -1,    -1,     7,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    88,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    -1,    49,    50,
+      51,    52,    53,     3,     4,     5,     6,     7,    -1,     9,
+      10,    -1,    -1,    -1,    -1,    66,    67,    68,     3,     4,
+       5,     6,    73,    -1,     9,    10,    -1,    -1,    -1,    -1,
+      -1,    82,    -1,    -1,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    -1,    49,
+      50,    51,    52,    53,     3,     4,     5,     6,    -1,    -1,
+       9,    10,    -1,    -1,    -1,    -1,    66,    -1,    -1,    -1,
+      -1,    -1,    72,    73,    74,    75,    76,    77,    -1,    -1,
+      -1,    66,    -1,    -1,    69,    -1,    -1,    72,    73,    74,
+      75,    76,    77,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    -1,    -1,    -1,    -1,    66,    -1,    -1,
+      69,    -1,    -1,    72,    73,    74,    75,    76,    77,     3,
+       4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,    -1,
+      -1,     3,     4,     5,     6,    -1,    -1,     9,    10,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    66,    67,    -1,    -1,
+      -1,    -1,    72,    73,    74,    75,    76,    77,    66,    67,
+      -1,    -1,    -1,    -1,    72,    73,    74,    75,    76,    77,
+       3,     4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,
+      -1,    -1,    66,    -1,    -1,    -1,    -1,    -1,    72,    73,
+      74,    75,    76,    77,    66,    -1,    -1,    -1,    -1,    -1,
+      72,    73,    74,    75,    76,    77,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     0,    -1,    -1,     3,
+      -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    66,    -1,    -1,    -1,    -1,    -1,    72,
+      73,    74,    75,    76,    77,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    -1,    49,    50,    51,    52,    53,
+       3,    -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    66,    -1,    -1,    -1,    -1,    -1,    -1,    73,
+      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    -1,    49,    50,    51,    52,
+      53,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    66,    -1,    -1,    -1,    -1,    -1,    -1,
+      73,    -1,    -1,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    -1,    49,    50,    51,    52,    53,     3,    -1,
+      -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      66,    67,    68,    -1,    -1,    -1,    -1,    73,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,     7,    49,    50,    51,    52,    53,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    67,    -1,    -1,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,     7,    49,    50,    51,    52,    53,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    67,    -1,     7,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,     7,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    -1,    49,    50,    51,
+      52,    53,    -1,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    -1,    49,    50,    51,    52,    53
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,     3,     7,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    49,    50,    51,    52,    53,    66,    73,   112,
+     113,   116,   117,   118,   119,   125,   131,   132,   133,   134,
+     155,   156,   157,     3,     7,    88,    82,   132,   131,   134,
+     135,    87,   114,   115,   132,   113,   113,     3,     7,    88,
+     113,    88,   112,   113,   147,   150,    66,    68,   133,     0,
+     156,    88,    88,   126,    67,   132,    67,   131,   134,    71,
+      87,    86,   150,   158,    88,    88,   117,   120,   121,   122,
+     131,     3,     4,     5,     6,     9,    10,    54,    55,    56,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    72,
+      73,    74,    75,    76,    77,    87,    89,    91,    92,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   110,   112,   145,   146,   147,   148,
+     149,   151,   152,   153,   154,   132,   112,   147,     3,    67,
+     113,   136,   137,   138,   139,     3,    69,    94,   107,   111,
+     127,   128,     3,   129,   130,    67,   115,    88,   108,   143,
+     147,   147,   120,   120,   122,    89,   121,    85,   123,   124,
+     132,   122,    85,    66,    94,    66,    94,    94,   111,    85,
+      66,    66,    66,   145,    66,     3,    87,    87,    87,   110,
+     110,   122,   140,     8,     9,    10,    66,    68,    70,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    86,
+     109,    96,    73,    78,    79,    74,    75,    11,    12,    13,
+      14,    80,    81,    15,    16,    72,    82,    83,    17,    18,
+      84,    71,    87,    89,   149,    66,    68,   132,   134,   141,
+     142,    67,    71,    67,    71,    69,   129,   129,    86,    71,
+      89,   143,   144,    89,    89,   111,    71,    87,    85,   145,
+     140,    85,   145,   110,   110,   110,    59,   112,   151,    87,
+      87,    67,    66,   134,   141,    67,     3,    67,    93,   108,
+     110,     3,   108,    96,    96,    96,    97,    97,    98,    98,
+      99,    99,    99,    99,   100,   100,   101,   102,   103,   104,
+     105,   110,   108,    67,   136,   141,    69,   111,   142,    66,
+      68,    48,   138,     3,    89,    89,   111,   130,    71,    89,
+     124,   111,    67,   145,    67,    67,    67,    66,   151,   151,
+      96,    67,    71,    69,    85,    67,    67,    69,    67,   136,
+      69,   111,    89,   143,   145,   145,   145,   110,    67,   110,
+      67,   110,   108,   107,    67,    69,    57,    67,   145,    67,
+     145,    67,   145,    87,   145,   145
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    90,    91,    91,    91,    91,    92,    92,    92,    92,
+      92,    92,    92,    92,    93,    93,    94,    94,    94,    94,
+      94,    94,    95,    95,    95,    95,    95,    95,    96,    96,
+      97,    97,    97,    97,    98,    98,    98,    99,    99,    99,
+     100,   100,   100,   100,   100,   101,   101,   101,   102,   102,
+     103,   103,   104,   104,   105,   105,   106,   106,   107,   107,
+     108,   108,   109,   109,   109,   109,   109,   109,   109,   109,
+     109,   109,   109,   110,   110,   111,   112,   112,   113,   113,
+     113,   113,   113,   113,   114,   114,   115,   115,   116,   116,
+     116,   116,   116,   117,   117,   117,   117,   117,   117,   117,
+     117,   117,   117,   117,   117,   117,   118,   118,   118,   118,
+     118,   119,   119,   120,   120,   121,   122,   122,   122,   122,
+     123,   123,   124,   124,   124,   126,   125,   127,   125,   128,
+     125,   125,   125,   129,   129,   129,   130,   130,   131,   131,
+     131,   131,   131,   131,   132,   132,   133,   133,   133,   133,
+     133,   133,   133,   133,   133,   134,   134,   134,   134,   135,
+     135,   136,   136,   137,   137,   138,   138,   138,   139,   139,
+     140,   140,   141,   141,   141,   142,   142,   142,   142,   142,
+     142,   142,   142,   142,   143,   143,   143,   144,   144,   145,
+     145,   145,   145,   145,   145,   146,   146,   146,   147,   147,
+     148,   148,   149,   149,   150,   150,   151,   151,   152,   152,
+     152,   153,   153,   153,   153,   153,   153,   154,   154,   154,
+     154,   154,   155,   155,   156,   156,   157,   158,   157,   157,
+     157
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     3,     1,     4,     3,     4,
+       3,     3,     2,     2,     1,     3,     1,     2,     2,     2,
+       4,     2,     1,     1,     1,     1,     1,     1,     1,     4,
+       1,     3,     3,     3,     1,     3,     3,     1,     3,     3,
+       1,     3,     3,     3,     3,     1,     3,     3,     1,     3,
+       1,     3,     1,     3,     1,     3,     1,     3,     1,     5,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     2,     3,     1,     2,
+       1,     2,     1,     2,     1,     3,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     5,     5,     4,     2,
+       2,     1,     1,     1,     2,     3,     2,     1,     2,     1,
+       1,     3,     1,     2,     3,     0,     5,     0,     6,     0,
+       6,     2,     2,     1,     3,     2,     1,     3,     1,     1,
+       1,     1,     1,     1,     2,     1,     1,     3,     4,     3,
+       4,     3,     4,     4,     3,     1,     2,     2,     3,     1,
+       2,     1,     3,     1,     3,     2,     2,     1,     1,     3,
+       1,     2,     1,     1,     2,     3,     2,     3,     3,     4,
+       2,     3,     3,     4,     1,     3,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     3,     4,     3,     2,     3,
+       1,     2,     1,     1,     1,     2,     1,     2,     5,     7,
+       5,     5,     7,     6,     7,     6,     7,     3,     2,     2,
+       2,     3,     1,     2,     1,     1,     4,     0,     4,     3,
+       2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* primary_expression: IDENTIFIER  */
+#line 92 "src/grammar.y"
+                { (yyval.ast_node) = create_identifier_node((yyvsp[0].str_val)); }
+#line 1749 "build/grammar_c.tab.c"
+    break;
+
+  case 3: /* primary_expression: CONSTANT  */
+#line 94 "src/grammar.y"
+                { (yyval.ast_node) = create_constant_node(parse_constant_value((yyvsp[0].str_val)), TYPE_INT); }
+#line 1755 "build/grammar_c.tab.c"
+    break;
+
+  case 4: /* primary_expression: STRING_LITERAL  */
+#line 96 "src/grammar.y"
+                { (yyval.ast_node) = create_string_literal_node((yyvsp[0].str_val)); }
+#line 1761 "build/grammar_c.tab.c"
+    break;
+
+  case 5: /* primary_expression: '(' expression ')'  */
+#line 98 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 1767 "build/grammar_c.tab.c"
+    break;
+
+  case 6: /* postfix_expression: primary_expression  */
+#line 103 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1773 "build/grammar_c.tab.c"
+    break;
+
+  case 7: /* postfix_expression: postfix_expression '[' expression ']'  */
+#line 105 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_ARRAY_ACCESS);
+			(yyval.ast_node)->data.array_access.array = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.array_access.index = (yyvsp[-1].ast_node);
+		}
+#line 1783 "build/grammar_c.tab.c"
+    break;
+
+  case 8: /* postfix_expression: postfix_expression '(' ')'  */
+#line 111 "src/grammar.y"
+                { (yyval.ast_node) = create_function_call_node((yyvsp[-2].ast_node), NULL); }
+#line 1789 "build/grammar_c.tab.c"
+    break;
+
+  case 9: /* postfix_expression: postfix_expression '(' argument_expression_list ')'  */
+#line 113 "src/grammar.y"
+                { (yyval.ast_node) = create_function_call_node((yyvsp[-3].ast_node), (yyvsp[-1].ast_node)); }
+#line 1795 "build/grammar_c.tab.c"
+    break;
+
+  case 10: /* postfix_expression: postfix_expression '.' IDENTIFIER  */
+#line 115 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_MEMBER_ACCESS);
+			(yyval.ast_node)->data.member_access.object = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.member_access.member = (yyvsp[0].str_val);
+			(yyval.ast_node)->data.member_access.is_pointer_access = 0;
+		}
+#line 1806 "build/grammar_c.tab.c"
+    break;
+
+  case 11: /* postfix_expression: postfix_expression PTR_OP IDENTIFIER  */
+#line 122 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_MEMBER_ACCESS);
+			(yyval.ast_node)->data.member_access.object = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.member_access.member = (yyvsp[0].str_val);
+			(yyval.ast_node)->data.member_access.is_pointer_access = 1;
+		}
+#line 1817 "build/grammar_c.tab.c"
+    break;
+
+  case 12: /* postfix_expression: postfix_expression INC_OP  */
+#line 129 "src/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_POSTINC, (yyvsp[-1].ast_node)); }
+#line 1823 "build/grammar_c.tab.c"
+    break;
+
+  case 13: /* postfix_expression: postfix_expression DEC_OP  */
+#line 131 "src/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_POSTDEC, (yyvsp[-1].ast_node)); }
+#line 1829 "build/grammar_c.tab.c"
+    break;
+
+  case 14: /* argument_expression_list: assignment_expression  */
+#line 136 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1835 "build/grammar_c.tab.c"
+    break;
+
+  case 15: /* argument_expression_list: argument_expression_list ',' assignment_expression  */
+#line 138 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			/* Add to argument list */
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 1847 "build/grammar_c.tab.c"
+    break;
+
+  case 16: /* unary_expression: postfix_expression  */
+#line 149 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1853 "build/grammar_c.tab.c"
+    break;
+
+  case 17: /* unary_expression: INC_OP unary_expression  */
+#line 151 "src/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_PREINC, (yyvsp[0].ast_node)); }
+#line 1859 "build/grammar_c.tab.c"
+    break;
+
+  case 18: /* unary_expression: DEC_OP unary_expression  */
+#line 153 "src/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node(UOP_PREDEC, (yyvsp[0].ast_node)); }
+#line 1865 "build/grammar_c.tab.c"
+    break;
+
+  case 19: /* unary_expression: unary_operator cast_expression  */
+#line 155 "src/grammar.y"
+                { (yyval.ast_node) = create_unary_op_node((yyvsp[-1].unary_op), (yyvsp[0].ast_node)); }
+#line 1871 "build/grammar_c.tab.c"
+    break;
+
+  case 20: /* unary_expression: SIZEOF '(' type_name ')'  */
+#line 157 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_constant_node(get_type_size((yyvsp[-1].type_info)), TYPE_LONG);
+		}
+#line 1879 "build/grammar_c.tab.c"
+    break;
+
+  case 21: /* unary_expression: SIZEOF unary_expression  */
+#line 161 "src/grammar.y"
+                {
+			/* For now, just a basic hack for self-hosting */
+			(yyval.ast_node) = create_constant_node(4, TYPE_LONG);
+		}
+#line 1888 "build/grammar_c.tab.c"
+    break;
+
+  case 22: /* unary_operator: '&'  */
+#line 168 "src/grammar.y"
+               { (yyval.unary_op) = UOP_ADDR; }
+#line 1894 "build/grammar_c.tab.c"
+    break;
+
+  case 23: /* unary_operator: '*'  */
+#line 169 "src/grammar.y"
+               { (yyval.unary_op) = UOP_DEREF; }
+#line 1900 "build/grammar_c.tab.c"
+    break;
+
+  case 24: /* unary_operator: '+'  */
+#line 170 "src/grammar.y"
+               { (yyval.unary_op) = UOP_PLUS; }
+#line 1906 "build/grammar_c.tab.c"
+    break;
+
+  case 25: /* unary_operator: '-'  */
+#line 171 "src/grammar.y"
+               { (yyval.unary_op) = UOP_MINUS; }
+#line 1912 "build/grammar_c.tab.c"
+    break;
+
+  case 26: /* unary_operator: '~'  */
+#line 172 "src/grammar.y"
+               { (yyval.unary_op) = UOP_BITNOT; }
+#line 1918 "build/grammar_c.tab.c"
+    break;
+
+  case 27: /* unary_operator: '!'  */
+#line 173 "src/grammar.y"
+               { (yyval.unary_op) = UOP_NOT; }
+#line 1924 "build/grammar_c.tab.c"
+    break;
+
+  case 28: /* cast_expression: unary_expression  */
+#line 178 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1930 "build/grammar_c.tab.c"
+    break;
+
+  case 29: /* cast_expression: '(' type_name ')' cast_expression  */
+#line 180 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_CAST);
+			(yyval.ast_node)->data.cast_expr.target_type = (yyvsp[-2].type_info);
+			(yyval.ast_node)->data.cast_expr.operand = (yyvsp[0].ast_node);
+		}
+#line 1940 "build/grammar_c.tab.c"
+    break;
+
+  case 30: /* multiplicative_expression: cast_expression  */
+#line 189 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1946 "build/grammar_c.tab.c"
+    break;
+
+  case 31: /* multiplicative_expression: multiplicative_expression '*' cast_expression  */
+#line 191 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_MUL, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1952 "build/grammar_c.tab.c"
+    break;
+
+  case 32: /* multiplicative_expression: multiplicative_expression '/' cast_expression  */
+#line 193 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_DIV, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1958 "build/grammar_c.tab.c"
+    break;
+
+  case 33: /* multiplicative_expression: multiplicative_expression '%' cast_expression  */
+#line 195 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_MOD, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1964 "build/grammar_c.tab.c"
+    break;
+
+  case 34: /* additive_expression: multiplicative_expression  */
+#line 200 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1970 "build/grammar_c.tab.c"
+    break;
+
+  case 35: /* additive_expression: additive_expression '+' multiplicative_expression  */
+#line 202 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_ADD, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1976 "build/grammar_c.tab.c"
+    break;
+
+  case 36: /* additive_expression: additive_expression '-' multiplicative_expression  */
+#line 204 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_SUB, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1982 "build/grammar_c.tab.c"
+    break;
+
+  case 37: /* shift_expression: additive_expression  */
+#line 209 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 1988 "build/grammar_c.tab.c"
+    break;
+
+  case 38: /* shift_expression: shift_expression LEFT_OP additive_expression  */
+#line 211 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_LSHIFT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 1994 "build/grammar_c.tab.c"
+    break;
+
+  case 39: /* shift_expression: shift_expression RIGHT_OP additive_expression  */
+#line 213 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_RSHIFT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2000 "build/grammar_c.tab.c"
+    break;
+
+  case 40: /* relational_expression: shift_expression  */
+#line 218 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2006 "build/grammar_c.tab.c"
+    break;
+
+  case 41: /* relational_expression: relational_expression '<' shift_expression  */
+#line 220 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_LT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2012 "build/grammar_c.tab.c"
+    break;
+
+  case 42: /* relational_expression: relational_expression '>' shift_expression  */
+#line 222 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_GT, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2018 "build/grammar_c.tab.c"
+    break;
+
+  case 43: /* relational_expression: relational_expression LE_OP shift_expression  */
+#line 224 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_LE, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2024 "build/grammar_c.tab.c"
+    break;
+
+  case 44: /* relational_expression: relational_expression GE_OP shift_expression  */
+#line 226 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_GE, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2030 "build/grammar_c.tab.c"
+    break;
+
+  case 45: /* equality_expression: relational_expression  */
+#line 231 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2036 "build/grammar_c.tab.c"
+    break;
+
+  case 46: /* equality_expression: equality_expression EQ_OP relational_expression  */
+#line 233 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_EQ, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2042 "build/grammar_c.tab.c"
+    break;
+
+  case 47: /* equality_expression: equality_expression NE_OP relational_expression  */
+#line 235 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_NE, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2048 "build/grammar_c.tab.c"
+    break;
+
+  case 48: /* and_expression: equality_expression  */
+#line 240 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2054 "build/grammar_c.tab.c"
+    break;
+
+  case 49: /* and_expression: and_expression '&' equality_expression  */
+#line 242 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_BITAND, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2060 "build/grammar_c.tab.c"
+    break;
+
+  case 50: /* exclusive_or_expression: and_expression  */
+#line 247 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2066 "build/grammar_c.tab.c"
+    break;
+
+  case 51: /* exclusive_or_expression: exclusive_or_expression '^' and_expression  */
+#line 249 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_XOR, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2072 "build/grammar_c.tab.c"
+    break;
+
+  case 52: /* inclusive_or_expression: exclusive_or_expression  */
+#line 254 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2078 "build/grammar_c.tab.c"
+    break;
+
+  case 53: /* inclusive_or_expression: inclusive_or_expression '|' exclusive_or_expression  */
+#line 256 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_BITOR, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2084 "build/grammar_c.tab.c"
+    break;
+
+  case 54: /* logical_and_expression: inclusive_or_expression  */
+#line 261 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2090 "build/grammar_c.tab.c"
+    break;
+
+  case 55: /* logical_and_expression: logical_and_expression AND_OP inclusive_or_expression  */
+#line 263 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_AND, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2096 "build/grammar_c.tab.c"
+    break;
+
+  case 56: /* logical_or_expression: logical_and_expression  */
+#line 268 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2102 "build/grammar_c.tab.c"
+    break;
+
+  case 57: /* logical_or_expression: logical_or_expression OR_OP logical_and_expression  */
+#line 270 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_OR, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2108 "build/grammar_c.tab.c"
+    break;
+
+  case 58: /* conditional_expression: logical_or_expression  */
+#line 275 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2114 "build/grammar_c.tab.c"
+    break;
+
+  case 59: /* conditional_expression: logical_or_expression '?' expression ':' conditional_expression  */
+#line 277 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_CONDITIONAL);
+			(yyval.ast_node)->data.conditional_expr.condition = (yyvsp[-4].ast_node);
+			(yyval.ast_node)->data.conditional_expr.then_expr = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.conditional_expr.else_expr = (yyvsp[0].ast_node);
+		}
+#line 2125 "build/grammar_c.tab.c"
+    break;
+
+  case 60: /* assignment_expression: conditional_expression  */
+#line 287 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2131 "build/grammar_c.tab.c"
+    break;
+
+  case 61: /* assignment_expression: unary_expression assignment_operator assignment_expression  */
+#line 289 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node((yyvsp[-1].binary_op), (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2137 "build/grammar_c.tab.c"
+    break;
+
+  case 62: /* assignment_operator: '='  */
+#line 293 "src/grammar.y"
+                        { (yyval.binary_op) = OP_ASSIGN; }
+#line 2143 "build/grammar_c.tab.c"
+    break;
+
+  case 63: /* assignment_operator: MUL_ASSIGN  */
+#line 294 "src/grammar.y"
+                        { (yyval.binary_op) = OP_MUL_ASSIGN; }
+#line 2149 "build/grammar_c.tab.c"
+    break;
+
+  case 64: /* assignment_operator: DIV_ASSIGN  */
+#line 295 "src/grammar.y"
+                        { (yyval.binary_op) = OP_DIV_ASSIGN; }
+#line 2155 "build/grammar_c.tab.c"
+    break;
+
+  case 65: /* assignment_operator: MOD_ASSIGN  */
+#line 296 "src/grammar.y"
+                        { (yyval.binary_op) = OP_MOD_ASSIGN; }
+#line 2161 "build/grammar_c.tab.c"
+    break;
+
+  case 66: /* assignment_operator: ADD_ASSIGN  */
+#line 297 "src/grammar.y"
+                        { (yyval.binary_op) = OP_ADD_ASSIGN; }
+#line 2167 "build/grammar_c.tab.c"
+    break;
+
+  case 67: /* assignment_operator: SUB_ASSIGN  */
+#line 298 "src/grammar.y"
+                        { (yyval.binary_op) = OP_SUB_ASSIGN; }
+#line 2173 "build/grammar_c.tab.c"
+    break;
+
+  case 68: /* assignment_operator: LEFT_ASSIGN  */
+#line 299 "src/grammar.y"
+                        { (yyval.binary_op) = OP_LSHIFT_ASSIGN; }
+#line 2179 "build/grammar_c.tab.c"
+    break;
+
+  case 69: /* assignment_operator: RIGHT_ASSIGN  */
+#line 300 "src/grammar.y"
+                        { (yyval.binary_op) = OP_RSHIFT_ASSIGN; }
+#line 2185 "build/grammar_c.tab.c"
+    break;
+
+  case 70: /* assignment_operator: AND_ASSIGN  */
+#line 301 "src/grammar.y"
+                        { (yyval.binary_op) = OP_AND_ASSIGN; }
+#line 2191 "build/grammar_c.tab.c"
+    break;
+
+  case 71: /* assignment_operator: XOR_ASSIGN  */
+#line 302 "src/grammar.y"
+                        { (yyval.binary_op) = OP_XOR_ASSIGN; }
+#line 2197 "build/grammar_c.tab.c"
+    break;
+
+  case 72: /* assignment_operator: OR_ASSIGN  */
+#line 303 "src/grammar.y"
+                        { (yyval.binary_op) = OP_OR_ASSIGN; }
+#line 2203 "build/grammar_c.tab.c"
+    break;
+
+  case 73: /* expression: assignment_expression  */
+#line 308 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2209 "build/grammar_c.tab.c"
+    break;
+
+  case 74: /* expression: expression ',' assignment_expression  */
+#line 310 "src/grammar.y"
+                { (yyval.ast_node) = create_binary_op_node(OP_COMMA, (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 2215 "build/grammar_c.tab.c"
+    break;
+
+  case 75: /* constant_expression: conditional_expression  */
+#line 315 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2221 "build/grammar_c.tab.c"
+    break;
+
+  case 76: /* declaration: declaration_specifiers ';'  */
+#line 320 "src/grammar.y"
+                { (yyval.ast_node) = NULL; /* Empty declaration */ free_type_info((yyvsp[-1].type_info)); }
+#line 2227 "build/grammar_c.tab.c"
+    break;
+
+  case 77: /* declaration: declaration_specifiers init_declarator_list ';'  */
+#line 322 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-1].ast_node);
+			ASTNode* curr = (yyval.ast_node);
+			while (curr) {
+				TypeInfo* full_type = duplicate_type_info((yyvsp[-2].type_info));
+				int p_level = 0;
+				if (curr->type == AST_VARIABLE_DECL) {
+					p_level = curr->data.variable_decl.pointer_level;
+					if (curr->data.variable_decl.parameters) {
+						TypeInfo* func_type = create_function_type(full_type, curr->data.variable_decl.parameters, curr->data.variable_decl.is_variadic);
+						full_type = func_type;
+					}
+					for (int i = 0; i < p_level; i++) {
+						full_type = create_pointer_type(full_type);
+					}
+					/* Handle array dimensions */
+					ASTNode* dims = curr->data.variable_decl.array_dimensions;
+					while (dims) {
+						int size = evaluate_constant_node(dims);
+						/* If size is 0, try to infer from initializer list */
+						if (size == 0 && curr->data.variable_decl.initializer &&
+							curr->data.variable_decl.initializer->type == AST_INITIALIZER_LIST) {
+							size = curr->data.variable_decl.initializer->data.initializer_list.count;
+						}
+						full_type = create_array_type(full_type, size);
+						dims = dims->next;
+					}
+					curr->data.variable_decl.type = full_type;
+
+					if ((yyvsp[-2].type_info) && (yyvsp[-2].type_info)->storage_class == STORAGE_TYPEDEF) {
+						Symbol* sym = create_symbol(curr->data.variable_decl.name, full_type);
+						sym->is_global = (g_local_symbols == NULL);
+						if (sym->is_global) symbol_add_global(sym);
+						else symbol_add_local(sym);
+					} else {
+						/* printf("; Adding global symbol: %s, type=%d\n", curr->data.variable_decl.name, full_type->base_type); */
+						Symbol* sym = create_symbol(curr->data.variable_decl.name, full_type);
+						sym->is_global = (g_local_symbols == NULL);
+						if (sym->is_global) symbol_add_global(sym);
+						else symbol_add_local(sym);
+					}
+				} else if (curr->type == AST_FUNCTION_DECL) {
+					p_level = curr->data.function_def.pointer_level;
+					for (int i = 0; i < p_level; i++) {
+						full_type = create_pointer_type(full_type);
+					}
+					curr->data.function_def.return_type = full_type;
+
+					/* Add function to symbol table */
+					TypeInfo* func_type = create_function_type(full_type, curr->data.function_def.parameters, curr->data.function_def.is_variadic);
+					Symbol* sym = create_symbol(curr->data.function_def.name, func_type);
+					sym->is_global = (g_local_symbols == NULL);
+					if (sym->is_global) symbol_add_global(sym);
+					else symbol_add_local(sym);
+				}
+				curr = curr->next;
+			}
+			free_type_info((yyvsp[-2].type_info));
+		}
+#line 2291 "build/grammar_c.tab.c"
+    break;
+
+  case 78: /* declaration_specifiers: storage_class_specifier  */
+#line 385 "src/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2297 "build/grammar_c.tab.c"
+    break;
+
+  case 79: /* declaration_specifiers: storage_class_specifier declaration_specifiers  */
+#line 387 "src/grammar.y"
+                {
+			if ((yyvsp[0].type_info) == NULL) {
+				(yyval.type_info) = (yyvsp[-1].type_info);
+			} else {
+				(yyval.type_info) = duplicate_type_info((yyvsp[0].type_info));
+				(yyval.type_info)->storage_class = (yyvsp[-1].type_info)->storage_class;
+			}
+		}
+#line 2310 "build/grammar_c.tab.c"
+    break;
+
+  case 80: /* declaration_specifiers: type_specifier  */
+#line 396 "src/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2316 "build/grammar_c.tab.c"
+    break;
+
+  case 81: /* declaration_specifiers: type_specifier declaration_specifiers  */
+#line 398 "src/grammar.y"
+                {
+			if ((yyvsp[0].type_info) == NULL) {
+				(yyval.type_info) = (yyvsp[-1].type_info);
+			} else {
+				(yyval.type_info) = duplicate_type_info((yyvsp[0].type_info));
+				if ((yyvsp[-1].type_info)) {
+					/* Handle unsigned/signed modifiers */
+					if ((yyvsp[-1].type_info)->base_type == TYPE_UNSIGNED) {
+						(yyval.type_info)->is_unsigned = 1;
+					} else if ((yyvsp[-1].type_info)->base_type == TYPE_SIGNED) {
+						(yyval.type_info)->is_unsigned = 0;
+					}
+					/* Smarter merging */
+					if ((yyvsp[-1].type_info)->base_type == TYPE_LONG || (yyval.type_info)->base_type == TYPE_LONG) {
+						(yyval.type_info)->base_type = TYPE_LONG;
+					} else if ((yyvsp[-1].type_info)->base_type == TYPE_SHORT || (yyval.type_info)->base_type == TYPE_SHORT) {
+						(yyval.type_info)->base_type = TYPE_SHORT;
+					} else if ((yyvsp[-1].type_info)->base_type == TYPE_CHAR || (yyval.type_info)->base_type == TYPE_CHAR) {
+						(yyval.type_info)->base_type = TYPE_CHAR;
+					} else if ((yyvsp[-1].type_info)->base_type == TYPE_BOOL || (yyval.type_info)->base_type == TYPE_BOOL) {
+						(yyval.type_info)->base_type = TYPE_BOOL;
+					} else if ((yyvsp[-1].type_info)->base_type == TYPE_UNSIGNED || (yyvsp[-1].type_info)->base_type == TYPE_SIGNED) {
+						/* Keep existing base type, just set is_unsigned above */
+					} else if ((yyvsp[-1].type_info)->base_type != TYPE_VOID) {
+						(yyval.type_info)->base_type = (yyvsp[-1].type_info)->base_type;
+					}
+
+					/* Preserve other fields if not already set */
+					if (!(yyval.type_info)->struct_name) (yyval.type_info)->struct_name = (yyvsp[-1].type_info)->struct_name;
+					if (!(yyval.type_info)->struct_members) (yyval.type_info)->struct_members = (yyvsp[-1].type_info)->struct_members;
+					if ((yyval.type_info)->size == 0) (yyval.type_info)->size = (yyvsp[-1].type_info)->size;
+					if ((yyval.type_info)->alignment == 0) (yyval.type_info)->alignment = (yyvsp[-1].type_info)->alignment;
+					if (!(yyval.type_info)->return_type) (yyval.type_info)->return_type = (yyvsp[-1].type_info)->return_type;
+					if (!(yyval.type_info)->parameters) (yyval.type_info)->parameters = (yyvsp[-1].type_info)->parameters;
+				}
+			}
+		}
+#line 2358 "build/grammar_c.tab.c"
+    break;
+
+  case 82: /* declaration_specifiers: type_qualifier  */
+#line 436 "src/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2364 "build/grammar_c.tab.c"
+    break;
+
+  case 83: /* declaration_specifiers: type_qualifier declaration_specifiers  */
+#line 438 "src/grammar.y"
+                {
+			if ((yyvsp[0].type_info) == NULL) {
+				(yyval.type_info) = (yyvsp[-1].type_info);
+			} else {
+				(yyval.type_info) = duplicate_type_info((yyvsp[0].type_info));
+				if ((yyvsp[-1].type_info)) {
+					(yyval.type_info)->qualifiers = (TypeQualifier)((yyval.type_info)->qualifiers | (yyvsp[-1].type_info)->qualifiers);
+				}
+			}
+		}
+#line 2379 "build/grammar_c.tab.c"
+    break;
+
+  case 84: /* init_declarator_list: init_declarator  */
+#line 452 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2385 "build/grammar_c.tab.c"
+    break;
+
+  case 85: /* init_declarator_list: init_declarator_list ',' init_declarator  */
+#line 454 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 2396 "build/grammar_c.tab.c"
+    break;
+
+  case 86: /* init_declarator: declarator  */
+#line 464 "src/grammar.y"
+                {
+			if ((yyvsp[0].ast_node)->data.identifier.is_function) {
+				if ((yyvsp[0].ast_node)->data.identifier.is_function_pointer) {
+					(yyval.ast_node) = create_variable_decl_node(NULL, (yyvsp[0].ast_node)->data.identifier.name, NULL);
+					(yyval.ast_node)->data.variable_decl.pointer_level = (yyvsp[0].ast_node)->data.identifier.pointer_level;
+					(yyval.ast_node)->data.variable_decl.parameters = (yyvsp[0].ast_node)->data.identifier.parameters;
+					(yyval.ast_node)->data.variable_decl.is_variadic = (yyvsp[0].ast_node)->data.identifier.is_variadic;
+				} else {
+					(yyval.ast_node) = create_function_decl_node(NULL, (yyvsp[0].ast_node)->data.identifier.name, (yyvsp[0].ast_node)->data.identifier.parameters, (yyvsp[0].ast_node)->data.identifier.is_variadic);
+					(yyval.ast_node)->data.function_def.pointer_level = (yyvsp[0].ast_node)->data.identifier.pointer_level;
+				}
+			} else {
+				(yyval.ast_node) = create_variable_decl_node(NULL, (yyvsp[0].ast_node)->data.identifier.name, NULL);
+				(yyval.ast_node)->data.variable_decl.pointer_level = (yyvsp[0].ast_node)->data.identifier.pointer_level;
+				(yyval.ast_node)->data.variable_decl.array_dimensions = (yyvsp[0].ast_node)->data.identifier.array_dimensions;
+			}
+		}
+#line 2418 "build/grammar_c.tab.c"
+    break;
+
+  case 87: /* init_declarator: declarator '=' initializer  */
+#line 482 "src/grammar.y"
+                {
+			if ((yyvsp[-2].ast_node)->data.identifier.is_function_pointer) {
+				(yyval.ast_node) = create_variable_decl_node(NULL, (yyvsp[-2].ast_node)->data.identifier.name, (yyvsp[0].ast_node));
+				(yyval.ast_node)->data.variable_decl.pointer_level = (yyvsp[-2].ast_node)->data.identifier.pointer_level;
+				(yyval.ast_node)->data.variable_decl.parameters = (yyvsp[-2].ast_node)->data.identifier.parameters;
+				(yyval.ast_node)->data.variable_decl.is_variadic = (yyvsp[-2].ast_node)->data.identifier.is_variadic;
+			} else {
+				(yyval.ast_node) = create_variable_decl_node(NULL, (yyvsp[-2].ast_node)->data.identifier.name, (yyvsp[0].ast_node));
+				(yyval.ast_node)->data.variable_decl.pointer_level = (yyvsp[-2].ast_node)->data.identifier.pointer_level;
+				(yyval.ast_node)->data.variable_decl.array_dimensions = (yyvsp[-2].ast_node)->data.identifier.array_dimensions;
+			}
+		}
+#line 2435 "build/grammar_c.tab.c"
+    break;
+
+  case 88: /* storage_class_specifier: TYPEDEF  */
+#line 497 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_TYPEDEF; }
+#line 2441 "build/grammar_c.tab.c"
+    break;
+
+  case 89: /* storage_class_specifier: EXTERN  */
+#line 498 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_EXTERN; }
+#line 2447 "build/grammar_c.tab.c"
+    break;
+
+  case 90: /* storage_class_specifier: STATIC  */
+#line 499 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_STATIC; }
+#line 2453 "build/grammar_c.tab.c"
+    break;
+
+  case 91: /* storage_class_specifier: AUTO  */
+#line 500 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_AUTO; }
+#line 2459 "build/grammar_c.tab.c"
+    break;
+
+  case 92: /* storage_class_specifier: REGISTER  */
+#line 501 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->storage_class = STORAGE_REGISTER; }
+#line 2465 "build/grammar_c.tab.c"
+    break;
+
+  case 93: /* type_specifier: VOID  */
+#line 505 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); }
+#line 2471 "build/grammar_c.tab.c"
+    break;
+
+  case 94: /* type_specifier: BOOL  */
+#line 506 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_BOOL); }
+#line 2477 "build/grammar_c.tab.c"
+    break;
+
+  case 95: /* type_specifier: CHAR  */
+#line 507 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_CHAR); }
+#line 2483 "build/grammar_c.tab.c"
+    break;
+
+  case 96: /* type_specifier: SHORT  */
+#line 508 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_SHORT); }
+#line 2489 "build/grammar_c.tab.c"
+    break;
+
+  case 97: /* type_specifier: INT  */
+#line 509 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_INT); }
+#line 2495 "build/grammar_c.tab.c"
+    break;
+
+  case 98: /* type_specifier: LONG  */
+#line 510 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_LONG); }
+#line 2501 "build/grammar_c.tab.c"
+    break;
+
+  case 99: /* type_specifier: FLOAT  */
+#line 511 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_FLOAT); }
+#line 2507 "build/grammar_c.tab.c"
+    break;
+
+  case 100: /* type_specifier: DOUBLE  */
+#line 512 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_DOUBLE); }
+#line 2513 "build/grammar_c.tab.c"
+    break;
+
+  case 101: /* type_specifier: SIGNED  */
+#line 513 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_SIGNED); }
+#line 2519 "build/grammar_c.tab.c"
+    break;
+
+  case 102: /* type_specifier: UNSIGNED  */
+#line 514 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_UNSIGNED); }
+#line 2525 "build/grammar_c.tab.c"
+    break;
+
+  case 103: /* type_specifier: struct_or_union_specifier  */
+#line 515 "src/grammar.y"
+                                    { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2531 "build/grammar_c.tab.c"
+    break;
+
+  case 104: /* type_specifier: enum_specifier  */
+#line 516 "src/grammar.y"
+                                    { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2537 "build/grammar_c.tab.c"
+    break;
+
+  case 105: /* type_specifier: TYPE_NAME  */
+#line 518 "src/grammar.y"
+        {
+            Symbol* sym = symbol_lookup((yyvsp[0].str_val));
+            if (sym && sym->type) {
+				if ((sym->type->base_type == TYPE_STRUCT || sym->type->base_type == TYPE_UNION) && sym->type->struct_name) {
+					Symbol* tag = tag_lookup(sym->type->struct_name);
+					if (tag) {
+						(yyval.type_info) = duplicate_type_info(tag->type);
+						/* Preserve pointer level from typedef */
+						(yyval.type_info)->pointer_level = sym->type->pointer_level;
+					}
+					else (yyval.type_info) = duplicate_type_info(sym->type);
+				} else {
+					(yyval.type_info) = duplicate_type_info(sym->type);
+				}
+                (yyval.type_info)->storage_class = STORAGE_NONE;
+            }
+            else (yyval.type_info) = create_type_info(TYPE_INT);
+        }
+#line 2560 "build/grammar_c.tab.c"
+    break;
+
+  case 106: /* struct_or_union_specifier: struct_or_union IDENTIFIER '{' struct_declaration_list '}'  */
+#line 540 "src/grammar.y"
+                {
+			Symbol* existing = tag_lookup((yyvsp[-3].str_val));
+			TypeInfo* type = existing ? existing->type : create_struct_type((yyvsp[-3].str_val), strcmp((yyvsp[-4].str_val), "union") == 0);
+			ASTNode* curr = (yyvsp[-1].ast_node);
+			while (curr) {
+				if (curr->type == AST_VARIABLE_DECL) {
+					struct_add_member(type, curr->data.variable_decl.name, curr->data.variable_decl.type);
+				}
+				curr = curr->next;
+			}
+			struct_finish_layout(type);
+			if (!existing) {
+				Symbol* tag = create_symbol((yyvsp[-3].str_val), type);
+				tag_add(tag);
+			}
+			(yyval.type_info) = type;
+		}
+#line 2582 "build/grammar_c.tab.c"
+    break;
+
+  case 107: /* struct_or_union_specifier: struct_or_union TYPE_NAME '{' struct_declaration_list '}'  */
+#line 558 "src/grammar.y"
+                {
+			Symbol* existing = tag_lookup((yyvsp[-3].str_val));
+			TypeInfo* type = existing ? existing->type : create_struct_type((yyvsp[-3].str_val), strcmp((yyvsp[-4].str_val), "union") == 0);
+			ASTNode* curr = (yyvsp[-1].ast_node);
+			while (curr) {
+				if (curr->type == AST_VARIABLE_DECL) {
+					struct_add_member(type, curr->data.variable_decl.name, curr->data.variable_decl.type);
+				}
+				curr = curr->next;
+			}
+			struct_finish_layout(type);
+			if (!existing) {
+				Symbol* tag = create_symbol((yyvsp[-3].str_val), type);
+				tag_add(tag);
+			}
+			(yyval.type_info) = type;
+		}
+#line 2604 "build/grammar_c.tab.c"
+    break;
+
+  case 108: /* struct_or_union_specifier: struct_or_union '{' struct_declaration_list '}'  */
+#line 576 "src/grammar.y"
+                {
+			TypeInfo* type = create_struct_type(NULL, strcmp((yyvsp[-3].str_val), "union") == 0);
+			ASTNode* curr = (yyvsp[-1].ast_node);
+			while (curr) {
+				if (curr->type == AST_VARIABLE_DECL) {
+					struct_add_member(type, curr->data.variable_decl.name, curr->data.variable_decl.type);
+				}
+				curr = curr->next;
+			}
+			struct_finish_layout(type);
+			(yyval.type_info) = type;
+		}
+#line 2621 "build/grammar_c.tab.c"
+    break;
+
+  case 109: /* struct_or_union_specifier: struct_or_union IDENTIFIER  */
+#line 589 "src/grammar.y"
+                {
+			Symbol* tag = tag_lookup((yyvsp[0].str_val));
+			if (tag) {
+				(yyval.type_info) = duplicate_type_info(tag->type);
+			} else {
+				/* printf("; Forward decl struct: %s\n", $2); */
+				TypeInfo* type = create_struct_type((yyvsp[0].str_val), strcmp((yyvsp[-1].str_val), "union") == 0);
+				Symbol* new_tag = create_symbol((yyvsp[0].str_val), type);
+				tag_add(new_tag);
+				(yyval.type_info) = type;
+			}
+		}
+#line 2638 "build/grammar_c.tab.c"
+    break;
+
+  case 110: /* struct_or_union_specifier: struct_or_union TYPE_NAME  */
+#line 602 "src/grammar.y"
+                {
+			Symbol* tag = tag_lookup((yyvsp[0].str_val));
+			if (tag) {
+				(yyval.type_info) = duplicate_type_info(tag->type);
+			} else {
+				TypeInfo* type = create_struct_type((yyvsp[0].str_val), strcmp((yyvsp[-1].str_val), "union") == 0);
+				Symbol* new_tag = create_symbol((yyvsp[0].str_val), type);
+				tag_add(new_tag);
+				(yyval.type_info) = type;
+			}
+		}
+#line 2654 "build/grammar_c.tab.c"
+    break;
+
+  case 111: /* struct_or_union: STRUCT  */
+#line 616 "src/grammar.y"
+                  { (yyval.str_val) = (char*)"struct"; }
+#line 2660 "build/grammar_c.tab.c"
+    break;
+
+  case 112: /* struct_or_union: UNION  */
+#line 617 "src/grammar.y"
+                  { (yyval.str_val) = (char*)"union"; }
+#line 2666 "build/grammar_c.tab.c"
+    break;
+
+  case 113: /* struct_declaration_list: struct_declaration  */
+#line 622 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2672 "build/grammar_c.tab.c"
+    break;
+
+  case 114: /* struct_declaration_list: struct_declaration_list struct_declaration  */
+#line 624 "src/grammar.y"
+                {
+			if ((yyvsp[-1].ast_node)) {
+				(yyval.ast_node) = (yyvsp[-1].ast_node);
+				ASTNode* curr = (yyvsp[-1].ast_node);
+				while (curr->next) curr = curr->next;
+				curr->next = (yyvsp[0].ast_node);
+			} else {
+				(yyval.ast_node) = (yyvsp[0].ast_node);
+			}
+		}
+#line 2687 "build/grammar_c.tab.c"
+    break;
+
+  case 115: /* struct_declaration: specifier_qualifier_list struct_declarator_list ';'  */
+#line 638 "src/grammar.y"
+                {
+			/* Apply type to all declarators and return as variable decls */
+			ASTNode* head = NULL;
+			ASTNode* tail = NULL;
+			ASTNode* curr_decl = (yyvsp[-1].ast_node);
+			while (curr_decl) {
+				TypeInfo* full_type = duplicate_type_info((yyvsp[-2].type_info));
+				int p_level = curr_decl->data.identifier.pointer_level;
+				for (int i = 0; i < p_level; i++) {
+					full_type = create_pointer_type(full_type);
+				}
+				/* Handle arrays in structs */
+				ASTNode* dims = curr_decl->data.identifier.array_dimensions;
+				while (dims) {
+					full_type = create_array_type(full_type, evaluate_constant_node(dims));
+					dims = dims->next;
+				}
+
+				ASTNode* var = create_variable_decl_node(full_type, curr_decl->data.identifier.name, NULL);
+				if (!head) head = var;
+				if (tail) tail->next = var;
+				tail = var;
+
+				curr_decl = curr_decl->next;
+			}
+			free_type_info((yyvsp[-2].type_info));
+			(yyval.ast_node) = head;
+		}
+#line 2720 "build/grammar_c.tab.c"
+    break;
+
+  case 116: /* specifier_qualifier_list: type_specifier specifier_qualifier_list  */
+#line 670 "src/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[0].type_info);
+			(yyval.type_info)->base_type = (yyvsp[-1].type_info)->base_type;
+			free_type_info((yyvsp[-1].type_info));
+		}
+#line 2730 "build/grammar_c.tab.c"
+    break;
+
+  case 117: /* specifier_qualifier_list: type_specifier  */
+#line 676 "src/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2736 "build/grammar_c.tab.c"
+    break;
+
+  case 118: /* specifier_qualifier_list: type_qualifier specifier_qualifier_list  */
+#line 678 "src/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[0].type_info);
+			(yyval.type_info)->qualifiers = (TypeQualifier)((yyval.type_info)->qualifiers | (yyvsp[-1].type_info)->qualifiers);
+			free_type_info((yyvsp[-1].type_info));
+		}
+#line 2746 "build/grammar_c.tab.c"
+    break;
+
+  case 119: /* specifier_qualifier_list: type_qualifier  */
+#line 684 "src/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 2752 "build/grammar_c.tab.c"
+    break;
+
+  case 120: /* struct_declarator_list: struct_declarator  */
+#line 689 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2758 "build/grammar_c.tab.c"
+    break;
+
+  case 121: /* struct_declarator_list: struct_declarator_list ',' struct_declarator  */
+#line 691 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 2764 "build/grammar_c.tab.c"
+    break;
+
+  case 122: /* struct_declarator: declarator  */
+#line 696 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2770 "build/grammar_c.tab.c"
+    break;
+
+  case 123: /* struct_declarator: ':' constant_expression  */
+#line 698 "src/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 2776 "build/grammar_c.tab.c"
+    break;
+
+  case 124: /* struct_declarator: declarator ':' constant_expression  */
+#line 700 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 2782 "build/grammar_c.tab.c"
+    break;
+
+  case 125: /* $@1: %empty  */
+#line 704 "src/grammar.y"
+                   { g_next_enum_value = 0; }
+#line 2788 "build/grammar_c.tab.c"
+    break;
+
+  case 126: /* enum_specifier: ENUM '{' $@1 enumerator_list '}'  */
+#line 705 "src/grammar.y"
+                { (yyval.type_info) = create_type_info(TYPE_ENUM); }
+#line 2794 "build/grammar_c.tab.c"
+    break;
+
+  case 127: /* $@2: %empty  */
+#line 706 "src/grammar.y"
+                              { g_next_enum_value = 0; }
+#line 2800 "build/grammar_c.tab.c"
+    break;
+
+  case 128: /* enum_specifier: ENUM IDENTIFIER '{' $@2 enumerator_list '}'  */
+#line 707 "src/grammar.y"
+                {
+			(yyval.type_info) = create_type_info(TYPE_ENUM);
+			(yyval.type_info)->struct_name = (yyvsp[-4].str_val);
+			tag_add(create_symbol((yyvsp[-4].str_val), (yyval.type_info)));
+		}
+#line 2810 "build/grammar_c.tab.c"
+    break;
+
+  case 129: /* $@3: %empty  */
+#line 712 "src/grammar.y"
+                             { g_next_enum_value = 0; }
+#line 2816 "build/grammar_c.tab.c"
+    break;
+
+  case 130: /* enum_specifier: ENUM TYPE_NAME '{' $@3 enumerator_list '}'  */
+#line 713 "src/grammar.y"
+                {
+			(yyval.type_info) = create_type_info(TYPE_ENUM);
+			(yyval.type_info)->struct_name = (yyvsp[-4].str_val);
+			tag_add(create_symbol((yyvsp[-4].str_val), (yyval.type_info)));
+		}
+#line 2826 "build/grammar_c.tab.c"
+    break;
+
+  case 131: /* enum_specifier: ENUM IDENTIFIER  */
+#line 719 "src/grammar.y"
+                {
+			Symbol* tag = tag_lookup((yyvsp[0].str_val));
+			if (tag) {
+				(yyval.type_info) = duplicate_type_info(tag->type);
+			} else {
+				(yyval.type_info) = create_type_info(TYPE_ENUM);
+				(yyval.type_info)->struct_name = (yyvsp[0].str_val);
+				tag_add(create_symbol((yyvsp[0].str_val), (yyval.type_info)));
+			}
+		}
+#line 2841 "build/grammar_c.tab.c"
+    break;
+
+  case 132: /* enum_specifier: ENUM TYPE_NAME  */
+#line 730 "src/grammar.y"
+                {
+			Symbol* tag = tag_lookup((yyvsp[0].str_val));
+			if (tag) {
+				(yyval.type_info) = duplicate_type_info(tag->type);
+			} else {
+				(yyval.type_info) = create_type_info(TYPE_ENUM);
+				(yyval.type_info)->struct_name = (yyvsp[0].str_val);
+				tag_add(create_symbol((yyvsp[0].str_val), (yyval.type_info)));
+			}
+		}
+#line 2856 "build/grammar_c.tab.c"
+    break;
+
+  case 133: /* enumerator_list: enumerator  */
+#line 744 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 2862 "build/grammar_c.tab.c"
+    break;
+
+  case 134: /* enumerator_list: enumerator_list ',' enumerator  */
+#line 746 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 2868 "build/grammar_c.tab.c"
+    break;
+
+  case 135: /* enumerator_list: enumerator_list ','  */
+#line 748 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 2874 "build/grammar_c.tab.c"
+    break;
+
+  case 136: /* enumerator: IDENTIFIER  */
+#line 753 "src/grammar.y"
+                {
+			Symbol* sym = create_symbol((yyvsp[0].str_val), create_type_info(TYPE_INT));
+			sym->is_enum_constant = 1;
+			sym->enum_value = g_next_enum_value++;
+			sym->is_global = 1;
+			symbol_add_global(sym);
+			(yyval.ast_node) = create_identifier_node((yyvsp[0].str_val));
+		}
+#line 2887 "build/grammar_c.tab.c"
+    break;
+
+  case 137: /* enumerator: IDENTIFIER '=' constant_expression  */
+#line 762 "src/grammar.y"
+                {
+			int val = evaluate_constant_node((yyvsp[0].ast_node));
+			g_next_enum_value = val;
+			Symbol* sym = create_symbol((yyvsp[-2].str_val), create_type_info(TYPE_INT));
+			sym->is_enum_constant = 1;
+			sym->enum_value = g_next_enum_value++;
+			sym->is_global = 1;
+			symbol_add_global(sym);
+			(yyval.ast_node) = create_identifier_node((yyvsp[-2].str_val));
+		}
+#line 2902 "build/grammar_c.tab.c"
+    break;
+
+  case 138: /* type_qualifier: CONST  */
+#line 775 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->qualifiers = QUAL_CONST; }
+#line 2908 "build/grammar_c.tab.c"
+    break;
+
+  case 139: /* type_qualifier: VOLATILE  */
+#line 776 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); (yyval.type_info)->qualifiers = QUAL_VOLATILE; }
+#line 2914 "build/grammar_c.tab.c"
+    break;
+
+  case 140: /* type_qualifier: NONNULL  */
+#line 777 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); }
+#line 2920 "build/grammar_c.tab.c"
+    break;
+
+  case 141: /* type_qualifier: NULLABLE  */
+#line 778 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); }
+#line 2926 "build/grammar_c.tab.c"
+    break;
+
+  case 142: /* type_qualifier: UNUSED  */
+#line 779 "src/grammar.y"
+                    { (yyval.type_info) = create_type_info(TYPE_VOID); }
+#line 2932 "build/grammar_c.tab.c"
+    break;
+
+  case 143: /* type_qualifier: DEPRECATED  */
+#line 780 "src/grammar.y"
+                     { (yyval.type_info) = create_type_info(TYPE_VOID); }
+#line 2938 "build/grammar_c.tab.c"
+    break;
+
+  case 144: /* declarator: pointer direct_declarator  */
+#line 785 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[0].ast_node);
+			(yyval.ast_node)->data.identifier.pointer_level += (yyvsp[-1].int_val);
+		}
+#line 2947 "build/grammar_c.tab.c"
+    break;
+
+  case 145: /* declarator: direct_declarator  */
+#line 790 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[0].ast_node);
+		}
+#line 2955 "build/grammar_c.tab.c"
+    break;
+
+  case 146: /* direct_declarator: IDENTIFIER  */
+#line 797 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_identifier_node((yyvsp[0].str_val));
+			(yyval.ast_node)->data.identifier.is_variadic = 0;
+			(yyval.ast_node)->data.identifier.pointer_level = 0;
+		}
+#line 2965 "build/grammar_c.tab.c"
+    break;
+
+  case 147: /* direct_declarator: '(' declarator ')'  */
+#line 803 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 2971 "build/grammar_c.tab.c"
+    break;
+
+  case 148: /* direct_declarator: '(' '^' declarator ')'  */
+#line 805 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 2977 "build/grammar_c.tab.c"
+    break;
+
+  case 149: /* direct_declarator: '(' '^' ')'  */
+#line 807 "src/grammar.y"
+                { (yyval.ast_node) = create_identifier_node("block_stub"); }
+#line 2983 "build/grammar_c.tab.c"
+    break;
+
+  case 150: /* direct_declarator: direct_declarator '[' constant_expression ']'  */
+#line 809 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-3].ast_node);
+			/* Prepend array dimension to dimension list */
+			if ((yyvsp[-1].ast_node) && (yyvsp[-1].ast_node)->type == AST_CONSTANT) {
+				(yyvsp[-1].ast_node)->next = (yyval.ast_node)->data.identifier.array_dimensions;
+				(yyval.ast_node)->data.identifier.array_dimensions = (yyvsp[-1].ast_node);
+			} else {
+				ASTNode* zero = create_constant_node(0, TYPE_INT);
+				zero->next = (yyval.ast_node)->data.identifier.array_dimensions;
+				(yyval.ast_node)->data.identifier.array_dimensions = zero;
+			}
+		}
+#line 3000 "build/grammar_c.tab.c"
+    break;
+
+  case 151: /* direct_declarator: direct_declarator '[' ']'  */
+#line 822 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* zero = create_constant_node(0, TYPE_INT);
+			zero->next = (yyval.ast_node)->data.identifier.array_dimensions;
+			(yyval.ast_node)->data.identifier.array_dimensions = zero;
+		}
+#line 3011 "build/grammar_c.tab.c"
+    break;
+
+  case 152: /* direct_declarator: direct_declarator '(' parameter_type_list ')'  */
+#line 829 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.identifier.is_function = 1;
+			if ((yyval.ast_node)->data.identifier.pointer_level > 0) {
+				(yyval.ast_node)->data.identifier.is_function_pointer = 1;
+			}
+			/* Handle (void) specifically */
+			if ((yyvsp[-1].param_info).head && (yyvsp[-1].param_info).head->type == AST_VARIABLE_DECL &&
+				(yyvsp[-1].param_info).head->data.variable_decl.type->base_type == TYPE_VOID &&
+				(yyvsp[-1].param_info).head->data.variable_decl.type->pointer_level == 0 &&
+				(yyvsp[-1].param_info).head->next == NULL) {
+				(yyval.ast_node)->data.identifier.parameters = NULL;
+			} else {
+				(yyval.ast_node)->data.identifier.parameters = (yyvsp[-1].param_info).head;
+			}
+			(yyval.ast_node)->data.identifier.is_variadic = (yyvsp[-1].param_info).is_variadic;
+		}
+#line 3033 "build/grammar_c.tab.c"
+    break;
+
+  case 153: /* direct_declarator: direct_declarator '(' identifier_list ')'  */
+#line 847 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.identifier.is_function = 1;
+			(yyval.ast_node)->data.identifier.is_variadic = 0;
+		}
+#line 3043 "build/grammar_c.tab.c"
+    break;
+
+  case 154: /* direct_declarator: direct_declarator '(' ')'  */
+#line 853 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.identifier.is_function = 1;
+			(yyval.ast_node)->data.identifier.is_variadic = 0;
+		}
+#line 3053 "build/grammar_c.tab.c"
+    break;
+
+  case 155: /* pointer: '*'  */
+#line 862 "src/grammar.y"
+                { (yyval.int_val) = 1; }
+#line 3059 "build/grammar_c.tab.c"
+    break;
+
+  case 156: /* pointer: '*' type_qualifier_list  */
+#line 864 "src/grammar.y"
+                { (yyval.int_val) = 1; }
+#line 3065 "build/grammar_c.tab.c"
+    break;
+
+  case 157: /* pointer: '*' pointer  */
+#line 866 "src/grammar.y"
+                { (yyval.int_val) = (yyvsp[0].int_val) + 1; }
+#line 3071 "build/grammar_c.tab.c"
+    break;
+
+  case 158: /* pointer: '*' type_qualifier_list pointer  */
+#line 868 "src/grammar.y"
+                { (yyval.int_val) = (yyvsp[0].int_val) + 1; }
+#line 3077 "build/grammar_c.tab.c"
+    break;
+
+  case 159: /* type_qualifier_list: type_qualifier  */
+#line 873 "src/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 3083 "build/grammar_c.tab.c"
+    break;
+
+  case 160: /* type_qualifier_list: type_qualifier_list type_qualifier  */
+#line 875 "src/grammar.y"
+                { (yyval.ast_node) = NULL; }
+#line 3089 "build/grammar_c.tab.c"
+    break;
+
+  case 161: /* parameter_type_list: parameter_list  */
+#line 880 "src/grammar.y"
+                {
+			(yyval.param_info).head = (yyvsp[0].ast_node);
+			(yyval.param_info).is_variadic = 0;
+		}
+#line 3098 "build/grammar_c.tab.c"
+    break;
+
+  case 162: /* parameter_type_list: parameter_list ',' ELLIPSIS  */
+#line 885 "src/grammar.y"
+                {
+			(yyval.param_info).head = (yyvsp[-2].ast_node);
+			(yyval.param_info).is_variadic = 1;
+		}
+#line 3107 "build/grammar_c.tab.c"
+    break;
+
+  case 163: /* parameter_list: parameter_declaration  */
+#line 893 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3113 "build/grammar_c.tab.c"
+    break;
+
+  case 164: /* parameter_list: parameter_list ',' parameter_declaration  */
+#line 895 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 3124 "build/grammar_c.tab.c"
+    break;
+
+  case 165: /* parameter_declaration: declaration_specifiers declarator  */
+#line 905 "src/grammar.y"
+                {
+			TypeInfo* full_type = duplicate_type_info((yyvsp[-1].type_info));
+			int p_level = (yyvsp[0].ast_node)->data.identifier.pointer_level;
+			if ((yyvsp[0].ast_node)->data.identifier.parameters) {
+				TypeInfo* func_type = create_function_type(full_type, (yyvsp[0].ast_node)->data.identifier.parameters, (yyvsp[0].ast_node)->data.identifier.is_variadic);
+				full_type = func_type;
+			}
+			for (int i = 0; i < p_level; i++) {
+				full_type = create_pointer_type(full_type);
+			}
+			/* Handle array dimensions for parameter (T[] -> T*) */
+			ASTNode* dims = (yyvsp[0].ast_node)->data.identifier.array_dimensions;
+			while (dims) {
+				full_type = create_pointer_type(full_type);
+				dims = dims->next;
+			}
+			(yyval.ast_node) = create_variable_decl_node(full_type, (yyvsp[0].ast_node)->data.identifier.name, NULL);
+		}
+#line 3147 "build/grammar_c.tab.c"
+    break;
+
+  case 166: /* parameter_declaration: declaration_specifiers abstract_declarator  */
+#line 924 "src/grammar.y"
+                { (yyval.ast_node) = create_variable_decl_node((yyvsp[-1].type_info), (char*)"param", NULL); }
+#line 3153 "build/grammar_c.tab.c"
+    break;
+
+  case 167: /* parameter_declaration: declaration_specifiers  */
+#line 926 "src/grammar.y"
+                { (yyval.ast_node) = create_variable_decl_node((yyvsp[0].type_info), (char*)"param", NULL); }
+#line 3159 "build/grammar_c.tab.c"
+    break;
+
+  case 168: /* identifier_list: IDENTIFIER  */
+#line 931 "src/grammar.y"
+                { (yyval.ast_node) = create_identifier_node((yyvsp[0].str_val)); }
+#line 3165 "build/grammar_c.tab.c"
+    break;
+
+  case 169: /* identifier_list: identifier_list ',' IDENTIFIER  */
+#line 933 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = create_identifier_node((yyvsp[0].str_val));
+		}
+#line 3176 "build/grammar_c.tab.c"
+    break;
+
+  case 170: /* type_name: specifier_qualifier_list  */
+#line 943 "src/grammar.y"
+                { (yyval.type_info) = (yyvsp[0].type_info); }
+#line 3182 "build/grammar_c.tab.c"
+    break;
+
+  case 171: /* type_name: specifier_qualifier_list abstract_declarator  */
+#line 945 "src/grammar.y"
+                {
+			(yyval.type_info) = (yyvsp[-1].type_info);
+			if ((yyvsp[0].ast_node)) {
+				for (int i = 0; i < (yyvsp[0].ast_node)->data.identifier.pointer_level; i++) {
+					(yyval.type_info) = create_pointer_type((yyval.type_info));
+				}
+			}
+		}
+#line 3195 "build/grammar_c.tab.c"
+    break;
+
+  case 172: /* abstract_declarator: pointer  */
+#line 957 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_identifier_node("");
+			(yyval.ast_node)->data.identifier.pointer_level = (yyvsp[0].int_val);
+		}
+#line 3204 "build/grammar_c.tab.c"
+    break;
+
+  case 173: /* abstract_declarator: direct_abstract_declarator  */
+#line 962 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3210 "build/grammar_c.tab.c"
+    break;
+
+  case 174: /* abstract_declarator: pointer direct_abstract_declarator  */
+#line 964 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[0].ast_node);
+			(yyval.ast_node)->data.identifier.pointer_level += (yyvsp[-1].int_val);
+		}
+#line 3219 "build/grammar_c.tab.c"
+    break;
+
+  case 175: /* direct_abstract_declarator: '(' abstract_declarator ')'  */
+#line 972 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-1].ast_node); }
+#line 3225 "build/grammar_c.tab.c"
+    break;
+
+  case 176: /* direct_abstract_declarator: '[' ']'  */
+#line 974 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_identifier_node("");
+			/* Array support later */
+		}
+#line 3234 "build/grammar_c.tab.c"
+    break;
+
+  case 177: /* direct_abstract_declarator: '[' constant_expression ']'  */
+#line 979 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_identifier_node("");
+		}
+#line 3242 "build/grammar_c.tab.c"
+    break;
+
+  case 178: /* direct_abstract_declarator: direct_abstract_declarator '[' ']'  */
+#line 983 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 3248 "build/grammar_c.tab.c"
+    break;
+
+  case 179: /* direct_abstract_declarator: direct_abstract_declarator '[' constant_expression ']'  */
+#line 985 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-3].ast_node); }
+#line 3254 "build/grammar_c.tab.c"
+    break;
+
+  case 180: /* direct_abstract_declarator: '(' ')'  */
+#line 987 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_identifier_node("");
+		}
+#line 3262 "build/grammar_c.tab.c"
+    break;
+
+  case 181: /* direct_abstract_declarator: '(' parameter_type_list ')'  */
+#line 991 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_identifier_node("");
+			(yyval.ast_node)->data.identifier.parameters = (yyvsp[-1].param_info).head;
+		}
+#line 3271 "build/grammar_c.tab.c"
+    break;
+
+  case 182: /* direct_abstract_declarator: direct_abstract_declarator '(' ')'  */
+#line 996 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[-2].ast_node); }
+#line 3277 "build/grammar_c.tab.c"
+    break;
+
+  case 183: /* direct_abstract_declarator: direct_abstract_declarator '(' parameter_type_list ')'  */
+#line 998 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.identifier.parameters = (yyvsp[-1].param_info).head;
+		}
+#line 3286 "build/grammar_c.tab.c"
+    break;
+
+  case 184: /* initializer: assignment_expression  */
+#line 1006 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3292 "build/grammar_c.tab.c"
+    break;
+
+  case 185: /* initializer: '{' initializer_list '}'  */
+#line 1008 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_INITIALIZER_LIST);
+			(yyval.ast_node)->data.initializer_list.items = (yyvsp[-1].ast_node);
+			int count = 0;
+			ASTNode* current = (yyvsp[-1].ast_node);
+			while (current) { count++; current = current->next; }
+			(yyval.ast_node)->data.initializer_list.count = count;
+		}
+#line 3305 "build/grammar_c.tab.c"
+    break;
+
+  case 186: /* initializer: '{' initializer_list ',' '}'  */
+#line 1017 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_INITIALIZER_LIST);
+			(yyval.ast_node)->data.initializer_list.items = (yyvsp[-2].ast_node);
+			int count = 0;
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current) { count++; current = current->next; }
+			(yyval.ast_node)->data.initializer_list.count = count;
+		}
+#line 3318 "build/grammar_c.tab.c"
+    break;
+
+  case 187: /* initializer_list: initializer  */
+#line 1029 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3324 "build/grammar_c.tab.c"
+    break;
+
+  case 188: /* initializer_list: initializer_list ',' initializer  */
+#line 1031 "src/grammar.y"
+                {
+			(yyval.ast_node) = (yyvsp[-2].ast_node);
+			ASTNode* current = (yyvsp[-2].ast_node);
+			while (current->next) current = current->next;
+			current->next = (yyvsp[0].ast_node);
+		}
+#line 3335 "build/grammar_c.tab.c"
+    break;
+
+  case 189: /* statement: labeled_statement  */
+#line 1040 "src/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3341 "build/grammar_c.tab.c"
+    break;
+
+  case 190: /* statement: compound_statement  */
+#line 1041 "src/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3347 "build/grammar_c.tab.c"
+    break;
+
+  case 191: /* statement: expression_statement  */
+#line 1042 "src/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3353 "build/grammar_c.tab.c"
+    break;
+
+  case 192: /* statement: selection_statement  */
+#line 1043 "src/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3359 "build/grammar_c.tab.c"
+    break;
+
+  case 193: /* statement: iteration_statement  */
+#line 1044 "src/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3365 "build/grammar_c.tab.c"
+    break;
+
+  case 194: /* statement: jump_statement  */
+#line 1045 "src/grammar.y"
+                                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3371 "build/grammar_c.tab.c"
+    break;
+
+  case 195: /* labeled_statement: IDENTIFIER ':' statement  */
+#line 1050 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_LABEL_STMT);
+			/* Set label and statement */
+		}
+#line 3380 "build/grammar_c.tab.c"
+    break;
+
+  case 196: /* labeled_statement: CASE constant_expression ':' statement  */
+#line 1055 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_CASE_STMT);
+			(yyval.ast_node)->data.case_stmt.value = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.case_stmt.statement = (yyvsp[0].ast_node);
+		}
+#line 3390 "build/grammar_c.tab.c"
+    break;
+
+  case 197: /* labeled_statement: DEFAULT ':' statement  */
+#line 1061 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_DEFAULT_STMT);
+			(yyval.ast_node)->data.case_stmt.value = NULL;  /* no value for default */
+			(yyval.ast_node)->data.case_stmt.statement = (yyvsp[0].ast_node);
+		}
+#line 3400 "build/grammar_c.tab.c"
+    break;
+
+  case 198: /* compound_statement: '{' '}'  */
+#line 1070 "src/grammar.y"
+                { (yyval.ast_node) = create_compound_stmt_node(NULL); }
+#line 3406 "build/grammar_c.tab.c"
+    break;
+
+  case 199: /* compound_statement: '{' block_item_list '}'  */
+#line 1072 "src/grammar.y"
+                { (yyval.ast_node) = create_compound_stmt_node((yyvsp[-1].ast_node)); }
+#line 3412 "build/grammar_c.tab.c"
+    break;
+
+  case 200: /* block_item_list: block_item  */
+#line 1077 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3418 "build/grammar_c.tab.c"
+    break;
+
+  case 201: /* block_item_list: block_item_list block_item  */
+#line 1079 "src/grammar.y"
+                {
+			if ((yyvsp[-1].ast_node)) {
+				(yyval.ast_node) = (yyvsp[-1].ast_node);
+				ASTNode* current = (yyvsp[-1].ast_node);
+				while (current->next) current = current->next;
+				current->next = (yyvsp[0].ast_node);
+			} else {
+				(yyval.ast_node) = (yyvsp[0].ast_node);
+			}
+		}
+#line 3433 "build/grammar_c.tab.c"
+    break;
+
+  case 202: /* block_item: declaration  */
+#line 1093 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3439 "build/grammar_c.tab.c"
+    break;
+
+  case 203: /* block_item: statement  */
+#line 1095 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3445 "build/grammar_c.tab.c"
+    break;
+
+  case 204: /* declaration_list: declaration  */
+#line 1100 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3451 "build/grammar_c.tab.c"
+    break;
+
+  case 205: /* declaration_list: declaration_list declaration  */
+#line 1102 "src/grammar.y"
+                {
+			if ((yyvsp[-1].ast_node)) {
+				(yyval.ast_node) = (yyvsp[-1].ast_node);
+				ASTNode* current = (yyvsp[-1].ast_node);
+				while (current->next) current = current->next;
+				current->next = (yyvsp[0].ast_node);
+			} else {
+				(yyval.ast_node) = (yyvsp[0].ast_node);
+			}
+		}
+#line 3466 "build/grammar_c.tab.c"
+    break;
+
+  case 206: /* expression_statement: ';'  */
+#line 1118 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_EXPRESSION_STMT);
+			(yyval.ast_node)->data.return_stmt.expression = NULL; /* Reuse return_stmt structure for expression */
+		}
+#line 3475 "build/grammar_c.tab.c"
+    break;
+
+  case 207: /* expression_statement: expression ';'  */
+#line 1123 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_EXPRESSION_STMT);
+			(yyval.ast_node)->data.return_stmt.expression = (yyvsp[-1].ast_node); /* Store the expression */
+		}
+#line 3484 "build/grammar_c.tab.c"
+    break;
+
+  case 208: /* selection_statement: IF '(' expression ')' statement  */
+#line 1131 "src/grammar.y"
+                { (yyval.ast_node) = create_if_stmt_node((yyvsp[-2].ast_node), (yyvsp[0].ast_node), NULL); }
+#line 3490 "build/grammar_c.tab.c"
+    break;
+
+  case 209: /* selection_statement: IF '(' expression ')' statement ELSE statement  */
+#line 1133 "src/grammar.y"
+                { (yyval.ast_node) = create_if_stmt_node((yyvsp[-4].ast_node), (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 3496 "build/grammar_c.tab.c"
+    break;
+
+  case 210: /* selection_statement: SWITCH '(' expression ')' statement  */
+#line 1135 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_SWITCH_STMT);
+			(yyval.ast_node)->data.switch_stmt.expression = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.switch_stmt.body = (yyvsp[0].ast_node);
+		}
+#line 3506 "build/grammar_c.tab.c"
+    break;
+
+  case 211: /* iteration_statement: WHILE '(' expression ')' statement  */
+#line 1144 "src/grammar.y"
+                { (yyval.ast_node) = create_while_stmt_node((yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 3512 "build/grammar_c.tab.c"
+    break;
+
+  case 212: /* iteration_statement: DO statement WHILE '(' expression ')' ';'  */
+#line 1146 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_DO_WHILE_STMT);
+			(yyval.ast_node)->data.while_stmt.condition = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.while_stmt.body = (yyvsp[-5].ast_node);
+		}
+#line 3522 "build/grammar_c.tab.c"
+    break;
+
+  case 213: /* iteration_statement: FOR '(' expression_statement expression_statement ')' statement  */
+#line 1152 "src/grammar.y"
+                { (yyval.ast_node) = create_for_stmt_node((yyvsp[-3].ast_node), (yyvsp[-2].ast_node), NULL, (yyvsp[0].ast_node)); }
+#line 3528 "build/grammar_c.tab.c"
+    break;
+
+  case 214: /* iteration_statement: FOR '(' expression_statement expression_statement expression ')' statement  */
+#line 1154 "src/grammar.y"
+                { (yyval.ast_node) = create_for_stmt_node((yyvsp[-4].ast_node), (yyvsp[-3].ast_node), (yyvsp[-2].ast_node), (yyvsp[0].ast_node)); }
+#line 3534 "build/grammar_c.tab.c"
+    break;
+
+  case 215: /* iteration_statement: FOR '(' declaration expression_statement ')' statement  */
+#line 1156 "src/grammar.y"
+                {
+			/* C99: for (int i = 0; condition; ) body */
+			(yyval.ast_node) = create_ast_node(AST_FOR_STMT);
+			(yyval.ast_node)->data.for_stmt.init = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.for_stmt.condition = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.for_stmt.update = NULL;
+			(yyval.ast_node)->data.for_stmt.body = (yyvsp[0].ast_node);
+		}
+#line 3547 "build/grammar_c.tab.c"
+    break;
+
+  case 216: /* iteration_statement: FOR '(' declaration expression_statement expression ')' statement  */
+#line 1165 "src/grammar.y"
+                {
+			/* C99: for (int i = 0; condition; update) body */
+			(yyval.ast_node) = create_ast_node(AST_FOR_STMT);
+			(yyval.ast_node)->data.for_stmt.init = (yyvsp[-4].ast_node);
+			(yyval.ast_node)->data.for_stmt.condition = (yyvsp[-3].ast_node);
+			(yyval.ast_node)->data.for_stmt.update = (yyvsp[-2].ast_node);
+			(yyval.ast_node)->data.for_stmt.body = (yyvsp[0].ast_node);
+		}
+#line 3560 "build/grammar_c.tab.c"
+    break;
+
+  case 217: /* jump_statement: GOTO IDENTIFIER ';'  */
+#line 1177 "src/grammar.y"
+                {
+			(yyval.ast_node) = create_ast_node(AST_GOTO_STMT);
+			/* Set target label */
+		}
+#line 3569 "build/grammar_c.tab.c"
+    break;
+
+  case 218: /* jump_statement: CONTINUE ';'  */
+#line 1182 "src/grammar.y"
+                { (yyval.ast_node) = create_ast_node(AST_CONTINUE_STMT); }
+#line 3575 "build/grammar_c.tab.c"
+    break;
+
+  case 219: /* jump_statement: BREAK ';'  */
+#line 1184 "src/grammar.y"
+                { (yyval.ast_node) = create_ast_node(AST_BREAK_STMT); }
+#line 3581 "build/grammar_c.tab.c"
+    break;
+
+  case 220: /* jump_statement: RETURN ';'  */
+#line 1186 "src/grammar.y"
+                { (yyval.ast_node) = create_return_stmt_node(NULL); }
+#line 3587 "build/grammar_c.tab.c"
+    break;
+
+  case 221: /* jump_statement: RETURN expression ';'  */
+#line 1188 "src/grammar.y"
+                { (yyval.ast_node) = create_return_stmt_node((yyvsp[-1].ast_node)); }
+#line 3593 "build/grammar_c.tab.c"
+    break;
+
+  case 222: /* translation_unit: external_declaration  */
+#line 1193 "src/grammar.y"
+                {
+			program_ast = (yyvsp[0].ast_node);
+			(yyval.ast_node) = program_ast;
+		}
+#line 3602 "build/grammar_c.tab.c"
+    break;
+
+  case 223: /* translation_unit: translation_unit external_declaration  */
+#line 1198 "src/grammar.y"
+                {
+			if ((yyvsp[-1].ast_node) == NULL) {
+				program_ast = (yyvsp[0].ast_node);
+				(yyval.ast_node) = (yyvsp[0].ast_node);
+			} else {
+				if ((yyvsp[0].ast_node) != NULL) {
+					ASTNode* current = (yyvsp[-1].ast_node);
+					while (current->next) current = current->next;
+					current->next = (yyvsp[0].ast_node);
+				}
+				(yyval.ast_node) = (yyvsp[-1].ast_node);
+				program_ast = (yyval.ast_node);
+			}
+		}
+#line 3621 "build/grammar_c.tab.c"
+    break;
+
+  case 224: /* external_declaration: function_definition  */
+#line 1216 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3627 "build/grammar_c.tab.c"
+    break;
+
+  case 225: /* external_declaration: declaration  */
+#line 1218 "src/grammar.y"
+                { (yyval.ast_node) = (yyvsp[0].ast_node); }
+#line 3633 "build/grammar_c.tab.c"
+    break;
+
+  case 226: /* function_definition: declaration_specifiers declarator declaration_list compound_statement  */
+#line 1223 "src/grammar.y"
+                {
+			TypeInfo* full_type = (yyvsp[-3].type_info);
+			for (int i = 0; i < (yyvsp[-2].ast_node)->data.identifier.pointer_level; i++) {
+				full_type = create_pointer_type(full_type);
+			}
+			(yyval.ast_node) = create_function_def_node(full_type, (yyvsp[-2].ast_node)->data.identifier.name, (yyvsp[-1].ast_node), (yyvsp[0].ast_node), (yyvsp[-2].ast_node)->data.identifier.is_variadic);
+		}
+#line 3645 "build/grammar_c.tab.c"
+    break;
+
+  case 227: /* $@4: %empty  */
+#line 1231 "src/grammar.y"
+                {
+			/* Register parameters in local scope before parsing body */
+			symbol_clear_locals();
+			if ((yyvsp[0].ast_node)->data.identifier.parameters) {
+				ASTNode* p = (yyvsp[0].ast_node)->data.identifier.parameters;
+				while (p) {
+					if (p->type == AST_VARIABLE_DECL) {
+						Symbol* s = create_symbol(p->data.variable_decl.name, p->data.variable_decl.type);
+						s->is_parameter = 1;
+						symbol_add_local(s);
+					}
+					p = p->next;
+				}
+			}
+			/* Even if no params, ensure local scope is active */
+			if (g_local_symbols == NULL) {
+				Symbol* dummy = create_symbol("", create_type_info(TYPE_VOID));
+				symbol_add_local(dummy);
+			}
+		}
+#line 3670 "build/grammar_c.tab.c"
+    break;
+
+  case 228: /* function_definition: declaration_specifiers declarator $@4 compound_statement  */
+#line 1252 "src/grammar.y"
+                {
+			TypeInfo* full_type = (yyvsp[-3].type_info);
+			for (int i = 0; i < (yyvsp[-2].ast_node)->data.identifier.pointer_level; i++) {
+				full_type = create_pointer_type(full_type);
+			}
+			ASTNode* params = ((yyvsp[-2].ast_node)->data.identifier.parameters) ? (yyvsp[-2].ast_node)->data.identifier.parameters : NULL;
+			(yyval.ast_node) = create_function_def_node(full_type, (yyvsp[-2].ast_node)->data.identifier.name, params, (yyvsp[0].ast_node), (yyvsp[-2].ast_node)->data.identifier.is_variadic);
+			symbol_clear_locals();
+		}
+#line 3684 "build/grammar_c.tab.c"
+    break;
+
+  case 229: /* function_definition: declarator declaration_list compound_statement  */
+#line 1262 "src/grammar.y"
+                {
+			TypeInfo* full_type = create_type_info(TYPE_INT);
+			for (int i = 0; i < (yyvsp[-2].ast_node)->data.identifier.pointer_level; i++) {
+				full_type = create_pointer_type(full_type);
+			}
+			(yyval.ast_node) = create_function_def_node(full_type, (yyvsp[-2].ast_node)->data.identifier.name, (yyvsp[-1].ast_node), (yyvsp[0].ast_node), (yyvsp[-2].ast_node)->data.identifier.is_variadic);
+		}
+#line 3696 "build/grammar_c.tab.c"
+    break;
+
+  case 230: /* function_definition: declarator compound_statement  */
+#line 1270 "src/grammar.y"
+                {
+			TypeInfo* full_type = create_type_info(TYPE_INT);
+			for (int i = 0; i < (yyvsp[-1].ast_node)->data.identifier.pointer_level; i++) {
+				full_type = create_pointer_type(full_type);
+			}
+			(yyval.ast_node) = create_function_def_node(full_type, (yyvsp[-1].ast_node)->data.identifier.name, NULL, (yyvsp[0].ast_node), (yyvsp[-1].ast_node)->data.identifier.is_variadic);
+		}
+#line 3708 "build/grammar_c.tab.c"
+    break;
+
+
+#line 3712 "build/grammar_c.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1279 "src/grammar.y"
+
+
+extern int yylineno;
+
+
+
+int yyerror(const char* s) {
+
+	fflush(stdout);
+
+	printf("\nError near '%s' at line %d, column %d: %s\n", yytext, yylineno, column, s);
+
+	return 0;
+
+}
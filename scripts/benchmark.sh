@@ -336,6 +336,175 @@ run_stress_tests() {
     done
 }
 
+# Measure batch-driver throughput from 1 job up to the core count
+run_scaling() {
+    print_header "Batch Scaling (-j)"
+
+    local scaling_dir="$BENCHMARK_DIR/scaling"
+    local output_dir="$scaling_dir/out"
+    rm -rf "$scaling_dir"
+    mkdir -p "$scaling_dir"
+
+    # Replicate the fixtures that compile cleanly into a larger corpus
+    local copies="${SCALING_COPIES:-20}"
+    local corpus=()
+    for test_file in "$TEST_FILES_DIR"/*.c; do
+        if ! ("$COMPILER" "$test_file" -o /dev/null) >/dev/null 2>&1; then
+            continue
+        fi
+        local name="$(basename "$test_file" .c)"
+        for ((i = 1; i <= copies; i++)); do
+            cp "$test_file" "$scaling_dir/${name}_$i.c"
+            corpus+=("$scaling_dir/${name}_$i.c")
+        done
+    done
+
+    if [ ${#corpus[@]} -eq 0 ]; then
+        print_warning "No compilable fixtures found in $TEST_FILES_DIR"
+        return
+    fi
+
+    local cores=$(getconf _NPROCESSORS_ONLN 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 1)
+    local base_ms=""
+
+    printf "  %-8s %12s %12s %10s\n" "Jobs" "Time (ms)" "Files/sec" "Speedup"
+    printf "  %-8s %12s %12s %10s\n" "----" "---------" "---------" "-------"
+
+    local jobs=1
+    while [ "$jobs" -le "$cores" ]; do
+        rm -rf "$output_dir"
+        local ms=$("$COMPILER" -v -j "$jobs" "${corpus[@]}" -o "$output_dir" 2>&1 |
+            awk '/^Batch:/ { for (i = 1; i <= NF; i++) if ($(i + 1) == "ms") print $i }')
+        if [ -z "$ms" ]; then
+            print_warning "Batch run with -j $jobs failed"
+            break
+        fi
+        [ -z "$base_ms" ] && base_ms="$ms"
+        awk -v j="$jobs" -v ms="$ms" -v base="$base_ms" -v n="${#corpus[@]}" \
+            'BEGIN { printf "  %-8s %12.3f %12.1f %9.2fx\n", j, ms, n * 1000 / ms, base / ms }'
+        echo "$jobs,$ms,${#corpus[@]}" >> "$RESULTS_DIR/scaling_results.csv"
+
+        if [ "$jobs" -lt "$cores" ] && [ $((jobs * 2)) -gt "$cores" ]; then
+            jobs=$cores
+        else
+            jobs=$((jobs * 2))
+        fi
+    done
+
+    print_success "Compiled ${#corpus[@]} files per run"
+}
+
+# Measure function-level codegen threads on one large translation unit
+run_codegen_scaling() {
+    print_header "Codegen Scaling (--codegen-jobs)"
+
+    local scaling_dir="$BENCHMARK_DIR/scaling"
+    local unit="$scaling_dir/many_functions.c"
+    local functions="${SCALING_FUNCTIONS:-2000}"
+    mkdir -p "$scaling_dir"
+
+    : > "$unit"
+    for ((i = 0; i < functions; i++)); do
+        cat >> "$unit" << EOF
+int func_$i(int a, int b) {
+    while (a != b) {
+        if (a > b) a = a - b; else b = b - a;
+    }
+    return a * $i;
+}
+EOF
+    done
+
+    local cores=$(getconf _NPROCESSORS_ONLN 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 1)
+    local base_ms=""
+
+    printf "  %-8s %12s %10s %10s\n" "Threads" "Codegen (ms)" "Speedup" "Output"
+    printf "  %-8s %12s %10s %10s\n" "-------" "------------" "-------" "------"
+
+    local jobs=1
+    while [ "$jobs" -le "$cores" ]; do
+        local output="$scaling_dir/many_functions_$jobs.ll"
+        local ms=$("$COMPILER" -v --codegen-jobs "$jobs" "$unit" -o "$output" 2>&1 |
+            sed -n 's/^LLVM IR generation completed (\([0-9.]*\) ms)$/\1/p')
+        if [ -z "$ms" ]; then
+            print_warning "Codegen run with $jobs thread(s) failed"
+            break
+        fi
+        [ -z "$base_ms" ] && base_ms="$ms"
+        local same="identical"
+        cmp -s "$scaling_dir/many_functions_1.ll" "$output" || same="DIFFERS"
+        awk -v j="$jobs" -v ms="$ms" -v base="$base_ms" -v same="$same" \
+            'BEGIN { printf "  %-8s %12.3f %9.2fx %10s\n", j, ms, base / ms, same }'
+
+        if [ "$jobs" -lt "$cores" ] && [ $((jobs * 2)) -gt "$cores" ]; then
+            jobs=$cores
+        else
+            jobs=$((jobs * 2))
+        fi
+    done
+
+    print_success "Generated $functions functions per run"
+}
+
+# Time the C port compiling its own sources, preprocessed the way the
+# bootstrap does. Set SELF_COMPILE_BASELINE to another ccompiler_c build
+# (e.g. from an older commit) to compare the two on the same inputs.
+run_self_compile() {
+    print_header "C Port Self-Compilation"
+
+    local c_compiler="${C_COMPILER:-$PROJECT_DIR/ccompiler_c}"
+    local runs="${SELF_COMPILE_RUNS:-20}"
+    local self_dir="$BENCHMARK_DIR/self_compile"
+    mkdir -p "$self_dir"
+
+    if [ ! -x "$c_compiler" ]; then
+        print_warning "C port not found at $c_compiler; run 'make' first"
+        return
+    fi
+
+    # Average wall time per compile in ms, or "failed". Runs in an empty
+    # directory so temporary files a compiler leaves behind are counted
+    time_compiler() {
+        local compiler="$1" input="$2" output="$3" work="$self_dir/work"
+        rm -rf "$work" && mkdir -p "$work"
+        if ! (cd "$work" && "$compiler" "$input" > "$output") 2>/dev/null; then
+            echo "failed -"
+            return
+        fi
+        local start=$(date +%s%N)
+        for ((i = 0; i < runs; i++)); do
+            (cd "$work" && "$compiler" "$input" > "$output" 2>/dev/null)
+        done
+        local end=$(date +%s%N)
+        local leftovers=$(ls -A "$work" | wc -l | tr -d ' ')
+        awk -v ns=$((end - start)) -v n="$runs" -v left="$leftovers" \
+            'BEGIN { printf "%.3f %d\n", ns / n / 1000000, left }'
+    }
+
+    printf "  %-14s %10s %10s %8s\n" "Source" "Time (ms)" "Baseline" "Temps"
+    printf "  %-14s %10s %10s %8s\n" "------" "---------" "--------" "-----"
+    local source name ms left base_ms base_left
+    for source in "$PROJECT_DIR"/src/*.c; do
+        name=$(basename "$source" .c)
+        gcc -E -P "$source" -I"$PROJECT_DIR/src" -I"$PROJECT_DIR/build" \
+            -I"$PROJECT_DIR/stubs" -nostdinc > "$self_dir/$name.pre.c" 2>/dev/null || continue
+
+        read -r ms left <<< \
+            "$(time_compiler "$c_compiler" "$self_dir/$name.pre.c" "$self_dir/$name.ll")"
+        base_ms="-"
+        if [ -n "$SELF_COMPILE_BASELINE" ]; then
+            read -r base_ms base_left <<< "$(time_compiler "$SELF_COMPILE_BASELINE" \
+                "$self_dir/$name.pre.c" "$self_dir/$name.baseline.ll")"
+            if [ "$ms" != "failed" ] && ! cmp -s "$self_dir/$name.ll" "$self_dir/$name.baseline.ll"; then
+                print_warning "$name: output differs from baseline"
+            fi
+        fi
+        printf "  %-14s %10s %10s %8s\n" "$name" "$ms" "$base_ms" "$left"
+    done
+
+    print_success "Self-compilation timed over $runs runs per source"
+}
+
 # Generate performance report
 generate_report() {
     print_header "Generating Performance Report"
@@ -459,6 +628,18 @@ main() {
     if [ "$1" = "--stress" ] || [ "$2" = "--stress" ]; then
         run_stress_tests
     fi
+
+    # Run the -j scaling sweep if requested
+    if [ "$1" = "--scaling" ] || [ "$2" = "--scaling" ]; then
+        echo "jobs,time_ms,files" > "$RESULTS_DIR/scaling_results.csv"
+        run_scaling
+        run_codegen_scaling
+    fi
+
+    # Time the C port on its own code generator if requested
+    if [ "$1" = "--self-compile" ] || [ "$2" = "--self-compile" ]; then
+        run_self_compile
+    fi
     
     # Generate report
     generate_report
@@ -3,6 +3,7 @@
 #include "memory.h"
 #include "error.h"
 #include "common.h"
+#include "string_pool.h"
 #include <ctype.h>
 
 ASTNode* create_ast_node(ASTNodeType type) {
@@ -38,8 +39,11 @@ ASTNode* create_constant_node(int value, DataType type) {
 
 ASTNode* create_string_literal_node(const char* string) {
     ASTNode* node = create_ast_node(AST_STRING_LITERAL);
-    node->data.string_literal.string = arena_strdup(g_compiler_arena, string);
-    node->data.string_literal.length = strlen(string);
+    /* Decoded once here; codegen works on the bytes */
+    size_t len = strlen(string);
+    char* bytes = (char*)arena_alloc(g_compiler_arena, len + 1);
+    node->data.string_literal.length = string_literal_decode(string, len, bytes);
+    node->data.string_literal.string = bytes;
     node->data_type = create_pointer_type(create_type_info(TYPE_CHAR));
     return node;
 }
@@ -199,6 +203,7 @@ TypeInfo* create_type_info(DataType base_type) {
     type->size = 0;
     type->alignment = 0;
     type->is_unsigned = (base_type == TYPE_UNSIGNED);
+    type->llvm_name = NULL;
     type->next = NULL;
     return type;
 }
@@ -208,6 +213,7 @@ TypeInfo* duplicate_type_info(TypeInfo* original) {
     TypeInfo* type = (TypeInfo*)arena_alloc(g_compiler_arena, sizeof(TypeInfo));
     memcpy(type, original, sizeof(TypeInfo));
     type->next = NULL; /* Don't copy the next pointer */
+    type->llvm_name = NULL; /* Copies are usually changed before use */
     return type;
 }
 
@@ -137,6 +137,7 @@ struct TypeInfo {
     int size;
     int alignment;
     int is_unsigned;              /* for unsigned types */
+    char* llvm_name;              /* LLVM spelling, cached by codegen */
     struct TypeInfo* next;        /* for type lists */
 };
 
@@ -3,6 +3,7 @@
 #include "symbols.h"
 #include "error.h"
 #include "memory.h"
+#include "string_pool.h"
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
@@ -10,20 +11,14 @@
 static CodeGenContext g_ctx;
 static int g_next_label_id = 0;
 
-typedef struct StringLiteral {
-    char* label; char* value; int length; struct StringLiteral* next;
-} StringLiteral;
-
-static StringLiteral* g_string_literals = NULL;
-
-void add_string_literal(char* label, char* value, int length) {
-    StringLiteral* s = (StringLiteral*)arena_alloc(g_compiler_arena, sizeof(StringLiteral));
-    s->label = label; s->value = arena_strdup(g_compiler_arena, value); s->length = length;
-    s->next = g_string_literals; g_string_literals = s;
-}
+/* String literals by content; each entry's label names its global */
+static StringPool g_strings;
 
 void codegen_init(FILE* output) {
-    g_ctx.output = output; g_ctx.alloca_file = NULL; g_ctx.next_reg_id = 0; g_next_label_id = 0; g_string_literals = NULL;
+    g_ctx.output = output; g_ctx.next_reg_id = 0; g_next_label_id = 0;
+    g_ctx.module.length = 0; g_ctx.allocas.length = 0; g_ctx.body.length = 0;
+    g_ctx.target = &g_ctx.module; g_ctx.in_function = 0;
+    string_pool_free(&g_strings); string_pool_init(&g_strings);
     g_ctx.labels = NULL; g_ctx.current_break_label = NULL; g_ctx.current_continue_label = NULL;
 }
 
@@ -93,8 +88,9 @@ char* get_next_reg(void) {
     sprintf(reg, "r%d", g_ctx.next_reg_id++); return reg;
 }
 
-char* llvm_type_to_string(TypeInfo* type) {
-    if (!type) return arena_strdup(g_compiler_arena, "i32");
+char* llvm_type_to_string(TypeInfo* type);
+
+static char* spell_type(TypeInfo* type) {
     char* base_str = NULL;
     switch (type->base_type) {
         case TYPE_VOID:   base_str = (type->pointer_level > 0) ? "i8" : "void"; break;
@@ -140,17 +136,58 @@ char* llvm_type_to_string(TypeInfo* type) {
         strcpy(ptr_str, base_str); for (int i = 0; i < type->pointer_level; i++) strcat(ptr_str, "*");
         return ptr_str;
     }
-    return arena_strdup(g_compiler_arena, base_str);
+    return base_str; /* A literal or an immutable spelling */
+}
+
+/* Spelled once per TypeInfo; the result is shared and must not change */
+char* llvm_type_to_string(TypeInfo* type) {
+    if (!type) return "i32";
+    if (!type->llvm_name) type->llvm_name = spell_type(type);
+    return type->llvm_name;
+}
+
+/* Make room for extra more bytes (plus a terminator) in s */
+static void segment_reserve(IRSegment* s, size_t extra) {
+    if (s->capacity - s->length > extra) return;
+    size_t capacity = s->capacity ? s->capacity * 2 : 4096;
+    while (capacity - s->length <= extra) capacity *= 2;
+    char* data = (char*)realloc(s->data, capacity);
+    if (!data) fatal_error("Out of memory for generated IR");
+    s->data = data; s->capacity = capacity;
+}
+
+static void segment_append(IRSegment* s, const char* text, size_t length) {
+    segment_reserve(s, length);
+    memcpy(s->data + s->length, text, length); s->length += length;
+}
+
+/* Format into s if it fits; otherwise grow s and return 0 so the caller
+ * can format again (va_copy is not available when bootstrapping) */
+static int segment_try_vprintf(IRSegment* s, const char* format, va_list args) {
+    size_t room = s->capacity - s->length;
+    int n = vsnprintf(room ? s->data + s->length : NULL, room, format, args);
+    if (n < 0) return 1;
+    if ((size_t)n >= room) { segment_reserve(s, (size_t)n); return 0; }
+    s->length += n; return 1;
+}
+
+/* Append formatted text to the current segment */
+static void emit_text(const char* format, ...) {
+    va_list args; va_start(args, format);
+    int done = segment_try_vprintf(g_ctx.target, format, args);
+    va_end(args);
+    if (!done) { va_start(args, format); segment_try_vprintf(g_ctx.target, format, args); va_end(args); }
 }
 
 void emit_instruction(const char* format, ...) {
+    IRSegment* target = g_ctx.target;
+    if (g_ctx.in_function && strstr(format, "= alloca")) target = &g_ctx.allocas;
+    segment_append(target, "  ", 2);
     va_list args; va_start(args, format);
-    FILE* target = g_ctx.output;
-    if (g_ctx.alloca_file && strstr(format, "= alloca")) {
-        target = g_ctx.alloca_file;
-    }
-    fprintf(target, "  "); vfprintf(target, format, args); fprintf(target, "\n");
+    int done = segment_try_vprintf(target, format, args);
     va_end(args);
+    if (!done) { va_start(args, format); segment_try_vprintf(target, format, args); va_end(args); }
+    segment_append(target, "\n", 1);
 }
 
 LLVMValue* create_llvm_value(LLVMValueType type, const char* name, TypeInfo* llvm_type) {
@@ -326,11 +363,12 @@ LLVMValue* gen_expression(ASTNode* expr) {
             return cast_to_type(val, expr->data.cast_expr.target_type);
         }
         case AST_STRING_LITERAL: {
-            char* label = get_next_label(".str"); char* val = expr->data.string_literal.string; int len = expr->data.string_literal.length;
-            if (val[0] == '\"') { val++; len -= 2; }
-            int true_len = 0; for (int i = 0; i < len; i++) { if (val[i] == '\\') { if (i + 1 < len) { i++; true_len++; } } else true_len++; }
-            add_string_literal(label, val, len); char* gep = (char*)arena_alloc(g_compiler_arena, 128);
-            sprintf(gep, "getelementptr inbounds ([%d x i8], [%d x i8]* @%s, i32 0, i32 0)", true_len + 1, true_len + 1, label);
+            int is_new = 0; int len = expr->data.string_literal.length;
+            int id = string_pool_intern(&g_strings, expr->data.string_literal.string, len, &is_new);
+            if (id < 0) { error_report("Out of memory for string literal"); return NULL; }
+            if (is_new) g_strings.entries[id].label = get_next_label(".str");
+            char* label = g_strings.entries[id].label; char* gep = (char*)arena_alloc(g_compiler_arena, 128);
+            sprintf(gep, "getelementptr inbounds ([%d x i8], [%d x i8]* @%s, i32 0, i32 0)", len + 1, len + 1, label);
             return create_llvm_value(LLVM_VALUE_CONSTANT, gep, create_pointer_type(create_type_info(TYPE_CHAR)));
         }
         case AST_CONDITIONAL: {
@@ -356,33 +394,33 @@ LLVMValue* gen_expression(ASTNode* expr) {
             emit_instruction("br i1 %%%s, label %%%s, label %%%s", cond_reg, then_label, else_label);
 
             /* Then branch */
-            fprintf(g_ctx.output, "%s:\n", then_label);
+            emit_text("%s:\n", then_label);
             LLVMValue* then_val = gen_expression(expr->data.conditional_expr.then_expr);
             char* then_phi_label = then_label;
             int then_needs_cast = (strcmp(llvm_type_to_string(then_val->llvm_type), llvm_type_to_string(common_type)) != 0);
             if (then_needs_cast) {
                 then_phi_label = get_next_label("cond_then_cast");
                 emit_instruction("br label %%%s", then_phi_label);
-                fprintf(g_ctx.output, "%s:\n", then_phi_label);
+                emit_text("%s:\n", then_phi_label);
                 then_val = cast_to_type(then_val, common_type);
             }
             emit_instruction("br label %%%s", end_label);
 
             /* Else branch */
-            fprintf(g_ctx.output, "%s:\n", else_label);
+            emit_text("%s:\n", else_label);
             LLVMValue* else_val = gen_expression(expr->data.conditional_expr.else_expr);
             char* else_phi_label = else_label;
             int else_needs_cast = (strcmp(llvm_type_to_string(else_val->llvm_type), llvm_type_to_string(common_type)) != 0);
             if (else_needs_cast) {
                 else_phi_label = get_next_label("cond_else_cast");
                 emit_instruction("br label %%%s", else_phi_label);
-                fprintf(g_ctx.output, "%s:\n", else_phi_label);
+                emit_text("%s:\n", else_phi_label);
                 else_val = cast_to_type(else_val, common_type);
             }
             emit_instruction("br label %%%s", end_label);
 
             /* End block with phi */
-            fprintf(g_ctx.output, "%s:\n", end_label);
+            emit_text("%s:\n", end_label);
             if (!then_val || !else_val) return NULL;
             char* res_reg = get_next_reg();
             char* res_type = llvm_type_to_string(common_type);
@@ -471,32 +509,32 @@ LLVMValue* gen_expression(ASTNode* expr) {
             char* ret_type_str = llvm_type_to_string(ret_type);
             char* params_str = (char*)arena_alloc(g_compiler_arena, 512); params_str[0] = '\0';
             for (int i = 0; i < arg_count; i++) { if (i > 0) strcat(params_str, ", "); if (!args[i]) strcat(params_str, "i32"); else strcat(params_str, llvm_type_to_string(args[i]->llvm_type)); }
-            fprintf(g_ctx.output, "  %s%s%s call %s ", res_reg ? "%" : "", res_reg ? res_reg : "", res_reg ? " =" : "", ret_type_str);
+            emit_text("  %s%s%s call %s ", res_reg ? "%" : "", res_reg ? res_reg : "", res_reg ? " =" : "", ret_type_str);
 
             if (func_type && func_type->is_variadic) {
-                fprintf(g_ctx.output, "(");
+                emit_text("(");
                 ASTNode* p = func_type->parameters;
                 while (p) {
-                    if (p->type == AST_VARIABLE_DECL) fprintf(g_ctx.output, "%s", llvm_type_to_string(p->data.variable_decl.type));
-                    else fprintf(g_ctx.output, "i32");
-                    fprintf(g_ctx.output, ", "); p = p->next;
+                    if (p->type == AST_VARIABLE_DECL) emit_text("%s", llvm_type_to_string(p->data.variable_decl.type));
+                    else emit_text("i32");
+                    emit_text(", "); p = p->next;
                 }
-                fprintf(g_ctx.output, "...) ");
+                emit_text("...) ");
             } else if (func_type) {
                 /* Use full signature for non-variadic calls too for better compatibility */
-                fprintf(g_ctx.output, "(%s) ", params_str);
+                emit_text("(%s) ", params_str);
             } else {
-                if (!func_val && strcmp(func_name, "printf") == 0) fprintf(g_ctx.output, "(i8*, ...) ");
-                else if (!func_val && strcmp(func_name, "fprintf") == 0) fprintf(g_ctx.output, "(i8*, i8*, ...) ");
-                else fprintf(g_ctx.output, "(%s) ", params_str);
+                if (!func_val && strcmp(func_name, "printf") == 0) emit_text("(i8*, ...) ");
+                else if (!func_val && strcmp(func_name, "fprintf") == 0) emit_text("(i8*, i8*, ...) ");
+                else emit_text("(%s) ", params_str);
             }
 
-            if (func_val) fprintf(g_ctx.output, "%s", format_operand(func_val));
-            else fprintf(g_ctx.output, "@%s", func_name);
+            if (func_val) emit_text("%s", format_operand(func_val));
+            else emit_text("@%s", func_name);
 
-            fprintf(g_ctx.output, "(");
-            for (int i = 0; i < arg_count; i++) { if (!args[i]) { fprintf(g_ctx.output, "i32 0%s", (i < arg_count - 1) ? ", " : ""); continue; } fprintf(g_ctx.output, "%s %s%s", llvm_type_to_string(args[i]->llvm_type), format_operand(args[i]), (i < arg_count - 1) ? ", " : ""); }
-            fprintf(g_ctx.output, ")\n"); free(args); if (res_reg) return create_llvm_value(LLVM_VALUE_REGISTER, res_reg, ret_type); else return NULL;
+            emit_text("(");
+            for (int i = 0; i < arg_count; i++) { if (!args[i]) { emit_text("i32 0%s", (i < arg_count - 1) ? ", " : ""); continue; } emit_text("%s %s%s", llvm_type_to_string(args[i]->llvm_type), format_operand(args[i]), (i < arg_count - 1) ? ", " : ""); }
+            emit_text(")\n"); free(args); if (res_reg) return create_llvm_value(LLVM_VALUE_REGISTER, res_reg, ret_type); else return NULL;
         }
         case AST_BINARY_OP: {
             if (expr->data.binary_op.op == OP_AND || expr->data.binary_op.op == OP_OR) {
@@ -517,7 +555,7 @@ LLVMValue* gen_expression(ASTNode* expr) {
                 if (is_and) emit_instruction("br i1 %%%s, label %%%s, label %%%s", left_cond, right_label, end_label);
                 else emit_instruction("br i1 %%%s, label %%%s, label %%%s", left_cond, end_label, right_label);
 
-                fprintf(g_ctx.output, "%s:\n", right_label);
+                emit_text("%s:\n", right_label);
                 LLVMValue* right = gen_expression(expr->data.binary_op.right);
                 char* right_cond = NULL;
                 if (right) {
@@ -532,7 +570,7 @@ LLVMValue* gen_expression(ASTNode* expr) {
                 }
                 emit_instruction("br label %%%s", end_label);
 
-                fprintf(g_ctx.output, "%s:\n", end_label);
+                emit_text("%s:\n", end_label);
                 if (!right) return NULL;
                 char* final_res = get_next_reg();
                 emit_instruction("%%%s = load i32, i32* %%%s", final_res, res_name);
@@ -711,50 +749,50 @@ void gen_statement(ASTNode* stmt) {
             LLVMValue* cond = gen_expression(stmt->data.if_stmt.condition); if (!cond) break;
             char* cond_reg = get_next_reg(); emit_instruction("%%%s = icmp ne %s %s, %s", cond_reg, llvm_type_to_string(cond->llvm_type), format_operand(cond), (cond->llvm_type->pointer_level > 0) ? "null" : "0");
             emit_instruction("br i1 %%%s, label %%%s, label %%%s", cond_reg, then_label, else_label ? else_label : end_label);
-            fprintf(g_ctx.output, "%s:\n", then_label); gen_statement(stmt->data.if_stmt.then_stmt); emit_instruction("br label %%%s", end_label);
-            if (else_label) { fprintf(g_ctx.output, "%s:\n", else_label); gen_statement(stmt->data.if_stmt.else_stmt); emit_instruction("br label %%%s", end_label); }
-            fprintf(g_ctx.output, "%s:\n", end_label); break;
+            emit_text("%s:\n", then_label); gen_statement(stmt->data.if_stmt.then_stmt); emit_instruction("br label %%%s", end_label);
+            if (else_label) { emit_text("%s:\n", else_label); gen_statement(stmt->data.if_stmt.else_stmt); emit_instruction("br label %%%s", end_label); }
+            emit_text("%s:\n", end_label); break;
         }
         case AST_WHILE_STMT: {
             char* cond_label = get_next_label("while_cond"); char* body_label = get_next_label("while_body"); char* end_label = get_next_label("while_end");
             char* old_break = g_ctx.current_break_label; char* old_cont = g_ctx.current_continue_label;
             g_ctx.current_break_label = end_label; g_ctx.current_continue_label = cond_label;
-            emit_instruction("br label %%%s", cond_label); fprintf(g_ctx.output, "%s:\n", cond_label);
+            emit_instruction("br label %%%s", cond_label); emit_text("%s:\n", cond_label);
             ASTNode* cond_node = stmt->data.while_stmt.condition; if (cond_node && cond_node->type == AST_EXPRESSION_STMT) cond_node = cond_node->data.return_stmt.expression;
             if (cond_node) {
                 LLVMValue* cond = gen_expression(cond_node);
                 if (cond) { char* cond_reg = get_next_reg(); emit_instruction("%%%s = icmp ne %s %s, %s", cond_reg, llvm_type_to_string(cond->llvm_type), format_operand(cond), (cond->llvm_type->pointer_level > 0) ? "null" : "0"); emit_instruction("br i1 %%%s, label %%%s, label %%%s", cond_reg, body_label, end_label); }
                 else emit_instruction("br label %%%s", body_label);
             } else emit_instruction("br label %%%s", body_label);
-            fprintf(g_ctx.output, "%s:\n", body_label); gen_statement(stmt->data.while_stmt.body); emit_instruction("br label %%%s", cond_label);
-            fprintf(g_ctx.output, "%s:\n", end_label); g_ctx.current_break_label = old_break; g_ctx.current_continue_label = old_cont; break;
+            emit_text("%s:\n", body_label); gen_statement(stmt->data.while_stmt.body); emit_instruction("br label %%%s", cond_label);
+            emit_text("%s:\n", end_label); g_ctx.current_break_label = old_break; g_ctx.current_continue_label = old_cont; break;
         }
         case AST_DO_WHILE_STMT: {
             char* body_label = get_next_label("do_body"); char* cond_label = get_next_label("do_cond"); char* end_label = get_next_label("do_end");
             char* old_break = g_ctx.current_break_label; char* old_cont = g_ctx.current_continue_label;
             g_ctx.current_break_label = end_label; g_ctx.current_continue_label = cond_label;
-            emit_instruction("br label %%%s", body_label); fprintf(g_ctx.output, "%s:\n", body_label);
+            emit_instruction("br label %%%s", body_label); emit_text("%s:\n", body_label);
             gen_statement(stmt->data.while_stmt.body); emit_instruction("br label %%%s", cond_label);
-            fprintf(g_ctx.output, "%s:\n", cond_label);
+            emit_text("%s:\n", cond_label);
             LLVMValue* cond = gen_expression(stmt->data.while_stmt.condition);
             if (cond) { char* cond_reg = get_next_reg(); emit_instruction("%%%s = icmp ne %s %s, %s", cond_reg, llvm_type_to_string(cond->llvm_type), format_operand(cond), (cond->llvm_type->pointer_level > 0) ? "null" : "0"); emit_instruction("br i1 %%%s, label %%%s, label %%%s", cond_reg, body_label, end_label); }
             else emit_instruction("br label %%%s", body_label);
-            fprintf(g_ctx.output, "%s:\n", end_label); g_ctx.current_break_label = old_break; g_ctx.current_continue_label = old_cont; break;
+            emit_text("%s:\n", end_label); g_ctx.current_break_label = old_break; g_ctx.current_continue_label = old_cont; break;
         }
         case AST_FOR_STMT: {
             char* cond_label = get_next_label("for_cond"); char* body_label = get_next_label("for_body"); char* incr_label = get_next_label("for_incr"); char* end_label = get_next_label("for_end");
             char* old_break = g_ctx.current_break_label; char* old_cont = g_ctx.current_continue_label;
             g_ctx.current_break_label = end_label; g_ctx.current_continue_label = incr_label;
-            gen_statement(stmt->data.for_stmt.init); emit_instruction("br label %%%s", cond_label); fprintf(g_ctx.output, "%s:\n", cond_label);
+            gen_statement(stmt->data.for_stmt.init); emit_instruction("br label %%%s", cond_label); emit_text("%s:\n", cond_label);
             ASTNode* cond_node = stmt->data.for_stmt.condition; if (cond_node && cond_node->type == AST_EXPRESSION_STMT) cond_node = cond_node->data.return_stmt.expression;
             if (cond_node) {
                 LLVMValue* cond = gen_expression(cond_node);
                 if (cond) { char* cond_reg = get_next_reg(); emit_instruction("%%%s = icmp ne %s %s, %s", cond_reg, llvm_type_to_string(cond->llvm_type), format_operand(cond), (cond->llvm_type->pointer_level > 0) ? "null" : "0"); emit_instruction("br i1 %%%s, label %%%s, label %%%s", cond_reg, body_label, end_label); }
                 else emit_instruction("br label %%%s", body_label);
             } else emit_instruction("br label %%%s", body_label);
-            fprintf(g_ctx.output, "%s:\n", body_label); gen_statement(stmt->data.for_stmt.body); emit_instruction("br label %%%s", incr_label);
-            fprintf(g_ctx.output, "%s:\n", incr_label); if (stmt->data.for_stmt.update) { ASTNode* u = stmt->data.for_stmt.update; if (u->type == AST_EXPRESSION_STMT) u = u->data.return_stmt.expression; gen_expression(u); }
-            emit_instruction("br label %%%s", cond_label); fprintf(g_ctx.output, "%s:\n", end_label); g_ctx.current_break_label = old_break; g_ctx.current_continue_label = old_cont; break;
+            emit_text("%s:\n", body_label); gen_statement(stmt->data.for_stmt.body); emit_instruction("br label %%%s", incr_label);
+            emit_text("%s:\n", incr_label); if (stmt->data.for_stmt.update) { ASTNode* u = stmt->data.for_stmt.update; if (u->type == AST_EXPRESSION_STMT) u = u->data.return_stmt.expression; gen_expression(u); }
+            emit_instruction("br label %%%s", cond_label); emit_text("%s:\n", end_label); g_ctx.current_break_label = old_break; g_ctx.current_continue_label = old_cont; break;
         }
         case AST_SWITCH_STMT: {
             LLVMValue* cond = gen_expression(stmt->data.switch_stmt.expression); if (!cond) break;
@@ -767,19 +805,19 @@ void gen_statement(ASTNode* stmt) {
                     char* next_cmp = get_next_label("switch_next"); char* cmp_reg = get_next_reg();
                     emit_instruction("%%%s = icmp eq %s %s, %d", cmp_reg, llvm_type_to_string(cond->llvm_type), format_operand(cond), c->value);
                     emit_instruction("br i1 %%%s, label %%%s, label %%%s", cmp_reg, c->label, next_cmp);
-                    fprintf(g_ctx.output, "%s:\n", next_cmp);
+                    emit_text("%s:\n", next_cmp);
                 }
                 c = c->next;
             }
             emit_instruction("br label %%%s", default_label);
             gen_statement(stmt->data.switch_stmt.body); emit_instruction("br label %%%s", end_label);
-            fprintf(g_ctx.output, "%s:\n", end_label); g_ctx.current_break_label = old_break; break;
+            emit_text("%s:\n", end_label); g_ctx.current_break_label = old_break; break;
         }
         case AST_CASE_STMT:
         case AST_DEFAULT_STMT: {
             if (stmt->data.case_stmt.label) {
                 emit_instruction("br label %%%s", stmt->data.case_stmt.label);
-                fprintf(g_ctx.output, "%s:\n", stmt->data.case_stmt.label);
+                emit_text("%s:\n", stmt->data.case_stmt.label);
             }
             gen_statement(stmt->data.case_stmt.statement); break;
         }
@@ -799,7 +837,7 @@ void gen_statement(ASTNode* stmt) {
         case AST_LABEL_STMT: {
             if (stmt->data.identifier.name) {
                 char* label = get_user_label(stmt->data.identifier.name);
-                emit_instruction("br label %%%s", label); fprintf(g_ctx.output, "%s:\n", label);
+                emit_instruction("br label %%%s", label); emit_text("%s:\n", label);
             }
             break;
         }
@@ -808,6 +846,23 @@ void gen_statement(ASTNode* stmt) {
     }
 }
 
+/* Encode every pooled literal straight into the module segment */
+static void emit_string_literals(void) {
+    size_t total = 0; int i;
+    for (i = 0; i < g_strings.count; i++) {
+        StringPoolEntry* e = &g_strings.entries[i];
+        total += strlen(e->label) + 96 + string_pool_encoded_length(&g_strings, e->bytes, e->length);
+    }
+    segment_reserve(&g_ctx.module, total);
+    IRSegment* out = &g_ctx.module;
+    for (i = 0; i < g_strings.count; i++) {
+        StringPoolEntry* e = &g_strings.entries[i];
+        out->length += sprintf(out->data + out->length, "@%s = private unnamed_addr constant [%d x i8] c\"", e->label, (int)e->length + 1);
+        out->length += string_pool_encode(&g_strings, e->bytes, e->length, out->data + out->length);
+        out->length += sprintf(out->data + out->length, "\\00\", align 1\n");
+    }
+}
+
 void codegen_run(ASTNode* ast) {
     if (!ast) return;
 
@@ -820,13 +875,13 @@ void codegen_run(ASTNode* ast) {
         s = s->next;
     }
 
-    fprintf(g_ctx.output, "; Generated LLVM IR\ntarget triple = \"arm64-apple-darwin\"\n\n");
+    emit_text("; Generated LLVM IR\ntarget triple = \"arm64-apple-darwin\"\n\n");
 
     /* Pre-pass: Emit hardcoded intrinsics that aren't in symbols */
-    fprintf(g_ctx.output, "declare void @llvm.va_start(i8*)\n");
-    fprintf(g_ctx.output, "declare void @llvm.va_end(i8*)\n");
-    fprintf(g_ctx.output, "declare void @llvm.memcpy.p0i8.p0i8.i64(i8* nocapture writeonly, i8* nocapture readonly, i64, i1 immarg)\n");
-    fprintf(g_ctx.output, "declare void @llvm.memset.p0i8.i64(i8* nocapture writeonly, i8, i64, i1 immarg)\n\n");
+    emit_text("declare void @llvm.va_start(i8*)\n");
+    emit_text("declare void @llvm.va_end(i8*)\n");
+    emit_text("declare void @llvm.memcpy.p0i8.p0i8.i64(i8* nocapture writeonly, i8* nocapture readonly, i64, i1 immarg)\n");
+    emit_text("declare void @llvm.memset.p0i8.i64(i8* nocapture writeonly, i8, i64, i1 immarg)\n\n");
 
     /* Pass 1: Collect/Update all global symbols from AST */
     ASTNode* curr = ast;
@@ -857,6 +912,7 @@ void codegen_run(ASTNode* ast) {
                 /* Update existing function symbol if we have parameters now and didn't before */
                 if (existing->type->base_type == TYPE_FUNCTION && !existing->type->parameters && type->parameters) {
                     existing->type->parameters = type->parameters;
+                    existing->type->llvm_name = NULL;
                 }
             }
         }
@@ -867,14 +923,14 @@ void codegen_run(ASTNode* ast) {
     TypeInfo* curr_type = g_all_structs;
     while (curr_type) {
         if (curr_type->base_type == TYPE_STRUCT || curr_type->base_type == TYPE_UNION) {
-            fprintf(g_ctx.output, "%%struct.%s = type { ", curr_type->struct_name);
+            emit_text("%%struct.%s = type { ", curr_type->struct_name);
             Symbol* m = curr_type->struct_members;
-            while (m) { fprintf(g_ctx.output, "%s%s", llvm_type_to_string(m->type), m->next ? ", " : ""); m = m->next; }
-            fprintf(g_ctx.output, " }\n");
+            while (m) { emit_text("%s%s", llvm_type_to_string(m->type), m->next ? ", " : ""); m = m->next; }
+            emit_text(" }\n");
         }
         curr_type = curr_type->next;
     }
-    fprintf(g_ctx.output, "\n");
+    emit_text("\n");
 
     /* Pass 3: Emit function definitions */
     curr = ast;
@@ -885,12 +941,9 @@ void codegen_run(ASTNode* ast) {
 
             symbol_clear_locals(); g_ctx.current_function_return_type = curr->data.function_def.return_type;
 
-            FILE* original_output = g_ctx.output;
-            g_ctx.alloca_file = fopen("alloca.tmp", "w+");
-            g_ctx.output = fopen("body.tmp", "w+");
-            if (!g_ctx.alloca_file || !g_ctx.output) {
-                fatal_error("Could not create temporary files for codegen");
-            }
+            /* Allocas and body are collected separately, then spliced */
+            g_ctx.allocas.length = 0; g_ctx.body.length = 0;
+            g_ctx.target = &g_ctx.body; g_ctx.in_function = 1;
 
             /* Handle parameters: add to symbol table and emit alloca/store */
             ASTNode* param = curr->data.function_def.parameters; int p_idx = 0;
@@ -907,27 +960,23 @@ void codegen_run(ASTNode* ast) {
 
             gen_statement(curr->data.function_def.body);
 
-            fclose(g_ctx.alloca_file);
-            fclose(g_ctx.output);
-            g_ctx.alloca_file = NULL;
-            g_ctx.output = original_output;
+            g_ctx.target = &g_ctx.module; g_ctx.in_function = 0;
 
-            fprintf(g_ctx.output, "define %s @%s(", llvm_type_to_string(curr->data.function_def.return_type), curr->data.function_def.name);
+            emit_text("define %s @%s(", llvm_type_to_string(curr->data.function_def.return_type), curr->data.function_def.name);
             param = curr->data.function_def.parameters; p_idx = 0;
-            while (param) { fprintf(g_ctx.output, "%s %%p%d%s", llvm_type_to_string(param->data.variable_decl.type), p_idx++, param->next ? ", " : ""); param = param->next; }
-            fprintf(g_ctx.output, ") {\n");
+            while (param) { emit_text("%s %%p%d%s", llvm_type_to_string(param->data.variable_decl.type), p_idx++, param->next ? ", " : ""); param = param->next; }
+            emit_text(") {\n");
 
-            /* Copy allocas collected during gen_statement */
-            FILE* f = fopen("alloca.tmp", "r");
-            if (f) { int c; while ((c = fgetc(f)) != EOF) fputc(c, g_ctx.output); fclose(f); }
-
-            /* Copy body */
-            f = fopen("body.tmp", "r");
-            if (f) { int c; while ((c = fgetc(f)) != EOF) fputc(c, g_ctx.output); fclose(f); }
+            /* Allocas first, then the body */
+            segment_reserve(&g_ctx.module, g_ctx.allocas.length + g_ctx.body.length);
+            memcpy(g_ctx.module.data + g_ctx.module.length, g_ctx.allocas.data, g_ctx.allocas.length);
+            g_ctx.module.length += g_ctx.allocas.length;
+            memcpy(g_ctx.module.data + g_ctx.module.length, g_ctx.body.data, g_ctx.body.length);
+            g_ctx.module.length += g_ctx.body.length;
 
             if (curr->data.function_def.return_type->base_type == TYPE_VOID && curr->data.function_def.return_type->pointer_level == 0) emit_instruction("ret void");
             else emit_instruction("ret %s %s", llvm_type_to_string(curr->data.function_def.return_type), (curr->data.function_def.return_type->pointer_level > 0) ? "null" : "0");
-            fprintf(g_ctx.output, "}\n\n");
+            emit_text("}\n\n");
         }
         curr = curr->next;
     }
@@ -940,13 +989,13 @@ void codegen_run(ASTNode* ast) {
             if (sym && sym->is_global && !sym->is_emitted) {
                 char* t_str = llvm_type_to_string(sym->type);
                 if (sym->type->storage_class == STORAGE_EXTERN) {
-                    fprintf(g_ctx.output, "@%s = external global %s\n", sym->name, t_str);
+                    emit_text("@%s = external global %s\n", sym->name, t_str);
                 } else if (sym->type->storage_class == STORAGE_TYPEDEF) {
                     /* Skip typedefs */
                 } else if (sym->type->base_type == TYPE_ARRAY || sym->type->base_type == TYPE_STRUCT || sym->type->base_type == TYPE_UNION) {
-                    fprintf(g_ctx.output, "@%s = global %s zeroinitializer\n", sym->name, t_str);
+                    emit_text("@%s = global %s zeroinitializer\n", sym->name, t_str);
                 } else {
-                    fprintf(g_ctx.output, "@%s = global %s %s\n", sym->name, t_str,
+                    emit_text("@%s = global %s %s\n", sym->name, t_str,
                         (sym->type->pointer_level > 0) ? "null" : "0");
                 }
                 sym->is_emitted = 1;
@@ -959,46 +1008,30 @@ void codegen_run(ASTNode* ast) {
     Symbol* g_sym = g_global_symbols;
     while (g_sym) {
         if (g_sym->type && g_sym->type->base_type == TYPE_FUNCTION && !g_sym->is_emitted && strncmp(g_sym->name, "llvm.", 5) != 0) {
-            fprintf(g_ctx.output, "declare %s @%s(", llvm_type_to_string(g_sym->type->return_type), g_sym->name);
+            emit_text("declare %s @%s(", llvm_type_to_string(g_sym->type->return_type), g_sym->name);
             ASTNode* p = g_sym->type->parameters;
             while (p) {
-                if (p->type == AST_VARIABLE_DECL) fprintf(g_ctx.output, "%s", llvm_type_to_string(p->data.variable_decl.type));
-                else fprintf(g_ctx.output, "i32");
-                if (p->next || g_sym->type->is_variadic) fprintf(g_ctx.output, ", ");
+                if (p->type == AST_VARIABLE_DECL) emit_text("%s", llvm_type_to_string(p->data.variable_decl.type));
+                else emit_text("i32");
+                if (p->next || g_sym->type->is_variadic) emit_text(", ");
                 p = p->next;
             }
-            if (g_sym->type->is_variadic) fprintf(g_ctx.output, "...");
-            fprintf(g_ctx.output, ")\n");
+            if (g_sym->type->is_variadic) emit_text("...");
+            emit_text(")\n");
             g_sym->is_emitted = 1;
         }
         g_sym = g_sym->next;
     }
 
-    StringLiteral* sl = g_string_literals;
-    while (sl) {
-        int already_emitted = 0; StringLiteral* p_sl = g_string_literals;
-        while (p_sl != sl) { if (strcmp(p_sl->label, sl->label) == 0) { already_emitted = 1; break; } p_sl = p_sl->next; }
-        if (!already_emitted) {
-            int true_len = 0; for (int i = 0; i < sl->length; i++) { if (sl->value[i] == '\\') { if (i + 1 < sl->length) { i++; true_len++; } } else true_len++; }
-            fprintf(g_ctx.output, "@%s = private unnamed_addr constant [%d x i8] c", sl->label, true_len + 1); fputc(34, g_ctx.output);
-            for (int i = 0; i < sl->length; i++) {
-                if (sl->value[i] == '\\') {
-                    if (i + 1 < sl->length) {
-                        if (sl->value[i+1] == 'n') { fputc(92, g_ctx.output); fprintf(g_ctx.output, "0A"); }
-                        else if (sl->value[i+1] == 't') { fputc(92, g_ctx.output); fprintf(g_ctx.output, "09"); }
-                        else if (sl->value[i+1] == 'r') { fputc(92, g_ctx.output); fprintf(g_ctx.output, "0D"); }
-                        else if (sl->value[i+1] == '0') { fputc(92, g_ctx.output); fprintf(g_ctx.output, "00"); }
-                        else if (sl->value[i+1] == '\\') { fputc(92, g_ctx.output); fprintf(g_ctx.output, "5C"); }
-                        else if (sl->value[i+1] == '"') { fputc(92, g_ctx.output); fprintf(g_ctx.output, "22"); }
-                        else fprintf(g_ctx.output, "%c", sl->value[i+1]); i++;
-                    }
-                } else if (sl->value[i] == '\"') { fputc(92, g_ctx.output); fprintf(g_ctx.output, "22"); }
-                else fprintf(g_ctx.output, "%c", sl->value[i]);
-            }
-            fputc(92, g_ctx.output); fprintf(g_ctx.output, "00"); fputc(34, g_ctx.output); fprintf(g_ctx.output, ", align 1"); fputc(10, g_ctx.output);
-        }
-        sl = sl->next;
-    }
+    emit_string_literals();
+
+    /* One write for the whole module */
+    if (g_ctx.module.length) fwrite(g_ctx.module.data, 1, g_ctx.module.length, g_ctx.output);
+    fflush(g_ctx.output);
 }
 
-void codegen_cleanup(void) {}
+void codegen_cleanup(void) {
+    string_pool_free(&g_strings);
+    free(g_ctx.module.data); free(g_ctx.allocas.data); free(g_ctx.body.data);
+    memset(&g_ctx.module, 0, sizeof(IRSegment)); memset(&g_ctx.allocas, 0, sizeof(IRSegment)); memset(&g_ctx.body, 0, sizeof(IRSegment));
+}
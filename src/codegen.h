@@ -31,10 +31,21 @@ typedef struct LabelEntry {
     struct LabelEntry* next;
 } LabelEntry;
 
+/* Growable in-memory IR text */
+typedef struct IRSegment {
+    char* data;
+    size_t length;
+    size_t capacity;
+} IRSegment;
+
 /* Code generation context */
 typedef struct {
-    FILE* output;
-    FILE* alloca_file;
+    FILE* output;        /* Receives the module when codegen_run finishes */
+    IRSegment module;    /* Module text */
+    IRSegment allocas;   /* Allocas of the current function */
+    IRSegment body;      /* Body of the current function */
+    IRSegment* target;   /* Where text goes: module, or body in a function */
+    int in_function;
     int next_reg_id;
     int next_bb_id;
     char* current_function_name;
@@ -0,0 +1,189 @@
+#include "string_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static int hex_value(int c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+size_t string_literal_decode(const char* token, size_t length, char* out) {
+    size_t i = 0;
+    size_t end = length;
+    size_t j = 0;
+
+    if (end > 0 && token[0] == 'L') i = 1;
+    if (i < end && token[i] == '"') {
+        i++;
+        if (end > i && token[end - 1] == '"') end--;
+    }
+
+    while (i < end) {
+        int c = token[i];
+        if (c != '\\' || i + 1 >= end) {
+            out[j++] = (char)c;
+            i++;
+            continue;
+        }
+
+        c = token[i + 1];
+        i += 2;
+        if (c == 'n') out[j++] = '\n';
+        else if (c == 't') out[j++] = '\t';
+        else if (c == 'r') out[j++] = '\r';
+        else if (c == 'a') out[j++] = 7;
+        else if (c == 'b') out[j++] = 8;
+        else if (c == 'f') out[j++] = 12;
+        else if (c == 'v') out[j++] = 11;
+        else if (c >= '0' && c <= '7') {
+            /* Up to three octal digits */
+            int value = c - '0';
+            int digits = 1;
+            while (digits < 3 && i < end && token[i] >= '0' && token[i] <= '7') {
+                value = value * 8 + (token[i] - '0');
+                i++;
+                digits++;
+            }
+            out[j++] = (char)value;
+        } else if (c == 'x' && i < end && hex_value((int)token[i]) >= 0) {
+            int value = 0;
+            while (i < end && hex_value((int)token[i]) >= 0) {
+                value = value * 16 + hex_value((int)token[i]);
+                i++;
+            }
+            out[j++] = (char)value;
+        } else {
+            /* \\ \' \" \? and unknown escapes stand for the character */
+            out[j++] = (char)c;
+        }
+    }
+    out[j] = '\0';
+    return j;
+}
+
+void string_pool_init(StringPool* pool) {
+    int c;
+    memset(pool, 0, sizeof(StringPool));
+    for (c = 0; c < 256; c++) {
+        pool->escaped[c] = (char)(c < 32 || c >= 127 || c == '"' || c == '\\');
+    }
+    for (c = 0; c < 16; c++) {
+        pool->hex_digits[c] = (char)(c < 10 ? '0' + c : 'A' + c - 10);
+    }
+}
+
+void string_pool_free(StringPool* pool) {
+    int i;
+    for (i = 0; i < pool->count; i++) {
+        free(pool->entries[i].bytes);
+    }
+    free(pool->entries);
+    free(pool->slots);
+    pool->entries = NULL;
+    pool->slots = NULL;
+    pool->count = 0;
+    pool->capacity = 0;
+    pool->slot_count = 0;
+}
+
+static unsigned int hash_bytes(const char* bytes, size_t length) {
+    unsigned int hash = 5381;
+    size_t i;
+    for (i = 0; i < length; i++) {
+        hash = (hash * 33) ^ (unsigned int)(bytes[i] & 255);
+    }
+    return hash;
+}
+
+/* Rebuild the slot table with twice the slots; keeps the load under half */
+static int grow_slots(StringPool* pool) {
+    int slot_count = pool->slot_count ? pool->slot_count * 2 : 64;
+    int* slots = (int*)calloc((size_t)slot_count, sizeof(int));
+    int i;
+    if (!slots) return -1;
+
+    for (i = 0; i < pool->count; i++) {
+        int slot = (int)(pool->entries[i].hash & (unsigned int)(slot_count - 1));
+        while (slots[slot]) slot = (slot + 1) & (slot_count - 1);
+        slots[slot] = i + 1;
+    }
+    free(pool->slots);
+    pool->slots = slots;
+    pool->slot_count = slot_count;
+    return 0;
+}
+
+int string_pool_intern(StringPool* pool, const char* bytes, size_t length,
+                       int* is_new) {
+    unsigned int hash = hash_bytes(bytes, length);
+    StringPoolEntry* entry;
+    int slot;
+
+    *is_new = 0;
+    if ((pool->count + 1) * 2 > pool->slot_count && grow_slots(pool) != 0) {
+        return -1;
+    }
+
+    slot = (int)(hash & (unsigned int)(pool->slot_count - 1));
+    while (pool->slots[slot]) {
+        entry = &pool->entries[pool->slots[slot] - 1];
+        if (entry->hash == hash && entry->length == length &&
+            memcmp(entry->bytes, bytes, length) == 0) {
+            return pool->slots[slot] - 1;
+        }
+        slot = (slot + 1) & (pool->slot_count - 1);
+    }
+
+    if (pool->count == pool->capacity) {
+        int capacity = pool->capacity ? pool->capacity * 2 : 32;
+        StringPoolEntry* entries = (StringPoolEntry*)realloc(
+            pool->entries, (size_t)capacity * sizeof(StringPoolEntry));
+        if (!entries) return -1;
+        pool->entries = entries;
+        pool->capacity = capacity;
+    }
+
+    entry = &pool->entries[pool->count];
+    entry->bytes = (char*)malloc(length + 1);
+    if (!entry->bytes) return -1;
+    memcpy(entry->bytes, bytes, length);
+    entry->bytes[length] = '\0';
+    entry->length = length;
+    entry->label = NULL;
+    entry->hash = hash;
+
+    pool->slots[slot] = pool->count + 1;
+    *is_new = 1;
+    return pool->count++;
+}
+
+size_t string_pool_encoded_length(const StringPool* pool, const char* bytes,
+                                  size_t length) {
+    size_t encoded = length;
+    size_t i;
+    for (i = 0; i < length; i++) {
+        if (pool->escaped[bytes[i] & 255]) encoded += 2;
+    }
+    return encoded;
+}
+
+size_t string_pool_encode(const StringPool* pool, const char* bytes,
+                          size_t length, char* out) {
+    size_t j = 0;
+    size_t i;
+    for (i = 0; i < length; i++) {
+        int c = bytes[i] & 255;
+        if (pool->escaped[c]) {
+            out[j] = '\\';
+            out[j + 1] = pool->hex_digits[c >> 4];
+            out[j + 2] = pool->hex_digits[c & 15];
+            j += 3;
+        } else {
+            out[j++] = (char)c;
+        }
+    }
+    return j;
+}
@@ -0,0 +1,53 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <stddef.h>
+
+/*
+ * String literals, shared by the C and C++ ports.
+ *
+ * The parser decodes a literal token into its bytes once. Code generation
+ * interns the bytes in a StringPool, which keeps one entry per distinct
+ * content, and encodes each entry for LLVM's c"..." syntax through the
+ * pool's lookup tables. Written in the subset the C port compiles, so the
+ * tables are filled at init time rather than by static initializers.
+ */
+
+typedef struct StringPoolEntry {
+    char* bytes;   /* Decoded contents, NUL-terminated */
+    size_t length; /* Byte count without the terminator */
+    char* label;   /* Global name, owned by the caller */
+    unsigned int hash;
+} StringPoolEntry;
+
+typedef struct StringPool {
+    StringPoolEntry* entries; /* In first-use order */
+    int count;
+    int capacity;
+    int* slots; /* Open-addressing table of entry index + 1 (0: empty) */
+    int slot_count;
+    char escaped[256]; /* Bytes written as \XX inside c"..." */
+    char hex_digits[16];
+} StringPool;
+
+/* Decode a literal token (surrounding quotes and an L prefix optional)
+ * into out, which needs length + 1 bytes. Returns the decoded length. */
+size_t string_literal_decode(const char* token, size_t length, char* out);
+
+void string_pool_init(StringPool* pool);
+/* Drop every entry; the pool stays usable */
+void string_pool_free(StringPool* pool);
+
+/* Index of the entry holding these bytes, adding one if needed; *is_new
+ * tells whether it was added. Returns -1 when out of memory. */
+int string_pool_intern(StringPool* pool, const char* bytes, size_t length,
+                       int* is_new);
+
+/* Size of the c"..." body for bytes, without quotes or terminator */
+size_t string_pool_encoded_length(const StringPool* pool, const char* bytes,
+                                  size_t length);
+/* Write the c"..." body for bytes into out (encoded_length bytes) */
+size_t string_pool_encode(const StringPool* pool, const char* bytes,
+                          size_t length, char* out);
+
+#endif /* STRING_POOL_H */
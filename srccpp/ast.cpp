@@ -1,5 +1,9 @@
 #include "ast.h"
 
+extern "C" {
+#include "../src/string_pool.h"
+}
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -51,33 +55,13 @@ ASTNode* create_constant_node(int value, DataType type) {
 ASTNode* create_string_literal_node(const char* string) {
     ASTNode* node = create_ast_node(AST_STRING_LITERAL);
 
+    /* Decoded once here; codegen works on the bytes */
     size_t len = strlen(string);
-    char* processed = (char*)safe_malloc(len + 1);
-
-    size_t j = 0;
-    /* Skip first quote (i=1), end before last quote (i < len-1) */
-    for (size_t i = 1; i < len - 1; i++) {
-        if (string[i] == '\\' && i + 1 < len - 1) {
-            char c = string[i+1];
-            switch (c) {
-                case 'n': processed[j++] = '\n'; break;
-                case 't': processed[j++] = '\t'; break;
-                case 'r': processed[j++] = '\r'; break;
-                case '0': processed[j++] = '\0'; break;
-                case '\\': processed[j++] = '\\'; break;
-                case '\'': processed[j++] = '\''; break;
-                case '"': processed[j++] = '"'; break;
-                default: processed[j++] = c; break;
-            }
-            i++;
-        } else {
-            processed[j++] = string[i];
-        }
-    }
-    processed[j] = '\0';
+    char* bytes = (char*)safe_malloc(len + 1);
+    size_t length = string_literal_decode(string, len, bytes);
 
-    node->data.string_literal.string = processed;
-    node->data.string_literal.length = j;
+    node->data.string_literal.string = bytes;
+    node->data.string_literal.length = (int)length;
     return node;
 }
 
@@ -102,6 +86,24 @@ int parse_constant_value(const char* s) {
     return (int)strtol(s, NULL, 0);
 }
 
+/* Type of an integer literal from its suffix; character constants are int */
+DataType constant_literal_type(const char* s) {
+    if (!s || s[0] == '\'')
+        return TYPE_INT;
+    DataType type = TYPE_INT;
+    for (const char* p = s + strlen(s); p > s; p--) {
+        char c = p[-1];
+        if (c == 'u' || c == 'U') {
+            type = TYPE_UNSIGNED;
+        } else if ((c == 'l' || c == 'L') && type != TYPE_UNSIGNED) {
+            type = TYPE_LONG;
+        } else if (c != 'l' && c != 'L') {
+            break;
+        }
+    }
+    return type;
+}
+
 ASTNode* create_binary_op_node(BinaryOp op, ASTNode* left, ASTNode* right) {
     ASTNode* node = create_ast_node(AST_BINARY_OP);
     node->data.binary_op.op = op;
@@ -319,6 +321,14 @@ void free_ast_node(ASTNode* node) {
             free_ast_node(node->data.function_def.body);
         }
         break;
+    case AST_ENUM_DECL:
+        free(node->data.enum_decl.name);
+        free_ast_node(node->data.enum_decl.enumerators);
+        break;
+    case AST_STATIC_ASSERT:
+        free_ast_node(node->data.static_assert_decl.condition);
+        free_ast_node(node->data.static_assert_decl.message);
+        break;
     default:
         /* Handle other node types as needed */
         break;
@@ -364,6 +374,11 @@ Symbol* create_symbol(const char* name, TypeInfo* type) {
     symbol->offset = 0;
     symbol->is_global = 0;
     symbol->is_parameter = 0;
+    symbol->is_array = 0;
+    symbol->is_constant = 0;
+    symbol->constant_value = 0;
+    symbol->storage_name = NULL;
+    symbol->out_of_scope = 0;
     symbol->next = NULL;
     return symbol;
 }
@@ -373,6 +388,7 @@ void free_symbol(Symbol* symbol) {
         return;
 
     free(symbol->name);
+    free(symbol->storage_name);
     free_type_info(symbol->type);
     free(symbol);
 }
@@ -408,6 +424,10 @@ static const char* node_type_to_string(ASTNodeType type) {
         return "FUNCTION_DEF";
     case AST_COMPOUND_STMT:
         return "COMPOUND_STMT";
+    case AST_ENUM_DECL:
+        return "ENUM_DECL";
+    case AST_STATIC_ASSERT:
+        return "STATIC_ASSERT";
     default:
         return "UNKNOWN";
     }
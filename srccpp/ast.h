@@ -52,6 +52,7 @@ typedef enum {
     AST_UNION_DECL,
     AST_ENUM_DECL,
     AST_TYPEDEF_DECL,
+    AST_STATIC_ASSERT,
 
     /* Types */
     AST_POINTER_TYPE,
@@ -174,6 +175,10 @@ struct Symbol {
     int is_global;
     int is_parameter; /* true if this is a function parameter */
     int is_array;     /* true if this is an array */
+    int is_constant;  /* true for enumeration constants */
+    int constant_value;
+    char* storage_name; /* IR name of a local that reuses a name; NULL: name */
+    int out_of_scope;   /* true once a local's block has ended */
     struct Symbol* next;
 };
 
@@ -190,7 +195,7 @@ struct ASTNode {
             ASTNode* parameters; /* for function declarators */
             int is_variadic;     /* for function declarators */
             int pointer_level;
-            struct ASTNode* array_dimensions; /* for array declarators, linked list of CONSTANT nodes */
+            struct ASTNode* array_dimensions; /* for array declarators, linked list of size expressions */
         } identifier;
 
         struct {
@@ -298,7 +303,7 @@ struct ASTNode {
             char* name;
             ASTNode* initializer;
             int pointer_level;
-            struct ASTNode* array_dimensions;      /* for array declarations, linked list of CONSTANT nodes */
+            struct ASTNode* array_dimensions;      /* for array declarations, linked list of size expressions */
         } variable_decl;
 
         struct {
@@ -316,6 +321,17 @@ struct ASTNode {
             Symbol* symbol_table; /* struct's symbol table */
         } struct_decl;
 
+        /* Enumerators are identifiers, or NAME = value assignments */
+        struct {
+            char* name; /* tag, or NULL */
+            ASTNode* enumerators;
+        } enum_decl;
+
+        struct {
+            ASTNode* condition;
+            ASTNode* message; /* string literal */
+        } static_assert_decl;
+
         /* Initializer list */
         struct {
             ASTNode* items;
@@ -344,6 +360,7 @@ ASTNode* create_identifier_node(const char* name);
 ASTNode* create_constant_node(int value, DataType type);
 ASTNode* create_string_literal_node(const char* string);
 int parse_constant_value(const char* s);
+DataType constant_literal_type(const char* s);
 ASTNode* create_binary_op_node(BinaryOp op, ASTNode* left, ASTNode* right);
 ASTNode* create_unary_op_node(UnaryOp op, ASTNode* operand);
 ASTNode* create_function_call_node(ASTNode* function, ASTNode* arguments);
@@ -0,0 +1,2177 @@
+#include "bitcode_writer.h"
+
+#include "target.h"
+
+#include <deque>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Bitstream */
+
+/* Abbreviation operand encodings; literals are flagged by a bit of their
+ * own, the others match the bitstream encoding field */
+enum {
+    ENCODING_LITERAL,
+    ENCODING_FIXED,
+    ENCODING_VBR,
+    ENCODING_ARRAY,
+    ENCODING_CHAR6,
+    ENCODING_BLOB
+};
+
+typedef struct AbbrevOp {
+    int encoding;
+    uint64_t value; /* Literal value, or width of fixed and VBR fields */
+} AbbrevOp;
+
+typedef std::vector<AbbrevOp> Abbrev;
+
+/* Builtin abbreviation ids; defined ones follow */
+enum { END_BLOCK, ENTER_SUBBLOCK, DEFINE_ABBREV, UNABBREV_RECORD, FIRST_ABBREV };
+
+typedef struct BlockScope {
+    int abbrev_width;
+    size_t length_offset; /* Of the block length word */
+    std::vector<Abbrev> abbrevs;
+} BlockScope;
+
+/* Bits are packed LSB first into little-endian 32-bit words */
+typedef struct BitStream {
+    std::vector<uint8_t> bytes;
+    uint64_t pending; /* Bits of the word being filled */
+    int pending_bits;
+    int abbrev_width;
+    std::vector<Abbrev> abbrevs; /* Of the current block */
+    std::vector<BlockScope> scopes;
+    std::unordered_map<unsigned, std::vector<Abbrev>> block_info;
+} BitStream;
+
+static void emit_bits(BitStream* s, uint64_t value, int width) {
+    if (width < 64)
+        value &= (1ull << width) - 1;
+    s->pending |= value << s->pending_bits;
+    s->pending_bits += width;
+    while (s->pending_bits >= 32) {
+        for (int i = 0; i < 4; i++) {
+            s->bytes.push_back((uint8_t)(s->pending >> (8 * i)));
+        }
+        s->pending >>= 32;
+        s->pending_bits -= 32;
+    }
+}
+
+static void emit_vbr(BitStream* s, uint64_t value, int width) {
+    uint64_t threshold = 1ull << (width - 1);
+    while (value >= threshold) {
+        emit_bits(s, (value & (threshold - 1)) | threshold, width);
+        value >>= width - 1;
+    }
+    emit_bits(s, value, width);
+}
+
+static void align_word(BitStream* s) {
+    if (s->pending_bits > 0)
+        emit_bits(s, 0, 32 - s->pending_bits);
+}
+
+static void enter_block(BitStream* s, unsigned block_id, int abbrev_width) {
+    emit_bits(s, ENTER_SUBBLOCK, s->abbrev_width);
+    emit_vbr(s, block_id, 8);
+    emit_vbr(s, (uint64_t)abbrev_width, 4);
+    align_word(s);
+
+    BlockScope scope;
+    scope.abbrev_width = s->abbrev_width;
+    scope.length_offset = s->bytes.size();
+    scope.abbrevs.swap(s->abbrevs);
+    s->scopes.push_back(std::move(scope));
+    emit_bits(s, 0, 32); /* Length in words, patched by exit_block */
+
+    s->abbrev_width = abbrev_width;
+    auto info = s->block_info.find(block_id);
+    if (info != s->block_info.end())
+        s->abbrevs = info->second;
+}
+
+static void exit_block(BitStream* s) {
+    emit_bits(s, END_BLOCK, s->abbrev_width);
+    align_word(s);
+
+    BlockScope& scope = s->scopes.back();
+    size_t words = (s->bytes.size() - scope.length_offset) / 4 - 1;
+    for (int i = 0; i < 4; i++) {
+        s->bytes[scope.length_offset + i] = (uint8_t)(words >> (8 * i));
+    }
+    s->abbrev_width = scope.abbrev_width;
+    s->abbrevs.swap(scope.abbrevs);
+    s->scopes.pop_back();
+}
+
+static void emit_abbrev_definition(BitStream* s, const Abbrev& abbrev) {
+    emit_bits(s, DEFINE_ABBREV, s->abbrev_width);
+    emit_vbr(s, abbrev.size(), 5);
+    for (const AbbrevOp& op : abbrev) {
+        emit_bits(s, op.encoding == ENCODING_LITERAL, 1);
+        if (op.encoding == ENCODING_LITERAL) {
+            emit_vbr(s, op.value, 8);
+            continue;
+        }
+        emit_bits(s, (uint64_t)op.encoding, 3);
+        if (op.encoding == ENCODING_FIXED || op.encoding == ENCODING_VBR)
+            emit_vbr(s, op.value, 5);
+    }
+}
+
+/* Abbreviation of the current block; returns its id */
+static unsigned define_abbrev(BitStream* s, const Abbrev& abbrev) {
+    emit_abbrev_definition(s, abbrev);
+    s->abbrevs.push_back(abbrev);
+    return (unsigned)(FIRST_ABBREV + s->abbrevs.size() - 1);
+}
+
+/* Abbreviation for every block_id block, defined inside BLOCKINFO after a
+ * SETBID record for block_id */
+static void define_block_info_abbrev(BitStream* s, unsigned block_id,
+                                     const Abbrev& abbrev) {
+    emit_abbrev_definition(s, abbrev);
+    s->block_info[block_id].push_back(abbrev);
+}
+
+static int is_char6(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '.' || c == '_';
+}
+
+static unsigned encode_char6(char c) {
+    if (c >= 'a' && c <= 'z')
+        return (unsigned)(c - 'a');
+    if (c >= 'A' && c <= 'Z')
+        return (unsigned)(c - 'A') + 26;
+    if (c >= '0' && c <= '9')
+        return (unsigned)(c - '0') + 52;
+    return c == '.' ? 62 : 63;
+}
+
+static int is_char6_string(const std::string& text) {
+    for (char c : text) {
+        if (!is_char6(c))
+            return 0;
+    }
+    return 1;
+}
+
+static void emit_scalar(BitStream* s, const AbbrevOp& op, uint64_t value) {
+    switch (op.encoding) {
+    case ENCODING_FIXED:
+        emit_bits(s, value, (int)op.value);
+        break;
+    case ENCODING_VBR:
+        emit_vbr(s, value, (int)op.value);
+        break;
+    case ENCODING_CHAR6:
+        emit_bits(s, encode_char6((char)value), 6);
+        break;
+    }
+}
+
+static void emit_record(BitStream* s, unsigned code,
+                        const std::vector<uint64_t>& ops) {
+    emit_bits(s, UNABBREV_RECORD, s->abbrev_width);
+    emit_vbr(s, code, 6);
+    emit_vbr(s, ops.size(), 6);
+    for (uint64_t op : ops) {
+        emit_vbr(s, op, 6);
+    }
+}
+
+/* values starts with the record code; an array takes all that remain */
+static void emit_abbrev_record(BitStream* s, unsigned abbrev_id,
+                               const std::vector<uint64_t>& values) {
+    const Abbrev& abbrev = s->abbrevs[abbrev_id - FIRST_ABBREV];
+    emit_bits(s, abbrev_id, s->abbrev_width);
+    size_t next = 0;
+    for (size_t i = 0; i < abbrev.size(); i++) {
+        const AbbrevOp& op = abbrev[i];
+        if (op.encoding == ENCODING_ARRAY) {
+            const AbbrevOp& element = abbrev[++i];
+            emit_vbr(s, values.size() - next, 6);
+            for (; next < values.size(); next++) {
+                emit_scalar(s, element, values[next]);
+            }
+        } else {
+            if (op.encoding != ENCODING_LITERAL)
+                emit_scalar(s, op, values[next]);
+            next++;
+        }
+    }
+}
+
+/* Record of an abbreviation [literal code, blob] */
+static void emit_blob_record(BitStream* s, unsigned abbrev_id,
+                             const std::string& blob) {
+    emit_bits(s, abbrev_id, s->abbrev_width);
+    emit_vbr(s, blob.size(), 6);
+    align_word(s);
+    for (char c : blob) {
+        emit_bits(s, (uint8_t)c, 8);
+    }
+    align_word(s);
+}
+
+static void emit_string_record(BitStream* s, unsigned code,
+                               const std::string& text, unsigned char6_abbrev) {
+    std::vector<uint64_t> values;
+    values.push_back(code);
+    for (char c : text) {
+        values.push_back((uint8_t)c);
+    }
+    if (char6_abbrev && is_char6_string(text)) {
+        emit_abbrev_record(s, char6_abbrev, values);
+    } else {
+        values.erase(values.begin());
+        emit_record(s, code, values);
+    }
+}
+
+static AbbrevOp literal(uint64_t value) {
+    AbbrevOp op = {ENCODING_LITERAL, value};
+    return op;
+}
+
+static AbbrevOp fixed(uint64_t width) {
+    AbbrevOp op = {ENCODING_FIXED, width};
+    return op;
+}
+
+static AbbrevOp vbr(uint64_t width) {
+    AbbrevOp op = {ENCODING_VBR, width};
+    return op;
+}
+
+static AbbrevOp encoded(int encoding) {
+    AbbrevOp op = {encoding, 0};
+    return op;
+}
+
+/* Module model */
+
+/* Block ids and record codes of LLVM 14 (LLVMBitCodes.h) */
+enum {
+    BLOCKINFO_BLOCK_ID = 0,
+    MODULE_BLOCK_ID = 8,
+    CONSTANTS_BLOCK_ID = 11,
+    FUNCTION_BLOCK_ID = 12,
+    IDENTIFICATION_BLOCK_ID = 13,
+    VALUE_SYMTAB_BLOCK_ID = 14,
+    TYPE_BLOCK_ID = 17,
+    STRTAB_BLOCK_ID = 23
+};
+
+enum {
+    BLOCKINFO_SETBID = 1,
+    IDENTIFICATION_STRING = 1,
+    IDENTIFICATION_EPOCH = 2,
+    MODULE_VERSION = 1,
+    MODULE_TRIPLE = 2,
+    MODULE_DATALAYOUT = 3,
+    MODULE_GLOBALVAR = 7,
+    MODULE_FUNCTION = 8,
+    TYPE_CODE_NUMENTRY = 1,
+    TYPE_CODE_VOID = 2,
+    TYPE_CODE_FLOAT = 3,
+    TYPE_CODE_DOUBLE = 4,
+    TYPE_CODE_OPAQUE = 6,
+    TYPE_CODE_INTEGER = 7,
+    TYPE_CODE_POINTER = 8,
+    TYPE_CODE_ARRAY = 11,
+    TYPE_CODE_STRUCT_NAME = 19,
+    TYPE_CODE_FUNCTION = 21,
+    CONSTANT_SETTYPE = 1,
+    CONSTANT_NULL = 2,
+    CONSTANT_UNDEF = 3,
+    CONSTANT_INTEGER = 4,
+    CONSTANT_FLOAT = 6,
+    CONSTANT_STRING = 8,
+    CONSTANT_CSTRING = 9,
+    CONSTANT_CE_CAST = 11,
+    INST_DECLAREBLOCKS = 1,
+    INST_BINOP = 2,
+    INST_CAST = 3,
+    INST_RET = 10,
+    INST_BR = 11,
+    INST_SWITCH = 12,
+    INST_UNREACHABLE = 15,
+    INST_PHI = 16,
+    INST_ALLOCA = 19,
+    INST_LOAD = 20,
+    INST_CMP2 = 28,
+    INST_CALL = 34,
+    INST_GEP = 43,
+    INST_STORE = 44,
+    VST_ENTRY = 1,
+    VST_BBENTRY = 2,
+    STRTAB_BLOB = 1
+};
+
+enum { CAST_TRUNC = 0, CAST_ZEXT = 1, CAST_SEXT = 2, CAST_FPTOSI = 4,
+       CAST_SITOFP = 6, CAST_FPTRUNC = 7, CAST_FPEXT = 8, CAST_PTRTOINT = 9,
+       CAST_INTTOPTR = 10, CAST_BITCAST = 11 };
+
+enum { LINKAGE_EXTERNAL = 0, LINKAGE_INTERNAL = 3, LINKAGE_PRIVATE = 9 };
+
+/* Abbreviations of each block kind, in definition order */
+enum {
+    FUNCTION_LOAD_ABBREV = FIRST_ABBREV,
+    FUNCTION_BINOP_ABBREV,
+    FUNCTION_CAST_ABBREV,
+    FUNCTION_RET_VOID_ABBREV,
+    FUNCTION_RET_VAL_ABBREV,
+    FUNCTION_UNREACHABLE_ABBREV,
+    FUNCTION_GEP_ABBREV
+};
+
+enum {
+    CONSTANTS_SETTYPE_ABBREV = FIRST_ABBREV,
+    CONSTANTS_INTEGER_ABBREV,
+    CONSTANTS_NULL_ABBREV,
+    CONSTANTS_STRING_ABBREV, /* Module level only */
+    CONSTANTS_CSTRING_ABBREV,
+    CONSTANTS_CSTRING6_ABBREV
+};
+
+enum { VST_ENTRY8_ABBREV = FIRST_ABBREV, VST_ENTRY6_ABBREV, VST_BBENTRY6_ABBREV };
+
+typedef enum {
+    BC_TYPE_VOID,
+    BC_TYPE_INTEGER,
+    BC_TYPE_FLOAT,
+    BC_TYPE_DOUBLE,
+    BC_TYPE_POINTER,
+    BC_TYPE_ARRAY,
+    BC_TYPE_STRUCT, /* Named and opaque */
+    BC_TYPE_FUNCTION
+} BCTypeKind;
+
+typedef struct BCType {
+    BCTypeKind kind;
+    unsigned width;  /* Integer bits */
+    int element;     /* Pointee, array element or return type */
+    uint64_t count;  /* Array length */
+    std::string name; /* Struct name */
+    std::vector<int> parameters;
+    int is_variadic;
+} BCType;
+
+typedef enum {
+    BC_VALUE_ARGUMENT,
+    BC_VALUE_CONSTANT, /* Of the function */
+    BC_VALUE_INSTRUCTION,
+    BC_VALUE_GLOBAL,
+    BC_VALUE_FUNCTION,
+    BC_VALUE_MODULE_CONSTANT
+} BCValueKind;
+
+typedef struct BCValue {
+    BCValueKind kind;
+    int index; /* Into the list of its kind */
+    int type;
+} BCValue;
+
+typedef enum {
+    BC_CONST_INTEGER,
+    BC_CONST_FLOAT,
+    BC_CONST_NULL,
+    BC_CONST_UNDEF,
+    BC_CONST_STRING,
+    BC_CONST_CAST /* Of a module value */
+} BCConstantKind;
+
+typedef struct BCConstant {
+    BCConstantKind kind;
+    int type;
+    int64_t value;     /* Integer, or cast opcode */
+    double real;       /* Float */
+    std::string bytes; /* String */
+    BCValue operand;   /* Cast operand */
+} BCConstant;
+
+typedef enum {
+    BC_ALLOCA,
+    BC_LOAD,
+    BC_STORE,
+    BC_GEP,
+    BC_BINARY,
+    BC_CMP,
+    BC_CAST,
+    BC_PHI,
+    BC_CALL, /* operands[0] is the callee */
+    BC_BR,
+    BC_COND_BR,
+    BC_SWITCH, /* operands[0] is the condition, then the case values;
+                  blocks[0] is the default, then the case targets */
+    BC_RET,
+    BC_UNREACHABLE
+} BCOpcode;
+
+typedef struct BCInstruction {
+    BCOpcode opcode;
+    int type;         /* Result type; -1 when nothing is defined */
+    int op;           /* Bitcode binary opcode, predicate or cast opcode */
+    int operand_type; /* Allocated, loaded or source element type; function
+                         type of a call */
+    std::vector<BCValue> operands;
+    std::vector<int> blocks; /* Branch targets, phi predecessors */
+    std::string name;        /* Of a named alloca */
+} BCInstruction;
+
+typedef struct BCBlock {
+    std::string name;
+    std::vector<int> instructions; /* In order */
+} BCBlock;
+
+typedef struct BCFunction {
+    std::string name;
+    int type; /* Function type */
+    int linkage;
+    int defined;
+    std::vector<std::string> parameter_names;
+    std::vector<BCConstant> constants;
+    std::unordered_map<std::string, int> constant_index;
+    std::vector<BCInstruction> instructions;
+    std::vector<BCBlock> blocks;
+} BCFunction;
+
+typedef struct BCGlobal {
+    std::string name;
+    int type; /* Value type */
+    int linkage;
+    int is_constant;
+    int unnamed_addr;
+    int initializer; /* Module constant; -1 for a declaration */
+} BCGlobal;
+
+struct BitcodeWriter {
+    std::vector<BCType> types;
+    std::unordered_map<std::string, int> type_index; /* By shape */
+    /* By spelling: canonical types belong to the context that made them,
+     * and function jobs each have their own */
+    std::unordered_map<std::string, int> lowered_types;
+    std::vector<BCGlobal> globals;
+    std::unordered_map<std::string, int> global_index;
+    std::deque<BCFunction> functions; /* Stable while calls declare more */
+    std::unordered_map<std::string, int> function_index;
+    std::vector<BCConstant> constants; /* Module constants */
+    std::unordered_map<std::string, int> constant_index;
+    IRConsumer consumer;
+    const TargetInfo* target;
+    int error_count;
+};
+
+static void writer_error(BitcodeWriter* writer, const char* format,
+                         const char* name) {
+    fprintf(stderr, "Error: ");
+    fprintf(stderr, format, name);
+    fprintf(stderr, "\n");
+    writer->error_count++;
+}
+
+/* Types */
+
+static int intern_type(BitcodeWriter* writer, const std::string& key,
+                       const BCType& type) {
+    auto found = writer->type_index.find(key);
+    if (found != writer->type_index.end())
+        return found->second;
+    int index = (int)writer->types.size();
+    writer->types.push_back(type);
+    writer->type_index.emplace(key, index);
+    return index;
+}
+
+static BCType make_type(BCTypeKind kind) {
+    BCType type;
+    type.kind = kind;
+    type.width = 0;
+    type.element = -1;
+    type.count = 0;
+    type.is_variadic = 0;
+    return type;
+}
+
+static int void_type(BitcodeWriter* writer) {
+    return intern_type(writer, "void", make_type(BC_TYPE_VOID));
+}
+
+static int integer_type(BitcodeWriter* writer, unsigned width) {
+    BCType type = make_type(BC_TYPE_INTEGER);
+    type.width = width;
+    return intern_type(writer, "i" + std::to_string(width), type);
+}
+
+static int pointer_type(BitcodeWriter* writer, int element) {
+    BCType type = make_type(BC_TYPE_POINTER);
+    type.element = element;
+    return intern_type(writer, "p" + std::to_string(element), type);
+}
+
+static int array_type(BitcodeWriter* writer, uint64_t count, int element) {
+    BCType type = make_type(BC_TYPE_ARRAY);
+    type.count = count;
+    type.element = element;
+    return intern_type(
+        writer, "a" + std::to_string(count) + "x" + std::to_string(element),
+        type);
+}
+
+static int function_type(BitcodeWriter* writer, int return_type,
+                         const std::vector<int>& parameters, int is_variadic) {
+    BCType type = make_type(BC_TYPE_FUNCTION);
+    type.element = return_type;
+    type.parameters = parameters;
+    type.is_variadic = is_variadic;
+    std::string key = "f" + std::to_string(return_type) + "(";
+    for (int parameter : parameters) {
+        key += std::to_string(parameter) + ",";
+    }
+    key += is_variadic ? "...)" : ")";
+    return intern_type(writer, key, type);
+}
+
+/* type must be canonical */
+static int lower_type(BitcodeWriter* writer, TypeInfo* type) {
+    if (!type)
+        return void_type(writer);
+
+    const char* name = canonical_type_name(type);
+    auto found = writer->lowered_types.find(name);
+    if (found != writer->lowered_types.end())
+        return found->second;
+
+    int result;
+    switch (type->base_type) {
+    case TYPE_VOID:
+        result = void_type(writer);
+        break;
+    case TYPE_BOOL:
+        result = integer_type(writer, 1);
+        break;
+    case TYPE_CHAR:
+        result = integer_type(writer, 8);
+        break;
+    case TYPE_SHORT:
+        result = integer_type(writer, 16);
+        break;
+    case TYPE_LONG:
+        result = integer_type(writer, 64);
+        break;
+    case TYPE_FLOAT:
+        result = intern_type(writer, "float", make_type(BC_TYPE_FLOAT));
+        break;
+    case TYPE_DOUBLE:
+        result = intern_type(writer, "double", make_type(BC_TYPE_DOUBLE));
+        break;
+    case TYPE_POINTER: {
+        /* void* is an i8*, as in the C API backend */
+        int pointee = lower_type(writer, type->return_type);
+        if (!type->return_type ||
+            writer->types[pointee].kind == BC_TYPE_VOID) {
+            pointee = integer_type(writer, 8);
+        }
+        result = pointer_type(writer, pointee);
+        break;
+    }
+    case TYPE_ARRAY: {
+        int element = type->return_type
+                          ? lower_type(writer, type->return_type)
+                          : integer_type(writer, 8);
+        result = array_type(writer, (uint64_t)type->array_size, element);
+        break;
+    }
+    case TYPE_STRUCT: {
+        /* Members are not tracked, so the struct stays opaque */
+        BCType opaque = make_type(BC_TYPE_STRUCT);
+        opaque.name = name + 1;
+        result = intern_type(writer, std::string("s") + (name + 1), opaque);
+        break;
+    }
+    default:
+        result = integer_type(writer, 32);
+        break;
+    }
+
+    writer->lowered_types.emplace(name, result);
+    return result;
+}
+
+/* Type of a value of type; void stands in for an int as in the text */
+static int lower_value_type(BitcodeWriter* writer, TypeInfo* type) {
+    int result = lower_type(writer, type);
+    if (writer->types[result].kind == BC_TYPE_VOID)
+        return integer_type(writer, 32);
+    return result;
+}
+
+static BCTypeKind type_kind(const BitcodeWriter* writer, int type) {
+    return writer->types[type].kind;
+}
+
+static int is_integer(const BitcodeWriter* writer, int type) {
+    return type_kind(writer, type) == BC_TYPE_INTEGER;
+}
+
+static int is_float(const BitcodeWriter* writer, int type) {
+    BCTypeKind kind = type_kind(writer, type);
+    return kind == BC_TYPE_FLOAT || kind == BC_TYPE_DOUBLE;
+}
+
+static int has_unknown_layout(const BitcodeWriter* writer, int type) {
+    while (type_kind(writer, type) == BC_TYPE_ARRAY) {
+        type = writer->types[type].element;
+    }
+    return type_kind(writer, type) == BC_TYPE_STRUCT;
+}
+
+/* Constants */
+
+static BCConstant make_constant(BCConstantKind kind, int type, int64_t value) {
+    BCConstant constant;
+    constant.kind = kind;
+    constant.type = type;
+    constant.value = value;
+    constant.real = 0.0;
+    constant.operand.kind = BC_VALUE_GLOBAL;
+    constant.operand.index = -1;
+    constant.operand.type = -1;
+    return constant;
+}
+
+static int intern_constant(std::vector<BCConstant>& pool,
+                           std::unordered_map<std::string, int>& index,
+                           const BCConstant& constant) {
+    char key[96];
+    snprintf(key, sizeof(key), "%d:%d:%lld:%a:%d:%d:", (int)constant.kind,
+             constant.type, (long long)constant.value, constant.real,
+             (int)constant.operand.kind, constant.operand.index);
+    std::string full = key + constant.bytes;
+    auto found = index.find(full);
+    if (found != index.end())
+        return found->second;
+    int result = (int)pool.size();
+    pool.push_back(constant);
+    index.emplace(full, result);
+    return result;
+}
+
+/* value truncated to width bits, then sign-extended */
+static int64_t sign_extend(int64_t value, unsigned width) {
+    if (width == 0 || width >= 64)
+        return value;
+    uint64_t mask = (1ull << width) - 1;
+    uint64_t bits = (uint64_t)value & mask;
+    if (bits >> (width - 1))
+        bits |= ~mask;
+    return (int64_t)bits;
+}
+
+static int module_constant(BitcodeWriter* writer, const BCConstant& constant) {
+    return intern_constant(writer->constants, writer->constant_index,
+                           constant);
+}
+
+/* Module constant of type for an integer initializer */
+static int module_constant_of(BitcodeWriter* writer, int type,
+                              long long constant) {
+    BCConstant result = make_constant(BC_CONST_NULL, type, 0);
+    switch (type_kind(writer, type)) {
+    case BC_TYPE_POINTER:
+        if (constant != 0) {
+            int i64 = integer_type(writer, 64);
+            result = make_constant(BC_CONST_CAST, type, CAST_INTTOPTR);
+            result.operand.kind = BC_VALUE_MODULE_CONSTANT;
+            result.operand.index = module_constant(
+                writer, make_constant(BC_CONST_INTEGER, i64, constant));
+            result.operand.type = i64;
+        }
+        break;
+    case BC_TYPE_FLOAT:
+    case BC_TYPE_DOUBLE:
+        result = make_constant(BC_CONST_FLOAT, type, 0);
+        result.real = (double)constant;
+        break;
+    case BC_TYPE_INTEGER:
+        result = make_constant(
+            BC_CONST_INTEGER, type,
+            sign_extend(constant, writer->types[type].width));
+        break;
+    default:
+        break;
+    }
+    return module_constant(writer, result);
+}
+
+/* Globals and functions */
+
+static BCValue global_value(BitcodeWriter* writer, int index) {
+    BCValue value = {BC_VALUE_GLOBAL, index,
+                     pointer_type(writer, writer->globals[index].type)};
+    return value;
+}
+
+static BCValue function_value(BitcodeWriter* writer, int index) {
+    BCValue value = {BC_VALUE_FUNCTION, index,
+                     pointer_type(writer, writer->functions[index].type)};
+    return value;
+}
+
+static int add_global_variable(BitcodeWriter* writer, const char* name,
+                               int type) {
+    BCGlobal global;
+    global.name = name;
+    global.type = type;
+    global.linkage = LINKAGE_EXTERNAL;
+    global.is_constant = 0;
+    global.unnamed_addr = 0;
+    global.initializer = -1;
+    int index = (int)writer->globals.size();
+    writer->globals.push_back(global);
+    writer->global_index.emplace(name, index);
+    return index;
+}
+
+/* Global @name, declared as an external variable of the pointee type when
+ * nothing defined it */
+static BCValue lookup_global(BitcodeWriter* writer, const char* name,
+                             int address_type) {
+    auto global = writer->global_index.find(name);
+    if (global != writer->global_index.end())
+        return global_value(writer, global->second);
+    auto function = writer->function_index.find(name);
+    if (function != writer->function_index.end())
+        return function_value(writer, function->second);
+
+    int element = type_kind(writer, address_type) == BC_TYPE_POINTER
+                      ? writer->types[address_type].element
+                      : integer_type(writer, 32);
+    return global_value(writer, add_global_variable(writer, name, element));
+}
+
+static int declare_function(BitcodeWriter* writer, const char* name,
+                            int type) {
+    auto found = writer->function_index.find(name);
+    if (found != writer->function_index.end())
+        return found->second;
+    BCFunction function;
+    function.name = name;
+    function.type = type;
+    function.linkage = LINKAGE_EXTERNAL;
+    function.defined = 0;
+    int index = (int)writer->functions.size();
+    writer->functions.push_back(std::move(function));
+    writer->function_index.emplace(name, index);
+    return index;
+}
+
+/* The function to give a body. A declaration of another type, made by a
+ * call ahead of the definition, takes the type of the definition; earlier
+ * uses are cast when the module is written. */
+static int define_function(BitcodeWriter* writer, const char* name,
+                           int type) {
+    int index = declare_function(writer, name, type);
+    BCFunction& function = writer->functions[index];
+    if (function.defined) {
+        writer_error(writer, "Redefinition of function '%s'", name);
+        return -1;
+    }
+    function.type = type;
+    function.defined = 1;
+    return index;
+}
+
+/* Function bodies */
+
+/* Values of the function being translated */
+typedef struct LoweringState {
+    BitcodeWriter* writer;
+    BCFunction* function;
+    int return_type;
+    int block;    /* Insertion block */
+    int position; /* Insert before this instruction of it; -1: append */
+    std::unordered_map<int, BCValue> registers;
+    std::unordered_map<std::string, BCValue> locals;
+    std::unordered_map<int, int> blocks;
+    std::vector<std::pair<const IRInstruction*, int>> phis;
+} LoweringState;
+
+static BCValue local_constant(LoweringState* state, BCConstantKind kind,
+                              int type, int64_t value) {
+    BCFunction* function = state->function;
+    BCValue result = {BC_VALUE_CONSTANT,
+                      intern_constant(function->constants,
+                                      function->constant_index,
+                                      make_constant(kind, type, value)),
+                      type};
+    return result;
+}
+
+static BCValue undefined(LoweringState* state, int type) {
+    return local_constant(state, BC_CONST_UNDEF, type, 0);
+}
+
+static BCValue null_value(LoweringState* state, int type) {
+    return local_constant(state, BC_CONST_NULL, type, 0);
+}
+
+static BCValue integer_value(LoweringState* state, int type, int64_t value) {
+    return local_constant(state, BC_CONST_INTEGER, type,
+                          sign_extend(value, state->writer->types[type].width));
+}
+
+static BCBlock make_block(const std::string& name) {
+    BCBlock block;
+    block.name = name;
+    return block;
+}
+
+static int append_block(LoweringState* state, const std::string& name) {
+    state->function->blocks.push_back(make_block(name));
+    return (int)state->function->blocks.size() - 1;
+}
+
+static void position_at_end(LoweringState* state, int block) {
+    state->block = block;
+    state->position = -1;
+}
+
+static BCValue insert(LoweringState* state, BCInstruction instruction) {
+    BCFunction* function = state->function;
+    int index = (int)function->instructions.size();
+    int type = instruction.type;
+    function->instructions.push_back(std::move(instruction));
+    std::vector<int>& list = function->blocks[state->block].instructions;
+    if (state->position < 0) {
+        list.push_back(index);
+    } else {
+        list.insert(list.begin() + state->position, index);
+        state->position++;
+    }
+    BCValue value = {BC_VALUE_INSTRUCTION, index, type};
+    return value;
+}
+
+static BCInstruction make_instruction(BCOpcode opcode, int type) {
+    BCInstruction instruction;
+    instruction.opcode = opcode;
+    instruction.type = type;
+    instruction.op = 0;
+    instruction.operand_type = -1;
+    return instruction;
+}
+
+static BCValue build_cast(LoweringState* state, int op, BCValue value,
+                          int type) {
+    BCInstruction cast = make_instruction(BC_CAST, type);
+    cast.op = op;
+    cast.operands.push_back(value);
+    return insert(state, std::move(cast));
+}
+
+static BCValue build_cmp(LoweringState* state, int predicate, BCValue left,
+                         BCValue right) {
+    BCInstruction cmp =
+        make_instruction(BC_CMP, integer_type(state->writer, 1));
+    cmp.op = predicate;
+    cmp.operands.push_back(left);
+    cmp.operands.push_back(right);
+    return insert(state, std::move(cmp));
+}
+
+/* Integer constant of the IR as type */
+static BCValue constant_of(LoweringState* state, int type, int constant) {
+    BitcodeWriter* writer = state->writer;
+    switch (type_kind(writer, type)) {
+    case BC_TYPE_POINTER:
+        if (constant == 0)
+            return null_value(state, type);
+        return build_cast(state, CAST_INTTOPTR,
+                          integer_value(state, integer_type(writer, 64),
+                                        constant),
+                          type);
+    case BC_TYPE_FLOAT:
+    case BC_TYPE_DOUBLE: {
+        BCConstant real = make_constant(BC_CONST_FLOAT, type, 0);
+        real.real = constant;
+        BCValue result = {BC_VALUE_CONSTANT,
+                          intern_constant(state->function->constants,
+                                          state->function->constant_index,
+                                          real),
+                          type};
+        return result;
+    }
+    case BC_TYPE_INTEGER:
+        return integer_value(state, type, constant);
+    default:
+        return null_value(state, type);
+    }
+}
+
+/* Values that were never defined, such as uses in unreachable code, are
+ * undefined rather than an error */
+static BCValue lower_value(LoweringState* state, const IRValue* value) {
+    BitcodeWriter* writer = state->writer;
+    int type = lower_value_type(writer, value->type);
+    switch (value->kind) {
+    case IR_VALUE_REGISTER: {
+        auto found = state->registers.find(value->id);
+        if (found != state->registers.end())
+            return found->second;
+        break;
+    }
+    case IR_VALUE_LOCAL: {
+        auto found = state->locals.find(value->name);
+        if (found != state->locals.end())
+            return found->second;
+        break;
+    }
+    case IR_VALUE_GLOBAL:
+        return lookup_global(writer, value->name, type);
+    case IR_VALUE_CONSTANT:
+        if (is_integer(writer, type) && writer->types[type].width == 1)
+            return integer_value(state, type, value->id != 0);
+        return constant_of(state, type, value->id);
+    case IR_VALUE_NONE:
+        break;
+    }
+    return undefined(state, type);
+}
+
+/* value as type, with the conversions of the C API backend. Integer and
+ * null constants are converted in place. */
+static BCValue convert(LoweringState* state, BCValue value, int type) {
+    if (value.type == type)
+        return value;
+
+    BitcodeWriter* writer = state->writer;
+    BCTypeKind from_kind = type_kind(writer, value.type);
+    BCTypeKind to_kind = type_kind(writer, type);
+    int from_float = is_float(writer, value.type);
+    int to_float = is_float(writer, type);
+
+    if (value.kind == BC_VALUE_CONSTANT) {
+        BCConstant constant = state->function->constants[value.index];
+        if (constant.kind == BC_CONST_UNDEF)
+            return undefined(state, type);
+        int is_null = constant.kind == BC_CONST_NULL ||
+                      (constant.kind == BC_CONST_INTEGER &&
+                       constant.value == 0);
+        if (is_null && to_kind == BC_TYPE_POINTER)
+            return null_value(state, type);
+        if (is_null && to_kind == BC_TYPE_INTEGER)
+            return integer_value(state, type, 0);
+        if (constant.kind == BC_CONST_INTEGER && to_kind == BC_TYPE_INTEGER) {
+            int64_t folded = constant.value;
+            if (writer->types[value.type].width == 1)
+                folded &= 1;
+            return integer_value(state, type, folded);
+        }
+    }
+
+    if (from_kind == BC_TYPE_INTEGER && to_kind == BC_TYPE_INTEGER) {
+        unsigned from_width = writer->types[value.type].width;
+        unsigned to_width = writer->types[type].width;
+        if (from_width > to_width)
+            return build_cast(state, CAST_TRUNC, value, type);
+        return build_cast(state, from_width == 1 ? CAST_ZEXT : CAST_SEXT,
+                          value, type);
+    }
+    if (from_kind == BC_TYPE_POINTER && to_kind == BC_TYPE_POINTER)
+        return build_cast(state, CAST_BITCAST, value, type);
+    if (from_kind == BC_TYPE_POINTER && to_kind == BC_TYPE_INTEGER)
+        return build_cast(state, CAST_PTRTOINT, value, type);
+    if (from_kind == BC_TYPE_INTEGER && to_kind == BC_TYPE_POINTER)
+        return build_cast(state, CAST_INTTOPTR, value, type);
+    if (from_kind == BC_TYPE_INTEGER && to_float)
+        return build_cast(state, CAST_SITOFP, value, type);
+    if (from_float && to_kind == BC_TYPE_INTEGER)
+        return build_cast(state, CAST_FPTOSI, value, type);
+    if (from_float && to_float) {
+        return build_cast(state,
+                          from_kind == BC_TYPE_FLOAT ? CAST_FPEXT
+                                                     : CAST_FPTRUNC,
+                          value, type);
+    }
+    return undefined(state, type);
+}
+
+static BCValue lower_operand(LoweringState* state, const IRValue* value,
+                             int type) {
+    return convert(state, lower_value(state, value), type);
+}
+
+/* Branch conditions are i1; anything else is compared against zero */
+static BCValue lower_condition(LoweringState* state, const IRValue* value) {
+    BitcodeWriter* writer = state->writer;
+    BCValue condition = lower_value(state, value);
+    if (is_integer(writer, condition.type) &&
+        writer->types[condition.type].width == 1) {
+        return condition;
+    }
+    if (type_kind(writer, condition.type) == BC_TYPE_POINTER) {
+        return build_cmp(state, 33 /* ne */, condition,
+                         null_value(state, condition.type));
+    }
+    condition = convert(state, condition, integer_type(writer, 32));
+    return build_cmp(state, 33 /* ne */, condition,
+                     integer_value(state, condition.type, 0));
+}
+
+static void define_result(LoweringState* state, const IRValue* result,
+                          BCValue value) {
+    if (result->kind == IR_VALUE_REGISTER) {
+        state->registers[result->id] = value;
+    } else if (result->kind == IR_VALUE_LOCAL) {
+        state->locals[result->name] = value;
+    }
+}
+
+static int lower_block(LoweringState* state, int id) {
+    auto found = state->blocks.find(id);
+    if (found != state->blocks.end())
+        return found->second;
+    int block = append_block(state, id == 0 ? "" : "bb" + std::to_string(id));
+    state->blocks.emplace(id, block);
+    return block;
+}
+
+static int is_terminated(const BCFunction* function, int block) {
+    const std::vector<int>& list = function->blocks[block].instructions;
+    if (list.empty())
+        return 0;
+    BCOpcode opcode = function->instructions[list.back()].opcode;
+    return opcode == BC_BR || opcode == BC_COND_BR || opcode == BC_SWITCH ||
+           opcode == BC_RET || opcode == BC_UNREACHABLE;
+}
+
+static void build_br(LoweringState* state, int block) {
+    BCInstruction br = make_instruction(BC_BR, -1);
+    br.blocks.push_back(block);
+    insert(state, std::move(br));
+}
+
+static void build_ret(LoweringState* state, const BCValue* value) {
+    BCInstruction ret = make_instruction(BC_RET, -1);
+    if (value)
+        ret.operands.push_back(*value);
+    insert(state, std::move(ret));
+}
+
+/* ret for a block that runs off the end of the function */
+static void build_default_return(LoweringState* state) {
+    if (type_kind(state->writer, state->return_type) == BC_TYPE_VOID) {
+        build_ret(state, NULL);
+    } else {
+        BCValue zero = null_value(state, state->return_type);
+        build_ret(state, &zero);
+    }
+}
+
+static BCValue lower_call(LoweringState* state,
+                          const IRInstruction* instruction) {
+    BitcodeWriter* writer = state->writer;
+    std::vector<BCValue> args;
+    for (int i = 0; i < instruction->operand_count; i++) {
+        args.push_back(lower_value(state, &instruction->operands[i]));
+    }
+
+    int callee;
+    auto found = writer->function_index.find(instruction->text);
+    if (found != writer->function_index.end()) {
+        callee = found->second;
+    } else {
+        /* Undeclared: the prototype is whatever the call passes */
+        std::vector<int> parameters;
+        if (instruction->is_variadic_call) {
+            for (int i = 0; i < instruction->parameter_count; i++) {
+                parameters.push_back(lower_value_type(
+                    writer, instruction->parameter_types[i]));
+            }
+        } else {
+            for (const BCValue& arg : args) {
+                parameters.push_back(arg.type);
+            }
+        }
+        callee = declare_function(
+            writer, instruction->text,
+            function_type(writer, lower_type(writer, instruction->type),
+                          parameters, instruction->is_variadic_call));
+    }
+
+    int type = writer->functions[callee].type;
+    int return_type = writer->types[type].element;
+    std::vector<int> parameters = writer->types[type].parameters;
+    size_t fixed = parameters.size();
+    if (args.size() < fixed ||
+        (args.size() > fixed && !writer->types[type].is_variadic)) {
+        /* Called with the wrong arity: call through a cast, as C would */
+        std::vector<int> arg_types;
+        for (const BCValue& arg : args) {
+            arg_types.push_back(arg.type);
+        }
+        type = function_type(writer, return_type, arg_types, 0);
+    } else {
+        for (size_t i = 0; i < fixed; i++) {
+            args[i] = convert(state, args[i], parameters[i]);
+        }
+    }
+
+    int is_void = type_kind(writer, return_type) == BC_TYPE_VOID;
+    BCInstruction call = make_instruction(BC_CALL, is_void ? -1 : return_type);
+    call.operand_type = type;
+    /* Typed as called; a cast is added when the function ends up with
+     * another type */
+    BCValue target = {BC_VALUE_FUNCTION, callee, pointer_type(writer, type)};
+    call.operands.push_back(target);
+    call.operands.insert(call.operands.end(), args.begin(), args.end());
+    BCValue result = insert(state, std::move(call));
+    if (is_void)
+        return undefined(state, lower_value_type(writer, instruction->type));
+    return result;
+}
+
+static int binary_opcode(int op) {
+    switch (op) {
+    case IR_ADD:
+        return 0;
+    case IR_SUB:
+        return 1;
+    case IR_MUL:
+        return 2;
+    case IR_SDIV:
+        return 4;
+    case IR_SREM:
+        return 6;
+    case IR_SHL:
+        return 7;
+    case IR_ASHR:
+        return 9;
+    case IR_AND:
+        return 10;
+    case IR_OR:
+        return 11;
+    default:
+        return 12;
+    }
+}
+
+static int int_predicate(int op) {
+    switch (op) {
+    case IR_ICMP_EQ:
+        return 32;
+    case IR_ICMP_NE:
+        return 33;
+    case IR_ICMP_SGT:
+        return 38;
+    case IR_ICMP_SGE:
+        return 39;
+    case IR_ICMP_SLT:
+        return 40;
+    default:
+        return 41;
+    }
+}
+
+/* Translate one instruction; returns 1 for terminators */
+static int lower_instruction(LoweringState* state,
+                             const IRInstruction* instruction) {
+    BitcodeWriter* writer = state->writer;
+    const IRValue* operands = instruction->operands;
+    BCValue value = {BC_VALUE_CONSTANT, -1, -1};
+    int defined = 1;
+
+    switch (instruction->opcode) {
+    case IR_ALLOCA: {
+        int type = lower_value_type(writer, instruction->type);
+        if (has_unknown_layout(writer, type)) {
+            writer_error(writer, "Layout of '%s' is unknown",
+                         canonical_type_name(instruction->type));
+            value = undefined(state, pointer_type(writer, type));
+            break;
+        }
+        BCInstruction alloca =
+            make_instruction(BC_ALLOCA, pointer_type(writer, type));
+        alloca.operand_type = type;
+        alloca.operands.push_back(
+            integer_value(state, integer_type(writer, 32), 1));
+        if (instruction->result.kind == IR_VALUE_LOCAL)
+            alloca.name = instruction->result.name;
+        value = insert(state, std::move(alloca));
+        break;
+    }
+    case IR_LOAD: {
+        int type = lower_value_type(writer, instruction->type);
+        BCInstruction load = make_instruction(BC_LOAD, type);
+        load.operand_type = type;
+        load.operands.push_back(lower_operand(state, &operands[0],
+                                              pointer_type(writer, type)));
+        value = insert(state, std::move(load));
+        break;
+    }
+    case IR_STORE: {
+        int type = lower_value_type(writer, instruction->type);
+        BCInstruction store = make_instruction(BC_STORE, -1);
+        store.operands.push_back(lower_operand(state, &operands[0], type));
+        store.operands.insert(store.operands.begin(),
+                              lower_operand(state, &operands[1],
+                                            pointer_type(writer, type)));
+        insert(state, std::move(store));
+        return 0;
+    }
+    case IR_GEP: {
+        int type = lower_value_type(writer, instruction->type);
+        if (has_unknown_layout(writer, type)) {
+            writer_error(writer, "Layout of '%s' is unknown",
+                         canonical_type_name(instruction->type));
+            value = undefined(
+                state, lower_value_type(writer, instruction->result.type));
+            break;
+        }
+        BCInstruction gep = make_instruction(BC_GEP, -1);
+        gep.operand_type = type;
+        gep.operands.push_back(lower_operand(state, &operands[0],
+                                             pointer_type(writer, type)));
+        int element = type;
+        for (int i = 1; i < instruction->operand_count; i++) {
+            if (i > 1) {
+                if (type_kind(writer, element) != BC_TYPE_ARRAY) {
+                    writer_error(writer, "Cannot index into '%s'",
+                                 canonical_type_name(instruction->type));
+                    break;
+                }
+                element = writer->types[element].element;
+            }
+            gep.operands.push_back(lower_value(state, &operands[i]));
+        }
+        gep.type = pointer_type(writer, element);
+        value = insert(state, std::move(gep));
+        break;
+    }
+    case IR_BINARY: {
+        int type = lower_value_type(writer, instruction->type);
+        int op = binary_opcode(instruction->op);
+        /* Floating point has add, sub, mul, sdiv and srem only */
+        if (!is_integer(writer, type) &&
+            !(is_float(writer, type) &&
+              (op <= 2 || op == 4 || op == 6))) {
+            writer_error(writer, "Cannot encode arithmetic on '%s'",
+                         canonical_type_name(instruction->type));
+            value = undefined(state, type);
+            break;
+        }
+        BCInstruction binary = make_instruction(BC_BINARY, type);
+        binary.op = op;
+        binary.operands.push_back(lower_operand(state, &operands[0], type));
+        binary.operands.push_back(lower_operand(state, &operands[1], type));
+        value = insert(state, std::move(binary));
+        break;
+    }
+    case IR_ICMP: {
+        int type = lower_value_type(writer, instruction->type);
+        if (is_float(writer, type)) {
+            writer_error(writer, "Cannot encode icmp on '%s'",
+                         canonical_type_name(instruction->type));
+            value = undefined(state, integer_type(writer, 1));
+            break;
+        }
+        BCValue left = lower_operand(state, &operands[0], type);
+        BCValue right = lower_operand(state, &operands[1], type);
+        value = build_cmp(state, int_predicate(instruction->op), left, right);
+        break;
+    }
+    case IR_CAST: {
+        int type = lower_value_type(writer, instruction->type);
+        BCValue source = lower_value(state, &operands[0]);
+        if (instruction->op == IR_ZEXT && is_integer(writer, source.type) &&
+            is_integer(writer, type) &&
+            writer->types[source.type].width < writer->types[type].width) {
+            value = build_cast(state, CAST_ZEXT, source, type);
+        } else {
+            value = convert(state, source, type);
+        }
+        break;
+    }
+    case IR_PHI: {
+        /* Incoming values may come from blocks not translated yet */
+        value = insert(state,
+                       make_instruction(BC_PHI, lower_value_type(
+                                                    writer, instruction->type)));
+        state->phis.emplace_back(instruction, value.index);
+        break;
+    }
+    case IR_CALL:
+        value = lower_call(state, instruction);
+        break;
+    case IR_BR:
+        build_br(state, lower_block(state, instruction->blocks[0]));
+        return 1;
+    case IR_COND_BR: {
+        BCInstruction br = make_instruction(BC_COND_BR, -1);
+        br.operands.push_back(lower_condition(state, &operands[0]));
+        br.blocks.push_back(lower_block(state, instruction->blocks[0]));
+        br.blocks.push_back(lower_block(state, instruction->blocks[1]));
+        insert(state, std::move(br));
+        return 1;
+    }
+    case IR_SWITCH: {
+        BCInstruction dispatch = make_instruction(BC_SWITCH, -1);
+        BCValue condition = lower_value(state, &operands[0]);
+        dispatch.operands.push_back(condition);
+        dispatch.blocks.push_back(lower_block(state, instruction->blocks[0]));
+        for (int i = 1; i < instruction->operand_count; i++) {
+            dispatch.operands.push_back(
+                lower_operand(state, &operands[i], condition.type));
+            dispatch.blocks.push_back(
+                lower_block(state, instruction->blocks[i]));
+        }
+        insert(state, std::move(dispatch));
+        return 1;
+    }
+    case IR_RET:
+        if (type_kind(writer, state->return_type) == BC_TYPE_VOID) {
+            build_ret(state, NULL);
+        } else if (instruction->operand_count == 0) {
+            build_default_return(state);
+        } else {
+            BCValue result =
+                lower_operand(state, &operands[0], state->return_type);
+            build_ret(state, &result);
+        }
+        return 1;
+    case IR_COMMENT:
+        defined = 0;
+        break;
+    }
+
+    if (defined) {
+        define_result(state, &instruction->result, value);
+    }
+    return 0;
+}
+
+static void add_incoming_values(LoweringState* state) {
+    for (auto& phi : state->phis) {
+        const IRInstruction* instruction = phi.first;
+        int type = state->function->instructions[phi.second].type;
+        for (int i = 0; i < instruction->operand_count; i++) {
+            int block = lower_block(state, instruction->blocks[i]);
+            /* Conversions go at the end of the predecessor */
+            state->block = block;
+            state->position =
+                (int)state->function->blocks[block].instructions.size() - 1;
+            BCValue value =
+                lower_operand(state, &instruction->operands[i], type);
+            BCInstruction& target = state->function->instructions[phi.second];
+            target.operands.push_back(value);
+            target.blocks.push_back(block);
+        }
+    }
+}
+
+static void add_function(void* data, const IRFunction* function) {
+    auto writer = static_cast<BitcodeWriter*>(data);
+
+    std::vector<int> parameters;
+    for (int i = 0; i < function->parameter_count; i++) {
+        parameters.push_back(
+            lower_value_type(writer, function->parameters[i].type));
+    }
+    LoweringState state;
+    state.writer = writer;
+    state.return_type = lower_type(writer, function->return_type);
+    int index = define_function(
+        writer, function->name,
+        function_type(writer, state.return_type, parameters, 0));
+    if (index < 0)
+        return;
+    state.function = &writer->functions[index];
+    if (strncmp(function->linkage, "internal", 8) == 0)
+        state.function->linkage = LINKAGE_INTERNAL;
+
+    for (int i = 0; i < function->parameter_count; i++) {
+        const char* name = function->parameters[i].name;
+        BCValue parameter = {BC_VALUE_ARGUMENT, i, parameters[i]};
+        state.function->parameter_names.push_back(name);
+        state.locals[name] = parameter;
+    }
+
+    /* Blocks in layout order, the entry block first */
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        lower_block(&state, block->id);
+    }
+    if (!function->first_block) {
+        position_at_end(&state, append_block(&state, ""));
+        build_default_return(&state);
+    }
+
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        position_at_end(&state, lower_block(&state, block->id));
+        int terminated = 0;
+        for (const IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            if (terminated) {
+                /* Code after a branch or return is unreachable */
+                position_at_end(&state, append_block(&state, ""));
+            }
+            terminated = lower_instruction(&state, instruction);
+        }
+        /* A block without terminator falls through to the next one */
+        if (!terminated) {
+            if (block->next) {
+                build_br(&state, lower_block(&state, block->next->id));
+            } else {
+                build_default_return(&state);
+            }
+        }
+    }
+
+    /* Branch targets that were never laid out */
+    for (size_t i = 0; i < state.function->blocks.size(); i++) {
+        if (!is_terminated(state.function, (int)i)) {
+            position_at_end(&state, (int)i);
+            insert(&state, make_instruction(BC_UNREACHABLE, -1));
+        }
+    }
+
+    add_incoming_values(&state);
+}
+
+/* Globals */
+
+/* Character array initializer: bytes, zero padded to the array length */
+static int char_array_initializer(BitcodeWriter* writer, int type,
+                                  const IRGlobal* global) {
+    if (type_kind(writer, type) != BC_TYPE_ARRAY)
+        return module_constant(writer, make_constant(BC_CONST_NULL, type, 0));
+    BCConstant string = make_constant(BC_CONST_STRING, type, 0);
+    string.bytes.assign(global->bytes, global->length);
+    string.bytes.resize(writer->types[type].count, '\0');
+    return module_constant(writer, string);
+}
+
+static void add_global(void* data, const IRGlobal* global) {
+    auto writer = static_cast<BitcodeWriter*>(data);
+
+    switch (global->kind) {
+    case IR_GLOBAL_DECLARATION: {
+        std::vector<int> parameters;
+        for (int i = 0; i < global->parameter_count; i++) {
+            parameters.push_back(
+                lower_value_type(writer, global->parameter_types[i]));
+        }
+        declare_function(writer, global->name,
+                         function_type(writer, lower_type(writer, global->type),
+                                       parameters, global->is_variadic));
+        break;
+    }
+    case IR_GLOBAL_VARIABLE:
+    case IR_GLOBAL_EXTERNAL: {
+        int type = lower_value_type(writer, global->type);
+        auto found = writer->global_index.find(global->name);
+        int index;
+        if (found != writer->global_index.end()) {
+            index = found->second;
+            if (global->kind == IR_GLOBAL_EXTERNAL ||
+                writer->globals[index].initializer >= 0) {
+                break; /* Declared again, or a tentative definition */
+            }
+            /* Uses so far are cast when the module is written */
+            writer->globals[index].type = type;
+        } else {
+            index = add_global_variable(writer, global->name, type);
+        }
+        if (global->kind == IR_GLOBAL_EXTERNAL)
+            break;
+        if (has_unknown_layout(writer, type)) {
+            writer_error(writer, "Layout of '%s' is unknown",
+                         canonical_type_name(global->type));
+            break;
+        }
+
+        int initializer;
+        if (global->has_constant) {
+            initializer = module_constant_of(writer, type, global->constant);
+        } else if (global->bytes) {
+            initializer = char_array_initializer(writer, type, global);
+        } else {
+            initializer = module_constant(
+                writer, make_constant(BC_CONST_NULL, type, 0));
+        }
+        writer->globals[index].initializer = initializer;
+        if (strncmp(global->linkage, "internal", 8) == 0)
+            writer->globals[index].linkage = LINKAGE_INTERNAL;
+        break;
+    }
+    case IR_GLOBAL_STRING: {
+        int type = array_type(writer, global->length + 1,
+                              integer_type(writer, 8));
+        BCConstant string = make_constant(BC_CONST_STRING, type, 0);
+        string.bytes.assign(global->bytes, global->length);
+        string.bytes.push_back('\0');
+        int index = add_global_variable(writer, global->name, type);
+        BCGlobal& variable = writer->globals[index];
+        variable.initializer = module_constant(writer, string);
+        variable.is_constant = 1;
+        variable.linkage = LINKAGE_PRIVATE;
+        variable.unnamed_addr = 1;
+        break;
+    }
+    }
+}
+
+/* Serialization */
+
+/* Global and function operands typed for a declaration that the definition
+ * changed go through a constant bitcast */
+static void cast_retyped_operands(BitcodeWriter* writer) {
+    for (BCFunction& function : writer->functions) {
+        for (BCInstruction& instruction : function.instructions) {
+            for (BCValue& operand : instruction.operands) {
+                if (operand.kind != BC_VALUE_GLOBAL &&
+                    operand.kind != BC_VALUE_FUNCTION) {
+                    continue;
+                }
+                BCValue current = operand.kind == BC_VALUE_GLOBAL
+                                      ? global_value(writer, operand.index)
+                                      : function_value(writer, operand.index);
+                if (current.type == operand.type)
+                    continue;
+                BCConstant cast =
+                    make_constant(BC_CONST_CAST, operand.type, CAST_BITCAST);
+                cast.operand = current;
+                operand.kind = BC_VALUE_MODULE_CONSTANT;
+                operand.index = module_constant(writer, cast);
+            }
+        }
+    }
+}
+
+static unsigned type_bits(const BitcodeWriter* writer) {
+    unsigned bits = 1;
+    while ((1ull << bits) < writer->types.size() + 1) {
+        bits++;
+    }
+    return bits;
+}
+
+static uint64_t module_value_id(const BitcodeWriter* writer,
+                                const BCValue& value) {
+    switch (value.kind) {
+    case BC_VALUE_GLOBAL:
+        return (uint64_t)value.index;
+    case BC_VALUE_FUNCTION:
+        return writer->globals.size() + (uint64_t)value.index;
+    default:
+        return writer->globals.size() + writer->functions.size() +
+               (uint64_t)value.index;
+    }
+}
+
+static void write_identification(BitStream* s) {
+    enter_block(s, IDENTIFICATION_BLOCK_ID, 5);
+    unsigned string_abbrev = define_abbrev(
+        s, {literal(IDENTIFICATION_STRING), encoded(ENCODING_ARRAY),
+            encoded(ENCODING_CHAR6)});
+    emit_string_record(s, IDENTIFICATION_STRING, "tinyc", string_abbrev);
+    emit_record(s, IDENTIFICATION_EPOCH, {0});
+    exit_block(s);
+}
+
+static void write_block_info(BitStream* s, unsigned bits) {
+    enter_block(s, BLOCKINFO_BLOCK_ID, 2);
+
+    /* Order matches the FUNCTION_*_ABBREV ids */
+    emit_record(s, BLOCKINFO_SETBID, {FUNCTION_BLOCK_ID});
+    define_block_info_abbrev(s, FUNCTION_BLOCK_ID,
+                             {literal(INST_LOAD), vbr(6), fixed(bits), vbr(4),
+                              fixed(1)});
+    define_block_info_abbrev(s, FUNCTION_BLOCK_ID,
+                             {literal(INST_BINOP), vbr(6), vbr(6), fixed(4)});
+    define_block_info_abbrev(s, FUNCTION_BLOCK_ID,
+                             {literal(INST_CAST), vbr(6), fixed(bits),
+                              fixed(4)});
+    define_block_info_abbrev(s, FUNCTION_BLOCK_ID, {literal(INST_RET)});
+    define_block_info_abbrev(s, FUNCTION_BLOCK_ID,
+                             {literal(INST_RET), vbr(6)});
+    define_block_info_abbrev(s, FUNCTION_BLOCK_ID,
+                             {literal(INST_UNREACHABLE)});
+    define_block_info_abbrev(s, FUNCTION_BLOCK_ID,
+                             {literal(INST_GEP), fixed(1), fixed(bits),
+                              encoded(ENCODING_ARRAY), vbr(6)});
+
+    emit_record(s, BLOCKINFO_SETBID, {CONSTANTS_BLOCK_ID});
+    define_block_info_abbrev(s, CONSTANTS_BLOCK_ID,
+                             {literal(CONSTANT_SETTYPE), fixed(bits)});
+    define_block_info_abbrev(s, CONSTANTS_BLOCK_ID,
+                             {literal(CONSTANT_INTEGER), vbr(8)});
+    define_block_info_abbrev(s, CONSTANTS_BLOCK_ID,
+                             {literal(CONSTANT_NULL)});
+
+    emit_record(s, BLOCKINFO_SETBID, {VALUE_SYMTAB_BLOCK_ID});
+    define_block_info_abbrev(s, VALUE_SYMTAB_BLOCK_ID,
+                             {literal(VST_ENTRY), vbr(8),
+                              encoded(ENCODING_ARRAY), fixed(8)});
+    define_block_info_abbrev(s, VALUE_SYMTAB_BLOCK_ID,
+                             {literal(VST_ENTRY), vbr(8),
+                              encoded(ENCODING_ARRAY),
+                              encoded(ENCODING_CHAR6)});
+    define_block_info_abbrev(s, VALUE_SYMTAB_BLOCK_ID,
+                             {literal(VST_BBENTRY), vbr(8),
+                              encoded(ENCODING_ARRAY),
+                              encoded(ENCODING_CHAR6)});
+
+    exit_block(s);
+}
+
+static void write_types(BitStream* s, const BitcodeWriter* writer,
+                        unsigned bits) {
+    enter_block(s, TYPE_BLOCK_ID, 4);
+    unsigned pointer_abbrev =
+        define_abbrev(s, {literal(TYPE_CODE_POINTER), fixed(bits), literal(0)});
+    unsigned function_abbrev =
+        define_abbrev(s, {literal(TYPE_CODE_FUNCTION), fixed(1),
+                          encoded(ENCODING_ARRAY), fixed(bits)});
+    unsigned array_abbrev =
+        define_abbrev(s, {literal(TYPE_CODE_ARRAY), vbr(8), fixed(bits)});
+    unsigned name_abbrev =
+        define_abbrev(s, {literal(TYPE_CODE_STRUCT_NAME), encoded(ENCODING_ARRAY),
+                          encoded(ENCODING_CHAR6)});
+
+    emit_record(s, TYPE_CODE_NUMENTRY, {writer->types.size()});
+    for (const BCType& type : writer->types) {
+        switch (type.kind) {
+        case BC_TYPE_VOID:
+            emit_record(s, TYPE_CODE_VOID, {});
+            break;
+        case BC_TYPE_FLOAT:
+            emit_record(s, TYPE_CODE_FLOAT, {});
+            break;
+        case BC_TYPE_DOUBLE:
+            emit_record(s, TYPE_CODE_DOUBLE, {});
+            break;
+        case BC_TYPE_INTEGER:
+            emit_record(s, TYPE_CODE_INTEGER, {type.width});
+            break;
+        case BC_TYPE_POINTER:
+            emit_abbrev_record(s, pointer_abbrev,
+                               {TYPE_CODE_POINTER, (uint64_t)type.element, 0});
+            break;
+        case BC_TYPE_ARRAY:
+            emit_abbrev_record(s, array_abbrev,
+                               {TYPE_CODE_ARRAY, type.count,
+                                (uint64_t)type.element});
+            break;
+        case BC_TYPE_STRUCT:
+            emit_string_record(s, TYPE_CODE_STRUCT_NAME, type.name, name_abbrev);
+            emit_record(s, TYPE_CODE_OPAQUE, {0});
+            break;
+        case BC_TYPE_FUNCTION: {
+            std::vector<uint64_t> values = {TYPE_CODE_FUNCTION,
+                                            (uint64_t)type.is_variadic,
+                                            (uint64_t)type.element};
+            for (int parameter : type.parameters) {
+                values.push_back((uint64_t)parameter);
+            }
+            emit_abbrev_record(s, function_abbrev, values);
+            break;
+        }
+        }
+    }
+    exit_block(s);
+}
+
+/* Zero-valued strings are null; C strings leave out their terminator */
+static void write_string_constant(BitStream* s, const std::string& bytes,
+                                  int module_level) {
+    if (bytes.find_first_not_of('\0') == std::string::npos) {
+        emit_abbrev_record(s, CONSTANTS_NULL_ABBREV, {CONSTANT_NULL});
+        return;
+    }
+    int is_cstring = bytes.back() == '\0' &&
+                     bytes.find('\0') == bytes.size() - 1;
+    std::string text = is_cstring ? bytes.substr(0, bytes.size() - 1) : bytes;
+    unsigned code = is_cstring ? CONSTANT_CSTRING : CONSTANT_STRING;
+
+    std::vector<uint64_t> values = {code};
+    for (char c : text) {
+        values.push_back((uint8_t)c);
+    }
+    if (!module_level) {
+        values.erase(values.begin());
+        emit_record(s, code, values);
+    } else if (is_cstring && is_char6_string(text)) {
+        emit_abbrev_record(s, CONSTANTS_CSTRING6_ABBREV, values);
+    } else {
+        emit_abbrev_record(s,
+                           is_cstring ? CONSTANTS_CSTRING_ABBREV
+                                      : CONSTANTS_STRING_ABBREV,
+                           values);
+    }
+}
+
+static void write_constants(BitStream* s, const BitcodeWriter* writer,
+                            const std::vector<BCConstant>& constants,
+                            int module_level) {
+    if (constants.empty())
+        return;
+    enter_block(s, CONSTANTS_BLOCK_ID, 4);
+    if (module_level) {
+        define_abbrev(s, {literal(CONSTANT_STRING), encoded(ENCODING_ARRAY),
+                          fixed(8)});
+        define_abbrev(s, {literal(CONSTANT_CSTRING), encoded(ENCODING_ARRAY),
+                          fixed(8)});
+        define_abbrev(s, {literal(CONSTANT_CSTRING), encoded(ENCODING_ARRAY),
+                          encoded(ENCODING_CHAR6)});
+    }
+
+    int current_type = -1;
+    for (const BCConstant& constant : constants) {
+        if (constant.type != current_type) {
+            current_type = constant.type;
+            emit_abbrev_record(s, CONSTANTS_SETTYPE_ABBREV,
+                               {CONSTANT_SETTYPE, (uint64_t)current_type});
+        }
+        switch (constant.kind) {
+        case BC_CONST_INTEGER: {
+            /* Sign rotated: the sign moves to the low bit */
+            uint64_t value = constant.value >= 0
+                                 ? (uint64_t)constant.value << 1
+                                 : ((uint64_t)-constant.value << 1) | 1;
+            emit_abbrev_record(s, CONSTANTS_INTEGER_ABBREV,
+                               {CONSTANT_INTEGER, value});
+            break;
+        }
+        case BC_CONST_FLOAT: {
+            uint64_t bits;
+            if (type_kind(writer, constant.type) == BC_TYPE_FLOAT) {
+                float single = (float)constant.real;
+                uint32_t word;
+                memcpy(&word, &single, sizeof(word));
+                bits = word;
+            } else {
+                memcpy(&bits, &constant.real, sizeof(bits));
+            }
+            emit_record(s, CONSTANT_FLOAT, {bits});
+            break;
+        }
+        case BC_CONST_NULL:
+            emit_abbrev_record(s, CONSTANTS_NULL_ABBREV, {CONSTANT_NULL});
+            break;
+        case BC_CONST_UNDEF:
+            emit_record(s, CONSTANT_UNDEF, {});
+            break;
+        case BC_CONST_STRING:
+            write_string_constant(s, constant.bytes, module_level);
+            break;
+        case BC_CONST_CAST:
+            emit_record(s, CONSTANT_CE_CAST,
+                        {(uint64_t)constant.value,
+                         (uint64_t)constant.operand.type,
+                         module_value_id(writer, constant.operand)});
+            break;
+        }
+    }
+    exit_block(s);
+}
+
+/* Value numbering of one function body: module values, then arguments,
+ * constants and instruction results */
+typedef struct BodyWriter {
+    const BitcodeWriter* writer;
+    const BCFunction* function;
+    uint64_t arguments; /* First argument id */
+    std::vector<uint64_t> ids;
+    uint64_t next; /* Id of the next result */
+} BodyWriter;
+
+static uint64_t value_id(const BodyWriter* body, const BCValue& value) {
+    switch (value.kind) {
+    case BC_VALUE_ARGUMENT:
+        return body->arguments + (uint64_t)value.index;
+    case BC_VALUE_CONSTANT:
+        return body->arguments +
+               body->function->parameter_names.size() + (uint64_t)value.index;
+    case BC_VALUE_INSTRUCTION:
+        return body->ids[value.index];
+    default:
+        return module_value_id(body->writer, value);
+    }
+}
+
+/* Operands are relative to the next result id */
+static void push_value(const BodyWriter* body, std::vector<uint64_t>& values,
+                       const BCValue& value) {
+    values.push_back((uint32_t)(body->next - value_id(body, value)));
+}
+
+/* Forward references carry their type; returns 1 for those */
+static int push_value_and_type(const BodyWriter* body,
+                               std::vector<uint64_t>& values,
+                               const BCValue& value) {
+    uint64_t id = value_id(body, value);
+    values.push_back((uint32_t)(body->next - id));
+    if (id >= body->next) {
+        values.push_back((uint64_t)value.type);
+        return 1;
+    }
+    return 0;
+}
+
+static void write_instruction(BitStream* s, const BodyWriter* body,
+                              const BCInstruction& instruction) {
+    const std::vector<BCValue>& operands = instruction.operands;
+    std::vector<uint64_t> values;
+
+    switch (instruction.opcode) {
+    case BC_ALLOCA:
+        emit_record(s, INST_ALLOCA,
+                    {(uint64_t)instruction.operand_type,
+                     (uint64_t)operands[0].type, value_id(body, operands[0]),
+                     64 /* Explicit type */});
+        break;
+    case BC_LOAD:
+        values.push_back(INST_LOAD);
+        push_value_and_type(body, values, operands[0]);
+        values.push_back((uint64_t)instruction.operand_type);
+        values.push_back(0);
+        values.push_back(0);
+        if (values.size() == 5) {
+            emit_abbrev_record(s, FUNCTION_LOAD_ABBREV, values);
+        } else {
+            values.erase(values.begin());
+            emit_record(s, INST_LOAD, values);
+        }
+        break;
+    case BC_STORE:
+        push_value_and_type(body, values, operands[0]);
+        push_value_and_type(body, values, operands[1]);
+        values.push_back(0);
+        values.push_back(0);
+        emit_record(s, INST_STORE, values);
+        break;
+    case BC_GEP:
+        values.push_back(INST_GEP);
+        values.push_back(0);
+        values.push_back((uint64_t)instruction.operand_type);
+        for (const BCValue& operand : operands) {
+            push_value_and_type(body, values, operand);
+        }
+        emit_abbrev_record(s, FUNCTION_GEP_ABBREV, values);
+        break;
+    case BC_BINARY:
+    case BC_CMP: {
+        int is_binary = instruction.opcode == BC_BINARY;
+        values.push_back(is_binary ? INST_BINOP : INST_CMP2);
+        int forward = push_value_and_type(body, values, operands[0]);
+        push_value(body, values, operands[1]);
+        values.push_back((uint64_t)instruction.op);
+        if (is_binary && !forward) {
+            emit_abbrev_record(s, FUNCTION_BINOP_ABBREV, values);
+        } else {
+            values.erase(values.begin());
+            emit_record(s, is_binary ? INST_BINOP : INST_CMP2, values);
+        }
+        break;
+    }
+    case BC_CAST:
+        values.push_back(INST_CAST);
+        if (!push_value_and_type(body, values, operands[0])) {
+            values.push_back((uint64_t)instruction.type);
+            values.push_back((uint64_t)instruction.op);
+            emit_abbrev_record(s, FUNCTION_CAST_ABBREV, values);
+        } else {
+            values.push_back((uint64_t)instruction.type);
+            values.push_back((uint64_t)instruction.op);
+            values.erase(values.begin());
+            emit_record(s, INST_CAST, values);
+        }
+        break;
+    case BC_PHI:
+        values.push_back((uint64_t)instruction.type);
+        for (size_t i = 0; i < operands.size(); i++) {
+            /* Signed: incoming values are often defined later */
+            int64_t delta =
+                (int64_t)body->next - (int64_t)value_id(body, operands[i]);
+            values.push_back(delta >= 0 ? (uint64_t)delta << 1
+                                        : ((uint64_t)-delta << 1) | 1);
+            values.push_back((uint64_t)instruction.blocks[i]);
+        }
+        emit_record(s, INST_PHI, values);
+        break;
+    case BC_CALL: {
+        const BCType& type = body->writer->types[instruction.operand_type];
+        values.push_back(0);       /* No attributes */
+        values.push_back(1 << 15); /* Explicit function type, C calls */
+        values.push_back((uint64_t)instruction.operand_type);
+        push_value_and_type(body, values, operands[0]);
+        for (size_t i = 1; i < operands.size(); i++) {
+            if (i <= type.parameters.size()) {
+                push_value(body, values, operands[i]);
+            } else {
+                push_value_and_type(body, values, operands[i]);
+            }
+        }
+        emit_record(s, INST_CALL, values);
+        break;
+    }
+    case BC_BR:
+        emit_record(s, INST_BR, {(uint64_t)instruction.blocks[0]});
+        break;
+    case BC_COND_BR:
+        values.push_back((uint64_t)instruction.blocks[0]);
+        values.push_back((uint64_t)instruction.blocks[1]);
+        push_value(body, values, operands[0]);
+        emit_record(s, INST_BR, values);
+        break;
+    case BC_SWITCH:
+        /* Case values are absolute constant ids */
+        values.push_back((uint64_t)operands[0].type);
+        push_value(body, values, operands[0]);
+        values.push_back((uint64_t)instruction.blocks[0]);
+        for (size_t i = 1; i < operands.size(); i++) {
+            values.push_back(value_id(body, operands[i]));
+            values.push_back((uint64_t)instruction.blocks[i]);
+        }
+        emit_record(s, INST_SWITCH, values);
+        break;
+    case BC_RET:
+        values.push_back(INST_RET);
+        if (operands.empty()) {
+            emit_abbrev_record(s, FUNCTION_RET_VOID_ABBREV, values);
+        } else if (!push_value_and_type(body, values, operands[0])) {
+            emit_abbrev_record(s, FUNCTION_RET_VAL_ABBREV, values);
+        } else {
+            values.erase(values.begin());
+            emit_record(s, INST_RET, values);
+        }
+        break;
+    case BC_UNREACHABLE:
+        emit_abbrev_record(s, FUNCTION_UNREACHABLE_ABBREV, {INST_UNREACHABLE});
+        break;
+    }
+}
+
+static void write_symbol(BitStream* s, unsigned code, uint64_t id,
+                         const std::string& name) {
+    std::vector<uint64_t> values = {code, id};
+    for (char c : name) {
+        values.push_back((uint8_t)c);
+    }
+    if (is_char6_string(name)) {
+        emit_abbrev_record(s,
+                           code == VST_BBENTRY ? VST_BBENTRY6_ABBREV
+                                               : VST_ENTRY6_ABBREV,
+                           values);
+    } else if (code == VST_ENTRY) {
+        emit_abbrev_record(s, VST_ENTRY8_ABBREV, values);
+    } else {
+        values.erase(values.begin());
+        emit_record(s, code, values);
+    }
+}
+
+static void write_function_body(BitStream* s, const BitcodeWriter* writer,
+                                const BCFunction& function) {
+    BodyWriter body;
+    body.writer = writer;
+    body.function = &function;
+    body.arguments = writer->globals.size() + writer->functions.size() +
+                     writer->constants.size();
+    body.ids.assign(function.instructions.size(), 0);
+    body.next = body.arguments + function.parameter_names.size() +
+                function.constants.size();
+
+    /* Results are numbered in layout order */
+    uint64_t first_result = body.next;
+    for (const BCBlock& block : function.blocks) {
+        for (int index : block.instructions) {
+            if (function.instructions[index].type >= 0)
+                body.ids[index] = body.next++;
+        }
+    }
+    body.next = first_result;
+
+    enter_block(s, FUNCTION_BLOCK_ID, 4);
+    emit_record(s, INST_DECLAREBLOCKS, {function.blocks.size()});
+    write_constants(s, writer, function.constants, 0);
+    for (const BCBlock& block : function.blocks) {
+        for (int index : block.instructions) {
+            const BCInstruction& instruction = function.instructions[index];
+            write_instruction(s, &body, instruction);
+            if (instruction.type >= 0)
+                body.next++;
+        }
+    }
+
+    enter_block(s, VALUE_SYMTAB_BLOCK_ID, 4);
+    for (size_t i = 0; i < function.parameter_names.size(); i++) {
+        write_symbol(s, VST_ENTRY, body.arguments + i,
+                     function.parameter_names[i]);
+    }
+    for (size_t i = 0; i < function.instructions.size(); i++) {
+        if (!function.instructions[i].name.empty()) {
+            write_symbol(s, VST_ENTRY, body.ids[i],
+                         function.instructions[i].name);
+        }
+    }
+    for (size_t i = 0; i < function.blocks.size(); i++) {
+        if (!function.blocks[i].name.empty())
+            write_symbol(s, VST_BBENTRY, i, function.blocks[i].name);
+    }
+    exit_block(s);
+
+    exit_block(s);
+}
+
+/* One operand per character */
+static std::vector<uint64_t> string_record(const char* text) {
+    std::vector<uint64_t> record;
+    for (const char* c = text; *c; c++) {
+        record.push_back((uint8_t)*c);
+    }
+    return record;
+}
+
+/* Module block: globals, then functions, then module constants take the
+ * first value ids. Names live in the string table after it. */
+static void write_module(BitStream* s, BitcodeWriter* writer) {
+    cast_retyped_operands(writer);
+    unsigned bits = type_bits(writer);
+    std::string strtab;
+
+    enter_block(s, MODULE_BLOCK_ID, 3);
+    emit_record(s, MODULE_VERSION, {2});
+    write_block_info(s, bits);
+    write_types(s, writer, bits);
+
+    emit_record(s, MODULE_TRIPLE, string_record(writer->target->triple));
+    emit_record(s, MODULE_DATALAYOUT,
+                string_record(writer->target->datalayout));
+
+    for (const BCGlobal& global : writer->globals) {
+        std::vector<uint64_t> values = {
+            strtab.size(),
+            global.name.size(),
+            (uint64_t)global.type,
+            2u | (uint64_t)global.is_constant, /* Explicit type */
+            global.initializer < 0
+                ? 0
+                : writer->globals.size() + writer->functions.size() +
+                      (uint64_t)global.initializer + 1,
+            (uint64_t)global.linkage,
+            0, /* Alignment */
+            0  /* Section */
+        };
+        if (global.unnamed_addr) {
+            values.push_back(0); /* Visibility */
+            values.push_back(0); /* Thread local */
+            values.push_back(1); /* unnamed_addr */
+        }
+        strtab += global.name;
+        emit_record(s, MODULE_GLOBALVAR, values);
+    }
+    for (const BCFunction& function : writer->functions) {
+        emit_record(s, MODULE_FUNCTION,
+                    {strtab.size(), function.name.size(),
+                     (uint64_t)function.type, 0 /* C calling convention */,
+                     (uint64_t)!function.defined, (uint64_t)function.linkage,
+                     0, 0, 0, 0});
+        strtab += function.name;
+    }
+
+    write_constants(s, writer, writer->constants, 1);
+    /* Bodies pair up with the definitions in record order */
+    for (const BCFunction& function : writer->functions) {
+        if (function.defined)
+            write_function_body(s, writer, function);
+    }
+    exit_block(s);
+
+    enter_block(s, STRTAB_BLOCK_ID, 3);
+    unsigned blob_abbrev =
+        define_abbrev(s, {literal(STRTAB_BLOB), encoded(ENCODING_BLOB)});
+    emit_blob_record(s, blob_abbrev, strtab);
+    exit_block(s);
+}
+
+/* Public interface */
+
+BitcodeWriter* bitcode_writer_create(void) {
+    auto writer = new BitcodeWriter();
+    writer->consumer.data = writer;
+    writer->consumer.add_global = add_global;
+    writer->consumer.add_function = add_function;
+    writer->target = target_host();
+    writer->error_count = 0;
+    return writer;
+}
+
+void bitcode_writer_attach(BitcodeWriter* writer, CodeGenContext* ctx) {
+    ctx->consumer = &writer->consumer;
+    writer->target = ctx->target;
+}
+
+unsigned char* bitcode_writer_release(BitcodeWriter* writer, size_t* length) {
+    if (writer->error_count > 0)
+        return NULL;
+
+    BitStream s;
+    s.pending = 0;
+    s.pending_bits = 0;
+    s.abbrev_width = 2;
+    emit_bits(&s, 'B', 8);
+    emit_bits(&s, 'C', 8);
+    emit_bits(&s, 0x0, 4);
+    emit_bits(&s, 0xC, 4);
+    emit_bits(&s, 0xE, 4);
+    emit_bits(&s, 0xD, 4);
+    write_identification(&s);
+    write_module(&s, writer);
+    align_word(&s);
+
+    unsigned char* result = (unsigned char*)malloc(s.bytes.size());
+    if (!result) {
+        fprintf(stderr, "Error: Memory allocation failed for bitcode\n");
+        exit(1);
+    }
+    memcpy(result, s.bytes.data(), s.bytes.size());
+    *length = s.bytes.size();
+    return result;
+}
+
+int bitcode_writer_write(BitcodeWriter* writer, const char* path) {
+    size_t length = 0;
+    unsigned char* bitcode = bitcode_writer_release(writer, &length);
+    if (!bitcode)
+        return -1;
+
+    FILE* out = path ? fopen(path, "wb") : stdout;
+    if (!out) {
+        fprintf(stderr, "Error: Cannot open output file '%s'\n", path);
+        free(bitcode);
+        return -1;
+    }
+    int result = fwrite(bitcode, 1, length, out) == length ? 0 : -1;
+    if (path ? fclose(out) != 0 : fflush(out) != 0)
+        result = -1;
+    if (result != 0)
+        fprintf(stderr, "Error: Failed to write bitcode\n");
+    free(bitcode);
+    return result;
+}
+
+void bitcode_writer_free(BitcodeWriter* writer) {
+    delete writer;
+}
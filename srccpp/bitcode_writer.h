@@ -0,0 +1,36 @@
+#ifndef BITCODE_WRITER_H
+#define BITCODE_WRITER_H
+
+extern "C" {
+
+#include "codegen.h"
+
+/*
+ * LLVM bitcode output (--emit=bc) without libLLVM.
+ *
+ * Attached to a code generation context like the LLVM C API backend, the
+ * writer copies each function and module global it is handed into its own
+ * module model, then serializes the whole module in the LLVM 14 bitstream
+ * format: identification, module (version 2, relative value ids) and
+ * string table blocks, with abbreviations for the common records. It
+ * covers the IR the code generator produces: integer, pointer, array and
+ * opaque struct types, global variables and strings, function declarations
+ * and definitions, and the memory, integer, cast, GEP, phi, call and
+ * branch instructions. Implicit conversions in the IR are made explicit,
+ * as in the C API backend, so that the output reads back with llvm-dis.
+ */
+
+typedef struct BitcodeWriter BitcodeWriter;
+
+BitcodeWriter* bitcode_writer_create(void);
+/* Route everything ctx generates from now on to writer, for ctx's target */
+void bitcode_writer_attach(BitcodeWriter* writer, CodeGenContext* ctx);
+/* Serialize the module to path, or stdout when path is NULL; returns 0 on
+ * success, else reports to stderr */
+int bitcode_writer_write(BitcodeWriter* writer, const char* path);
+/* Serialize the module into a malloc'd buffer; NULL on error */
+unsigned char* bitcode_writer_release(BitcodeWriter* writer, size_t* length);
+void bitcode_writer_free(BitcodeWriter* writer);
+}
+
+#endif /* BITCODE_WRITER_H */
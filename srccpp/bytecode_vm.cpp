@@ -0,0 +1,1510 @@
+#include "bytecode_vm.h"
+
+#include "target.h"
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Bytecode */
+
+/* a, b and c are frame registers unless noted */
+#define VM_OPCODES(X)                                                         \
+    X(MOVE)          /* a = b */                                              \
+    X(FRAME_ADDRESS) /* a = frame memory + immediate */                       \
+    X(LOAD_I1)       /* a = *(i1*)b, likewise for the other loads */          \
+    X(LOAD_I8)                                                                \
+    X(LOAD_I16)                                                               \
+    X(LOAD_I32)                                                               \
+    X(LOAD_U32) /* float bits */                                              \
+    X(LOAD_I64)                                                               \
+    X(STORE_8) /* *(i8*)b = a, likewise for the other stores */               \
+    X(STORE_16)                                                               \
+    X(STORE_32)                                                               \
+    X(STORE_64)                                                               \
+    X(ADD) /* a = b op c, in 64 bits */                                       \
+    X(SUB)                                                                    \
+    X(MUL)                                                                    \
+    X(SHL)                                                                    \
+    X(ADD32) /* a = b op c, in 32 bits sign-extended */                       \
+    X(SUB32)                                                                  \
+    X(MUL32)                                                                  \
+    X(SHL32)                                                                  \
+    X(SDIV)                                                                   \
+    X(SREM)                                                                   \
+    X(AND)                                                                    \
+    X(OR)                                                                     \
+    X(XOR)                                                                    \
+    X(ASHR)                                                                   \
+    X(ADD_IMMEDIATE) /* a = b + immediate */                                  \
+    X(ADD_SCALED)    /* a = b + c * immediate */                              \
+    X(EQ)            /* a = b cmp c, signed */                                \
+    X(NE)                                                                     \
+    X(LT)                                                                     \
+    X(GT)                                                                     \
+    X(LE)                                                                     \
+    X(GE)                                                                     \
+    X(TRUNC_I1) /* a = b narrowed or widened */                               \
+    X(SEXT_I8)                                                                \
+    X(SEXT_I16)                                                               \
+    X(SEXT_I32)                                                               \
+    X(ZEXT_I8)                                                                \
+    X(ZEXT_I16)                                                               \
+    X(ZEXT_I32)                                                               \
+    X(INT_TO_FLOAT) /* a = b converted; floats are kept as their bits */     \
+    X(INT_TO_DOUBLE)                                                          \
+    X(FLOAT_TO_INT)                                                           \
+    X(DOUBLE_TO_INT)                                                          \
+    X(FLOAT_TO_DOUBLE)                                                        \
+    X(DOUBLE_TO_FLOAT)                                                        \
+    X(JUMP)         /* to instruction immediate */                            \
+    X(JUMP_IF_ZERO) /* to instruction immediate when a is zero */             \
+    X(JUMP_TABLE)   /* c + 1 JUMPs follow: the (a - immediate + 1)th when     \
+                       in range, else the first */                            \
+    X(CALL) /* a = function b (arguments: immediate registers at c) */        \
+    X(RETURN)       /* a, or nothing when a < 0 */                            \
+    X(TRAP)         /* Branch to a block that was never laid out */
+
+typedef enum {
+#define VM_OPCODE_ENUM(name) VM_##name,
+    VM_OPCODES(VM_OPCODE_ENUM)
+#undef VM_OPCODE_ENUM
+} VMOpcode;
+
+typedef struct VMInstruction {
+    int opcode;
+    int a;
+    int b;
+    int c;
+    int64_t immediate;
+} VMInstruction;
+
+/* Foreign functions take the integer arguments of a call */
+typedef int64_t (*VMForeign)(const int64_t* args, int count);
+
+typedef struct VMFunction {
+    std::string name;
+    int defined;
+    VMForeign foreign; /* Bound at link time for undefined functions */
+    std::vector<VMInstruction> code;
+    std::vector<int64_t> registers; /* Initial values: constants, globals */
+    std::vector<std::pair<int, std::string>> addresses; /* Filled at link */
+    std::vector<int> call_arguments; /* Argument registers of all calls */
+    int parameter_count;
+    int frame_size; /* Bytes of stack memory for allocas */
+} VMFunction;
+
+/* Signature of a declared or defined function, for argument conversions;
+ * types are interned in the VM's own table, as function bodies release
+ * theirs once compiled */
+typedef struct VMPrototype {
+    TypeInfo* return_type;
+    std::vector<TypeInfo*> parameters;
+    int is_variadic;
+} VMPrototype;
+
+struct BytecodeVM {
+    std::vector<VMFunction*> functions;
+    std::unordered_map<std::string, int> function_index;
+    std::unordered_map<std::string, VMPrototype> prototypes;
+    TypeTable types; /* Prototype types */
+    std::vector<uint8_t> data; /* Globals and strings; fixed once linked */
+    std::unordered_map<std::string, size_t> data_symbols;
+    const TargetInfo* target;
+    IRConsumer consumer;
+    int error_count;
+
+    /* Execution */
+    int64_t* register_stack;
+    size_t register_top;
+    uint8_t* memory_stack;
+    size_t memory_top;
+    jmp_buf trap;
+};
+
+#define VM_REGISTER_STACK (1u << 20) /* Registers, all frames */
+#define VM_MEMORY_STACK (8u << 20)   /* Bytes of alloca memory */
+#define VM_MAX_ARGUMENTS 64
+
+static void vm_error(BytecodeVM* vm, const char* format, const char* name) {
+    fprintf(stderr, "Error: ");
+    fprintf(stderr, format, name);
+    fprintf(stderr, "\n");
+    vm->error_count++;
+}
+
+/* Runtime error: report and leave bytecode_vm_run */
+static void vm_trap(BytecodeVM* vm, const char* format, const char* name) {
+    fflush(stdout);
+    vm_error(vm, format, name);
+    longjmp(vm->trap, 1);
+}
+
+/* Foreign function table */
+
+static int64_t foreign_printf(const int64_t* a, int count) {
+    int64_t v[16] = {0};
+    memcpy(v, a, sizeof(int64_t) * (count < 16 ? count : 16));
+    return printf((const char*)v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7],
+                  v[8], v[9], v[10], v[11], v[12], v[13], v[14], v[15]);
+}
+
+static int64_t foreign_sprintf(const int64_t* a, int count) {
+    int64_t v[16] = {0};
+    memcpy(v, a, sizeof(int64_t) * (count < 16 ? count : 16));
+    return sprintf((char*)v[0], (const char*)v[1], v[2], v[3], v[4], v[5],
+                   v[6], v[7], v[8], v[9], v[10], v[11], v[12], v[13], v[14],
+                   v[15]);
+}
+
+static int64_t foreign_scanf(const int64_t* a, int count) {
+    int64_t v[16] = {0};
+    memcpy(v, a, sizeof(int64_t) * (count < 16 ? count : 16));
+    return scanf((const char*)v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7],
+                 v[8], v[9], v[10], v[11], v[12], v[13], v[14], v[15]);
+}
+
+static int64_t foreign_puts(const int64_t* a, int) {
+    return puts((const char*)a[0]);
+}
+
+static int64_t foreign_putchar(const int64_t* a, int) {
+    return putchar((int)a[0]);
+}
+
+static int64_t foreign_getchar(const int64_t*, int) {
+    return getchar();
+}
+
+static int64_t foreign_malloc(const int64_t* a, int) {
+    return (int64_t)malloc((size_t)a[0]);
+}
+
+static int64_t foreign_calloc(const int64_t* a, int) {
+    return (int64_t)calloc((size_t)a[0], (size_t)a[1]);
+}
+
+static int64_t foreign_realloc(const int64_t* a, int) {
+    return (int64_t)realloc((void*)a[0], (size_t)a[1]);
+}
+
+static int64_t foreign_free(const int64_t* a, int) {
+    free((void*)a[0]);
+    return 0;
+}
+
+static int64_t foreign_strlen(const int64_t* a, int) {
+    return (int64_t)strlen((const char*)a[0]);
+}
+
+static int64_t foreign_strcmp(const int64_t* a, int) {
+    return strcmp((const char*)a[0], (const char*)a[1]);
+}
+
+static int64_t foreign_strncmp(const int64_t* a, int) {
+    return strncmp((const char*)a[0], (const char*)a[1], (size_t)a[2]);
+}
+
+static int64_t foreign_strcpy(const int64_t* a, int) {
+    return (int64_t)strcpy((char*)a[0], (const char*)a[1]);
+}
+
+static int64_t foreign_strcat(const int64_t* a, int) {
+    return (int64_t)strcat((char*)a[0], (const char*)a[1]);
+}
+
+static int64_t foreign_memset(const int64_t* a, int) {
+    return (int64_t)memset((void*)a[0], (int)a[1], (size_t)a[2]);
+}
+
+static int64_t foreign_memcpy(const int64_t* a, int) {
+    return (int64_t)memcpy((void*)a[0], (const void*)a[1], (size_t)a[2]);
+}
+
+static int64_t foreign_memcmp(const int64_t* a, int) {
+    return memcmp((const void*)a[0], (const void*)a[1], (size_t)a[2]);
+}
+
+static int64_t foreign_abs(const int64_t* a, int) {
+    return abs((int)a[0]);
+}
+
+static int64_t foreign_atoi(const int64_t* a, int) {
+    return atoi((const char*)a[0]);
+}
+
+static int64_t foreign_exit(const int64_t* a, int) {
+    exit((int)a[0]);
+}
+
+/* Results are extended as the C return type requires; arguments past
+ * those named in the table's wrapper are ignored, and only integer and
+ * pointer arguments can be passed */
+static const struct ForeignEntry {
+    const char* name;
+    VMForeign function;
+    int arity; /* Arguments read; variadic wrappers take up to 16 */
+} foreign_functions[] = {
+    {"printf", foreign_printf, 1},   {"sprintf", foreign_sprintf, 2},
+    {"scanf", foreign_scanf, 1},     {"puts", foreign_puts, 1},
+    {"putchar", foreign_putchar, 1}, {"getchar", foreign_getchar, 0},
+    {"malloc", foreign_malloc, 1},   {"calloc", foreign_calloc, 2},
+    {"realloc", foreign_realloc, 2}, {"free", foreign_free, 1},
+    {"strlen", foreign_strlen, 1},   {"strcmp", foreign_strcmp, 2},
+    {"strncmp", foreign_strncmp, 3}, {"strcpy", foreign_strcpy, 2},
+    {"strcat", foreign_strcat, 2},   {"memset", foreign_memset, 3},
+    {"memcpy", foreign_memcpy, 3},   {"memcmp", foreign_memcmp, 3},
+    {"abs", foreign_abs, 1},         {"atoi", foreign_atoi, 1},
+    {"exit", foreign_exit, 1},
+};
+
+static const ForeignEntry* find_foreign(const char* name) {
+    for (const ForeignEntry& entry : foreign_functions) {
+        if (strcmp(entry.name, name) == 0)
+            return &entry;
+    }
+    return NULL;
+}
+
+/* Types */
+
+enum { CLASS_INTEGER, CLASS_FLOAT, CLASS_DOUBLE };
+
+/* Pointers count as integers; void stands in for an int as in the text */
+static int value_class(const TypeInfo* type) {
+    if (type && type->base_type == TYPE_FLOAT)
+        return CLASS_FLOAT;
+    if (type && type->base_type == TYPE_DOUBLE)
+        return CLASS_DOUBLE;
+    return CLASS_INTEGER;
+}
+
+static int value_bits(const TypeInfo* type) {
+    if (!type)
+        return 32;
+    switch (type->base_type) {
+    case TYPE_BOOL:
+        return 1;
+    case TYPE_CHAR:
+        return 8;
+    case TYPE_SHORT:
+        return 16;
+    case TYPE_LONG:
+    case TYPE_DOUBLE:
+    case TYPE_POINTER:
+    case TYPE_ARRAY:
+    case TYPE_FUNCTION:
+    case TYPE_STRUCT:
+    case TYPE_UNION:
+        return 64;
+    default:
+        return 32;
+    }
+}
+
+static int has_unknown_layout(const TypeInfo* type) {
+    while (type && type->base_type == TYPE_ARRAY) {
+        type = type->return_type;
+    }
+    return type &&
+           (type->base_type == TYPE_STRUCT || type->base_type == TYPE_UNION);
+}
+
+static int type_size(BytecodeVM* vm, const TypeInfo* type) {
+    if (!type || type->base_type == TYPE_VOID)
+        return vm->target->int_size;
+    return target_type_size(vm->target, type);
+}
+
+/* Register contents of constant value: integers sign-extended, i1 as 0/1,
+ * floats as their bits */
+static int64_t constant_bits_of(const TypeInfo* type, int64_t constant) {
+    switch (value_class(type)) {
+    case CLASS_FLOAT: {
+        float real = (float)constant;
+        uint32_t bits;
+        memcpy(&bits, &real, sizeof(bits));
+        return bits;
+    }
+    case CLASS_DOUBLE: {
+        double real = (double)constant;
+        int64_t bits;
+        memcpy(&bits, &real, sizeof(bits));
+        return bits;
+    }
+    default:
+        switch (value_bits(type)) {
+        case 1:
+            return constant != 0;
+        case 8:
+            return (int8_t)constant;
+        case 16:
+            return (int16_t)constant;
+        case 32:
+            return (int32_t)constant;
+        default:
+            return constant;
+        }
+    }
+}
+
+static int64_t constant_bits(const IRValue* value) {
+    return constant_bits_of(value->type, value->id);
+}
+
+/* Compilation */
+
+typedef struct VMCompileState {
+    BytecodeVM* vm;
+    VMFunction* function;
+    TypeInfo* return_type;
+    std::unordered_map<int, int> registers;
+    std::unordered_map<std::string, int> locals;
+    std::unordered_map<int64_t, int> constants;
+    std::unordered_map<std::string, int> globals;
+    std::unordered_map<int, int> blocks; /* First instruction by block id */
+    std::vector<std::pair<size_t, int>> branches; /* Instruction, block */
+    std::unordered_map<int, std::vector<const IRInstruction*>> phis;
+    int current_block;
+} VMCompileState;
+
+static int function_for(BytecodeVM* vm, const char* name) {
+    auto found = vm->function_index.find(name);
+    if (found != vm->function_index.end())
+        return found->second;
+    VMFunction* function = new VMFunction();
+    function->name = name;
+    function->defined = 0;
+    function->foreign = NULL;
+    function->parameter_count = 0;
+    function->frame_size = 0;
+    vm->functions.push_back(function);
+    int index = (int)vm->functions.size() - 1;
+    vm->function_index.emplace(name, index);
+    return index;
+}
+
+static int new_register(VMCompileState* state) {
+    state->function->registers.push_back(0);
+    return (int)state->function->registers.size() - 1;
+}
+
+static size_t emit(VMCompileState* state, int opcode, int a, int b, int c,
+                   int64_t immediate) {
+    VMInstruction instruction = {opcode, a, b, c, immediate};
+    state->function->code.push_back(instruction);
+    return state->function->code.size() - 1;
+}
+
+static int constant_register(VMCompileState* state, int64_t bits) {
+    auto found = state->constants.find(bits);
+    if (found != state->constants.end())
+        return found->second;
+    int reg = new_register(state);
+    state->function->registers[reg] = bits;
+    state->constants.emplace(bits, reg);
+    return reg;
+}
+
+/* Register of value; values that were never defined, such as uses in
+ * unreachable code, read as zero */
+static int value_register(VMCompileState* state, const IRValue* value) {
+    switch (value->kind) {
+    case IR_VALUE_REGISTER: {
+        auto found = state->registers.find(value->id);
+        if (found != state->registers.end())
+            return found->second;
+        break;
+    }
+    case IR_VALUE_LOCAL: {
+        auto found = state->locals.find(value->name);
+        if (found != state->locals.end())
+            return found->second;
+        break;
+    }
+    case IR_VALUE_GLOBAL: {
+        auto found = state->globals.find(value->name);
+        if (found != state->globals.end())
+            return found->second;
+        int reg = new_register(state);
+        state->function->addresses.emplace_back(reg, value->name);
+        state->globals.emplace(value->name, reg);
+        return reg;
+    }
+    case IR_VALUE_CONSTANT:
+        return constant_register(state, constant_bits(value));
+    case IR_VALUE_NONE:
+        break;
+    }
+    return constant_register(state, 0);
+}
+
+/* Register for result, made on first definition */
+static int result_register(VMCompileState* state, const IRValue* result) {
+    if (result->kind == IR_VALUE_REGISTER) {
+        auto found = state->registers.find(result->id);
+        if (found != state->registers.end())
+            return found->second;
+        int reg = new_register(state);
+        state->registers.emplace(result->id, reg);
+        return reg;
+    }
+    if (result->kind == IR_VALUE_LOCAL) {
+        auto found = state->locals.find(result->name);
+        if (found != state->locals.end())
+            return found->second;
+        int reg = new_register(state);
+        state->locals.emplace(result->name, reg);
+        return reg;
+    }
+    return new_register(state); /* Unused */
+}
+
+static int narrowing_opcode(int bits) {
+    switch (bits) {
+    case 1:
+        return VM_TRUNC_I1;
+    case 8:
+        return VM_SEXT_I8;
+    case 16:
+        return VM_SEXT_I16;
+    default:
+        return VM_SEXT_I32;
+    }
+}
+
+/* Register holding reg, of type from, as type to; the C API backend's
+ * implicit conversions */
+static int convert(VMCompileState* state, int reg, const TypeInfo* from,
+                   const TypeInfo* to) {
+    int from_class = value_class(from);
+    int to_class = value_class(to);
+    int result;
+
+    if (from_class == CLASS_INTEGER && to_class == CLASS_INTEGER) {
+        /* Registers hold integers sign-extended, so only narrowing costs */
+        if (value_bits(to) >= value_bits(from))
+            return reg;
+        result = new_register(state);
+        emit(state, narrowing_opcode(value_bits(to)), result, reg, 0, 0);
+        return result;
+    }
+    if (from_class == to_class)
+        return reg;
+
+    result = new_register(state);
+    if (from_class == CLASS_INTEGER) {
+        emit(state,
+             to_class == CLASS_FLOAT ? VM_INT_TO_FLOAT : VM_INT_TO_DOUBLE,
+             result, reg, 0, 0);
+    } else if (to_class == CLASS_INTEGER) {
+        emit(state,
+             from_class == CLASS_FLOAT ? VM_FLOAT_TO_INT : VM_DOUBLE_TO_INT,
+             result, reg, 0, 0);
+        if (value_bits(to) < 64)
+            emit(state, narrowing_opcode(value_bits(to)), result, result, 0,
+                 0);
+    } else {
+        emit(state,
+             from_class == CLASS_FLOAT ? VM_FLOAT_TO_DOUBLE
+                                       : VM_DOUBLE_TO_FLOAT,
+             result, reg, 0, 0);
+    }
+    return result;
+}
+
+static int operand_register(VMCompileState* state, const IRValue* value,
+                            const TypeInfo* type) {
+    return convert(state, value_register(state, value), value->type, type);
+}
+
+/* Control flow */
+
+static void emit_branch(VMCompileState* state, int opcode, int a, int block) {
+    state->branches.emplace_back(emit(state, opcode, a, 0, 0, 0), block);
+}
+
+/* Phi results of target set to their values for the edge from the
+ * current block */
+/* Phis take their values at once: with several, one may read another's
+ * result (a swap), so all values are copied out before any is written */
+static void emit_phi_moves(VMCompileState* state, int target) {
+    auto found = state->phis.find(target);
+    if (found == state->phis.end())
+        return;
+    std::vector<std::pair<const IRInstruction*, int>> moves;
+    for (const IRInstruction* phi : found->second) {
+        for (int i = 0; i < phi->operand_count; i++) {
+            if (phi->blocks[i] != state->current_block)
+                continue;
+            int value = operand_register(state, &phi->operands[i], phi->type);
+            moves.emplace_back(phi, value);
+            break;
+        }
+    }
+    if (moves.size() > 1) {
+        for (auto& move : moves) {
+            int copy = new_register(state);
+            emit(state, VM_MOVE, copy, move.second, 0, 0);
+            move.second = copy;
+        }
+    }
+    for (const auto& move : moves) {
+        emit(state, VM_MOVE, result_register(state, &move.first->result),
+             move.second, 0, 0);
+    }
+}
+
+static void emit_jump(VMCompileState* state, int target) {
+    emit_phi_moves(state, target);
+    emit_branch(state, VM_JUMP, 0, target);
+}
+
+/* Case values spanning at most this many table entries per case get a
+ * jump table; sparser switches compare case by case */
+#define VM_JUMP_TABLE_SPREAD 3
+#define VM_JUMP_TABLE_MIN_CASES 4
+
+/* A dense switch indexes a table of JUMPs, entry 0 being the default.
+ * Targets whose phis need moves are reached through a stub per target
+ * after the table. */
+static void emit_switch(VMCompileState* state,
+                        const IRInstruction* instruction) {
+    const IRValue* operands = instruction->operands;
+    int count = instruction->operand_count - 1;
+    int condition = operand_register(state, &operands[0], operands[0].type);
+    int64_t low = 0, high = 0;
+    for (int i = 1; i <= count; i++) {
+        if (i == 1 || operands[i].id < low)
+            low = operands[i].id;
+        if (i == 1 || operands[i].id > high)
+            high = operands[i].id;
+    }
+
+    if (count < VM_JUMP_TABLE_MIN_CASES ||
+        high - low >= (int64_t)count * VM_JUMP_TABLE_SPREAD) {
+        for (int i = 1; i <= count; i++) {
+            int equal = new_register(state);
+            emit(state, VM_EQ, equal, condition,
+                 value_register(state, &operands[i]), 0);
+            size_t skip = emit(state, VM_JUMP_IF_ZERO, equal, 0, 0, 0);
+            emit_jump(state, instruction->blocks[i]);
+            state->function->code[skip].immediate =
+                (int64_t)state->function->code.size();
+        }
+        emit_jump(state, instruction->blocks[0]);
+        return;
+    }
+
+    int size = (int)(high - low) + 1;
+    size_t table = emit(state, VM_JUMP_TABLE, condition, 0, size, 0);
+    state->function->code[table].immediate = low;
+    std::vector<int> targets(size + 1, instruction->blocks[0]);
+    for (int i = count; i >= 1; i--)
+        targets[operands[i].id - low + 1] = instruction->blocks[i];
+    for (int i = 0; i <= size; i++)
+        emit(state, VM_JUMP, 0, 0, 0, 0);
+
+    std::unordered_map<int, size_t> stubs;
+    for (int i = 0; i <= size; i++) {
+        size_t entry = table + 1 + (size_t)i;
+        if (!state->phis.count(targets[i])) {
+            state->branches.emplace_back(entry, targets[i]);
+            continue;
+        }
+        auto stub = stubs.find(targets[i]);
+        if (stub == stubs.end()) {
+            stub = stubs.emplace(targets[i], state->function->code.size())
+                       .first;
+            emit_jump(state, targets[i]);
+        }
+        state->function->code[entry].immediate = (int64_t)stub->second;
+    }
+}
+
+/* ret for a block that runs off the end of the function */
+static void emit_default_return(VMCompileState* state) {
+    emit(state, VM_RETURN, constant_register(state, 0), 0, 0, 0);
+}
+
+/* Instructions */
+
+static int load_opcode(const TypeInfo* type) {
+    if (value_class(type) == CLASS_FLOAT)
+        return VM_LOAD_U32;
+    switch (value_bits(type)) {
+    case 1:
+        return VM_LOAD_I1;
+    case 8:
+        return VM_LOAD_I8;
+    case 16:
+        return VM_LOAD_I16;
+    case 32:
+        return VM_LOAD_I32;
+    default:
+        return VM_LOAD_I64;
+    }
+}
+
+static int store_opcode(const TypeInfo* type) {
+    int bits = value_class(type) == CLASS_FLOAT ? 32 : value_bits(type);
+    if (bits <= 8)
+        return VM_STORE_8;
+    if (bits == 16)
+        return VM_STORE_16;
+    if (bits == 32)
+        return VM_STORE_32;
+    return VM_STORE_64;
+}
+
+static void compile_binary(VMCompileState* state,
+                           const IRInstruction* instruction) {
+    int left = operand_register(state, &instruction->operands[0],
+                                instruction->type);
+    int right = operand_register(state, &instruction->operands[1],
+                                 instruction->type);
+    int result = result_register(state, &instruction->result);
+    int bits = value_bits(instruction->type);
+
+    /* Bitwise operations, shifts right and division keep sign-extended
+     * operands sign-extended; the others wrap at the type's width */
+    int opcode;
+    int wraps = 1;
+    switch (instruction->op) {
+    case IR_ADD:
+        opcode = bits == 32 ? VM_ADD32 : VM_ADD;
+        break;
+    case IR_SUB:
+        opcode = bits == 32 ? VM_SUB32 : VM_SUB;
+        break;
+    case IR_MUL:
+        opcode = bits == 32 ? VM_MUL32 : VM_MUL;
+        break;
+    case IR_SHL:
+        opcode = bits == 32 ? VM_SHL32 : VM_SHL;
+        break;
+    case IR_SDIV:
+        opcode = VM_SDIV;
+        wraps = bits < 32; /* Only INT_MIN / -1 overflows at 32 bits */
+        break;
+    case IR_SREM:
+        opcode = VM_SREM;
+        wraps = 0;
+        break;
+    case IR_AND:
+        opcode = VM_AND;
+        wraps = 0;
+        break;
+    case IR_OR:
+        opcode = VM_OR;
+        wraps = 0;
+        break;
+    case IR_XOR:
+        opcode = VM_XOR;
+        wraps = 0;
+        break;
+    default:
+        opcode = VM_ASHR;
+        wraps = 0;
+        break;
+    }
+    emit(state, opcode, result, left, right, 0);
+    if (wraps && bits != 32 && bits != 64)
+        emit(state, narrowing_opcode(bits), result, result, 0, 0);
+}
+
+static int compare_opcode(int op) {
+    switch (op) {
+    case IR_ICMP_EQ:
+        return VM_EQ;
+    case IR_ICMP_NE:
+        return VM_NE;
+    case IR_ICMP_SLT:
+        return VM_LT;
+    case IR_ICMP_SGT:
+        return VM_GT;
+    case IR_ICMP_SLE:
+        return VM_LE;
+    default:
+        return VM_GE;
+    }
+}
+
+static void compile_gep(VMCompileState* state,
+                        const IRInstruction* instruction) {
+    int address = value_register(state, &instruction->operands[0]);
+    int result = result_register(state, &instruction->result);
+    const TypeInfo* type = instruction->type;
+    int64_t offset = 0;
+    for (int i = 1; i < instruction->operand_count && type; i++) {
+        if (i > 1)
+            type = type->return_type; /* Array element */
+        if (!type)
+            break;
+        int64_t scale = type_size(state->vm, type);
+        const IRValue* index = &instruction->operands[i];
+        if (index->kind == IR_VALUE_CONSTANT) {
+            offset += constant_bits(index) * scale;
+            continue;
+        }
+        emit(state, VM_ADD_SCALED, result, address,
+             value_register(state, index), scale);
+        address = result;
+    }
+    if (offset != 0 || address != result)
+        emit(state, VM_ADD_IMMEDIATE, result, address, 0, offset);
+}
+
+static void compile_call(VMCompileState* state,
+                         const IRInstruction* instruction) {
+    BytecodeVM* vm = state->vm;
+    auto found = vm->prototypes.find(instruction->text);
+    const VMPrototype* prototype =
+        found != vm->prototypes.end() ? &found->second : NULL;
+
+    /* Arguments take the declared parameter types when the arity fits */
+    int count = instruction->operand_count;
+    int fixed = prototype ? (int)prototype->parameters.size() : 0;
+    int typed = prototype && (count == fixed ||
+                              (count > fixed && prototype->is_variadic));
+    if (count > VM_MAX_ARGUMENTS) {
+        vm_error(vm, "Too many arguments in call to '%s'", instruction->text);
+        return;
+    }
+
+    std::vector<int> arguments;
+    for (int i = 0; i < count; i++) {
+        const TypeInfo* type = typed && i < fixed
+                                   ? prototype->parameters[i]
+                                   : instruction->operands[i].type;
+        arguments.push_back(
+            operand_register(state, &instruction->operands[i], type));
+    }
+    size_t first = state->function->call_arguments.size();
+    state->function->call_arguments.insert(
+        state->function->call_arguments.end(), arguments.begin(),
+        arguments.end());
+
+    TypeInfo* return_type =
+        prototype ? prototype->return_type : instruction->type;
+    int value = new_register(state);
+    emit(state, VM_CALL, value, function_for(vm, instruction->text),
+         (int)first, count);
+    /* Calls are typed int before their callee is declared; a pointer
+     * result keeps all 64 bits, so that p = malloc(n) works */
+    int converted =
+        return_type && return_type->base_type == TYPE_POINTER
+            ? value
+            : convert(state, value, return_type, instruction->type);
+    emit(state, VM_MOVE, result_register(state, &instruction->result),
+         converted, 0, 0);
+}
+
+/* Compile one instruction; returns 1 for terminators */
+static int compile_instruction(VMCompileState* state,
+                               const IRInstruction* instruction) {
+    BytecodeVM* vm = state->vm;
+    const IRValue* operands = instruction->operands;
+
+    switch (instruction->opcode) {
+    case IR_ALLOCA: {
+        if (has_unknown_layout(instruction->type)) {
+            vm_error(vm, "Layout of '%s' is unknown",
+                     canonical_type_name(instruction->type));
+            return 0;
+        }
+        int offset = state->function->frame_size;
+        state->function->frame_size +=
+            (type_size(vm, instruction->type) + 7) & ~7;
+        /* Each alloca names new memory, even under a name seen before */
+        int reg = new_register(state);
+        if (instruction->result.kind == IR_VALUE_REGISTER) {
+            state->registers[instruction->result.id] = reg;
+        } else if (instruction->result.kind == IR_VALUE_LOCAL) {
+            state->locals[instruction->result.name] = reg;
+        }
+        emit(state, VM_FRAME_ADDRESS, reg, 0, 0, offset);
+        return 0;
+    }
+    case IR_LOAD: {
+        int address = value_register(state, &operands[0]);
+        emit(state, load_opcode(instruction->type),
+             result_register(state, &instruction->result), address, 0, 0);
+        return 0;
+    }
+    case IR_STORE: {
+        int value = operand_register(state, &operands[0], instruction->type);
+        int address = value_register(state, &operands[1]);
+        emit(state, store_opcode(instruction->type), value, address, 0, 0);
+        return 0;
+    }
+    case IR_GEP:
+        if (has_unknown_layout(instruction->type)) {
+            vm_error(vm, "Layout of '%s' is unknown",
+                     canonical_type_name(instruction->type));
+            return 0;
+        }
+        compile_gep(state, instruction);
+        return 0;
+    case IR_BINARY:
+        compile_binary(state, instruction);
+        return 0;
+    case IR_ICMP: {
+        int left = operand_register(state, &operands[0], instruction->type);
+        int right = operand_register(state, &operands[1], instruction->type);
+        emit(state, compare_opcode(instruction->op),
+             result_register(state, &instruction->result), left, right, 0);
+        return 0;
+    }
+    case IR_CAST: {
+        const TypeInfo* from = operands[0].type;
+        int value = value_register(state, &operands[0]);
+        int from_bits = value_bits(from);
+        int result = result_register(state, &instruction->result);
+        if (instruction->op == IR_ZEXT && value_class(from) == CLASS_INTEGER &&
+            value_class(instruction->type) == CLASS_INTEGER &&
+            from_bits < value_bits(instruction->type) && from_bits > 1) {
+            emit(state,
+                 from_bits == 8    ? VM_ZEXT_I8
+                 : from_bits == 16 ? VM_ZEXT_I16
+                                   : VM_ZEXT_I32,
+                 result, value, 0, 0);
+        } else {
+            emit(state, VM_MOVE, result,
+                 convert(state, value, from, instruction->type), 0, 0);
+        }
+        return 0;
+    }
+    case IR_PHI:
+        /* Set by the predecessors, see emit_phi_moves */
+        result_register(state, &instruction->result);
+        return 0;
+    case IR_CALL:
+        compile_call(state, instruction);
+        return 0;
+    case IR_BR:
+        emit_jump(state, instruction->blocks[0]);
+        return 1;
+    case IR_COND_BR: {
+        /* Branch conditions compare against zero; floats as integers */
+        int condition = operand_register(
+            state, &operands[0],
+            value_class(operands[0].type) == CLASS_INTEGER ? operands[0].type
+                                                           : NULL);
+        size_t else_branch = emit(state, VM_JUMP_IF_ZERO, condition, 0, 0, 0);
+        emit_jump(state, instruction->blocks[0]);
+        state->function->code[else_branch].immediate =
+            (int64_t)state->function->code.size();
+        emit_jump(state, instruction->blocks[1]);
+        return 1;
+    }
+    case IR_SWITCH:
+        emit_switch(state, instruction);
+        return 1;
+    case IR_RET:
+        if (!state->return_type ||
+            state->return_type->base_type == TYPE_VOID) {
+            emit(state, VM_RETURN, -1, 0, 0, 0);
+        } else if (instruction->operand_count == 0) {
+            emit_default_return(state);
+        } else {
+            emit(state, VM_RETURN,
+                 operand_register(state, &operands[0], state->return_type), 0,
+                 0, 0);
+        }
+        return 1;
+    case IR_COMMENT:
+        return 0;
+    }
+    return 0;
+}
+
+static void add_prototype(BytecodeVM* vm, const char* name,
+                          TypeInfo* return_type, TypeInfo* const* parameters,
+                          int count, int is_variadic) {
+    VMPrototype prototype;
+    prototype.return_type = type_table_canonical(&vm->types, return_type);
+    for (int i = 0; i < count; i++) {
+        prototype.parameters.push_back(
+            type_table_canonical(&vm->types, parameters[i]));
+    }
+    prototype.is_variadic = is_variadic;
+    vm->prototypes[name] = prototype;
+}
+
+static void add_function(void* data, const IRFunction* function) {
+    auto vm = static_cast<BytecodeVM*>(data);
+    if (!function->name)
+        return;
+
+    VMFunction* compiled = vm->functions[function_for(vm, function->name)];
+    if (compiled->defined) {
+        vm_error(vm, "Redefinition of function '%s'", function->name);
+        return;
+    }
+    compiled->defined = 1;
+    std::vector<TypeInfo*> parameter_types;
+    for (int i = 0; i < function->parameter_count; i++) {
+        parameter_types.push_back(function->parameters[i].type);
+    }
+    add_prototype(vm, function->name, function->return_type,
+                  parameter_types.data(), function->parameter_count, 0);
+
+    VMCompileState state;
+    state.vm = vm;
+    state.function = compiled;
+    state.return_type = function->return_type;
+    state.current_block = 0;
+
+    /* Arguments arrive in the first registers, sign-extended for 64 bits */
+    compiled->parameter_count = function->parameter_count;
+    for (int i = 0; i < function->parameter_count; i++) {
+        state.locals[function->parameters[i].name] = new_register(&state);
+    }
+    for (int i = 0; i < function->parameter_count; i++) {
+        const TypeInfo* type = function->parameters[i].type;
+        if (value_class(type) == CLASS_INTEGER && value_bits(type) < 64)
+            emit(&state, narrowing_opcode(value_bits(type)), i, i, 0, 0);
+    }
+
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        for (const IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            if (instruction->opcode == IR_PHI)
+                state.phis[block->id].push_back(instruction);
+        }
+    }
+    if (!function->first_block)
+        emit_default_return(&state);
+
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        state.blocks.emplace(block->id, (int)compiled->code.size());
+        state.current_block = block->id;
+        int terminated = 0;
+        for (const IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            /* Code after a branch or return is unreachable but harmless */
+            terminated = compile_instruction(&state, instruction);
+        }
+        /* A block without terminator falls through to the next one */
+        if (!terminated) {
+            if (block->next) {
+                emit_phi_moves(&state, block->next->id);
+            } else {
+                emit_default_return(&state);
+            }
+        }
+    }
+
+    /* Branch targets that were never laid out trap */
+    int trap = -1;
+    for (auto& branch : state.branches) {
+        auto target = state.blocks.find(branch.second);
+        if (target == state.blocks.end()) {
+            if (trap < 0)
+                trap = (int)emit(&state, VM_TRAP, 0, 0, 0, 0);
+            compiled->code[branch.first].immediate = trap;
+        } else {
+            compiled->code[branch.first].immediate = target->second;
+        }
+    }
+    compiled->frame_size = (compiled->frame_size + 15) & ~15;
+}
+
+/* Globals */
+
+static void add_global(void* data, const IRGlobal* global) {
+    auto vm = static_cast<BytecodeVM*>(data);
+
+    switch (global->kind) {
+    case IR_GLOBAL_DECLARATION:
+        if (!vm->prototypes.count(global->name)) {
+            add_prototype(vm, global->name, global->type,
+                          global->parameter_types, global->parameter_count,
+                          global->is_variadic);
+        }
+        break;
+    case IR_GLOBAL_VARIABLE: {
+        if (vm->data_symbols.count(global->name))
+            break; /* A tentative definition */
+        if (has_unknown_layout(global->type)) {
+            vm_error(vm, "Layout of '%s' is unknown",
+                     canonical_type_name(global->type));
+            break;
+        }
+
+        size_t size = (size_t)type_size(vm, global->type);
+        while (vm->data.size() % 8) {
+            vm->data.push_back(0);
+        }
+        size_t start = vm->data.size();
+        vm->data.resize(start + size, 0);
+        if (global->has_constant) {
+            int64_t bits = constant_bits_of(global->type, global->constant);
+            memcpy(vm->data.data() + start, &bits,
+                   size < sizeof(bits) ? size : sizeof(bits));
+        } else if (global->bytes) {
+            memcpy(vm->data.data() + start, global->bytes,
+                   global->length < size ? global->length : size);
+        }
+        vm->data_symbols.emplace(global->name, start);
+        break;
+    }
+    case IR_GLOBAL_EXTERNAL:
+        break; /* Must be defined by the program; checked at link time */
+    case IR_GLOBAL_STRING: {
+        size_t start = vm->data.size();
+        vm->data.insert(vm->data.end(), global->bytes,
+                        global->bytes + global->length);
+        vm->data.push_back(0);
+        vm->data_symbols.emplace(global->name, start);
+        break;
+    }
+    }
+}
+
+/* Linking */
+
+static int link_program(BytecodeVM* vm) {
+    for (VMFunction* function : vm->functions) {
+        if (function->defined)
+            continue;
+        const ForeignEntry* entry = find_foreign(function->name.c_str());
+        if (!entry) {
+            vm_error(vm, "Undefined function '%s'", function->name.c_str());
+            continue;
+        }
+        function->foreign = entry->function;
+    }
+
+    for (VMFunction* function : vm->functions) {
+        for (auto& address : function->addresses) {
+            auto data = vm->data_symbols.find(address.second);
+            auto code = vm->function_index.find(address.second);
+            if (data != vm->data_symbols.end()) {
+                function->registers[address.first] =
+                    (int64_t)(vm->data.data() + data->second);
+            } else if (code != vm->function_index.end()) {
+                function->registers[address.first] =
+                    (int64_t)vm->functions[code->second];
+            } else {
+                vm_error(vm, "Undefined symbol '%s'", address.second.c_str());
+            }
+        }
+    }
+    return vm->error_count > 0 ? -1 : 0;
+}
+
+/* Execution */
+
+#if defined(__GNUC__)
+#define VM_DISPATCH() goto* dispatch[ip->opcode]
+#define VM_CASE(name) op_##name:
+#define VM_NEXT()                                                             \
+    do {                                                                      \
+        ip++;                                                                 \
+        VM_DISPATCH();                                                        \
+    } while (0)
+#define VM_JUMP(target)                                                       \
+    do {                                                                      \
+        ip = code + (target);                                                 \
+        VM_DISPATCH();                                                        \
+    } while (0)
+#else
+#define VM_DISPATCH() switch (ip->opcode)
+#define VM_CASE(name) case VM_##name:
+#define VM_NEXT()                                                             \
+    {                                                                         \
+        ip++;                                                                 \
+        continue;                                                             \
+    }
+#define VM_JUMP(target)                                                       \
+    {                                                                         \
+        ip = code + (target);                                                 \
+        continue;                                                             \
+    }
+#endif
+
+static int64_t float_bits(float real) {
+    uint32_t bits;
+    memcpy(&bits, &real, sizeof(bits));
+    return bits;
+}
+
+static float bits_float(int64_t bits) {
+    uint32_t low = (uint32_t)bits;
+    float real;
+    memcpy(&real, &low, sizeof(real));
+    return real;
+}
+
+static int64_t double_bits(double real) {
+    int64_t bits;
+    memcpy(&bits, &real, sizeof(bits));
+    return bits;
+}
+
+static double bits_double(int64_t bits) {
+    double real;
+    memcpy(&real, &bits, sizeof(real));
+    return real;
+}
+
+/* Run function on args; only plain data lives on this frame, since a
+ * runtime error longjmps out of it */
+static int64_t execute(BytecodeVM* vm, const VMFunction* function,
+                       const int64_t* args, int arg_count) {
+    if (function->foreign)
+        return function->foreign(args, arg_count);
+
+    size_t register_count = function->registers.size();
+    if (vm->register_top + register_count > VM_REGISTER_STACK ||
+        vm->memory_top + function->frame_size > VM_MEMORY_STACK) {
+        vm_trap(vm, "Stack overflow in '%s'", function->name.c_str());
+    }
+    int64_t* r = vm->register_stack + vm->register_top;
+    uint8_t* frame = vm->memory_stack + vm->memory_top;
+    vm->register_top += register_count;
+    vm->memory_top += function->frame_size;
+
+    if (register_count > 0)
+        memcpy(r, function->registers.data(), register_count * sizeof(*r));
+    for (int i = 0; i < function->parameter_count; i++) {
+        r[i] = i < arg_count ? args[i] : 0;
+    }
+
+    const VMInstruction* code = function->code.data();
+    const VMInstruction* ip = code;
+    int64_t result = 0;
+
+#if defined(__GNUC__)
+    static const void* const dispatch[] = {
+#define VM_OPCODE_LABEL(name) &&op_##name,
+        VM_OPCODES(VM_OPCODE_LABEL)
+#undef VM_OPCODE_LABEL
+    };
+    VM_DISPATCH();
+#else
+    for (;;)
+        VM_DISPATCH() {
+#endif
+    VM_CASE(MOVE) {
+        r[ip->a] = r[ip->b];
+        VM_NEXT();
+    }
+    VM_CASE(FRAME_ADDRESS) {
+        r[ip->a] = (int64_t)(frame + ip->immediate);
+        VM_NEXT();
+    }
+    VM_CASE(LOAD_I1) {
+        uint8_t value;
+        memcpy(&value, (const void*)r[ip->b], sizeof(value));
+        r[ip->a] = value & 1;
+        VM_NEXT();
+    }
+    VM_CASE(LOAD_I8) {
+        int8_t value;
+        memcpy(&value, (const void*)r[ip->b], sizeof(value));
+        r[ip->a] = value;
+        VM_NEXT();
+    }
+    VM_CASE(LOAD_I16) {
+        int16_t value;
+        memcpy(&value, (const void*)r[ip->b], sizeof(value));
+        r[ip->a] = value;
+        VM_NEXT();
+    }
+    VM_CASE(LOAD_I32) {
+        int32_t value;
+        memcpy(&value, (const void*)r[ip->b], sizeof(value));
+        r[ip->a] = value;
+        VM_NEXT();
+    }
+    VM_CASE(LOAD_U32) {
+        uint32_t value;
+        memcpy(&value, (const void*)r[ip->b], sizeof(value));
+        r[ip->a] = value;
+        VM_NEXT();
+    }
+    VM_CASE(LOAD_I64) {
+        memcpy(&r[ip->a], (const void*)r[ip->b], sizeof(int64_t));
+        VM_NEXT();
+    }
+    VM_CASE(STORE_8) {
+        uint8_t value = (uint8_t)r[ip->a];
+        memcpy((void*)r[ip->b], &value, sizeof(value));
+        VM_NEXT();
+    }
+    VM_CASE(STORE_16) {
+        uint16_t value = (uint16_t)r[ip->a];
+        memcpy((void*)r[ip->b], &value, sizeof(value));
+        VM_NEXT();
+    }
+    VM_CASE(STORE_32) {
+        uint32_t value = (uint32_t)r[ip->a];
+        memcpy((void*)r[ip->b], &value, sizeof(value));
+        VM_NEXT();
+    }
+    VM_CASE(STORE_64) {
+        memcpy((void*)r[ip->b], &r[ip->a], sizeof(int64_t));
+        VM_NEXT();
+    }
+    VM_CASE(ADD) {
+        r[ip->a] = (int64_t)((uint64_t)r[ip->b] + (uint64_t)r[ip->c]);
+        VM_NEXT();
+    }
+    VM_CASE(SUB) {
+        r[ip->a] = (int64_t)((uint64_t)r[ip->b] - (uint64_t)r[ip->c]);
+        VM_NEXT();
+    }
+    VM_CASE(MUL) {
+        r[ip->a] = (int64_t)((uint64_t)r[ip->b] * (uint64_t)r[ip->c]);
+        VM_NEXT();
+    }
+    VM_CASE(SHL) {
+        r[ip->a] = (int64_t)((uint64_t)r[ip->b] << (r[ip->c] & 63));
+        VM_NEXT();
+    }
+    VM_CASE(ADD32) {
+        r[ip->a] = (int32_t)((uint32_t)r[ip->b] + (uint32_t)r[ip->c]);
+        VM_NEXT();
+    }
+    VM_CASE(SUB32) {
+        r[ip->a] = (int32_t)((uint32_t)r[ip->b] - (uint32_t)r[ip->c]);
+        VM_NEXT();
+    }
+    VM_CASE(MUL32) {
+        r[ip->a] = (int32_t)((uint32_t)r[ip->b] * (uint32_t)r[ip->c]);
+        VM_NEXT();
+    }
+    VM_CASE(SHL32) {
+        r[ip->a] = (int32_t)((uint32_t)r[ip->b] << (r[ip->c] & 31));
+        VM_NEXT();
+    }
+    VM_CASE(SDIV) {
+        int64_t divisor = r[ip->c];
+        if (divisor == 0)
+            vm_trap(vm, "Division by zero in '%s'", function->name.c_str());
+        r[ip->a] = divisor == -1 ? (int64_t)(0 - (uint64_t)r[ip->b])
+                                 : r[ip->b] / divisor;
+        VM_NEXT();
+    }
+    VM_CASE(SREM) {
+        int64_t divisor = r[ip->c];
+        if (divisor == 0)
+            vm_trap(vm, "Division by zero in '%s'", function->name.c_str());
+        r[ip->a] = divisor == -1 ? 0 : r[ip->b] % divisor;
+        VM_NEXT();
+    }
+    VM_CASE(AND) {
+        r[ip->a] = r[ip->b] & r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(OR) {
+        r[ip->a] = r[ip->b] | r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(XOR) {
+        r[ip->a] = r[ip->b] ^ r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(ASHR) {
+        r[ip->a] = r[ip->b] >> (r[ip->c] & 63);
+        VM_NEXT();
+    }
+    VM_CASE(ADD_IMMEDIATE) {
+        r[ip->a] = (int64_t)((uint64_t)r[ip->b] + (uint64_t)ip->immediate);
+        VM_NEXT();
+    }
+    VM_CASE(ADD_SCALED) {
+        r[ip->a] = (int64_t)((uint64_t)r[ip->b] +
+                             (uint64_t)r[ip->c] * (uint64_t)ip->immediate);
+        VM_NEXT();
+    }
+    VM_CASE(EQ) {
+        r[ip->a] = r[ip->b] == r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(NE) {
+        r[ip->a] = r[ip->b] != r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(LT) {
+        r[ip->a] = r[ip->b] < r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(GT) {
+        r[ip->a] = r[ip->b] > r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(LE) {
+        r[ip->a] = r[ip->b] <= r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(GE) {
+        r[ip->a] = r[ip->b] >= r[ip->c];
+        VM_NEXT();
+    }
+    VM_CASE(TRUNC_I1) {
+        r[ip->a] = r[ip->b] & 1;
+        VM_NEXT();
+    }
+    VM_CASE(SEXT_I8) {
+        r[ip->a] = (int8_t)r[ip->b];
+        VM_NEXT();
+    }
+    VM_CASE(SEXT_I16) {
+        r[ip->a] = (int16_t)r[ip->b];
+        VM_NEXT();
+    }
+    VM_CASE(SEXT_I32) {
+        r[ip->a] = (int32_t)r[ip->b];
+        VM_NEXT();
+    }
+    VM_CASE(ZEXT_I8) {
+        r[ip->a] = (uint8_t)r[ip->b];
+        VM_NEXT();
+    }
+    VM_CASE(ZEXT_I16) {
+        r[ip->a] = (uint16_t)r[ip->b];
+        VM_NEXT();
+    }
+    VM_CASE(ZEXT_I32) {
+        r[ip->a] = (uint32_t)r[ip->b];
+        VM_NEXT();
+    }
+    VM_CASE(INT_TO_FLOAT) {
+        r[ip->a] = float_bits((float)r[ip->b]);
+        VM_NEXT();
+    }
+    VM_CASE(INT_TO_DOUBLE) {
+        r[ip->a] = double_bits((double)r[ip->b]);
+        VM_NEXT();
+    }
+    VM_CASE(FLOAT_TO_INT) {
+        r[ip->a] = (int64_t)bits_float(r[ip->b]);
+        VM_NEXT();
+    }
+    VM_CASE(DOUBLE_TO_INT) {
+        r[ip->a] = (int64_t)bits_double(r[ip->b]);
+        VM_NEXT();
+    }
+    VM_CASE(FLOAT_TO_DOUBLE) {
+        r[ip->a] = double_bits((double)bits_float(r[ip->b]));
+        VM_NEXT();
+    }
+    VM_CASE(DOUBLE_TO_FLOAT) {
+        r[ip->a] = float_bits((float)bits_double(r[ip->b]));
+        VM_NEXT();
+    }
+    VM_CASE(JUMP) {
+        VM_JUMP(ip->immediate);
+    }
+    VM_CASE(JUMP_IF_ZERO) {
+        if (r[ip->a] == 0)
+            VM_JUMP(ip->immediate);
+        VM_NEXT();
+    }
+    VM_CASE(JUMP_TABLE) {
+        uint64_t index = (uint64_t)(r[ip->a] - ip->immediate);
+        VM_JUMP((ip - code) + 1 +
+                (index < (uint64_t)ip->c ? (int64_t)index + 1 : 0));
+    }
+    VM_CASE(CALL) {
+        int64_t call_args[VM_MAX_ARGUMENTS];
+        int count = (int)ip->immediate;
+        const int* registers = function->call_arguments.data() + ip->c;
+        for (int i = 0; i < count; i++) {
+            call_args[i] = r[registers[i]];
+        }
+        r[ip->a] = execute(vm, vm->functions[ip->b], call_args, count);
+        VM_NEXT();
+    }
+    VM_CASE(RETURN) {
+        result = ip->a >= 0 ? r[ip->a] : 0;
+        goto done;
+    }
+    VM_CASE(TRAP) {
+        vm_trap(vm, "Unreachable code reached in '%s'",
+                function->name.c_str());
+    }
+#if !defined(__GNUC__)
+        }
+#endif
+
+done:
+    vm->register_top -= register_count;
+    vm->memory_top -= function->frame_size;
+    return result;
+}
+
+/* Public interface */
+
+BytecodeVM* bytecode_vm_create(void) {
+    auto vm = new BytecodeVM();
+    vm->consumer.data = vm;
+    vm->consumer.add_global = add_global;
+    vm->consumer.add_function = add_function;
+    vm->target = target_host();
+    vm->error_count = 0;
+    vm->register_stack = NULL;
+    vm->register_top = 0;
+    vm->memory_stack = NULL;
+    vm->memory_top = 0;
+    return vm;
+}
+
+void bytecode_vm_attach(BytecodeVM* vm, CodeGenContext* ctx) {
+    ctx->consumer = &vm->consumer;
+    ctx->target = vm->target;
+}
+
+int bytecode_vm_run(BytecodeVM* vm, int argc, char** argv, int* status) {
+    if (vm->error_count > 0 || link_program(vm) != 0)
+        return -1;
+
+    auto found = vm->function_index.find("main");
+    if (found == vm->function_index.end() ||
+        !vm->functions[found->second]->defined) {
+        vm_error(vm, "%s: no function to run", "main");
+        return -1;
+    }
+    const VMFunction* main_function = vm->functions[found->second];
+
+    if (!vm->register_stack) {
+        vm->register_stack =
+            (int64_t*)malloc(VM_REGISTER_STACK * sizeof(int64_t));
+        vm->memory_stack = (uint8_t*)malloc(VM_MEMORY_STACK);
+        if (!vm->register_stack || !vm->memory_stack) {
+            fprintf(stderr, "Error: Memory allocation failed for VM stack\n");
+            exit(1);
+        }
+    }
+    vm->register_top = 0;
+    vm->memory_top = 0;
+    if (setjmp(vm->trap) != 0)
+        return -1;
+
+    int64_t args[2] = {argc, (int64_t)argv};
+    int64_t result = execute(vm, main_function, args, 2);
+    *status = (int)result;
+    return 0;
+}
+
+void bytecode_vm_free(BytecodeVM* vm) {
+    if (!vm)
+        return;
+    for (VMFunction* function : vm->functions) {
+        delete function;
+    }
+    type_table_free(&vm->types);
+    free(vm->register_stack);
+    free(vm->memory_stack);
+    delete vm;
+}
@@ -0,0 +1,35 @@
+#ifndef BYTECODE_VM_H
+#define BYTECODE_VM_H
+
+extern "C" {
+
+#include "codegen.h"
+
+/*
+ * Bytecode interpreter (--interp).
+ *
+ * Attached to a code generation context, the VM compiles each function it
+ * is handed into register bytecode: every IR value gets a frame register,
+ * constants and global addresses are preloaded from a per-function
+ * template, and conversions become explicit instructions. Execution is a
+ * computed-goto loop with one C call per bytecode call. Memory is the
+ * process's own: allocas live on a VM stack, globals and strings in a data
+ * block, so pointers, arrays and C strings work unchanged and can be
+ * handed to libc. Undefined functions bind to a small table of libc
+ * wrappers (printf, malloc, strlen, ...). Needs no LLVM.
+ */
+
+typedef struct BytecodeVM BytecodeVM;
+
+BytecodeVM* bytecode_vm_create(void);
+/* Route everything ctx generates from now on to vm; ctx's target becomes
+ * the host */
+void bytecode_vm_attach(BytecodeVM* vm, CodeGenContext* ctx);
+/* Link the program and run its main with argc and argv; main's return
+ * value goes to status. Returns 0 when main returned, else -1 after
+ * reporting a link or runtime error to stderr. */
+int bytecode_vm_run(BytecodeVM* vm, int argc, char** argv, int* status);
+void bytecode_vm_free(BytecodeVM* vm);
+}
+
+#endif /* BYTECODE_VM_H */
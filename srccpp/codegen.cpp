@@ -1,9 +1,17 @@
 #include "codegen.h"
 
 #include "constants.h"
+#include "ssa.h"
 
 #include <assert.h>
+#include <atomic>
+#include <limits.h>
 #include <stdarg.h>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 /* Helper functions */
 static void* safe_malloc(size_t size) {
@@ -24,20 +32,52 @@ static char* safe_strdup(const char* str) {
 }
 
 static void emit_all_global_constants(CodeGenContext* ctx);
+static void add_module_global(CodeGenContext* ctx, const IRGlobal* global);
+static void emit_function_declaration(CodeGenContext* ctx,
+                                      ASTNode* func_decl);
+static Symbol* lookup_storage(CodeGenContext* ctx, const char* name);
+static void leave_scope(CodeGenContext* ctx, const Symbol* scope);
+static void drop_local_symbols(CodeGenContext* ctx, const Symbol* scope);
 static void generate_function_declaration(CodeGenContext* ctx, ASTNode* func_decl) {
     /* Check if already declared (e.g. by runtime declarations) */
     if (lookup_symbol(ctx, func_decl->data.function_def.name)) {
         return;
     }
 
-    char* ret_type_str = llvm_type_to_string(func_decl->data.function_def.return_type);
+    if (ctx->consumer) {
+        std::vector<TypeInfo*> parameter_types;
+        for (ASTNode* param = func_decl->data.function_def.parameters; param;
+             param = param->next) {
+            parameter_types.push_back(
+                canonical_type(ctx, param->data.variable_decl.type));
+        }
+        IRGlobal global = ir_global(
+            IR_GLOBAL_DECLARATION, func_decl->data.function_def.name,
+            canonical_type(ctx, func_decl->data.function_def.return_type));
+        global.parameter_types = parameter_types.data();
+        global.parameter_count = (int)parameter_types.size();
+        global.is_variadic = func_decl->data.function_def.is_variadic;
+        add_module_global(ctx, &global);
+    } else {
+        emit_function_declaration(ctx, func_decl);
+    }
+
+    /* Add to global symbol table to allow calls */
+    Symbol* symbol = create_symbol(func_decl->data.function_def.name,
+                                   duplicate_type_info(func_decl->data.function_def.return_type));
+    symbol->is_global = 1;
+    add_global_symbol(ctx, symbol);
+}
+
+static void emit_function_declaration(CodeGenContext* ctx,
+                                      ASTNode* func_decl) {
+    const char* ret_type_str = llvm_type_name(ctx, func_decl->data.function_def.return_type);
     char params_buf[1024] = "";
     ASTNode* param = func_decl->data.function_def.parameters;
 
     while (param) {
-        char* param_type_str = llvm_type_to_string(param->data.variable_decl.type);
+        const char* param_type_str = llvm_type_name(ctx, param->data.variable_decl.type);
         strcat(params_buf, param_type_str);
-        free(param_type_str);
         if (param->next) {
             strcat(params_buf, ", ");
         }
@@ -54,13 +94,15 @@ static void generate_function_declaration(CodeGenContext* ctx, ASTNode* func_dec
 
     emit_global_declaration(ctx, "declare %s @%s(%s)", ret_type_str,
                             func_decl->data.function_def.name, params_buf);
-    free(ret_type_str);
+}
 
-    /* Add to global symbol table to allow calls */
-    Symbol* symbol = create_symbol(func_decl->data.function_def.name,
-                                   duplicate_type_info(func_decl->data.function_def.return_type));
-    symbol->is_global = 1;
-    add_global_symbol(ctx, symbol);
+
+/* Drop the pooled string literals along with their labels */
+static void reset_string_pool(CodeGenContext* ctx) {
+    for (int i = 0; i < ctx->strings.count; i++) {
+        free(ctx->strings.entries[i].label);
+    }
+    string_pool_free(&ctx->strings);
 }
 
 /* Context management */
@@ -70,17 +112,57 @@ CodeGenContext* create_codegen_context(FILE* output) {
     memset(ctx, 0, sizeof(CodeGenContext));
 
     ctx->output = output ? output : stdout;
+    ir_buffer_init(&ctx->out, ctx->output);
+    ctx->target = target_host();
     ctx->next_reg_id = 1;
     ctx->next_bb_id = 1;
     ctx->current_function_id = 0;
+    constant_section_init(&ctx->constants);
+    string_pool_init(&ctx->strings);
+    ir_builder_init(&ctx->builder);
+
+    return ctx;
+}
 
+CodeGenContext* create_buffered_codegen_context(void) {
+    CodeGenContext* ctx = create_codegen_context(NULL);
+    ctx->output = NULL;
+    ir_buffer_init(&ctx->out, NULL);
     return ctx;
 }
 
+/* Print the function being built, or instructions generated outside any
+ * function, and drop it. A consumer only sees named functions. */
+static void print_pending_ir(CodeGenContext* ctx) {
+    IRFunction* function = ctx->builder.function;
+    if (function) {
+        if (!ctx->consumer) {
+            ir_print_function(&ctx->out, function, ctx->ir_flags);
+        } else if (function->name) {
+            ctx->consumer->add_function(ctx->consumer->data, function);
+        }
+        ir_builder_reset(&ctx->builder);
+    }
+}
+
+static void add_module_global(CodeGenContext* ctx, const IRGlobal* global) {
+    ctx->consumer->add_global(ctx->consumer->data, global);
+}
+
+int codegen_flush_output(CodeGenContext* ctx) {
+    print_pending_ir(ctx);
+    return ir_buffer_flush(&ctx->out);
+}
+
 void free_codegen_context(CodeGenContext* ctx) {
     if (!ctx)
         return;
 
+    print_pending_ir(ctx);
+    ir_builder_free(&ctx->builder);
+    ir_buffer_flush(&ctx->out);
+    ir_buffer_free(&ctx->out);
+
     /* Free symbol tables */
     while (ctx->global_symbols) {
         Symbol* next = ctx->global_symbols->next;
@@ -102,101 +184,1308 @@ void free_codegen_context(CodeGenContext* ctx) {
         ctx->bb_list = next;
     }
 
-    /* Free global constants */
-    while (ctx->global_constants) {
-        GlobalConstant* next = ctx->global_constants->next;
-        free(ctx->global_constants->declaration);
-        free(ctx->global_constants);
-        ctx->global_constants = next;
-    }
+    constant_section_free(&ctx->constants);
+    reset_string_pool(ctx);
+    type_table_free(&ctx->types);
 
     if (ctx->current_function_name) {
         free(ctx->current_function_name);
     }
 
+    while (ctx->diagnostics) {
+        Diagnostic* next = ctx->diagnostics->next;
+        free(ctx->diagnostics->message);
+        free(ctx->diagnostics);
+        ctx->diagnostics = next;
+    }
+
     free(ctx);
 }
 
 /* Forward declarations */
 void generate_module_header(CodeGenContext* ctx);
 void process_ast_nodes(CodeGenContext* ctx, ASTNode* ast);
+static void alias_duplicate_strings(CodeGenContext* ctx);
 void generate_switch_statement(CodeGenContext* ctx, ASTNode* stmt);
+static void generate_case_label(CodeGenContext* ctx, ASTNode* stmt);
+static void generate_enum_declaration(CodeGenContext* ctx, ASTNode* decl);
+static void generate_static_assert(CodeGenContext* ctx, ASTNode* decl);
 
 /* Main code generation function */
 void generate_llvm_ir(CodeGenContext* ctx, ASTNode* ast) {
     if (!ctx || !ast)
         return;
 
+    /* Aliasing duplicate strings needs every constant at the end */
+    if (ctx->whole_program) {
+        ctx->stream_constants = 0;
+    }
+
     generate_module_header(ctx);
     generate_runtime_declarations(ctx);
     process_ast_nodes(ctx, ast);
 
-    /* Emit global constants at the end of the module */
+    if (ctx->whole_program) {
+        alias_duplicate_strings(ctx);
+    }
+
+    /* Emit the remaining global constants at the end of the module */
     emit_all_global_constants(ctx);
+
+    if (codegen_flush_output(ctx) != 0) {
+        codegen_error(ctx, "Failed to write LLVM IR output");
+    }
 }
 
 void generate_module_header(CodeGenContext* ctx) {
-    fprintf(ctx->output, "; Generated LLVM IR\n");
-    fprintf(ctx->output, "target triple = \"arm64-apple-darwin\"\n\n");
+    int compact = ctx->ir_flags & IR_PRINT_COMPACT;
+    if (!compact) {
+        ir_buffer_append_str(&ctx->out, "; Generated LLVM IR\n");
+    }
+    ir_buffer_format(&ctx->out,
+                     "target datalayout = \"%s\"\n"
+                     "target triple = \"%s\"\n%s",
+                     ctx->target->datalayout, ctx->target->triple,
+                     compact ? "" : "\n");
+}
+
+/* A function definition generated on a private context. Bodies only read
+ * module state (global symbols declared before them) and only add module
+ * constants, so they can be generated in any order and merged afterwards. */
+typedef struct FunctionJob {
+    const CodeGenContext* module;
+    ASTNode* func_def;
+    Symbol* visible_globals;         /* Module symbols declared so far */
+    GlobalConstant* constant_anchor; /* Constants follow this (NULL: head) */
+    char* text;
+    size_t text_length;
+    ConstantSection constants;
+    Diagnostic* diagnostics;
+} FunctionJob;
+
+static void generate_function_job(FunctionJob* job) {
+    CodeGenContext* fn_ctx = create_buffered_codegen_context();
+    fn_ctx->global_symbols = job->visible_globals;
+    fn_ctx->quiet_diagnostics = 1; /* Reported in order when merged */
+    fn_ctx->whole_program = job->module->whole_program;
+    fn_ctx->exported_symbols = job->module->exported_symbols;
+    fn_ctx->exported_count = job->module->exported_count;
+    fn_ctx->consumer = job->module->consumer;
+    fn_ctx->ir_flags = job->module->ir_flags;
+    fn_ctx->ssa = job->module->ssa;
+    fn_ctx->target = job->module->target;
+
+    generate_function_definition(fn_ctx, job->func_def);
+    job->text = ir_buffer_release(&fn_ctx->out, &job->text_length);
+    if (!job->text) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
+
+    job->constants = fn_ctx->constants;
+    job->diagnostics = fn_ctx->diagnostics;
+    constant_section_init(&fn_ctx->constants);
+    fn_ctx->diagnostics = NULL;
+    fn_ctx->diagnostics_tail = NULL;
+
+    /* Free only symbols added in front of the shared module list */
+    while (fn_ctx->global_symbols != job->visible_globals) {
+        Symbol* next = fn_ctx->global_symbols->next;
+        free_symbol(fn_ctx->global_symbols);
+        fn_ctx->global_symbols = next;
+    }
+    fn_ctx->global_symbols = NULL;
+    free_codegen_context(fn_ctx);
+}
+
+static void run_function_jobs(std::vector<FunctionJob>& jobs,
+                              int thread_count) {
+    if (thread_count > (int)jobs.size()) {
+        thread_count = (int)jobs.size();
+    }
+    if (thread_count <= 1) {
+        for (auto& job : jobs) {
+            generate_function_job(&job);
+        }
+        return;
+    }
+
+    /* Workers claim the next unstarted function, balancing uneven sizes */
+    std::atomic<size_t> next_job(0);
+    auto worker = [&jobs, &next_job]() {
+        size_t index;
+        while ((index = next_job.fetch_add(1)) < jobs.size()) {
+            generate_function_job(&jobs[index]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < thread_count; i++) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
+
+/* Write the constants collected so far as their own group */
+static void stream_constants(CodeGenContext* ctx, ConstantSection* section) {
+    if (section->head) {
+        constant_section_write(section, &ctx->out);
+        if (!(ctx->ir_flags & IR_PRINT_COMPACT)) {
+            ir_buffer_append_char(&ctx->out, '\n');
+        }
+    }
+}
+
+/* Append bodies and diagnostics in source order, then splice each
+ * function's constants in after the module constant that preceded it.
+ * When streaming, each function's constants follow its body instead. */
+static void merge_function_jobs(CodeGenContext* ctx,
+                                std::vector<FunctionJob>& jobs) {
+    if (ctx->stream_constants) {
+        for (auto& job : jobs) {
+            ir_buffer_append(&ctx->out, job.text, job.text_length);
+            stream_constants(ctx, &job.constants);
+        }
+    } else {
+        /* Bodies go to the output as-is, with writev when it is a file */
+        std::vector<struct iovec> bodies(jobs.size());
+        for (size_t i = 0; i < jobs.size(); i++) {
+            bodies[i].iov_base = jobs[i].text;
+            bodies[i].iov_len = jobs[i].text_length;
+        }
+        ir_buffer_append_spans(&ctx->out, bodies.data(), (int)bodies.size());
+    }
+
+    for (auto& job : jobs) {
+        free(job.text);
+
+        while (job.diagnostics) {
+            Diagnostic* next = job.diagnostics->next;
+            if (job.diagnostics->severity == DIAGNOSTIC_ERROR) {
+                codegen_error(ctx, "%s", job.diagnostics->message);
+            } else {
+                codegen_warning(ctx, "%s", job.diagnostics->message);
+            }
+            free(job.diagnostics->message);
+            free(job.diagnostics);
+            job.diagnostics = next;
+        }
+    }
+
+    /* Reverse order keeps functions sharing an anchor in source order */
+    ConstantSection* section = &ctx->constants;
+    for (size_t i = jobs.size(); i-- > 0;) {
+        ConstantSection* job_section = &jobs[i].constants;
+        GlobalConstant* first = job_section->head;
+        GlobalConstant* last = job_section->tail;
+        if (first) {
+            GlobalConstant* anchor = jobs[i].constant_anchor;
+            GlobalConstant** link = anchor ? &anchor->next : &section->head;
+            last->next = *link;
+            *link = first;
+            if (section->tail == anchor) {
+                section->tail = last;
+            }
+            section->count += job_section->count;
+        }
+        constant_section_adopt(section, job_section);
+    }
+}
+
+/* Storage class of a declaration; pointer declarators wrap the specifiers */
+static StorageClass declared_storage(const TypeInfo* type) {
+    while (type && type->storage_class == STORAGE_NONE &&
+           type->base_type == TYPE_POINTER) {
+        type = type->return_type;
+    }
+    return type ? type->storage_class : STORAGE_NONE;
+}
+
+/* 2: initialized definition, 1: tentative definition, 0: extern */
+static int variable_definition_rank(const ASTNode* decl) {
+    if (decl->data.variable_decl.initializer) {
+        return 2;
+    }
+    return declared_storage(decl->data.variable_decl.type) == STORAGE_EXTERN
+               ? 0
+               : 1;
+}
+
+/* File-scope static names of one unit and their qualified names, with the
+ * local declarations in scope at the node being renamed */
+struct StaticRenames {
+    std::unordered_map<std::string, std::string> names;
+    std::vector<std::string> locals;
+};
+
+static void rename_static_references(ASTNode* node, StaticRenames& renames);
+
+static void rename_static_list(ASTNode* list, StaticRenames& renames) {
+    for (ASTNode* node = list; node; node = node->next) {
+        rename_static_references(node, renames);
+    }
+}
+
+static void rename_static_name(char** name, const StaticRenames& renames) {
+    auto found = renames.names.find(*name);
+    if (found == renames.names.end()) {
+        return;
+    }
+    for (const std::string& local : renames.locals) {
+        if (local == *name) {
+            return;
+        }
+    }
+    free(*name);
+    *name = safe_strdup(found->second.c_str());
+}
+
+/* A local declaration shadows a static name for the rest of its block */
+static void declare_local(const char* name, StaticRenames& renames) {
+    if (name && renames.names.count(name)) {
+        renames.locals.push_back(name);
+    }
+}
+
+static void rename_static_references(ASTNode* node, StaticRenames& renames) {
+    if (!node)
+        return;
+
+    size_t scope = renames.locals.size();
+    switch (node->type) {
+    case AST_IDENTIFIER:
+        rename_static_name(&node->data.identifier.name, renames);
+        break;
+    case AST_BINARY_OP:
+        rename_static_references(node->data.binary_op.left, renames);
+        rename_static_references(node->data.binary_op.right, renames);
+        break;
+    case AST_UNARY_OP:
+        rename_static_references(node->data.unary_op.operand, renames);
+        break;
+    case AST_FUNCTION_CALL:
+        rename_static_references(node->data.function_call.function, renames);
+        rename_static_list(node->data.function_call.arguments, renames);
+        break;
+    case AST_ARRAY_ACCESS:
+        rename_static_references(node->data.array_access.array, renames);
+        rename_static_references(node->data.array_access.index, renames);
+        break;
+    case AST_MEMBER_ACCESS:
+        rename_static_references(node->data.member_access.object, renames);
+        break;
+    case AST_CAST:
+        rename_static_references(node->data.cast_expr.operand, renames);
+        break;
+    case AST_CONDITIONAL:
+        rename_static_references(node->data.conditional_expr.condition,
+                                 renames);
+        rename_static_references(node->data.conditional_expr.then_expr,
+                                 renames);
+        rename_static_references(node->data.conditional_expr.else_expr,
+                                 renames);
+        break;
+    case AST_INITIALIZER_LIST:
+        rename_static_list(node->data.initializer_list.items, renames);
+        break;
+    case AST_COMPOUND_STMT:
+        rename_static_list(node->data.compound_stmt.statements, renames);
+        renames.locals.resize(scope);
+        break;
+    case AST_EXPRESSION_STMT:
+    case AST_RETURN_STMT:
+        rename_static_references(node->data.return_stmt.expression, renames);
+        break;
+    case AST_IF_STMT:
+        rename_static_references(node->data.if_stmt.condition, renames);
+        rename_static_references(node->data.if_stmt.then_stmt, renames);
+        rename_static_references(node->data.if_stmt.else_stmt, renames);
+        break;
+    case AST_WHILE_STMT:
+    case AST_DO_WHILE_STMT:
+        rename_static_references(node->data.while_stmt.condition, renames);
+        rename_static_references(node->data.while_stmt.body, renames);
+        break;
+    case AST_FOR_STMT:
+        /* A declaration in the init clause is scoped to the loop */
+        rename_static_list(node->data.for_stmt.init, renames);
+        rename_static_references(node->data.for_stmt.condition, renames);
+        rename_static_references(node->data.for_stmt.update, renames);
+        rename_static_references(node->data.for_stmt.body, renames);
+        renames.locals.resize(scope);
+        break;
+    case AST_SWITCH_STMT:
+        rename_static_references(node->data.switch_stmt.expression, renames);
+        rename_static_references(node->data.switch_stmt.body, renames);
+        break;
+    case AST_CASE_STMT:
+    case AST_DEFAULT_STMT:
+        rename_static_references(node->data.case_stmt.value, renames);
+        rename_static_references(node->data.case_stmt.statement, renames);
+        break;
+    case AST_VARIABLE_DECL:
+        rename_static_list(node->data.variable_decl.array_dimensions,
+                           renames);
+        declare_local(node->data.variable_decl.name, renames);
+        rename_static_references(node->data.variable_decl.initializer,
+                                 renames);
+        break;
+    case AST_ENUM_DECL:
+        /* Enumerators are identifiers, or NAME = value assignments */
+        for (ASTNode* item = node->data.enum_decl.enumerators; item;
+             item = item->next) {
+            if (item->type == AST_IDENTIFIER) {
+                declare_local(item->data.identifier.name, renames);
+            } else if (item->type == AST_BINARY_OP &&
+                       item->data.binary_op.left->type == AST_IDENTIFIER) {
+                rename_static_references(item->data.binary_op.right, renames);
+                declare_local(item->data.binary_op.left->data.identifier.name,
+                              renames);
+            }
+        }
+        break;
+    case AST_STATIC_ASSERT:
+        rename_static_references(node->data.static_assert_decl.condition,
+                                 renames);
+        break;
+    default:
+        break;
+    }
+}
+
+void qualify_unit_statics(ASTNode* unit, int unit_index) {
+    StaticRenames renames;
+    for (ASTNode* node = unit; node; node = node->next) {
+        const char* name = NULL;
+        if (node->type == AST_FUNCTION_DEF || node->type == AST_FUNCTION_DECL) {
+            if (declared_storage(node->data.function_def.return_type) ==
+                STORAGE_STATIC) {
+                name = node->data.function_def.name;
+            }
+        } else if (node->type == AST_VARIABLE_DECL &&
+                   declared_storage(node->data.variable_decl.type) ==
+                       STORAGE_STATIC) {
+            name = node->data.variable_decl.name;
+        }
+        if (name) {
+            renames.names[name] =
+                std::string(name) + "." + std::to_string(unit_index);
+        }
+    }
+    if (renames.names.empty()) {
+        return;
+    }
+
+    /* Later declarations of a static name keep its internal linkage */
+    for (ASTNode* node = unit; node; node = node->next) {
+        switch (node->type) {
+        case AST_FUNCTION_DEF:
+        case AST_FUNCTION_DECL:
+            rename_static_name(&node->data.function_def.name, renames);
+            if (node->type == AST_FUNCTION_DEF) {
+                for (ASTNode* param = node->data.function_def.parameters;
+                     param; param = param->next) {
+                    if (param->type == AST_VARIABLE_DECL) {
+                        declare_local(param->data.variable_decl.name, renames);
+                    }
+                }
+                rename_static_references(node->data.function_def.body,
+                                         renames);
+                renames.locals.clear();
+            }
+            break;
+        case AST_VARIABLE_DECL:
+            rename_static_name(&node->data.variable_decl.name, renames);
+            rename_static_list(node->data.variable_decl.array_dimensions,
+                               renames);
+            rename_static_references(node->data.variable_decl.initializer,
+                                     renames);
+            break;
+        case AST_ENUM_DECL:
+        case AST_STATIC_ASSERT:
+            rename_static_references(node, renames);
+            renames.locals.clear();
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* Whole-program mode: keep one node per module symbol. Prototypes of
+ * functions defined in some unit are dropped, and of the declarations of
+ * a global variable only the strongest (initialized, tentative, extern)
+ * is emitted. */
+static void select_whole_program_nodes(
+    CodeGenContext* ctx, ASTNode* ast,
+    std::unordered_set<const ASTNode*>& skipped) {
+    std::unordered_set<std::string> defined_functions;
+    for (ASTNode* node = ast; node; node = node->next) {
+        if (node->type == AST_FUNCTION_DEF &&
+            !defined_functions.insert(node->data.function_def.name).second) {
+            codegen_error(ctx,
+                          "Function '%s' is defined in more than one "
+                          "translation unit",
+                          node->data.function_def.name);
+            skipped.insert(node);
+        }
+    }
+
+    std::unordered_map<std::string, ASTNode*> variables;
+    for (ASTNode* node = ast; node; node = node->next) {
+        if (node->type == AST_FUNCTION_DECL) {
+            if (defined_functions.count(node->data.function_def.name)) {
+                skipped.insert(node);
+            }
+            continue;
+        }
+        if (node->type != AST_VARIABLE_DECL ||
+            declared_storage(node->data.variable_decl.type) ==
+                STORAGE_TYPEDEF) {
+            continue;
+        }
+
+        auto found = variables.find(node->data.variable_decl.name);
+        if (found == variables.end()) {
+            variables[node->data.variable_decl.name] = node;
+            continue;
+        }
+
+        int rank = variable_definition_rank(node);
+        int chosen_rank = variable_definition_rank(found->second);
+        if (rank == 2 && chosen_rank == 2) {
+            codegen_error(ctx,
+                          "Variable '%s' is initialized in more than one "
+                          "translation unit",
+                          node->data.variable_decl.name);
+        }
+        if (rank > chosen_rank) {
+            skipped.insert(found->second);
+            found->second = node;
+        } else {
+            skipped.insert(node);
+        }
+    }
+}
+
+/* In whole-program mode identical string constants from different
+ * functions become aliases of the first one, so the data is stored once */
+static void alias_duplicate_strings(CodeGenContext* ctx) {
+    static const char marker[] = " = private unnamed_addr constant ";
+    std::unordered_map<std::string, std::string> first_by_value;
+
+    for (GlobalConstant* gc = ctx->constants.head; gc; gc = gc->next) {
+        const char* decl = gc->declaration;
+        const char* value = strstr(decl, marker);
+        if (strncmp(decl, "@.str", 5) != 0 || !value) {
+            continue;
+        }
+
+        std::string name(decl + 1, value - decl - 1);
+        value += sizeof(marker) - 1;
+        auto inserted = first_by_value.emplace(value, name);
+        if (inserted.second) {
+            continue;
+        }
+
+        /* value is <type> c"<bytes>" */
+        const char* initializer = strstr(value, " c\"");
+        if (!initializer) {
+            continue;
+        }
+        std::string type(value, initializer - value);
+        std::string pointer =
+            ctx->ir_flags & IR_PRINT_OPAQUE_POINTERS ? "ptr" : type + "*";
+        std::string alias = "@" + name + " = private unnamed_addr alias " +
+                            type + ", " + pointer + " @" +
+                            inserted.first->second;
+        constant_section_replace(&ctx->constants, gc, alias.data(),
+                                 alias.size());
+    }
+}
+
+/* Linkage prefix for a module-level definition */
+static const char* symbol_linkage(const CodeGenContext* ctx,
+                                  const char* name) {
+    if (!ctx->whole_program || strcmp(name, "main") == 0) {
+        return "";
+    }
+    for (int i = 0; i < ctx->exported_count; i++) {
+        if (strcmp(ctx->exported_symbols[i], name) == 0) {
+            return "";
+        }
+    }
+    return "internal ";
 }
 
 void process_ast_nodes(CodeGenContext* ctx, ASTNode* ast) {
+    std::unordered_set<const ASTNode*> skipped;
+    if (ctx->whole_program) {
+        select_whole_program_nodes(ctx, ast, skipped);
+    }
+
+    std::vector<FunctionJob> jobs;
     ASTNode* current = ast;
     while (current) {
+        if (skipped.count(current)) {
+            current = current->next;
+            continue;
+        }
         switch (current->type) {
-        case AST_FUNCTION_DEF:
-            generate_function_definition(ctx, current);
+        case AST_FUNCTION_DEF: {
+            FunctionJob job;
+            memset(&job, 0, sizeof(job));
+            job.module = ctx;
+            job.func_def = current;
+            job.visible_globals = ctx->global_symbols;
+            job.constant_anchor = ctx->constants.tail;
+            constant_section_init(&job.constants);
+            jobs.push_back(job);
             break;
+        }
         case AST_FUNCTION_DECL:
             generate_function_declaration(ctx, current);
             break;
         case AST_VARIABLE_DECL:
             generate_declaration(ctx, current);
             break;
+        case AST_ENUM_DECL:
+            generate_enum_declaration(ctx, current);
+            break;
+        case AST_STATIC_ASSERT:
+            generate_static_assert(ctx, current);
+            break;
         default:
             /* Handle other top-level constructs */
             break;
         }
+        if (ctx->stream_constants) {
+            stream_constants(ctx, &ctx->constants);
+        }
         current = current->next;
     }
+
+    /* Consumers take functions one at a time, in source order */
+    run_function_jobs(jobs, ctx->consumer ? 1 : ctx->codegen_jobs);
+    merge_function_jobs(ctx, jobs);
 }
 
-/* Expression generation */
-/* Helper function to load value from identifier if it's a variable pointer */
-LLVMValue* load_value_if_needed(CodeGenContext* ctx, LLVMValue* value) {
-    if (!value)
-        return NULL;
+/* IR building helpers */
 
-    if (!value->is_lvalue)
-        return value;
+static TypeInfo* int_type(CodeGenContext* ctx) {
+    return canonical_basic_type(ctx, TYPE_INT);
+}
+
+/* Operand for value, typed as type when given, else with its own type */
+static IRValue ir_operand(const LLVMValue* value, TypeInfo* type) {
+    if (!type)
+        type = value->llvm_type;
+    if (value->type == LLVM_VALUE_CONSTANT)
+        return ir_constant(value->id, type);
+    if (value->type == LLVM_VALUE_GLOBAL)
+        return ir_value(IR_VALUE_GLOBAL, 0, value->name, type);
+    if (value->name)
+        return ir_value(IR_VALUE_LOCAL, 0, value->name, type);
+    return ir_register(value->id, type);
+}
+
+/* Name of symbol's storage in the IR */
+static const char* storage_name(const Symbol* symbol) {
+    return symbol->storage_name ? symbol->storage_name : symbol->name;
+}
+
+/* The storage behind symbol, or value when there is none */
+static IRValue ir_address(const Symbol* symbol, const LLVMValue* value,
+                          TypeInfo* type) {
+    if (symbol) {
+        return ir_value(symbol->is_global ? IR_VALUE_GLOBAL : IR_VALUE_LOCAL,
+                        0, storage_name(symbol), type);
+    }
+    return ir_operand(value, type);
+}
 
-    if (!value->name)
+/* A named stack slot or parameter */
+static IRValue ir_local(const char* name, TypeInfo* type) {
+    return ir_value(IR_VALUE_LOCAL, 0, name, type);
+}
+
+/* result = op i32 left, right */
+static int build_int_binary(CodeGenContext* ctx, IRBinaryOp op, IRValue left,
+                            IRValue right) {
+    int reg = get_next_register(ctx);
+    ir_build_binary(&ctx->builder, op, ir_register(reg, int_type(ctx)),
+                    int_type(ctx), left, right);
+    return reg;
+}
+
+/* result = icmp predicate i32 left, right, an i1 */
+static int build_int_compare(CodeGenContext* ctx, IRPredicate predicate,
+                             IRValue left, IRValue right) {
+    int reg = get_next_register(ctx);
+    TypeInfo* bool_type = canonical_basic_type(ctx, TYPE_BOOL);
+    ir_build_icmp(&ctx->builder, predicate, ir_register(reg, bool_type),
+                  int_type(ctx), left, right);
+    return reg;
+}
+
+/* Widen or narrow value to type */
+static int build_cast(CodeGenContext* ctx, IRCastOp op, IRValue value,
+                      TypeInfo* type) {
+    int reg = get_next_register(ctx);
+    ir_build_cast(&ctx->builder, op, ir_register(reg, type), value, type);
+    return reg;
+}
+
+/* result = load type, type* address */
+static int build_load(CodeGenContext* ctx, TypeInfo* type, IRValue address) {
+    int reg = get_next_register(ctx);
+    ir_build_load(&ctx->builder, ir_register(reg, type), type, address);
+    return reg;
+}
+
+/* End the current block with a jump and start block */
+static void begin_block(CodeGenContext* ctx, int block) {
+    ir_build_br(&ctx->builder, block);
+    ir_builder_set_block(&ctx->builder, block);
+}
+
+/* Constant folding */
+
+static int is_integer_type(DataType type);
+
+/* op on i32 constants, wrapping like the instruction would; returns 0
+ * when the result is undefined (division by zero, INT_MIN / -1, a shift
+ * out of range) and the instruction must stay */
+static int fold_int_binary(IRBinaryOp op, int left, int right, int* result) {
+    unsigned a = (unsigned)left;
+    unsigned b = (unsigned)right;
+    switch (op) {
+    case IR_ADD:
+        *result = (int)(a + b);
+        return 1;
+    case IR_SUB:
+        *result = (int)(a - b);
+        return 1;
+    case IR_MUL:
+        *result = (int)(a * b);
+        return 1;
+    case IR_SDIV:
+    case IR_SREM:
+        if (right == 0 || (left == INT_MIN && right == -1))
+            return 0;
+        *result = op == IR_SDIV ? left / right : left % right;
+        return 1;
+    case IR_AND:
+        *result = left & right;
+        return 1;
+    case IR_OR:
+        *result = left | right;
+        return 1;
+    case IR_XOR:
+        *result = left ^ right;
+        return 1;
+    case IR_SHL:
+    case IR_ASHR:
+        if (right < 0 || right > 31)
+            return 0;
+        *result = op == IR_SHL ? (int)(a << right) : left >> right;
+        return 1;
+    }
+    return 0;
+}
+
+static int fold_int_compare(IRPredicate predicate, int left, int right) {
+    switch (predicate) {
+    case IR_ICMP_EQ:
+        return left == right;
+    case IR_ICMP_NE:
+        return left != right;
+    case IR_ICMP_SLT:
+        return left < right;
+    case IR_ICMP_SGT:
+        return left > right;
+    case IR_ICMP_SLE:
+        return left <= right;
+    case IR_ICMP_SGE:
+        return left >= right;
+    }
+    return 0;
+}
+
+/* Constant value converted to the integer type as C would */
+static int fold_int_cast(int value, const TypeInfo* type) {
+    switch (type->base_type) {
+    case TYPE_BOOL:
+        return value != 0;
+    case TYPE_CHAR:
+        return (signed char)value;
+    case TYPE_SHORT:
+        return (short)value;
+    default:
         return value;
+    }
+}
 
-    Symbol* symbol = lookup_symbol(ctx, value->name);
-    TypeInfo* type = symbol ? symbol->type : value->llvm_type;
+static int is_constant(const LLVMValue* value) {
+    return value->type == LLVM_VALUE_CONSTANT;
+}
 
-    /* Handle array decay: array name returns pointer to first element */
-    if (type && type->base_type == TYPE_ARRAY) {
-        if (symbol && symbol->is_parameter) return value;
+/* x op C or C op x that is x itself or a constant, without the
+ * instruction; x must already be an int, since the result is one */
+static int simplify_int_binary(CodeGenContext* ctx, IRBinaryOp op,
+                               const LLVMValue* left, const LLVMValue* right,
+                               LLVMValue* result) {
+    const LLVMValue* value = is_constant(left) ? right : left;
+    int constant = is_constant(left) ? left->id : right->id;
+    int constant_on_right = !is_constant(left);
+    if (value->llvm_type != int_type(ctx))
+        return 0;
+
+    switch (op) {
+    case IR_ADD:
+    case IR_OR:
+    case IR_XOR:
+        if (constant != 0)
+            return 0;
+        break;
+    case IR_SUB:
+    case IR_SHL:
+    case IR_ASHR:
+        if (constant != 0 || !constant_on_right)
+            return 0;
+        break;
+    case IR_MUL:
+        if (constant == 0) {
+            *result = llvm_constant(0, int_type(ctx));
+            return 1;
+        }
+        if (constant != 1)
+            return 0;
+        break;
+    case IR_SDIV:
+        if (constant != 1 || !constant_on_right)
+            return 0;
+        break;
+    case IR_SREM:
+        if (constant != 1 || !constant_on_right)
+            return 0;
+        *result = llvm_constant(0, int_type(ctx));
+        return 1;
+    case IR_AND:
+        if (constant == 0) {
+            *result = llvm_constant(0, int_type(ctx));
+            return 1;
+        }
+        if (constant != -1)
+            return 0;
+        break;
+    }
+    *result = *value;
+    return 1;
+}
+
+/* Integer constant expressions */
+
+/* Width and signedness of an integer type; 0 for other types */
+static int constant_type(CodeGenContext* ctx, DataType type, int* bits,
+                         int* is_unsigned) {
+    *is_unsigned = 0;
+    switch (type) {
+    case TYPE_BOOL:
+    case TYPE_CHAR:
+        *bits = 8;
+        return 1;
+    case TYPE_SHORT:
+        *bits = 8 * ctx->target->short_size;
+        return 1;
+    case TYPE_LONG:
+        *bits = 8 * ctx->target->long_size;
+        return 1;
+    case TYPE_INT:
+    case TYPE_SIGNED:
+    case TYPE_ENUM:
+        *bits = 32;
+        return 1;
+    case TYPE_UNSIGNED:
+        *bits = 32;
+        *is_unsigned = 1;
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Wrap value->value to its width */
+static void constant_normalize(ConstantValue* value) {
+    unsigned long long raw = (unsigned long long)value->value;
+    if (value->bits < 64) {
+        unsigned long long mask = (1ULL << value->bits) - 1;
+        raw &= mask;
+        if (!value->is_unsigned && (raw >> (value->bits - 1)))
+            raw |= ~mask;
+    }
+    value->value = (long long)raw;
+}
+
+static ConstantValue constant_of(long long value, int bits, int is_unsigned) {
+    ConstantValue result = {value, bits, is_unsigned};
+    constant_normalize(&result);
+    return result;
+}
+
+/* Integer promotion: anything narrower than int becomes int */
+static void constant_promote(ConstantValue* value) {
+    if (value->bits < 32) {
+        value->bits = 32;
+        value->is_unsigned = 0;
+    }
+}
+
+/* Usual arithmetic conversions of two promoted operands */
+static void constant_convert(ConstantValue* left, ConstantValue* right) {
+    int bits = left->bits > right->bits ? left->bits : right->bits;
+    int is_unsigned;
+    if (left->is_unsigned == right->is_unsigned) {
+        is_unsigned = left->is_unsigned;
+    } else {
+        const ConstantValue* u = left->is_unsigned ? left : right;
+        /* A wider signed type holds every value of the unsigned one */
+        is_unsigned = u->bits >= bits;
+    }
+    left->bits = right->bits = bits;
+    left->is_unsigned = right->is_unsigned = is_unsigned;
+    constant_normalize(left);
+    constant_normalize(right);
+}
+
+static int constant_is_true(const ConstantValue* value) {
+    return value->value != 0;
+}
+
+/* evaluated is 0 inside an arm that C does not evaluate: division by zero
+ * and bad shifts there do not make the expression non-constant */
+static int evaluate_constant(CodeGenContext* ctx, ASTNode* expr,
+                             ConstantValue* value, int evaluated);
+
+/* Type of an expression that sizeof needs, read off the AST without
+ * generating it; NULL when it is not known */
+static TypeInfo* operand_type(CodeGenContext* ctx, ASTNode* expr) {
+    switch (expr->type) {
+    case AST_CONSTANT:
+        return canonical_basic_type(ctx, expr->data.constant.const_type);
+    case AST_IDENTIFIER: {
+        Symbol* symbol = lookup_symbol(ctx, expr->data.identifier.name);
+        if (!symbol)
+            return NULL;
+        return symbol->is_constant ? canonical_basic_type(ctx, TYPE_INT)
+                                   : symbol->type;
+    }
+    case AST_FUNCTION_CALL: {
+        /* Function symbols carry their return type */
+        ASTNode* function = expr->data.function_call.function;
+        Symbol* symbol = function && function->type == AST_IDENTIFIER
+                             ? lookup_symbol(ctx, function->data.identifier.name)
+                             : NULL;
+        return symbol ? symbol->type : NULL;
+    }
+    case AST_ARRAY_ACCESS: {
+        TypeInfo* array = operand_type(ctx, expr->data.array_access.array);
+        return array && (array->base_type == TYPE_ARRAY ||
+                         array->base_type == TYPE_POINTER)
+                   ? array->return_type
+                   : NULL;
+    }
+    case AST_CAST:
+        return expr->data.cast_expr.target_type;
+    case AST_CONDITIONAL:
+        return operand_type(ctx, expr->data.conditional_expr.then_expr);
+    case AST_UNARY_OP: {
+        ASTNode* inner = expr->data.unary_op.operand;
+        TypeInfo* type = inner ? operand_type(ctx, inner) : NULL;
+        switch (expr->data.unary_op.op) {
+        case UOP_ADDR:
+            return type ? canonical_pointer_type(ctx, type) : NULL;
+        case UOP_DEREF:
+            return type && (type->base_type == TYPE_ARRAY ||
+                            type->base_type == TYPE_POINTER)
+                       ? type->return_type
+                       : NULL;
+        case UOP_NOT:
+            return canonical_basic_type(ctx, TYPE_INT);
+        case UOP_SIZEOF:
+            return NULL; /* Constant, sized by the evaluator */
+        default:
+            break;
+        }
+        /* +, -, ~ promote; ++ and -- keep the operand's type */
+        if (type && get_type_size(ctx, type) < ctx->target->int_size &&
+            expr->data.unary_op.op <= UOP_BITNOT)
+            return canonical_basic_type(ctx, TYPE_INT);
+        return type;
+    }
+    case AST_BINARY_OP: {
+        BinaryOp op = expr->data.binary_op.op;
+        if (op >= OP_LT && op <= OP_OR)
+            return canonical_basic_type(ctx, TYPE_INT);
+        if (op == OP_COMMA)
+            return operand_type(ctx, expr->data.binary_op.right);
+        TypeInfo* left = operand_type(ctx, expr->data.binary_op.left);
+        if (op >= OP_ASSIGN)
+            return left;
+        TypeInfo* right = operand_type(ctx, expr->data.binary_op.right);
+        if (!left || !right)
+            return NULL;
+        /* Pointer arithmetic keeps the pointer; the difference of two
+         * pointers is a long */
+        int left_pointer = left->base_type == TYPE_POINTER ||
+                           left->base_type == TYPE_ARRAY;
+        int right_pointer = right->base_type == TYPE_POINTER ||
+                            right->base_type == TYPE_ARRAY;
+        if (left_pointer && right_pointer)
+            return canonical_basic_type(ctx, TYPE_LONG);
+        if (left_pointer || right_pointer)
+            return canonical_pointer_type(
+                ctx, (left_pointer ? left : right)->return_type);
+        /* The wider operand, at least int */
+        TypeInfo* wider =
+            get_type_size(ctx, right) > get_type_size(ctx, left) ? right
+                                                                  : left;
+        return get_type_size(ctx, wider) < ctx->target->int_size
+                   ? canonical_basic_type(ctx, TYPE_INT)
+                   : wider;
+    }
+    default:
+        return NULL;
+    }
+}
+
+/* sizeof operand, without evaluating it */
+static int constant_sizeof(CodeGenContext* ctx, ASTNode* operand,
+                           long long* size) {
+    if (operand->type == AST_IDENTIFIER) {
+        Symbol* symbol = lookup_symbol(ctx, operand->data.identifier.name);
+        if (!symbol)
+            return 0;
+        *size = symbol->is_constant ? ctx->target->int_size
+                                    : get_type_size(ctx, symbol->type);
+        return 1;
+    }
+    if (operand->type == AST_STRING_LITERAL) {
+        *size = operand->data.string_literal.length + 1;
+        return 1;
+    }
+    ConstantValue value;
+    if (evaluate_constant(ctx, operand, &value, 0)) {
+        *size = value.bits / 8;
+        return 1;
+    }
+    TypeInfo* type = operand_type(ctx, operand);
+    if (!type)
+        return 0;
+    *size = get_type_size(ctx, type);
+    return 1;
+}
 
-        char* gep_reg = get_next_register(ctx);
-        char* array_type_str = llvm_type_to_string(type);
-        const char* name = symbol ? symbol->name : value->name;
+static int evaluate_constant_unary(CodeGenContext* ctx, ASTNode* expr,
+                                   ConstantValue* value, int evaluated) {
+    UnaryOp op = expr->data.unary_op.op;
+    if (op == UOP_SIZEOF) {
+        long long size;
+        if (expr->data.unary_op.operand) {
+            if (!constant_sizeof(ctx, expr->data.unary_op.operand, &size))
+                return 0;
+        } else {
+            size = get_type_size(ctx, expr->data_type);
+        }
+        *value = constant_of(size, 8 * ctx->target->pointer_size, 1);
+        return 1;
+    }
+    if (op != UOP_PLUS && op != UOP_MINUS && op != UOP_NOT &&
+        op != UOP_BITNOT)
+        return 0;
 
-        if (symbol && symbol->is_global) {
-             emit_instruction(ctx, "%%%s = getelementptr %s, %s* @%s, i32 0, i32 0",
-                              gep_reg, array_type_str, array_type_str, name);
+    if (!evaluate_constant(ctx, expr->data.unary_op.operand, value, evaluated))
+        return 0;
+    constant_promote(value);
+    unsigned long long raw = (unsigned long long)value->value;
+    switch (op) {
+    case UOP_MINUS:
+        value->value = (long long)(0 - raw);
+        break;
+    case UOP_NOT:
+        *value = constant_of(raw == 0, 32, 0);
+        return 1;
+    case UOP_BITNOT:
+        value->value = (long long)~raw;
+        break;
+    default:
+        break;
+    }
+    constant_normalize(value);
+    return 1;
+}
+
+static int evaluate_constant_binary(CodeGenContext* ctx, ASTNode* expr,
+                                    ConstantValue* value, int evaluated) {
+    BinaryOp op = expr->data.binary_op.op;
+    ConstantValue left, right;
+    if (!evaluate_constant(ctx, expr->data.binary_op.left, &left, evaluated))
+        return 0;
+
+    /* && and || leave the right operand unevaluated when the left decides */
+    if (op == OP_AND || op == OP_OR) {
+        int decided = (op == OP_AND) != constant_is_true(&left);
+        if (!evaluate_constant(ctx, expr->data.binary_op.right, &right,
+                               evaluated && !decided))
+            return 0;
+        int result = decided ? op == OP_OR : constant_is_true(&right);
+        *value = constant_of(result, 32, 0);
+        return 1;
+    }
+
+    if (!evaluate_constant(ctx, expr->data.binary_op.right, &right, evaluated))
+        return 0;
+    constant_promote(&left);
+    constant_promote(&right);
+
+    /* Shifts take the type of the promoted left operand */
+    if (op == OP_LSHIFT || op == OP_RSHIFT) {
+        int in_range = right.is_unsigned
+                           ? (unsigned long long)right.value <
+                                 (unsigned long long)left.bits
+                           : right.value >= 0 && right.value < left.bits;
+        if (!in_range) {
+            if (evaluated)
+                return 0;
+            *value = left;
+            return 1;
+        }
+        int count = (int)right.value;
+        *value = left;
+        if (op == OP_LSHIFT) {
+            value->value = (long long)((unsigned long long)left.value << count);
+        } else if (left.is_unsigned) {
+            value->value = (long long)((unsigned long long)left.value >> count);
         } else {
-             emit_instruction(ctx, "%%%s = getelementptr %s, %s* %%%s, i32 0, i32 0",
-                              gep_reg, array_type_str, array_type_str, name);
+            value->value = left.value >> count;
         }
+        constant_normalize(value);
+        return 1;
+    }
+
+    constant_convert(&left, &right);
+    unsigned long long a = (unsigned long long)left.value;
+    unsigned long long b = (unsigned long long)right.value;
+    int is_unsigned = left.is_unsigned;
+    int compared;
+    switch (op) {
+    case OP_LT:
+        compared = is_unsigned ? a < b : left.value < right.value;
+        break;
+    case OP_GT:
+        compared = is_unsigned ? a > b : left.value > right.value;
+        break;
+    case OP_LE:
+        compared = is_unsigned ? a <= b : left.value <= right.value;
+        break;
+    case OP_GE:
+        compared = is_unsigned ? a >= b : left.value >= right.value;
+        break;
+    case OP_EQ:
+        compared = a == b;
+        break;
+    case OP_NE:
+        compared = a != b;
+        break;
+    default:
+        compared = -1;
+        break;
+    }
+    if (compared >= 0) {
+        *value = constant_of(compared, 32, 0);
+        return 1;
+    }
+
+    *value = left;
+    switch (op) {
+    case OP_ADD:
+        value->value = (long long)(a + b);
+        break;
+    case OP_SUB:
+        value->value = (long long)(a - b);
+        break;
+    case OP_MUL:
+        value->value = (long long)(a * b);
+        break;
+    case OP_DIV:
+    case OP_MOD: {
+        long long min = left.bits == 64 ? LLONG_MIN : INT_MIN;
+        if (b == 0 || (!is_unsigned && left.value == min && right.value == -1)) {
+            if (evaluated)
+                return 0;
+            value->value = 0;
+            break;
+        }
+        if (is_unsigned) {
+            value->value = (long long)(op == OP_DIV ? a / b : a % b);
+        } else {
+            value->value = op == OP_DIV ? left.value / right.value
+                                        : left.value % right.value;
+        }
+        break;
+    }
+    case OP_BITAND:
+        value->value = (long long)(a & b);
+        break;
+    case OP_BITOR:
+        value->value = (long long)(a | b);
+        break;
+    case OP_XOR:
+        value->value = (long long)(a ^ b);
+        break;
+    default:
+        /* Assignments and the comma operator are never constant */
+        return 0;
+    }
+    constant_normalize(value);
+    return 1;
+}
+
+static int evaluate_constant(CodeGenContext* ctx, ASTNode* expr,
+                             ConstantValue* value, int evaluated) {
+    if (!expr)
+        return 0;
+
+    switch (expr->type) {
+    case AST_CONSTANT: {
+        int bits, is_unsigned;
+        if (!constant_type(ctx, expr->data.constant.const_type, &bits,
+                           &is_unsigned)) {
+            bits = 32;
+            is_unsigned = 0;
+        }
+        *value = constant_of(expr->data.constant.value.int_val, bits,
+                             is_unsigned);
+        return 1;
+    }
+    case AST_IDENTIFIER: {
+        Symbol* symbol = lookup_symbol(ctx, expr->data.identifier.name);
+        if (!symbol || !symbol->is_constant)
+            return 0;
+        *value = constant_of(symbol->constant_value, 32, 0);
+        return 1;
+    }
+    case AST_UNARY_OP:
+        return evaluate_constant_unary(ctx, expr, value, evaluated);
+    case AST_BINARY_OP:
+        return evaluate_constant_binary(ctx, expr, value, evaluated);
+    case AST_CONDITIONAL: {
+        ConstantValue condition, then_value, else_value;
+        if (!evaluate_constant(ctx, expr->data.conditional_expr.condition,
+                               &condition, evaluated))
+            return 0;
+        int take_then = constant_is_true(&condition);
+        if (!evaluate_constant(ctx, expr->data.conditional_expr.then_expr,
+                               &then_value, evaluated && take_then) ||
+            !evaluate_constant(ctx, expr->data.conditional_expr.else_expr,
+                               &else_value, evaluated && !take_then))
+            return 0;
+        constant_promote(&then_value);
+        constant_promote(&else_value);
+        constant_convert(&then_value, &else_value);
+        *value = take_then ? then_value : else_value;
+        return 1;
+    }
+    case AST_CAST: {
+        const TypeInfo* target = expr->data.cast_expr.target_type;
+        int bits, is_unsigned;
+        if (!target ||
+            !constant_type(ctx, target->base_type, &bits, &is_unsigned) ||
+            !evaluate_constant(ctx, expr->data.cast_expr.operand, value,
+                               evaluated))
+            return 0;
+        if (target->base_type == TYPE_BOOL) {
+            *value = constant_of(constant_is_true(value), bits, 1);
+            return 1;
+        }
+        *value = constant_of(value->value, bits, is_unsigned);
+        return 1;
+    }
+    default:
+        return 0;
+    }
+}
+
+int evaluate_constant_expression(CodeGenContext* ctx, ASTNode* expr,
+                                 ConstantValue* value) {
+    return evaluate_constant(ctx, expr, value, 1);
+}
+
+/* value converted to an integer variable of type, as its initializer,
+ * in the signed form IR constants print in; other types take the value
+ * unchanged */
+static long long constant_for_type(CodeGenContext* ctx,
+                                   const ConstantValue* value,
+                                   const TypeInfo* type) {
+    int bits, is_unsigned;
+    if (!constant_type(ctx, type->base_type, &bits, &is_unsigned))
+        return value->value;
+    if (type->base_type == TYPE_BOOL)
+        return constant_is_true(value);
+    return constant_of(value->value, bits, 0).value;
+}
+
+/* Expression generation */
+
+/* Branch to then_block when condition is nonzero, else to else_block */
+static void emit_condition_branch(CodeGenContext* ctx,
+                                  const LLVMValue* condition, int then_block,
+                                  int else_block) {
+    /* A constant condition picks its block now; the other is unreachable */
+    if (is_constant(condition)) {
+        ir_build_br(&ctx->builder, condition->id != 0 ? then_block : else_block);
+        return;
+    }
+
+    TypeInfo* bool_type = canonical_basic_type(ctx, TYPE_BOOL);
+    IRValue cond;
+    if (condition->llvm_type && condition->llvm_type->base_type == TYPE_BOOL) {
+        cond = ir_operand(condition, bool_type);
+    } else {
+        int cmp_reg = build_int_compare(ctx, IR_ICMP_NE,
+                                        ir_operand(condition, int_type(ctx)),
+                                        ir_constant(0, int_type(ctx)));
+        cond = ir_register(cmp_reg, bool_type);
+    }
+    ir_build_cond_br(&ctx->builder, cond, then_block, else_block);
+}
+
+/* Helper function to load value from identifier if it's a variable pointer */
+LLVMValue load_value_if_needed(CodeGenContext* ctx, LLVMValue value) {
+    if (value.type == LLVM_VALUE_NONE || !value.is_lvalue)
+        return value;
 
-        TypeInfo* ptr_type = create_pointer_type(duplicate_type_info(type->return_type));
-        LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, gep_reg, ptr_type);
+    Symbol* symbol = value.name ? lookup_storage(ctx, value.name) : NULL;
+    TypeInfo* type = symbol ? symbol->type : value.llvm_type;
 
-        free(array_type_str);
-        return result;
+    /* Handle array decay: array name returns pointer to first element */
+    if (type && type->base_type == TYPE_ARRAY) {
+        if (symbol && symbol->is_parameter) return value;
+
+        int gep_reg = get_next_register(ctx);
+        TypeInfo* element_pointer =
+            canonical_pointer_type(ctx, type->return_type);
+        IRValue indices[2] = {ir_constant(0, int_type(ctx)),
+                              ir_constant(0, int_type(ctx))};
+        ir_build_gep(&ctx->builder, ir_register(gep_reg, element_pointer),
+                     canonical_type(ctx, type),
+                     ir_address(symbol, &value,
+                                canonical_pointer_type(ctx, type)),
+                     indices, 2);
+
+        return llvm_register(gep_reg, element_pointer);
     }
 
     /* Prevent loading of array pointers (Pointer to Array) */
@@ -209,95 +1498,33 @@ LLVMValue* load_value_if_needed(CodeGenContext* ctx, LLVMValue* value) {
     if (symbol && symbol->is_parameter)
         return value;
 
-    char* load_reg = get_next_register(ctx);
-    TypeInfo* loaded_type = duplicate_type_info(type);
-    LLVMValue* loaded_value =
-        create_llvm_value(LLVM_VALUE_REGISTER, load_reg, loaded_type);
-
-    char* value_type_str = llvm_type_to_string(type);
-    TypeInfo* pointer_type_info =
-        create_pointer_type(duplicate_type_info(type));
-    char* pointer_type_str = llvm_type_to_string(pointer_type_info);
-
-    const char* name = symbol ? symbol->name : value->name;
-
-    if (symbol && symbol->is_global) {
-        emit_instruction(ctx, "%%%s = load %s, %s @%s", load_reg,
-                         value_type_str, pointer_type_str, name);
-    } else {
-        emit_instruction(ctx, "%%%s = load %s, %s %%%s", load_reg,
-
-                         value_type_str, pointer_type_str, name);
-    }
+    TypeInfo* value_type = canonical_type(ctx, type);
+    int load_reg = build_load(
+        ctx, value_type,
+        ir_address(symbol, &value, canonical_pointer_type(ctx, type)));
 
-    free(value_type_str);
-    free(pointer_type_str);
-    free_type_info(pointer_type_info);
-    free(load_reg);
-    free_llvm_value(value);
-    return loaded_value;
+    return llvm_register(load_reg, value_type);
 }
 
-static LLVMValue* ensure_pointer_value(CodeGenContext* ctx, LLVMValue* value) {
-    if (!value)
-        return NULL;
-
-    if (!value->llvm_type || value->llvm_type->base_type != TYPE_POINTER)
+static LLVMValue ensure_pointer_value(CodeGenContext* ctx, LLVMValue value) {
+    if (!value.llvm_type || value.llvm_type->base_type != TYPE_POINTER)
         return value;
 
-    Symbol* symbol = lookup_symbol(ctx, value->name);
+    Symbol* symbol = value.name ? lookup_storage(ctx, value.name) : NULL;
     if (!symbol || symbol->is_parameter)
         return value;
 
-    char* load_reg = get_next_register(ctx);
-    char* value_type_str = llvm_type_to_string(symbol->type);
-    TypeInfo* storage_pointer_type =
-        create_pointer_type(duplicate_type_info(symbol->type));
-    char* storage_pointer_str = llvm_type_to_string(storage_pointer_type);
-
-    if (symbol->is_global) {
-        emit_instruction(ctx, "%%%s = load %s, %s @%s", load_reg,
-                         value_type_str, storage_pointer_str, symbol->name);
-    } else {
-        emit_instruction(ctx, "%%%s = load %s, %s %%%s", load_reg,
-                         value_type_str, storage_pointer_str, symbol->name);
-    }
-
-    free(value_type_str);
-    free(storage_pointer_str);
-    free_type_info(storage_pointer_type);
-
-    LLVMValue* loaded_value =
-        create_llvm_value(LLVM_VALUE_REGISTER, load_reg,
-                          duplicate_type_info(symbol->type));
-    free(load_reg);
-    return loaded_value;
-}
-
-static LLVMValue* ensure_integer_register(CodeGenContext* ctx,
-                                          LLVMValue* value) {
-    if (!value)
-        return NULL;
-
-    if (value->type == LLVM_VALUE_REGISTER)
-        return value;
-
-    if (value->type == LLVM_VALUE_CONSTANT) {
-        char* reg = get_next_register(ctx);
-        LLVMValue* reg_value = create_llvm_value(LLVM_VALUE_REGISTER, reg,
-                                                 create_type_info(TYPE_INT));
-        emit_instruction(ctx, "%%%s = add i32 0, %s", reg, value->name);
-        free(reg);
-        free_llvm_value(value);
-        return reg_value;
-    }
+    TypeInfo* value_type = canonical_type(ctx, symbol->type);
+    int load_reg = build_load(
+        ctx, value_type,
+        ir_address(symbol, &value, canonical_pointer_type(ctx, symbol->type)));
 
-    return value;
+    return llvm_register(load_reg, value_type);
 }
 
-LLVMValue* generate_expression(CodeGenContext* ctx, ASTNode* expr) {
+LLVMValue generate_expression(CodeGenContext* ctx, ASTNode* expr) {
     if (!expr)
-        return NULL;
+        return llvm_no_value();
 
     switch (expr->type) {
     case AST_IDENTIFIER:
@@ -325,10 +1552,10 @@ LLVMValue* generate_expression(CodeGenContext* ctx, ASTNode* expr) {
         if (expr->data.return_stmt.expression) {
             return generate_expression(ctx, expr->data.return_stmt.expression);
         }
-        return NULL;
+        return llvm_no_value();
     default:
         codegen_error(ctx, "Unsupported expression type: %d", expr->type);
-        return NULL;
+        return llvm_no_value();
     }
 }
 
@@ -348,47 +1575,47 @@ static bool is_comparison_operator(BinaryOp op) {
             op == OP_EQ || op == OP_NE);
 }
 
-/* Get LLVM instruction name for binary operator */
-static const char* get_binary_op_instruction(BinaryOp op) {
+/* IR operation for binary operator: an IRPredicate for comparisons, else
+ * an IRBinaryOp; -1 when there is none */
+static int get_binary_op_instruction(BinaryOp op) {
     switch (op) {
     case OP_ADD:
-        return "add";
+        return IR_ADD;
     case OP_SUB:
-        return "sub";
+        return IR_SUB;
     case OP_MUL:
-        return "mul";
+        return IR_MUL;
     case OP_DIV:
-        return "sdiv";
+        return IR_SDIV;
     case OP_MOD:
-        return "srem";
+        return IR_SREM;
     case OP_LT:
-        return "icmp slt";
+        return IR_ICMP_SLT;
     case OP_GT:
-        return "icmp sgt";
+        return IR_ICMP_SGT;
     case OP_LE:
-        return "icmp sle";
+        return IR_ICMP_SLE;
     case OP_GE:
-        return "icmp sge";
+        return IR_ICMP_SGE;
     case OP_EQ:
-        return "icmp eq";
+        return IR_ICMP_EQ;
     case OP_NE:
-        return "icmp ne";
+        return IR_ICMP_NE;
     case OP_BITAND:
-        return "and";
+        return IR_AND;
     case OP_BITOR:
-        return "or";
+        return IR_OR;
     case OP_XOR:
-        return "xor";
+        return IR_XOR;
     case OP_LSHIFT:
-        return "shl";
+        return IR_SHL;
     case OP_RSHIFT:
-        return "ashr";
+        return IR_ASHR;
     default:
-        return NULL;
+        return -1;
     }
 }
 
-/* Format operand for LLVM instruction (constant vs register) */
 /* Helper to escape string for LLVM IR */
 void escape_string_for_llvm(const char* input, char* output, size_t output_size) {
     size_t j = 0;
@@ -405,73 +1632,302 @@ void escape_string_for_llvm(const char* input, char* output, size_t output_size)
     output[j] = '\0';
 }
 
-static void format_operand(const LLVMValue* value, char* buffer,
-                           size_t buffer_size) {
+/* Format operand for LLVM instruction (constant, register or global) */
+void format_operand(const LLVMValue* value, char* buffer, size_t buffer_size) {
     if (value->type == LLVM_VALUE_CONSTANT) {
-        snprintf(buffer, buffer_size, "%d", value->data.constant_val);
-    } else {
+        snprintf(buffer, buffer_size, "%d", value->id);
+    } else if (value->type == LLVM_VALUE_GLOBAL) {
+        snprintf(buffer, buffer_size, "@%s", value->name);
+    } else if (value->name) {
         snprintf(buffer, buffer_size, "%%%s", value->name);
+    } else {
+        snprintf(buffer, buffer_size, "%%%d", value->id);
+    }
+}
+
+/* Whether both operands of binary expr are signed int after promotion,
+ * the only operands that constants fold correctly for as i32 */
+static int has_signed_int_operands(CodeGenContext* ctx, ASTNode* expr) {
+    ASTNode* operands[2] = {expr->data.binary_op.left,
+                            expr->data.binary_op.right};
+    for (ASTNode* operand : operands) {
+        TypeInfo* type = operand_type(ctx, operand);
+        if (!type)
+            return 0;
+        switch (canonical_type(ctx, type)->base_type) {
+        case TYPE_BOOL:
+        case TYPE_CHAR:
+        case TYPE_SHORT:
+        case TYPE_INT:
+        case TYPE_SIGNED:
+        case TYPE_ENUM:
+            break;
+        default:
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* left predicate right as an i1, or a constant when both sides are and
+ * signed_ints says they compare as signed ints */
+static LLVMValue generate_compare(CodeGenContext* ctx, IRPredicate predicate,
+                                  const LLVMValue* left,
+                                  const LLVMValue* right, int signed_ints) {
+    if (signed_ints && is_constant(left) && is_constant(right)) {
+        return llvm_constant(fold_int_compare(predicate, left->id, right->id),
+                             int_type(ctx));
     }
+
+    int cmp_reg = build_int_compare(ctx, predicate,
+                                    ir_operand(left, int_type(ctx)),
+                                    ir_operand(right, int_type(ctx)));
+    return llvm_register(cmp_reg, canonical_basic_type(ctx, TYPE_BOOL));
+}
+
+/* A truth value as the int 0 or 1 that C gives it in value context */
+static LLVMValue widen_truth_value(CodeGenContext* ctx, LLVMValue flag) {
+    if (flag.type == LLVM_VALUE_NONE)
+        return flag;
+    if (is_constant(&flag))
+        return llvm_constant(flag.id != 0, int_type(ctx));
+
+    int result_reg = build_cast(ctx, IR_ZEXT, ir_operand(&flag, NULL),
+                                int_type(ctx));
+    return llvm_register(result_reg, int_type(ctx));
 }
 
 /* Generate comparison operation with i1 to i32 conversion */
-static LLVMValue* generate_comparison_op(CodeGenContext* ctx,
-                                         const char* op_name,
-                                         const LLVMValue* left,
-                                         const LLVMValue* right) {
-    char left_operand[MAX_OPERAND_STRING_LENGTH];
-    char right_operand[MAX_OPERAND_STRING_LENGTH];
+static LLVMValue generate_comparison_op(CodeGenContext* ctx,
+                                        IRPredicate predicate,
+                                        const LLVMValue* left,
+                                        const LLVMValue* right,
+                                        int signed_ints) {
+    return widen_truth_value(
+        ctx, generate_compare(ctx, predicate, left, right, signed_ints));
+}
+
+/* Generate arithmetic operation; constants fold as i32 only when
+ * signed_ints says both operands are signed ints */
+static LLVMValue generate_arithmetic_op(CodeGenContext* ctx, IRBinaryOp op,
+                                        const LLVMValue* left,
+                                        const LLVMValue* right,
+                                        int signed_ints) {
+    LLVMValue folded;
+    if (is_constant(left) && is_constant(right)) {
+        int value;
+        if (signed_ints && fold_int_binary(op, left->id, right->id, &value))
+            return llvm_constant(value, int_type(ctx));
+    } else if ((is_constant(left) || is_constant(right)) &&
+               simplify_int_binary(ctx, op, left, right, &folded)) {
+        return folded;
+    }
 
-    format_operand(left, left_operand, sizeof(left_operand));
-    format_operand(right, right_operand, sizeof(right_operand));
+    int result_reg = build_int_binary(ctx, op, ir_operand(left, int_type(ctx)),
+                                      ir_operand(right, int_type(ctx)));
 
-    /* Generate comparison and result registers */
-    char* cmp_reg = get_next_register(ctx);
-    char* result_reg = get_next_register(ctx);
+    return llvm_register(result_reg, int_type(ctx));
+}
 
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                                          create_type_info(TYPE_INT));
+/* Integer promotion: sign-extend a value narrower than int to i32 */
+static LLVMValue promote_to_int(CodeGenContext* ctx, LLVMValue value) {
+    if (is_constant(&value))
+        return llvm_constant(value.id, int_type(ctx));
 
-    /* Emit comparison instruction */
-    emit_instruction(ctx, "%%%s = %s i32 %s, %s", cmp_reg, op_name,
-                     left_operand, right_operand);
+    int res_reg = build_cast(ctx, IR_SEXT, ir_operand(&value, NULL),
+                             int_type(ctx));
 
-    /* Convert i1 result to i32 */
-    emit_instruction(ctx, "%%%s = zext i1 %%%s to i32", result_reg, cmp_reg);
+    return llvm_register(res_reg, int_type(ctx));
+}
 
-    /* Cleanup */
-    free(cmp_reg);
-    free(result_reg);
+/* The operands of comparison expr, loaded and promoted to int; 0 when
+ * either could not be generated */
+static int generate_comparison_operands(CodeGenContext* ctx, ASTNode* expr,
+                                        LLVMValue* left, LLVMValue* right) {
+    *left = generate_expression(ctx, expr->data.binary_op.left);
+    *right = generate_expression(ctx, expr->data.binary_op.right);
+    if (left->type == LLVM_VALUE_NONE || right->type == LLVM_VALUE_NONE)
+        return 0;
 
-    return result;
+    *left = load_value_if_needed(ctx, *left);
+    *right = load_value_if_needed(ctx, *right);
+    if (left->llvm_type && get_type_size(ctx, left->llvm_type) < 4)
+        *left = promote_to_int(ctx, *left);
+    if (right->llvm_type && get_type_size(ctx, right->llvm_type) < 4)
+        *right = promote_to_int(ctx, *right);
+    return 1;
 }
 
-/* Generate arithmetic operation */
-static LLVMValue* generate_arithmetic_op(CodeGenContext* ctx,
-                                         const char* op_name,
-                                         const LLVMValue* left,
-                                         const LLVMValue* right) {
-    char left_operand[MAX_OPERAND_STRING_LENGTH];
-    char right_operand[MAX_OPERAND_STRING_LENGTH];
+static bool is_logical_operator(const ASTNode* expr) {
+    return expr->type == AST_BINARY_OP && (expr->data.binary_op.op == OP_AND ||
+                                           expr->data.binary_op.op == OP_OR);
+}
 
-    format_operand(left, left_operand, sizeof(left_operand));
-    format_operand(right, right_operand, sizeof(right_operand));
+static LLVMValue generate_logical_truth(CodeGenContext* ctx, ASTNode* expr);
+
+/* The predicate that holds exactly when predicate does not */
+static IRPredicate invert_predicate(IRPredicate predicate) {
+    switch (predicate) {
+    case IR_ICMP_EQ:
+        return IR_ICMP_NE;
+    case IR_ICMP_NE:
+        return IR_ICMP_EQ;
+    case IR_ICMP_SLT:
+        return IR_ICMP_SGE;
+    case IR_ICMP_SGT:
+        return IR_ICMP_SLE;
+    case IR_ICMP_SLE:
+        return IR_ICMP_SGT;
+    default:
+        return IR_ICMP_SLT;
+    }
+}
 
-    char* result_reg = get_next_register(ctx);
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                                          create_type_info(TYPE_INT));
+/* expr != 0 as an i1, or as the constant 0 or 1. Comparisons, && and ||
+ * give their i1 as it is instead of an int to compare against zero. */
+static LLVMValue generate_truth_value(CodeGenContext* ctx, ASTNode* expr) {
+    if (is_logical_operator(expr))
+        return generate_logical_truth(ctx, expr);
+
+    /* !x is x == 0; ! of a comparison is the inverse comparison */
+    int negate = 0;
+    ASTNode* operand = expr;
+    if (expr->type == AST_UNARY_OP && expr->data.unary_op.op == UOP_NOT) {
+        negate = 1;
+        operand = expr->data.unary_op.operand;
+    }
+    if (operand->type == AST_BINARY_OP &&
+        is_comparison_operator(operand->data.binary_op.op)) {
+        ConstantValue known;
+        if (evaluate_constant_expression(ctx, operand, &known))
+            return llvm_constant((known.value != 0) != negate, int_type(ctx));
+        LLVMValue left, right;
+        if (!generate_comparison_operands(ctx, operand, &left, &right))
+            return llvm_no_value();
+        IRPredicate predicate = (IRPredicate)get_binary_op_instruction(
+            operand->data.binary_op.op);
+        return generate_compare(
+            ctx, negate ? invert_predicate(predicate) : predicate, &left,
+            &right, has_signed_int_operands(ctx, operand));
+    }
 
-    /* Emit arithmetic instruction */
-    emit_instruction(ctx, "%%%s = %s i32 %s, %s", result_reg, op_name,
-                     left_operand, right_operand);
+    LLVMValue value = generate_expression(ctx, operand);
+    if (value.type == LLVM_VALUE_NONE)
+        return value;
+    value = load_value_if_needed(ctx, value);
+    if (is_constant(&value))
+        return llvm_constant((value.id != 0) != negate, int_type(ctx));
 
-    /* Cleanup */
-    free(result_reg);
+    TypeInfo* bool_type = canonical_basic_type(ctx, TYPE_BOOL);
+    int is_bool = value.llvm_type && value.llvm_type->base_type == TYPE_BOOL;
+    if (is_bool && !negate)
+        return value;
+    TypeInfo* type = is_bool ? bool_type : int_type(ctx);
+    int cmp_reg = get_next_register(ctx);
+    ir_build_icmp(&ctx->builder, negate ? IR_ICMP_EQ : IR_ICMP_NE,
+                  ir_register(cmp_reg, bool_type), type,
+                  ir_operand(&value, type), ir_constant(0, type));
+    return llvm_register(cmp_reg, bool_type);
+}
 
-    return result;
+/* Branch to then_block when expr is nonzero, else to else_block. In this
+ * condition context a comparison branches on its i1, ! swaps the targets,
+ * and && and || become chains of branches, so no truth value is widened to
+ * int only to be compared against zero again. */
+static void generate_condition_branch(CodeGenContext* ctx, ASTNode* expr,
+                                      int then_block, int else_block) {
+    if (expr->type == AST_UNARY_OP && expr->data.unary_op.op == UOP_NOT) {
+        generate_condition_branch(ctx, expr->data.unary_op.operand,
+                                  else_block, then_block);
+        return;
+    }
+
+    if (is_logical_operator(expr)) {
+        int is_or = expr->data.binary_op.op == OP_OR;
+        ASTNode* right = expr->data.binary_op.right;
+
+        /* A constant left side either decides the branch, leaving the right
+         * side unevaluated, or leaves it to the right side */
+        ConstantValue known;
+        if (evaluate_constant_expression(ctx, expr->data.binary_op.left,
+                                         &known)) {
+            if ((known.value != 0) == is_or) {
+                ir_build_br(&ctx->builder, is_or ? then_block : else_block);
+            } else {
+                generate_condition_branch(ctx, right, then_block, else_block);
+            }
+            return;
+        }
+
+        int right_bb = get_next_basic_block(ctx);
+        generate_condition_branch(ctx, expr->data.binary_op.left,
+                                  is_or ? then_block : right_bb,
+                                  is_or ? right_bb : else_block);
+        ir_builder_set_block(&ctx->builder, right_bb);
+        generate_condition_branch(ctx, right, then_block, else_block);
+        return;
+    }
+
+    LLVMValue condition = generate_truth_value(ctx, expr);
+    if (condition.type == LLVM_VALUE_NONE) {
+        ir_build_br(&ctx->builder, else_block);
+        return;
+    }
+    emit_condition_branch(ctx, &condition, then_block, else_block);
+}
+
+/* a && b or a || b as an i1: the left side branches as a condition and the
+ * short-circuit result meets the right side's truth value in a phi */
+static LLVMValue generate_logical_truth(CodeGenContext* ctx, ASTNode* expr) {
+    int is_or = expr->data.binary_op.op == OP_OR;
+    ASTNode* left = expr->data.binary_op.left;
+    TypeInfo* bool_type = canonical_basic_type(ctx, TYPE_BOOL);
+
+    /* A constant left side either decides the result, leaving the right
+     * side unevaluated, or leaves just the right side's truth */
+    ConstantValue known;
+    if (evaluate_constant_expression(ctx, left, &known)) {
+        if ((known.value != 0) == is_or)
+            return llvm_constant(is_or, int_type(ctx));
+        return generate_truth_value(ctx, expr->data.binary_op.right);
+    }
+
+    int right_bb = get_next_basic_block(ctx);
+    int end_bb = get_next_basic_block(ctx);
+    /* A left side that is itself a chain leaves from several blocks; they
+     * meet in one before the phi */
+    int short_bb = is_logical_operator(left) ||
+                           (left->type == AST_UNARY_OP &&
+                            left->data.unary_op.op == UOP_NOT)
+                       ? get_next_basic_block(ctx)
+                       : end_bb;
+
+    generate_condition_branch(ctx, left, is_or ? short_bb : right_bb,
+                              is_or ? right_bb : short_bb);
+    int short_from = ctx->builder.block->id;
+    if (short_bb != end_bb) {
+        ir_builder_set_block(&ctx->builder, short_bb);
+        ir_build_br(&ctx->builder, end_bb);
+        short_from = short_bb;
+    }
+
+    ir_builder_set_block(&ctx->builder, right_bb);
+    LLVMValue right = generate_truth_value(ctx, expr->data.binary_op.right);
+    if (right.type == LLVM_VALUE_NONE)
+        return right;
+    int right_from = ctx->builder.block->id;
+    begin_block(ctx, end_bb);
+
+    int result_reg = get_next_register(ctx);
+    IRValue incoming[2] = {ir_constant(is_or, bool_type),
+                           ir_operand(&right, bool_type)};
+    int predecessors[2] = {short_from, right_from};
+    ir_build_phi(&ctx->builder, ir_register(result_reg, bool_type), bool_type,
+                 incoming, predecessors, 2);
+    return llvm_register(result_reg, bool_type);
 }
 
-LLVMValue* generate_binary_op(CodeGenContext* ctx, ASTNode* expr) {
+LLVMValue generate_binary_op(CodeGenContext* ctx, ASTNode* expr) {
     BinaryOp op = expr->data.binary_op.op;
 
     /* Handle assignment operators separately */
@@ -479,82 +1935,37 @@ LLVMValue* generate_binary_op(CodeGenContext* ctx, ASTNode* expr) {
         return generate_assignment_op(ctx, expr);
     }
 
+    /* Constant subtrees fold at the widths and signedness C gives them */
+    ConstantValue known;
+    if (evaluate_constant_expression(ctx, expr, &known))
+        return llvm_constant((int)known.value, int_type(ctx));
+
     /* Handle logical AND/OR with short-circuit evaluation */
-    if (op == OP_AND || op == OP_OR) {
-        char* cond_bb = get_next_basic_block(ctx);
-        char* second_bb = get_next_basic_block(ctx);
-        char* end_bb = get_next_basic_block(ctx);
-
-        /* First, jump to condition block */
-        emit_instruction(ctx, "br label %%%s", cond_bb);
-
-        /* Condition block - evaluate left side */
-        emit_basic_block_label(ctx, cond_bb);
-        LLVMValue* left = generate_expression(ctx, expr->data.binary_op.left);
-        left = load_value_if_needed(ctx, left);
-        char left_op[MAX_OPERAND_STRING_LENGTH];
-        format_operand(left, left_op, sizeof(left_op));
-
-        char* cond_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = icmp ne i32 %s, 0", cond_reg, left_op);
-
-        if (op == OP_AND) {
-            emit_instruction(ctx, "br i1 %%%s, label %%%s, label %%%s", cond_reg,
-                             second_bb, end_bb);
-        } else {
-            emit_instruction(ctx, "br i1 %%%s, label %%%s, label %%%s", cond_reg,
-                             end_bb, second_bb);
-        }
-
-        emit_basic_block_label(ctx, second_bb);
-        LLVMValue* right = generate_expression(ctx, expr->data.binary_op.right);
-        right = load_value_if_needed(ctx, right);
-        char right_op[MAX_OPERAND_STRING_LENGTH];
-        format_operand(right, right_op, sizeof(right_op));
-
-        char* cond_right_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = icmp ne i32 %s, 0", cond_right_reg,
-                         right_op);
-        emit_instruction(ctx, "br label %%%s", end_bb);
-
-        emit_basic_block_label(ctx, end_bb);
-        /* result = phi [ left_bool, cond_bb ], [ right_bool, second_bb ] */
-        char* result_reg = get_next_register(ctx);
-        char* left_bool_val = (op == OP_AND) ? (char*)"false" : (char*)"true";
-        emit_instruction(ctx,
-                         "%%%s = phi i1 [ %s, %%%s ], [ %%%s, %%%s ]",
-                         result_reg, left_bool_val, cond_bb,
-                         cond_right_reg, second_bb);
-
-        char* final_result_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = zext i1 %%%s to i32", final_result_reg,
-                         result_reg);
-
-        free_llvm_value(left);
-        free_llvm_value(right);
-        free(cond_bb);
-        free(second_bb);
-        free(end_bb);
-        free(cond_reg);
-        free(cond_right_reg);
-        free(result_reg);
-
-        return create_llvm_value(LLVM_VALUE_REGISTER, final_result_reg,
-                                 create_type_info(TYPE_INT));
+    if (op == OP_AND || op == OP_OR)
+        return widen_truth_value(ctx, generate_logical_truth(ctx, expr));
+
+    int signed_ints = has_signed_int_operands(ctx, expr);
+    if (is_comparison_operator(op)) {
+        LLVMValue left, right;
+        if (!generate_comparison_operands(ctx, expr, &left, &right))
+            return llvm_no_value();
+        return generate_comparison_op(
+            ctx, (IRPredicate)get_binary_op_instruction(op), &left, &right,
+            signed_ints);
     }
 
     /* Generate left and right operands */
-    LLVMValue* left = generate_expression(ctx, expr->data.binary_op.left);
-    LLVMValue* right = generate_expression(ctx, expr->data.binary_op.right);
+    LLVMValue left = generate_expression(ctx, expr->data.binary_op.left);
+    LLVMValue right = generate_expression(ctx, expr->data.binary_op.right);
 
-    if (!left || !right) {
-        return NULL;
+    if (left.type == LLVM_VALUE_NONE || right.type == LLVM_VALUE_NONE) {
+        return llvm_no_value();
     }
 
     /* Handle pointer arithmetic before loading values */
     if ((op == OP_ADD || op == OP_SUB) &&
-        ((left->llvm_type && left->llvm_type->base_type == TYPE_POINTER) ||
-         (right->llvm_type && right->llvm_type->base_type == TYPE_POINTER))) {
+        ((left.llvm_type && left.llvm_type->base_type == TYPE_POINTER) ||
+         (right.llvm_type && right.llvm_type->base_type == TYPE_POINTER))) {
         return generate_pointer_arithmetic_op(ctx, op, left, right);
     }
 
@@ -562,69 +1973,26 @@ LLVMValue* generate_binary_op(CodeGenContext* ctx, ASTNode* expr) {
     left = load_value_if_needed(ctx, left);
     right = load_value_if_needed(ctx, right);
 
-    if (!left || !right) {
-        return NULL;
-    }
-
     /* Integer Promotion: Cast types smaller than int to int */
-    if (left->llvm_type && get_type_size(left->llvm_type) < 4) {
-        char* res_reg = get_next_register(ctx);
-        char op_str[MAX_OPERAND_STRING_LENGTH];
-        format_operand(left, op_str, sizeof(op_str));
-        char* type_str = llvm_type_to_string(left->llvm_type);
-
-        emit_instruction(ctx, "%%%s = sext %s %s to i32", res_reg, type_str, op_str);
-
-        free(type_str);
-        TypeInfo* new_type = create_type_info(TYPE_INT);
-        /* Preserve is_lvalue? result of cast is rvalue */
-        /* Free old left wrapper but keep its register name if it was register?
-           format_operand uses name. left->name is strdup'd.
-           free_llvm_value frees name. */
-        free_llvm_value(left);
-        left = create_llvm_value(LLVM_VALUE_REGISTER, res_reg, new_type);
+    if (left.llvm_type && get_type_size(ctx, left.llvm_type) < 4) {
+        left = promote_to_int(ctx, left);
     }
-
-    if (right->llvm_type && get_type_size(right->llvm_type) < 4) {
-        char* res_reg = get_next_register(ctx);
-        char op_str[MAX_OPERAND_STRING_LENGTH];
-        format_operand(right, op_str, sizeof(op_str));
-        char* type_str = llvm_type_to_string(right->llvm_type);
-
-        emit_instruction(ctx, "%%%s = sext %s %s to i32", res_reg, type_str, op_str);
-
-        free(type_str);
-        TypeInfo* new_type = create_type_info(TYPE_INT);
-        free_llvm_value(right);
-        right = create_llvm_value(LLVM_VALUE_REGISTER, res_reg, new_type);
+    if (right.llvm_type && get_type_size(ctx, right.llvm_type) < 4) {
+        right = promote_to_int(ctx, right);
     }
 
-    /* Get instruction name for the operator */
-    const char* op_name = get_binary_op_instruction(op);
-    if (!op_name) {
+    /* Get the IR operation for the operator */
+    int ir_op = get_binary_op_instruction(op);
+    if (ir_op < 0) {
         codegen_error(ctx, "Unsupported binary operator: %d", op);
-        free_llvm_value(left);
-        free_llvm_value(right);
-        return NULL;
-    }
-
-    LLVMValue* result;
-
-    /* Handle comparison vs arithmetic operations */
-    if (is_comparison_operator(op)) {
-        result = generate_comparison_op(ctx, op_name, left, right);
-    } else {
-        result = generate_arithmetic_op(ctx, op_name, left, right);
+        return llvm_no_value();
     }
 
-    /* Cleanup operands */
-    free_llvm_value(left);
-    free_llvm_value(right);
-
-    return result;
+    return generate_arithmetic_op(ctx, (IRBinaryOp)ir_op, &left, &right,
+                                  signed_ints);
 }
 
-LLVMValue* generate_assignment_op(CodeGenContext* ctx, ASTNode* expr) {
+LLVMValue generate_assignment_op(CodeGenContext* ctx, ASTNode* expr) {
     ASTNode* left_node = expr->data.binary_op.left;
     ASTNode* right_node = expr->data.binary_op.right;
     BinaryOp op = expr->data.binary_op.op;
@@ -633,90 +2001,71 @@ LLVMValue* generate_assignment_op(CodeGenContext* ctx, ASTNode* expr) {
     if (left_node->type == AST_ARRAY_ACCESS) {
         if (op != OP_ASSIGN) {
             codegen_error(ctx, "Compound assignment to array elements not yet supported");
-            return NULL;
+            return llvm_no_value();
         }
 
         ASTNode* array_node = left_node->data.array_access.array;
         ASTNode* index_node = left_node->data.array_access.index;
 
         /* Generate right-hand side value */
-        LLVMValue* right_value = generate_expression(ctx, right_node);
-        if (!right_value) return NULL;
+        LLVMValue right_value = generate_expression(ctx, right_node);
+        if (right_value.type == LLVM_VALUE_NONE) return right_value;
         right_value = load_value_if_needed(ctx, right_value);
-        if (!right_value) return NULL;
 
         /* Generate array base address */
-        LLVMValue* array_value = generate_expression(ctx, array_node);
-        if (!array_value) {
-            free_llvm_value(right_value);
-            return NULL;
-        }
+        LLVMValue array_value = generate_expression(ctx, array_node);
+        if (array_value.type == LLVM_VALUE_NONE) return array_value;
 
         /* Generate index */
-        LLVMValue* index_value = generate_expression(ctx, index_node);
-        if (!index_value) {
-            free_llvm_value(right_value);
-            free_llvm_value(array_value);
-            return NULL;
-        }
+        LLVMValue index_value = generate_expression(ctx, index_node);
+        if (index_value.type == LLVM_VALUE_NONE) return index_value;
         index_value = load_value_if_needed(ctx, index_value);
 
         /* Get element pointer using getelementptr */
-        char* gep_reg = get_next_register(ctx);
-        char index_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(index_value, index_operand, sizeof(index_operand));
+        int gep_reg = get_next_register(ctx);
 
         /* Determine element type */
+        TypeInfo* array_type = array_value.llvm_type;
         TypeInfo* element_type = NULL;
-        if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_POINTER) {
-            element_type = array_value->llvm_type->return_type;
-        } else if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_ARRAY) {
-            element_type = array_value->llvm_type->return_type;
+        if (array_type && (array_type->base_type == TYPE_POINTER ||
+                           array_type->base_type == TYPE_ARRAY)) {
+            element_type = array_type->return_type;
         }
         if (!element_type) {
-            element_type = create_type_info(TYPE_INT);
+            element_type = canonical_basic_type(ctx, TYPE_INT);
         }
 
-        char* element_type_str = llvm_type_to_string(element_type);
-        char* pointer_type_str = llvm_type_to_string(array_value->llvm_type);
-
-        char array_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(array_value, array_operand, sizeof(array_operand));
-
-        if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_ARRAY) {
-            emit_instruction(ctx, "%%%s = getelementptr %s, %s* %s, i32 0, i32 %s",
-                             gep_reg, pointer_type_str, pointer_type_str,
-                             array_operand, index_operand);
-        } else if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_POINTER &&
-                   array_value->llvm_type->return_type &&
-                   array_value->llvm_type->return_type->base_type == TYPE_ARRAY) {
+        TypeInfo* element = canonical_type(ctx, element_type);
+        TypeInfo* element_pointer = canonical_pointer_type(ctx, element_type);
+        IRValue gep_result = ir_register(gep_reg, element_pointer);
+        IRValue indices[2] = {ir_constant(0, int_type(ctx)),
+                              ir_operand(&index_value, int_type(ctx))};
+
+        if (array_type && array_type->base_type == TYPE_ARRAY) {
+            ir_build_gep(&ctx->builder, gep_result,
+                         canonical_type(ctx, array_type),
+                         ir_operand(&array_value,
+                                    canonical_pointer_type(ctx, array_type)),
+                         indices, 2);
+        } else if (array_type && array_type->base_type == TYPE_POINTER &&
+                   array_type->return_type &&
+                   array_type->return_type->base_type == TYPE_ARRAY) {
             /* Pointer to array: decay to pointer to first element (GEP 0, index) */
-            emit_instruction(ctx, "%%%s = getelementptr %s, %s %s, i32 0, i32 %s",
-                             gep_reg, element_type_str, pointer_type_str,
-                             array_operand, index_operand);
+            ir_build_gep(&ctx->builder, gep_result, element,
+                         ir_operand(&array_value,
+                                    canonical_type(ctx, array_type)),
+                         indices, 2);
         } else {
-            emit_instruction(ctx, "%%%s = getelementptr %s, %s %s, i32 %s",
-                             gep_reg, element_type_str, pointer_type_str,
-                             array_operand, index_operand);
+            ir_build_gep(&ctx->builder, gep_result, element,
+                         ir_operand(&array_value,
+                                    canonical_type(ctx, array_type)),
+                         indices + 1, 1);
         }
 
         /* Store the value */
-        char right_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(right_value, right_operand, sizeof(right_operand));
-
-        TypeInfo* ptr_to_element = create_pointer_type(duplicate_type_info(element_type));
-        char* ptr_type_str = llvm_type_to_string(ptr_to_element);
+        ir_build_store(&ctx->builder, element, ir_operand(&right_value, NULL),
+                       gep_result);
 
-        emit_instruction(ctx, "store %s %s, %s %%%s",
-                         element_type_str, right_operand, ptr_type_str, gep_reg);
-
-        free(element_type_str);
-        free(pointer_type_str);
-        free(ptr_type_str);
-        free_type_info(ptr_to_element);
-        free(gep_reg);
-        free_llvm_value(array_value);
-        free_llvm_value(index_value);
 
         /* Return the stored value */
         return right_value;
@@ -724,649 +2073,433 @@ LLVMValue* generate_assignment_op(CodeGenContext* ctx, ASTNode* expr) {
 
     if (left_node->type != AST_IDENTIFIER) {
         codegen_error(ctx, "Left side of assignment must be a variable");
-        return NULL;
+        return llvm_no_value();
     }
 
     Symbol* symbol = lookup_symbol(ctx, left_node->data.identifier.name);
     if (!symbol) {
         codegen_error(ctx, "Undefined variable: %s",
                       left_node->data.identifier.name);
-        return NULL;
+        return llvm_no_value();
     }
 
-    LLVMValue* right_value = generate_expression(ctx, right_node);
-    if (!right_value)
-        return NULL;
+    LLVMValue right_value = generate_expression(ctx, right_node);
+    if (right_value.type == LLVM_VALUE_NONE)
+        return right_value;
 
     right_value = load_value_if_needed(ctx, right_value);
-    if (!right_value)
-        return NULL;
 
-    char right_operand[MAX_OPERAND_STRING_LENGTH];
-    format_operand(right_value, right_operand, sizeof(right_operand));
-
-    char* value_type_str = llvm_type_to_string(symbol->type);
-    TypeInfo* pointer_type_info =
-        create_pointer_type(duplicate_type_info(symbol->type));
-    char* pointer_type_str = llvm_type_to_string(pointer_type_info);
+    IRValue right_operand = ir_operand(&right_value, NULL);
+    TypeInfo* value_type = canonical_type(ctx, symbol->type);
+    TypeInfo* pointer_type = canonical_pointer_type(ctx, symbol->type);
+    IRValue address = ir_address(symbol, NULL, pointer_type);
 
     if (op == OP_ASSIGN) {
         /* If converting to bool, use icmp ne 0 */
         if (symbol->type->base_type == TYPE_BOOL &&
-            right_value->llvm_type &&
-            right_value->llvm_type->base_type != TYPE_BOOL) {
+            right_value.llvm_type &&
+            right_value.llvm_type->base_type != TYPE_BOOL) {
 
-            char* cmp_reg = get_next_register(ctx);
-            emit_instruction(ctx, "%%%s = icmp ne i32 %s, 0", cmp_reg, right_operand);
+            int cmp_reg = build_int_compare(ctx, IR_ICMP_NE, right_operand,
+                                            ir_constant(0, int_type(ctx)));
 
             /* Update operand to use the bool result */
-            snprintf(right_operand, sizeof(right_operand), "%%%s", cmp_reg);
-
-            /* Add to cleanup list? No need, cmp_reg string is managed by us or get_next_register */
-            free(cmp_reg);
+            right_operand = ir_register(cmp_reg, value_type);
         }
 
-        if (symbol->is_global) {
-            emit_instruction(ctx, "store %s %s, %s @%s", value_type_str,
-                             right_operand, pointer_type_str, symbol->name);
-        } else {
-            emit_instruction(ctx, "store %s %s, %s %%%s", value_type_str,
-                             right_operand, pointer_type_str, symbol->name);
-        }
+        ir_build_store(&ctx->builder, value_type, right_operand, address);
 
-        free(value_type_str);
-        free(pointer_type_str);
-        free_type_info(pointer_type_info);
-        free_llvm_value(right_value);
 
-        TypeInfo* location_type =
-            create_pointer_type(duplicate_type_info(symbol->type));
-        LLVMValue* location_value =
-            create_llvm_value(symbol->is_global ? LLVM_VALUE_GLOBAL
-                                                : LLVM_VALUE_REGISTER,
-                              symbol->name, location_type);
+        LLVMValue location_value =
+            llvm_value(symbol->is_global ? LLVM_VALUE_GLOBAL
+                                         : LLVM_VALUE_REGISTER,
+                       0, storage_name(symbol), pointer_type);
         return load_value_if_needed(ctx, location_value);
     }
 
-    const char* op_name = NULL;
+    IRBinaryOp ir_op;
     switch (op) {
     case OP_ADD_ASSIGN:
-        op_name = "add";
+        ir_op = IR_ADD;
         break;
     case OP_SUB_ASSIGN:
-        op_name = "sub";
+        ir_op = IR_SUB;
         break;
     case OP_MUL_ASSIGN:
-        op_name = "mul";
+        ir_op = IR_MUL;
         break;
     case OP_DIV_ASSIGN:
-        op_name = "sdiv";
+        ir_op = IR_SDIV;
         break;
     case OP_MOD_ASSIGN:
-        op_name = "srem";
+        ir_op = IR_SREM;
         break;
     case OP_AND_ASSIGN:
-        op_name = "and";
+        ir_op = IR_AND;
         break;
     case OP_OR_ASSIGN:
-        op_name = "or";
+        ir_op = IR_OR;
         break;
     case OP_XOR_ASSIGN:
-        op_name = "xor";
+        ir_op = IR_XOR;
         break;
     case OP_LSHIFT_ASSIGN:
-        op_name = "shl";
+        ir_op = IR_SHL;
         break;
     case OP_RSHIFT_ASSIGN:
-        op_name = "ashr";
+        ir_op = IR_ASHR;
         break;
     default:
         codegen_error(ctx, "Unsupported assignment operator: %d", op);
-        free(value_type_str);
-        free(pointer_type_str);
-        free_type_info(pointer_type_info);
-        free_llvm_value(right_value);
-        return NULL;
-    }
-
-    char* load_reg = get_next_register(ctx);
-    if (symbol->is_global) {
-        emit_instruction(ctx, "%%%s = load %s, %s @%s", load_reg,
-                         value_type_str, pointer_type_str, symbol->name);
-    } else {
-        emit_instruction(ctx, "%%%s = load %s, %s %%%s", load_reg,
-                         value_type_str, pointer_type_str, symbol->name);
+        return llvm_no_value();
     }
 
-    char* result_reg = get_next_register(ctx);
-    emit_instruction(ctx, "%%%s = %s %s %%%s, %s", result_reg, op_name,
-                     value_type_str, load_reg, right_operand);
-
-    char result_operand[MAX_OPERAND_STRING_LENGTH];
-    snprintf(result_operand, sizeof(result_operand), "%%%s", result_reg);
+    int load_reg = build_load(ctx, value_type, address);
 
-    if (symbol->is_global) {
-        emit_instruction(ctx, "store %s %s, %s @%s", value_type_str,
-                         result_operand, pointer_type_str, symbol->name);
-    } else {
-        emit_instruction(ctx, "store %s %s, %s %%%s", value_type_str,
-                         result_operand, pointer_type_str, symbol->name);
-    }
-
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                                          duplicate_type_info(symbol->type));
+    int result_reg = get_next_register(ctx);
+    IRValue result = ir_register(result_reg, value_type);
+    ir_build_binary(&ctx->builder, ir_op, result, value_type,
+                    ir_register(load_reg, value_type), right_operand);
 
-    free(value_type_str);
-    free(pointer_type_str);
-    free_type_info(pointer_type_info);
-    free(load_reg);
-    free(result_reg);
-    free_llvm_value(right_value);
+    ir_build_store(&ctx->builder, value_type, result, address);
 
-    return result;
+    return llvm_register(result_reg, value_type);
 }
 
 /* Helper functions for unary operations */
-static LLVMValue* generate_arithmetic_unary_op(CodeGenContext* ctx,
-                                               const LLVMValue* operand,
-                                               LLVMValue* result, UnaryOp op) {
-    const char* operand_str = operand->name;
+static LLVMValue generate_arithmetic_unary_op(CodeGenContext* ctx,
+                                              const LLVMValue* operand,
+                                              UnaryOp op) {
+    IRBuilder* builder = &ctx->builder;
+    TypeInfo* type = int_type(ctx);
+    LLVMValue result = llvm_register(get_next_register(ctx), type);
+    IRValue value = ir_operand(operand, type);
+    IRValue zero = ir_constant(0, type);
 
     switch (op) {
     case UOP_PLUS:
         /* Unary plus is a no-op */
-        if (operand->type == LLVM_VALUE_CONSTANT) {
-            emit_instruction(ctx, "%%%s = add i32 0, %s", result->name,
-                             operand_str);
-        } else {
-            emit_instruction(ctx, "%%%s = add i32 0, %%%s", result->name,
-                             operand_str);
-        }
+        ir_build_binary(builder, IR_ADD, ir_register(result.id, type), type,
+                        zero, value);
         break;
     case UOP_MINUS:
-        if (operand->type == LLVM_VALUE_CONSTANT) {
-            emit_instruction(ctx, "%%%s = sub i32 0, %s", result->name,
-                             operand_str);
-        } else {
-            emit_instruction(ctx, "%%%s = sub i32 0, %%%s", result->name,
-                             operand_str);
-        }
+        ir_build_binary(builder, IR_SUB, ir_register(result.id, type), type,
+                        zero, value);
         break;
     case UOP_NOT:
         /* Generate icmp which returns i1, then zext to i32 */
-        if (operand->type == LLVM_VALUE_CONSTANT) {
-            emit_instruction(ctx, "%%%s = icmp eq i32 %s, 0", result->name,
-                             operand_str);
-        } else {
-            emit_instruction(ctx, "%%%s = icmp eq i32 %%%s, 0", result->name,
-                             operand_str);
-        }
-        /* Convert i1 result to i32 */
         {
-            char* zext_reg = get_next_register(ctx);
-            emit_instruction(ctx, "%%%s = zext i1 %%%s to i32", zext_reg, result->name);
-            /* Free the old name and update to use the zexted value */
-            free(result->name);
-            result->name = zext_reg;
+            TypeInfo* bool_type = canonical_basic_type(ctx, TYPE_BOOL);
+            ir_build_icmp(builder, IR_ICMP_EQ,
+                          ir_register(result.id, bool_type), type, value,
+                          zero);
+            /* Convert i1 result to i32 */
+            result.id = build_cast(ctx, IR_ZEXT,
+                                   ir_register(result.id, bool_type), type);
         }
         break;
     case UOP_BITNOT:
-        if (operand->type == LLVM_VALUE_CONSTANT) {
-            emit_instruction(ctx, "%%%s = xor i32 %s, -1", result->name,
-                             operand_str);
-        } else {
-            emit_instruction(ctx, "%%%s = xor i32 %%%s, -1", result->name,
-                             operand_str);
-        }
+        ir_build_binary(builder, IR_XOR, ir_register(result.id, type), type,
+                        value, ir_constant(-1, type));
         break;
     default:
-        return NULL;
+        return llvm_no_value();
     }
     return result;
 }
 
-static LLVMValue* generate_increment_decrement_op(CodeGenContext* ctx,
-                                                  LLVMValue* operand,
-                                                  LLVMValue* result,
-                                                  UnaryOp op) {
+static LLVMValue generate_increment_decrement_op(CodeGenContext* ctx,
+                                                 const LLVMValue* operand,
+                                                 UnaryOp op) {
     if (operand->type == LLVM_VALUE_CONSTANT) {
         codegen_error(ctx, "Cannot increment/decrement constant");
-        return NULL;
-    }
-
-    char* load_reg = get_next_register(ctx);
-    char* mod_reg = get_next_register(ctx);
-    const char* operation =
-        (op == UOP_PREINC || op == UOP_POSTINC) ? "add" : "sub";
-
-    switch (op) {
-    case UOP_PREINC:
-    case UOP_PREDEC:
-        /* Pre-increment/decrement: modify then return new value */
-        emit_instruction(ctx, "%%%s = load i32, i32* %%%s", load_reg,
-                         operand->name);
-        emit_instruction(ctx, "%%%s = %s i32 %%%s, 1", mod_reg, operation,
-                         load_reg);
-        emit_instruction(ctx, "store i32 %%%s, i32* %%%s", mod_reg,
-                         operand->name);
-        emit_instruction(ctx, "%%%s = add i32 %%%s, 0", result->name, mod_reg);
-        break;
-    case UOP_POSTINC:
-    case UOP_POSTDEC:
-        /* Post-increment/decrement: return old value then modify */
-        emit_instruction(ctx, "%%%s = load i32, i32* %%%s", result->name,
-                         operand->name);
-        emit_instruction(ctx, "%%%s = %s i32 %%%s, 1", mod_reg, operation,
-                         result->name);
-        emit_instruction(ctx, "store i32 %%%s, i32* %%%s", mod_reg,
-                         operand->name);
-        break;
-    default:
-        free(load_reg);
-        free(mod_reg);
-        return NULL;
+        return llvm_no_value();
     }
 
-    free(load_reg);
-    free(mod_reg);
-    return result;
+    IRBuilder* builder = &ctx->builder;
+    TypeInfo* type = int_type(ctx);
+    IRBinaryOp operation =
+        (op == UOP_PREINC || op == UOP_POSTINC) ? IR_ADD : IR_SUB;
+    IRValue address = ir_operand(operand, canonical_pointer_type(ctx, type));
+
+    /* The old value, then the new one; pre- forms yield the new value */
+    int load_reg = get_next_register(ctx);
+    ir_build_load(builder, ir_register(load_reg, type), type, address);
+    int mod_reg = get_next_register(ctx);
+    IRValue modified = ir_register(mod_reg, type);
+    ir_build_binary(builder, operation, modified, type,
+                    ir_register(load_reg, type), ir_constant(1, type));
+    ir_build_store(builder, type, modified, address);
+
+    int is_prefix = op == UOP_PREINC || op == UOP_PREDEC;
+    return llvm_register(is_prefix ? mod_reg : load_reg, type);
 }
 
-static LLVMValue* generate_address_deref_op(CodeGenContext* ctx,
-                                            LLVMValue* operand,
-                                            LLVMValue* result, UnaryOp op) {
+static LLVMValue generate_address_deref_op(CodeGenContext* ctx,
+                                           LLVMValue operand, UnaryOp op) {
     switch (op) {
     case UOP_ADDR: {
-        Symbol* symbol = lookup_symbol(ctx, operand->name);
+        Symbol* symbol =
+            operand.name ? lookup_storage(ctx, operand.name) : NULL;
         if (!symbol) {
             codegen_error(ctx, "Cannot take address of unknown symbol");
-            return NULL;
+            return llvm_no_value();
         }
 
-        free_llvm_value(result);
-        TypeInfo* pointer_type =
-            create_pointer_type(duplicate_type_info(symbol->type));
-        LLVMValue* address_value =
-            create_llvm_value(symbol->is_global ? LLVM_VALUE_GLOBAL
-                                                : LLVM_VALUE_REGISTER,
-                              symbol->name, pointer_type);
-        return address_value;
+        return llvm_value(symbol->is_global ? LLVM_VALUE_GLOBAL
+                                            : LLVM_VALUE_REGISTER,
+                          0, storage_name(symbol),
+                          canonical_pointer_type(ctx, symbol->type));
     }
     case UOP_DEREF: {
-        LLVMValue* operand_source = operand;
         operand = ensure_pointer_value(ctx, operand);
-        bool operand_replaced = (operand != operand_source);
 
-        if (!operand || !operand->llvm_type ||
-            operand->llvm_type->base_type != TYPE_POINTER) {
+        TypeInfo* pointer_type = operand.llvm_type;
+        if (!pointer_type || pointer_type->base_type != TYPE_POINTER) {
             codegen_error(ctx, "Cannot dereference non-pointer type");
-            if (operand_replaced) {
-                free_llvm_value(operand);
-            }
-            return NULL;
+            return llvm_no_value();
         }
 
-        TypeInfo* pointee_type =
-            duplicate_type_info(operand->llvm_type->return_type);
-
-        char* pointee_type_str =
-            llvm_type_to_string(operand->llvm_type->return_type);
-        char* pointer_type_str = llvm_type_to_string(operand->llvm_type);
+        TypeInfo* pointee_type = canonical_type(ctx, pointer_type->return_type);
+        LLVMValue result = llvm_register(get_next_register(ctx),
+                                         pointer_type->return_type);
 
-        free_type_info(result->llvm_type);
-        result->llvm_type = pointee_type;
+        ir_build_load(&ctx->builder, ir_register(result.id, pointee_type),
+                      pointee_type,
+                      ir_operand(&operand, canonical_type(ctx, pointer_type)));
 
-        char operand_str[MAX_OPERAND_STRING_LENGTH];
-        format_operand(operand, operand_str, sizeof(operand_str));
-
-        emit_instruction(ctx, "%%%s = load %s, %s %s", result->name,
-                         pointee_type_str, pointer_type_str, operand_str);
-
-        free(pointee_type_str);
-        free(pointer_type_str);
-        if (operand_replaced) {
-            free_llvm_value(operand);
-        }
-        return result;
-    }
-    case UOP_SIZEOF: {
-        int size = INT_SIZE_BYTES;
-        if (operand->llvm_type) {
-            size = get_type_size(operand->llvm_type);
-        }
-        emit_instruction(ctx, "%%%s = add i32 0, %d", result->name, size);
         return result;
     }
     default:
-        return NULL;
+        return llvm_no_value();
     }
 }
 
-LLVMValue* generate_pointer_arithmetic_op(CodeGenContext* ctx, BinaryOp op,
-                                          LLVMValue* left, LLVMValue* right) {
-    bool left_is_pointer =
-        (left->llvm_type && left->llvm_type->base_type == TYPE_POINTER);
-    bool right_is_pointer =
-        (right->llvm_type && right->llvm_type->base_type == TYPE_POINTER);
+/* getelementptr of pointer_value by index_value, typed like the pointer */
+static LLVMValue emit_pointer_offset(CodeGenContext* ctx,
+                                     const LLVMValue* pointer_value,
+                                     const LLVMValue* index_value) {
+    TypeInfo* pointer_type = pointer_value->llvm_type;
+    int result_reg = get_next_register(ctx);
+    IRValue index = ir_operand(index_value, int_type(ctx));
+
+    ir_build_gep(&ctx->builder,
+                 ir_register(result_reg, canonical_type(ctx, pointer_type)),
+                 canonical_type(ctx, pointer_type->return_type),
+                 ir_operand(pointer_value, canonical_type(ctx, pointer_type)),
+                 &index, 1);
+
+    return llvm_register(result_reg, pointer_type);
+}
+
+static int is_pointer_value(const LLVMValue* value) {
+    return value->llvm_type && value->llvm_type->base_type == TYPE_POINTER;
+}
 
-    if (op == OP_ADD && (left_is_pointer || right_is_pointer)) {
-        LLVMValue* pointer_value = left_is_pointer ? left : right;
-        LLVMValue* pointer_source = pointer_value;
-        pointer_value = ensure_pointer_value(ctx, pointer_value);
-        if (pointer_value != pointer_source) {
-            free_llvm_value(pointer_source);
-        }
+LLVMValue generate_pointer_arithmetic_op(CodeGenContext* ctx, BinaryOp op,
+                                         LLVMValue left, LLVMValue right) {
+    bool left_is_pointer = is_pointer_value(&left);
+    bool right_is_pointer = is_pointer_value(&right);
 
-        LLVMValue* index_value = left_is_pointer ? right : left;
-        LLVMValue* index_source = index_value;
-        index_value = load_value_if_needed(ctx, index_value);
-        if (index_value != index_source) {
-            free_llvm_value(index_source);
-        }
-        index_value = ensure_integer_register(ctx, index_value);
+    if (op == OP_ADD && (left_is_pointer || right_is_pointer)) {
+        LLVMValue pointer_value =
+            ensure_pointer_value(ctx, left_is_pointer ? left : right);
+        LLVMValue index_value =
+            load_value_if_needed(ctx, left_is_pointer ? right : left);
 
-        if (!pointer_value || !pointer_value->llvm_type ||
-            pointer_value->llvm_type->base_type != TYPE_POINTER) {
+        if (!is_pointer_value(&pointer_value)) {
             codegen_error(ctx, "Pointer arithmetic requires pointer operand");
-            free_llvm_value(pointer_value);
-            free_llvm_value(index_value);
-            return NULL;
+            return llvm_no_value();
         }
 
-        char pointer_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(pointer_value, pointer_operand, sizeof(pointer_operand));
-
-        char index_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(index_value, index_operand, sizeof(index_operand));
-
-        char* result_reg = get_next_register(ctx);
-        LLVMValue* result =
-            create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                              duplicate_type_info(pointer_value->llvm_type));
-
-        char* element_type_str =
-            llvm_type_to_string(pointer_value->llvm_type->return_type);
-        char* pointer_type_str = llvm_type_to_string(pointer_value->llvm_type);
-
-        emit_instruction(ctx, "%%%s = getelementptr %s, %s %s, i32 %s",
-                         result->name, element_type_str, pointer_type_str,
-                         pointer_operand, index_operand);
-
-        free(element_type_str);
-        free(pointer_type_str);
-        free(result_reg);
-        free_llvm_value(pointer_value);
-        free_llvm_value(index_value);
-        return result;
+        return emit_pointer_offset(ctx, &pointer_value, &index_value);
     }
 
     if (op == OP_SUB && left_is_pointer && !right_is_pointer) {
-        LLVMValue* pointer_source = left;
-        LLVMValue* pointer_value = ensure_pointer_value(ctx, left);
-        if (pointer_value != pointer_source) {
-            free_llvm_value(pointer_source);
-        }
-
-        LLVMValue* index_source = right;
-        LLVMValue* index_value = load_value_if_needed(ctx, right);
-        if (index_value != index_source) {
-            free_llvm_value(index_source);
-        }
-        index_value = ensure_integer_register(ctx, index_value);
+        LLVMValue pointer_value = ensure_pointer_value(ctx, left);
+        LLVMValue index_value = load_value_if_needed(ctx, right);
 
-        if (!pointer_value || !pointer_value->llvm_type ||
-            pointer_value->llvm_type->base_type != TYPE_POINTER) {
+        if (!is_pointer_value(&pointer_value)) {
             codegen_error(ctx, "Pointer subtraction requires pointer operand");
-            free_llvm_value(pointer_value);
-            free_llvm_value(index_value);
-            return NULL;
+            return llvm_no_value();
         }
 
-        char* neg_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = sub i32 0, %%%s", neg_reg,
-                         index_value->name);
-        LLVMValue* neg_value = create_llvm_value(LLVM_VALUE_REGISTER, neg_reg,
-                                                 create_type_info(TYPE_INT));
-        free(neg_reg);
-        free_llvm_value(index_value);
-        index_value = neg_value;
-
-        char pointer_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(pointer_value, pointer_operand, sizeof(pointer_operand));
-
-        char index_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(index_value, index_operand, sizeof(index_operand));
-
-        char* result_reg = get_next_register(ctx);
-        LLVMValue* result =
-            create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                              duplicate_type_info(pointer_value->llvm_type));
-
-        char* element_type_str =
-            llvm_type_to_string(pointer_value->llvm_type->return_type);
-        char* pointer_type_str = llvm_type_to_string(pointer_value->llvm_type);
-
-        emit_instruction(ctx, "%%%s = getelementptr %s, %s %s, i32 %s",
-                         result->name, element_type_str, pointer_type_str,
-                         pointer_operand, index_operand);
+        LLVMValue neg_value;
+        if (is_constant(&index_value)) {
+            neg_value = llvm_constant((int)(0u - (unsigned)index_value.id),
+                                      int_type(ctx));
+        } else {
+            int neg_reg = build_int_binary(
+                ctx, IR_SUB, ir_constant(0, int_type(ctx)),
+                ir_operand(&index_value, int_type(ctx)));
+            neg_value = llvm_register(neg_reg, int_type(ctx));
+        }
 
-        free(element_type_str);
-        free(pointer_type_str);
-        free(result_reg);
-        free_llvm_value(pointer_value);
-        free_llvm_value(index_value);
-        return result;
+        return emit_pointer_offset(ctx, &pointer_value, &neg_value);
     }
 
     if (op == OP_SUB && left_is_pointer && right_is_pointer) {
-        LLVMValue* left_source = left;
-        LLVMValue* left_pointer = ensure_pointer_value(ctx, left);
-        if (left_pointer != left_source) {
-            free_llvm_value(left_source);
-        }
-
-        LLVMValue* right_source = right;
-        LLVMValue* right_pointer = ensure_pointer_value(ctx, right);
-        if (right_pointer != right_source) {
-            free_llvm_value(right_source);
-        }
+        LLVMValue left_pointer = ensure_pointer_value(ctx, left);
+        LLVMValue right_pointer = ensure_pointer_value(ctx, right);
 
-        if (!left_pointer || !right_pointer || !left_pointer->llvm_type ||
-            left_pointer->llvm_type->base_type != TYPE_POINTER ||
-            !right_pointer->llvm_type ||
-            right_pointer->llvm_type->base_type != TYPE_POINTER) {
+        if (!is_pointer_value(&left_pointer) ||
+            !is_pointer_value(&right_pointer)) {
             codegen_error(ctx, "Pointer difference requires pointer operands");
-            free_llvm_value(left_pointer);
-            free_llvm_value(right_pointer);
-            return NULL;
+            return llvm_no_value();
         }
 
-        char left_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(left_pointer, left_operand, sizeof(left_operand));
-
-        char right_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(right_pointer, right_operand, sizeof(right_operand));
-
-        char* pointer_type_str = llvm_type_to_string(left_pointer->llvm_type);
+        IRBuilder* builder = &ctx->builder;
+        TypeInfo* pointer_type = left_pointer.llvm_type;
+        TypeInfo* long_type = canonical_basic_type(ctx, TYPE_LONG);
 
-        char* left_int_reg = get_next_register(ctx);
-        char* right_int_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = ptrtoint %s %s to i64", left_int_reg,
-                         pointer_type_str, left_operand);
-        emit_instruction(ctx, "%%%s = ptrtoint %s %s to i64", right_int_reg,
-                         pointer_type_str, right_operand);
+        int left_int_reg = get_next_register(ctx);
+        int right_int_reg = get_next_register(ctx);
+        IRValue left_int = ir_register(left_int_reg, long_type);
+        IRValue right_int = ir_register(right_int_reg, long_type);
+        ir_build_cast(builder, IR_PTRTOINT, left_int,
+                      ir_operand(&left_pointer, pointer_type), long_type);
+        ir_build_cast(builder, IR_PTRTOINT, right_int,
+                      ir_operand(&right_pointer, pointer_type), long_type);
 
-        char* diff_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = sub i64 %%%s, %%%s", diff_reg,
-                         left_int_reg, right_int_reg);
+        int diff_reg = get_next_register(ctx);
+        IRValue diff = ir_register(diff_reg, long_type);
+        ir_build_binary(builder, IR_SUB, diff, long_type, left_int, right_int);
 
-        int elem_size = get_type_size(left_pointer->llvm_type->return_type);
+        int elem_size = get_type_size(ctx, left_pointer.llvm_type->return_type);
         if (elem_size <= 0)
             elem_size = 1;
 
-        char* quotient_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = sdiv i64 %%%s, %d", quotient_reg,
-                         diff_reg, elem_size);
-
-        char* trunc_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = trunc i64 %%%s to i32", trunc_reg,
-                         quotient_reg);
-
-        LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, trunc_reg,
-                                              create_type_info(TYPE_INT));
-
-        free(pointer_type_str);
-        free(left_int_reg);
-        free(right_int_reg);
-        free(diff_reg);
-        free(quotient_reg);
-        free(trunc_reg);
-        free_llvm_value(left_pointer);
-        free_llvm_value(right_pointer);
-        return result;
+        int quotient_reg = get_next_register(ctx);
+        IRValue quotient = ir_register(quotient_reg, long_type);
+        ir_build_binary(builder, IR_SDIV, quotient, long_type, diff,
+                        ir_constant(elem_size, long_type));
+
+        int trunc_reg = build_cast(ctx, IR_TRUNC, quotient, int_type(ctx));
+
+        return llvm_register(trunc_reg, int_type(ctx));
     }
 
     codegen_error(ctx, "Unsupported pointer arithmetic operation");
-    free_llvm_value(left);
-    free_llvm_value(right);
-    return NULL;
+    return llvm_no_value();
 }
 
-LLVMValue* generate_conditional_op(CodeGenContext* ctx, ASTNode* expr) {
-    /* Generate condition */
-    LLVMValue* condition = generate_expression(ctx, expr->data.conditional_expr.condition);
-    if (!condition)
-        return NULL;
+LLVMValue generate_conditional_op(CodeGenContext* ctx, ASTNode* expr) {
+    ASTNode* condition = expr->data.conditional_expr.condition;
 
-    condition = load_value_if_needed(ctx, condition);
-    char cond_operand[MAX_OPERAND_STRING_LENGTH];
-    format_operand(condition, cond_operand, sizeof(cond_operand));
+    /* A constant condition evaluates only the arm it selects */
+    ConstantValue known;
+    if (evaluate_constant_expression(ctx, condition, &known)) {
+        ASTNode* arm = known.value != 0 ? expr->data.conditional_expr.then_expr
+                                        : expr->data.conditional_expr.else_expr;
+        return load_value_if_needed(ctx, generate_expression(ctx, arm));
+    }
 
     /* Create basic blocks */
-    char* then_bb = get_next_basic_block(ctx);
-    char* else_bb = get_next_basic_block(ctx);
-    char* end_bb = get_next_basic_block(ctx);
+    int then_bb = get_next_basic_block(ctx);
+    int else_bb = get_next_basic_block(ctx);
+    int end_bb = get_next_basic_block(ctx);
 
     /* Evaluate condition and branch */
-    /* Evaluate condition and branch */
-    char* cmp_reg = NULL;
-    if (condition->llvm_type && condition->llvm_type->base_type == TYPE_BOOL) {
-        emit_instruction(ctx, "br i1 %s, label %%%s, label %%%s", cond_operand, then_bb, else_bb);
-    } else {
-        cmp_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = icmp ne i32 %s, 0", cmp_reg, cond_operand);
-        emit_instruction(ctx, "br i1 %%%s, label %%%s, label %%%s", cmp_reg, then_bb, else_bb);
-    }
+    generate_condition_branch(ctx, condition, then_bb, else_bb);
 
-    /* Then block - compute true value */
-    emit_basic_block_label(ctx, then_bb);
-    LLVMValue* then_val = generate_expression(ctx, expr->data.conditional_expr.then_expr);
+    /* Then block - compute true value; the arms may end in blocks of their
+     * own */
+    ir_builder_set_block(&ctx->builder, then_bb);
+    LLVMValue then_val = generate_expression(ctx, expr->data.conditional_expr.then_expr);
     then_val = load_value_if_needed(ctx, then_val);
-    char then_operand[MAX_OPERAND_STRING_LENGTH];
-    format_operand(then_val, then_operand, sizeof(then_operand));
-    emit_instruction(ctx, "br label %%%s", end_bb);
+    int then_from = ctx->builder.block->id;
+    ir_build_br(&ctx->builder, end_bb);
 
     /* Else block - compute false value */
-    emit_basic_block_label(ctx, else_bb);
-    LLVMValue* else_val = generate_expression(ctx, expr->data.conditional_expr.else_expr);
+    ir_builder_set_block(&ctx->builder, else_bb);
+    LLVMValue else_val = generate_expression(ctx, expr->data.conditional_expr.else_expr);
     else_val = load_value_if_needed(ctx, else_val);
-    char else_operand[MAX_OPERAND_STRING_LENGTH];
-    format_operand(else_val, else_operand, sizeof(else_operand));
-    emit_instruction(ctx, "br label %%%s", end_bb);
+    int else_from = ctx->builder.block->id;
 
     /* End block - phi node */
-    emit_basic_block_label(ctx, end_bb);
-    char* result_reg = get_next_register(ctx);  /* Get result reg after branches */
-    emit_instruction(ctx, "%%%s = phi i32 [ %s, %%%s ], [ %s, %%%s ]",
-                     result_reg, then_operand, then_bb, else_operand, else_bb);
-
-    TypeInfo* result_type = create_type_info(TYPE_INT);
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg, result_type);
-
-    free_llvm_value(condition);
-    free_llvm_value(then_val);
-    free_llvm_value(else_val);
-    free(then_bb);
-    free(else_bb);
-    free(end_bb);
-    if (cmp_reg) free(cmp_reg);
-    free(result_reg);
-
-    return result;
+    begin_block(ctx, end_bb);
+    int result_reg = get_next_register(ctx);  /* Get result reg after branches */
+    IRValue incoming[2] = {ir_operand(&then_val, int_type(ctx)),
+                           ir_operand(&else_val, int_type(ctx))};
+    int predecessors[2] = {then_from, else_from};
+    ir_build_phi(&ctx->builder, ir_register(result_reg, int_type(ctx)),
+                 int_type(ctx), incoming, predecessors, 2);
+
+    return llvm_register(result_reg, int_type(ctx));
 }
 
-LLVMValue* generate_cast(CodeGenContext* ctx, ASTNode* expr) {
+LLVMValue generate_cast(CodeGenContext* ctx, ASTNode* expr) {
     TypeInfo* target_type = expr->data.cast_expr.target_type;
     ASTNode* operand_node = expr->data.cast_expr.operand;
 
     if (!target_type || !operand_node) {
         codegen_error(ctx, "Invalid cast expression");
-        return NULL;
+        return llvm_no_value();
     }
 
-    LLVMValue* operand = generate_expression(ctx, operand_node);
-    if (!operand)
-        return NULL;
+    LLVMValue operand = generate_expression(ctx, operand_node);
+    if (operand.type == LLVM_VALUE_NONE)
+        return operand;
 
     operand = load_value_if_needed(ctx, operand);
-    if (!operand)
-        return NULL;
 
     /* Get source and target sizes */
-    int src_size = get_type_size(operand->llvm_type);
-    int dst_size = get_type_size(target_type);
+    int src_size = get_type_size(ctx, operand.llvm_type);
+    int dst_size = get_type_size(ctx, target_type);
+
+    /* Integer constants convert now */
+    if (is_constant(&operand) && (is_integer_type(target_type->base_type) ||
+                                  target_type->base_type == TYPE_BOOL)) {
+        return llvm_constant(fold_int_cast(operand.id, target_type),
+                             canonical_type(ctx, target_type));
+    }
 
     /* If same size, return as-is */
     if (src_size == dst_size) {
-        TypeInfo* result_type = duplicate_type_info(target_type);
-        operand->llvm_type = result_type;
+        operand.llvm_type = canonical_type(ctx, target_type);
         return operand;
     }
 
-    char* result_reg = get_next_register(ctx);
-    char* src_type_str = llvm_type_to_string(operand->llvm_type);
-    char* dst_type_str = llvm_type_to_string(target_type);
-
-    char operand_str[MAX_OPERAND_STRING_LENGTH];
-    format_operand(operand, operand_str, sizeof(operand_str));
-
+    IRCastOp cast_op;
     if (dst_size < src_size) {
         /* Truncate */
-        emit_instruction(ctx, "%%%s = trunc %s %s to %s",
-                         result_reg, src_type_str, operand_str, dst_type_str);
+        cast_op = IR_TRUNC;
     } else {
         /* Extend - use sign extension for most types (char, int, etc. are signed) */
-        DataType base = operand->llvm_type ? operand->llvm_type->base_type : TYPE_INT;
+        DataType base = operand.llvm_type ? operand.llvm_type->base_type : TYPE_INT;
         bool is_signed = (base == TYPE_INT || base == TYPE_CHAR || base == TYPE_SHORT ||
                           base == TYPE_LONG);
-        if (is_signed) {
-            emit_instruction(ctx, "%%%s = sext %s %s to %s",
-                             result_reg, src_type_str, operand_str, dst_type_str);
-        } else {
-            emit_instruction(ctx, "%%%s = zext %s %s to %s",
-                             result_reg, src_type_str, operand_str, dst_type_str);
-        }
+        cast_op = is_signed ? IR_SEXT : IR_ZEXT;
     }
 
-    TypeInfo* result_type = duplicate_type_info(target_type);
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg, result_type);
-
-    free(src_type_str);
-    free(dst_type_str);
-    free(result_reg);
-    free_llvm_value(operand);
+    TypeInfo* result_type = canonical_type(ctx, target_type);
+    int result_reg = build_cast(ctx, cast_op, ir_operand(&operand, NULL),
+                                result_type);
 
-    return result;
+    return llvm_register(result_reg, result_type);
 }
 
-LLVMValue* generate_unary_op(CodeGenContext* ctx, ASTNode* expr) {
-    LLVMValue* operand = generate_expression(ctx, expr->data.unary_op.operand);
-    if (!operand)
-        return NULL;
+LLVMValue generate_unary_op(CodeGenContext* ctx, ASTNode* expr) {
+    /* sizeof(type): the parser leaves the type for the target to size */
+    if (expr->data.unary_op.op == UOP_SIZEOF &&
+        !expr->data.unary_op.operand) {
+        return llvm_constant(get_type_size(ctx, expr->data_type),
+                             int_type(ctx));
+    }
+
+    /* sizeof never evaluates its operand; one whose type is not known
+     * is taken to be an int */
+    if (expr->data.unary_op.op == UOP_SIZEOF) {
+        ConstantValue size;
+        if (!evaluate_constant_expression(ctx, expr, &size))
+            return llvm_constant(ctx->target->int_size, int_type(ctx));
+        return llvm_constant((int)size.value, int_type(ctx));
+    }
+
+    LLVMValue operand = generate_expression(ctx, expr->data.unary_op.operand);
+    if (operand.type == LLVM_VALUE_NONE)
+        return operand;
 
-    char* result_reg = get_next_register(ctx);
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                                          create_type_info(TYPE_INT));
     UnaryOp op = expr->data.unary_op.op;
 
     /* Determine if we need the value or pointer based on operation */
@@ -1377,11 +2510,16 @@ LLVMValue* generate_unary_op(CodeGenContext* ctx, ASTNode* expr) {
     case UOP_BITNOT:
         /* For these operations, we need the value, not the pointer */
         operand = load_value_if_needed(ctx, operand);
-        if (!operand) {
-            free_llvm_value(result);
-            free(result_reg);
-            return NULL;
+        if (is_constant(&operand)) {
+            unsigned value = (unsigned)operand.id;
+            int folded = op == UOP_PLUS    ? (int)value
+                         : op == UOP_MINUS ? (int)(0u - value)
+                         : op == UOP_NOT   ? value == 0
+                                           : (int)~value;
+            return llvm_constant(folded, int_type(ctx));
         }
+        if (op == UOP_PLUS && operand.llvm_type == int_type(ctx))
+            return operand;
         break;
     case UOP_PREINC:
     case UOP_PREDEC:
@@ -1391,7 +2529,6 @@ LLVMValue* generate_unary_op(CodeGenContext* ctx, ASTNode* expr) {
         /* For these operations, we need the pointer, not the value */
         break;
     case UOP_DEREF:
-    case UOP_SIZEOF:
         /* Handle these specially in their respective functions */
         break;
     default:
@@ -1399,203 +2536,132 @@ LLVMValue* generate_unary_op(CodeGenContext* ctx, ASTNode* expr) {
     }
 
     /* Delegate to appropriate helper function */
-    LLVMValue* operation_result = NULL;
-
     switch (op) {
     case UOP_PLUS:
     case UOP_MINUS:
     case UOP_NOT:
     case UOP_BITNOT:
-        operation_result =
-            generate_arithmetic_unary_op(ctx, operand, result, op);
-        break;
+        return generate_arithmetic_unary_op(ctx, &operand, op);
     case UOP_PREINC:
     case UOP_PREDEC:
     case UOP_POSTINC:
     case UOP_POSTDEC:
-        operation_result =
-            generate_increment_decrement_op(ctx, operand, result, op);
-        break;
+        return generate_increment_decrement_op(ctx, &operand, op);
     case UOP_ADDR:
     case UOP_DEREF:
-    case UOP_SIZEOF:
-        operation_result = generate_address_deref_op(ctx, operand, result, op);
-        break;
+        return generate_address_deref_op(ctx, operand, op);
     default:
         codegen_error(ctx, "Unsupported unary operator: %d", op);
-        free_llvm_value(result);
-        free_llvm_value(operand);
-        free(result_reg);
-        return NULL;
-    }
-
-    /* Handle operation failure */
-    if (!operation_result) {
-        free_llvm_value(result);
-        free_llvm_value(operand);
-        free(result_reg);
-        return NULL;
+        return llvm_no_value();
     }
-
-    free_llvm_value(operand);
-    free(result_reg);
-    return operation_result;
 }
 
-LLVMValue* generate_identifier(CodeGenContext* ctx, ASTNode* identifier) {
+LLVMValue generate_identifier(CodeGenContext* ctx, ASTNode* identifier) {
     Symbol* symbol = lookup_symbol(ctx, identifier->data.identifier.name);
     if (!symbol) {
         codegen_error(ctx, "Undefined identifier: %s",
                       identifier->data.identifier.name);
-        return NULL;
+        return llvm_no_value();
     }
 
+    /* Enumeration constants are values, not storage */
+    if (symbol->is_constant) {
+        return llvm_constant(symbol->constant_value, int_type(ctx));
+    }
+
+    TypeInfo* type = canonical_type(ctx, symbol->type);
+
     /* For function parameters, use them directly without loading */
     if (symbol->is_parameter) {
-        LLVMValue* result =
-            create_llvm_value(LLVM_VALUE_REGISTER,
-                              identifier->data.identifier.name,
-                              duplicate_type_info(symbol->type));
-        return result;
+        return llvm_value(LLVM_VALUE_REGISTER, 0, symbol->name, type);
     }
 
     /* For local variables, return the address (pointer) so increment/decrement
      * can work */
     if (!symbol->is_global && ctx->current_function_name) {
-        LLVMValue* result =
-            create_llvm_value(LLVM_VALUE_REGISTER, symbol->name,
-                              duplicate_type_info(symbol->type));
-        result->is_lvalue = 1;
+        LLVMValue result =
+            llvm_value(LLVM_VALUE_REGISTER, 0, storage_name(symbol), type);
+        result.is_lvalue = 1;
         return result;
     }
 
     /* Global variables */
     if (symbol->is_global) {
-        LLVMValue* result =
-            create_llvm_value(LLVM_VALUE_GLOBAL, symbol->name,
-                              duplicate_type_info(symbol->type));
-        result->is_lvalue = 1;
+        LLVMValue result = llvm_value(LLVM_VALUE_GLOBAL, 0, symbol->name, type);
+        result.is_lvalue = 1;
         return result;
     }
 
     /* Default case - should not reach here */
-    LLVMValue* result =
-        create_llvm_value(LLVM_VALUE_REGISTER, identifier->data.identifier.name,
-                          duplicate_type_info(symbol->type));
-    return result;
+    return llvm_value(LLVM_VALUE_REGISTER, 0, symbol->name, type);
+}
+
+LLVMValue generate_constant(CodeGenContext* ctx, ASTNode* constant) {
+    /* For constants, we use the value directly in instructions */
+    return llvm_constant(constant->data.constant.value.int_val,
+                         canonical_basic_type(ctx, TYPE_INT));
 }
 
-LLVMValue* generate_constant(CodeGenContext* ctx, ASTNode* constant) {
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_CONSTANT, NULL,
-                                          create_type_info(TYPE_INT));
-    result->data.constant_val = constant->data.constant.value.int_val;
+/* Add @name = c"<bytes>\00" to the module constants, encoded in place */
+static void emit_string_constant(CodeGenContext* ctx, const char* name,
+                                 const char* bytes, size_t length) {
+    if (ctx->consumer) {
+        IRGlobal global = ir_global(IR_GLOBAL_STRING, name, NULL);
+        global.bytes = bytes;
+        global.length = length;
+        add_module_global(ctx, &global);
+        return;
+    }
+
+    IRBuffer* scratch = &ctx->constants.scratch;
+    scratch->length = 0;
+    ir_buffer_format(scratch, "@%s = private unnamed_addr constant [%zu x i8] c\"",
+                     name, length + 1);
+
+    size_t encoded = string_pool_encoded_length(&ctx->strings, bytes, length);
+    if (scratch->capacity - scratch->length < encoded) {
+        ir_buffer_grow(scratch, encoded);
+    }
+    if (scratch->error) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
+    scratch->length += string_pool_encode(&ctx->strings, bytes, length,
+                                          scratch->data + scratch->length);
+    ir_buffer_append(scratch, "\\00\"", 4);
+
+    constant_section_append(&ctx->constants, scratch->data, scratch->length);
+}
 
-    /* For constants, we use the value directly in instructions */
-    snprintf(ctx->temp_buffer, sizeof(ctx->temp_buffer), "%d",
-             result->data.constant_val);
-    result->name = safe_strdup(ctx->temp_buffer);
+LLVMValue generate_string_literal(CodeGenContext* ctx, ASTNode* string_lit) {
+    const char* bytes = string_lit->data.string_literal.string;
+    size_t length = string_lit->data.string_literal.length;
 
-    return result;
-}
+    /* Identical literals share one constant */
+    int is_new = 0;
+    int id = string_pool_intern(&ctx->strings, bytes, length, &is_new);
+    if (id < 0) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
 
-LLVMValue* generate_string_literal(CodeGenContext* ctx, ASTNode* string_lit) {
-    /* Generate global string constant */
-    char* global_name = get_next_register(ctx);
-    const char* str = string_lit->data.string_literal.string;
-    int length = string_lit->data.string_literal.length;
-
-    /* Process escape sequences and remove surrounding quotes */
-    char* processed = static_cast<char*>(safe_malloc(length * 2 + 1)); /* Extra space for escapes */
-    int j = 0;
-    for (int i = 0; i < length; i++) {
-        if (str[i] == '\\' && i + 1 < length) {
-            /* Handle escape sequences */
-            switch (str[i + 1]) {
-            case 'n':
-                processed[j++] = '\\';
-                processed[j++] = '0';
-                processed[j++] = 'A';
-                i++; /* Skip the 'n' */
-                break;
-            case 't':
-                processed[j++] = '\\';
-                processed[j++] = '0';
-                processed[j++] = '9';
-                i++;
-                break;
-            case 'r':
-                processed[j++] = '\\';
-                processed[j++] = '0';
-                processed[j++] = 'D';
-                i++;
-                break;
-            case '0':
-                processed[j++] = '\\';
-                processed[j++] = '0';
-                processed[j++] = '0';
-                i++;
-                break;
-            case '\\':
-                processed[j++] = '\\';
-                processed[j++] = '\\';
-                i++;
-                break;
-            case '"':
-                processed[j++] = '\\';
-                processed[j++] = '"';
-                i++;
-                break;
-            default:
-                processed[j++] = str[i];
-                break;
-            }
-        } else if (str[i] == '\n') {
-            processed[j++] = '\\';
-            processed[j++] = '0';
-            processed[j++] = 'A';
-        } else if (str[i] == '\r') {
-            processed[j++] = '\\';
-            processed[j++] = '0';
-            processed[j++] = 'D';
-        } else if (str[i] == '\t') {
-            processed[j++] = '\\';
-            processed[j++] = '0';
-            processed[j++] = '9';
-        } else if (str[i] != '"') {
-            /* Skip surrounding quotes */
-            processed[j++] = str[i];
-        }
-    }
-    processed[j] = '\0';
-
-    /* Calculate actual byte length for LLVM [N x i8] */
-    int byte_length = 0;
-    for (int i = 0; i < length; i++) {
-        if (str[i] == '"')
-            continue;
-        if (str[i] == '\\' && i + 1 < length) {
-            byte_length++;
-            i++;
-        } else if (str[i] == '\n' || str[i] == '\r' || str[i] == '\t') {
-            byte_length++;
+    /* Named per function so bodies can be generated independently */
+    StringPoolEntry* entry = &ctx->strings.entries[id];
+    if (is_new) {
+        char global_name[MAX_TEMP_BUFFER_SIZE];
+        if (ctx->current_function_name) {
+            snprintf(global_name, sizeof(global_name), ".str.%s.%d",
+                     ctx->current_function_name, id);
         } else {
-            byte_length++;
+            snprintf(global_name, sizeof(global_name), ".str.%d", id);
         }
+        entry->label = safe_strdup(global_name);
+        emit_string_constant(ctx, entry->label, bytes, length);
     }
 
-    emit_global_declaration(ctx,
-                            "@%s = private unnamed_addr constant [%d x i8] "
-                            "c\"%s\\00\"",
-                            global_name, byte_length + 1, processed);
-
-    free(processed);
-
-    LLVMValue* result =
-        create_llvm_value(LLVM_VALUE_GLOBAL, global_name,
-                          create_pointer_type(create_type_info(TYPE_CHAR)));
-    free(global_name);
-
-    return result;
+    return llvm_value(LLVM_VALUE_GLOBAL, 0, entry->label,
+                      canonical_pointer_type(
+                          ctx, canonical_basic_type(ctx, TYPE_CHAR)));
 }
 
 /* Statement generation */
@@ -1613,6 +2679,12 @@ void generate_statement(CodeGenContext* ctx, ASTNode* stmt) {
     case AST_VARIABLE_DECL:
         generate_declaration(ctx, stmt);
         break;
+    case AST_ENUM_DECL:
+        generate_enum_declaration(ctx, stmt);
+        break;
+    case AST_STATIC_ASSERT:
+        generate_static_assert(ctx, stmt);
+        break;
     case AST_IF_STMT:
         generate_if_statement(ctx, stmt);
         break;
@@ -1626,18 +2698,22 @@ void generate_statement(CodeGenContext* ctx, ASTNode* stmt) {
         generate_return_statement(ctx, stmt);
         break;
     case AST_BREAK_STMT:
-        if (ctx->loop_break_label) {
-            emit_instruction(ctx, "br label %%%s", ctx->loop_break_label);
+        if (ctx->loop_break_block) {
+            ir_build_br(&ctx->builder, ctx->loop_break_block);
         }
         break;
     case AST_CONTINUE_STMT:
-        if (ctx->loop_continue_label) {
-            emit_instruction(ctx, "br label %%%s", ctx->loop_continue_label);
+        if (ctx->loop_continue_block) {
+            ir_build_br(&ctx->builder, ctx->loop_continue_block);
         }
         break;
     case AST_SWITCH_STMT:
         generate_switch_statement(ctx, stmt);
         break;
+    case AST_CASE_STMT:
+    case AST_DEFAULT_STMT:
+        generate_case_label(ctx, stmt);
+        break;
     default:
         /* Handle other statement types */
         break;
@@ -1645,47 +2721,25 @@ void generate_statement(CodeGenContext* ctx, ASTNode* stmt) {
 }
 
 void generate_compound_statement(CodeGenContext* ctx, ASTNode* stmt) {
+    const Symbol* scope = ctx->local_symbols;
     ASTNode* current = stmt->data.compound_stmt.statements;
-    ASTNode* last = NULL;
     while (current) {
         generate_statement(ctx, current);
-        last = current;
         current = current->next;
     }
-
-    /* If we're in a loop body and the block didn't end with a terminal instruction,
-     * fall through to continue/update block */
-    if (ctx->loop_continue_label && last) {
-        /* Check if last statement is a terminal statement (break/continue/return) */
-        if (last->type != AST_BREAK_STMT &&
-            last->type != AST_CONTINUE_STMT &&
-            last->type != AST_RETURN_STMT) {
-            emit_instruction(ctx, "br label %%%s", ctx->loop_continue_label);
-        }
-    }
+    leave_scope(ctx, scope);
 }
 
 void generate_return_statement(CodeGenContext* ctx, ASTNode* stmt) {
     if (stmt->data.return_stmt.expression) {
-        LLVMValue* return_val =
+        LLVMValue return_val =
             generate_expression(ctx, stmt->data.return_stmt.expression);
-        if (return_val) {
-            if (return_val->type == LLVM_VALUE_CONSTANT) {
-                /* For constants, use literal value directly */
-                emit_instruction(ctx, "ret i32 %d",
-                                 return_val->data.constant_val);
-            } else {
-                /* For variables/registers, use register name */
-                emit_instruction(ctx, "ret i32 %%%s", return_val->name);
-            }
-
-            /* Safer memory cleanup to avoid double-free issues in complex
-             * expressions */
-            /* Don't free immediately - defer to end of function generation */
-            /* free_llvm_value(return_val); */
+        if (return_val.type != LLVM_VALUE_NONE) {
+            ir_build_ret(&ctx->builder, int_type(ctx),
+                         ir_operand(&return_val, int_type(ctx)));
         }
     } else {
-        emit_instruction(ctx, "ret void");
+        ir_build_ret(&ctx->builder, NULL, ir_no_value());
     }
 }
 
@@ -1697,11 +2751,7 @@ void generate_expression_statement(CodeGenContext* ctx, ASTNode* stmt) {
     /* The expression is stored in the same field as return statements */
     if (stmt->data.return_stmt.expression) {
         /* Generate the expression but discard the result */
-        LLVMValue* result =
-            generate_expression(ctx, stmt->data.return_stmt.expression);
-        if (result) {
-            free_llvm_value(result);
-        }
+        generate_expression(ctx, stmt->data.return_stmt.expression);
     }
 
     /* If we're in a loop body and this is not a terminal statement,
@@ -1715,32 +2765,32 @@ void generate_expression_statement(CodeGenContext* ctx, ASTNode* stmt) {
 /* Function definition */
 void generate_function_definition(CodeGenContext* ctx, ASTNode* func_def) {
     ctx->current_function_name = safe_strdup(func_def->data.function_def.name);
+
+    /* Value, block and string numbering restarts in every function */
+    ctx->next_reg_id = 1;
+    ctx->next_bb_id = 1;
+    reset_string_pool(ctx);
     ctx->current_function_return_type = func_def->data.function_def.return_type;
 
-    /* Clear local symbols between function definitions - disabled to avoid
-     * double-free issues */
-    /* clear_local_symbols(ctx); */
+    /* Parameters and locals live until the end of the definition */
+    Symbol* outer_scope = ctx->local_symbols;
 
     /* Generate function signature */
-    char* return_type =
-        llvm_type_to_string(func_def->data.function_def.return_type);
+    TypeInfo* return_type =
+        canonical_type(ctx, func_def->data.function_def.return_type);
+    const char* linkage =
+        symbol_linkage(ctx, func_def->data.function_def.name);
 
     /* Handle function parameters */
+    std::vector<IRValue> params;
     if (func_def->data.function_def.parameters) {
-        /* Process parameter declarations and build parameter list */
-        char param_list[512] = "";
-        int param_count = 0;
-
         /* Walk through parameter declarations */
         const ASTNode* param_decl = func_def->data.function_def.parameters;
         while (param_decl) {
             if (param_decl->type == AST_VARIABLE_DECL) {
                 /* Add parameter to function signature */
-                if (param_count > 0) {
-                    strcat(param_list, ", ");
-                }
-                strcat(param_list, "i32 %");
-                strcat(param_list, param_decl->data.variable_decl.name);
+                params.push_back(ir_local(param_decl->data.variable_decl.name,
+                                          int_type(ctx)));
 
                 /* Create parameter symbol with safer approach */
                 TypeInfo* param_type =
@@ -1751,27 +2801,25 @@ void generate_function_definition(CodeGenContext* ctx, ASTNode* func_def) {
                 param_symbol->is_global = 0;    /* Parameter is local */
                 param_symbol->is_parameter = 1; /* Mark as parameter */
                 add_local_symbol(ctx, param_symbol);
-
-                param_count++;
             }
             param_decl = param_decl->next;
         }
-
-        emit_function_header(ctx, "define %s @%s(%s) {", return_type,
-                             func_def->data.function_def.name, param_list);
-    } else {
-        /* No parameters */
-        emit_function_header(ctx, "define %s @%s() {", return_type,
-                             func_def->data.function_def.name);
     }
 
+    print_pending_ir(ctx);
+    ir_builder_begin_function(&ctx->builder, func_def->data.function_def.name,
+                              linkage, return_type, params.data(),
+                              (int)params.size());
+
     /* Generate function body */
     generate_statement(ctx, func_def->data.function_def.body);
+    if (ctx->ssa) {
+        ssa_promote_locals(&ctx->builder);
+    }
 
-    emit_instruction(ctx, "}");
-    fprintf(ctx->output, "\n");
+    print_pending_ir(ctx);
+    drop_local_symbols(ctx, outer_scope);
 
-    free(return_type);
     if (ctx->current_function_name) {
         free(ctx->current_function_name);
         ctx->current_function_name = NULL;
@@ -1787,26 +2835,49 @@ void add_local_symbol(CodeGenContext* ctx, Symbol* symbol) {
     if (!ctx || !symbol)
         return;
 
-    /* Check for duplicate symbols to prevent corruption */
-    const Symbol* existing = ctx->local_symbols;
-    while (existing) {
-        if (existing->name && symbol->name &&
-            strcmp(existing->name, symbol->name) == 0) {
-            /* Don't add duplicate - just update the existing one */
-            return;
+    /* A local that reuses the name of one declared earlier in the function
+     * (a shadowing or sibling block) gets its own slot, name.N; C names
+     * cannot contain a dot */
+    int uses = 0;
+    for (const Symbol* existing = ctx->local_symbols; existing;
+         existing = existing->next) {
+        if (strcmp(existing->name, symbol->name) == 0) {
+            uses++;
         }
-        existing = existing->next;
+    }
+    if (uses > 0 && !symbol->is_constant) {
+        std::string name = std::string(symbol->name) + "." +
+                           std::to_string(uses);
+        symbol->storage_name = safe_strdup(name.c_str());
     }
 
     symbol->next = ctx->local_symbols;
     ctx->local_symbols = symbol;
 }
 
+/* Locals declared since scope go out of scope; they keep their names
+ * reserved until the function ends */
+static void leave_scope(CodeGenContext* ctx, const Symbol* scope) {
+    for (Symbol* symbol = ctx->local_symbols; symbol != scope;
+         symbol = symbol->next) {
+        symbol->out_of_scope = 1;
+    }
+}
+
+/* Free the locals declared since scope */
+static void drop_local_symbols(CodeGenContext* ctx, const Symbol* scope) {
+    while (ctx->local_symbols != scope) {
+        Symbol* next = ctx->local_symbols->next;
+        free_symbol(ctx->local_symbols);
+        ctx->local_symbols = next;
+    }
+}
+
 Symbol* lookup_symbol(CodeGenContext* ctx, const char* name) {
     /* Check local symbols first */
     Symbol* symbol = ctx->local_symbols;
     while (symbol) {
-        if (strcmp(symbol->name, name) == 0) {
+        if (!symbol->out_of_scope && strcmp(symbol->name, name) == 0) {
             return symbol;
         }
         symbol = symbol->next;
@@ -1824,6 +2895,23 @@ Symbol* lookup_symbol(CodeGenContext* ctx, const char* name) {
     return NULL;
 }
 
+/* The symbol whose storage a value names: a local by its IR name, else a
+ * global */
+static Symbol* lookup_storage(CodeGenContext* ctx, const char* name) {
+    for (Symbol* symbol = ctx->local_symbols; symbol; symbol = symbol->next) {
+        if (!symbol->out_of_scope &&
+            strcmp(storage_name(symbol), name) == 0) {
+            return symbol;
+        }
+    }
+    for (Symbol* symbol = ctx->global_symbols; symbol; symbol = symbol->next) {
+        if (strcmp(symbol->name, name) == 0) {
+            return symbol;
+        }
+    }
+    return NULL;
+}
+
 void clear_local_symbols(CodeGenContext* ctx) {
     if (!ctx)
         return;
@@ -1838,132 +2926,346 @@ void clear_local_symbols(CodeGenContext* ctx) {
 }
 
 /* Output functions */
-void emit_instruction(CodeGenContext* ctx, const char* format, ...) {
+void emit_global_declaration(CodeGenContext* ctx, const char* format, ...) {
+    IRBuffer* scratch = &ctx->constants.scratch;
     va_list args;
     va_start(args, format);
+    scratch->length = 0;
+    ir_buffer_vformat(scratch, format, args);
+    va_end(args);
 
-    fprintf(ctx->output, "  ");
-    vfprintf(ctx->output, format, args);
-    fprintf(ctx->output, "\n");
+    if (scratch->error) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
+    constant_section_append(&ctx->constants, scratch->data, scratch->length);
+}
 
-    va_end(args);
+static void emit_all_global_constants(CodeGenContext* ctx) {
+    if (ctx->constants.head && !(ctx->ir_flags & IR_PRINT_COMPACT)) {
+        ir_buffer_append_str(&ctx->out, "\n; Global constants\n");
+    }
+    constant_section_write(&ctx->constants, &ctx->out);
 }
 
-void emit_global_declaration(CodeGenContext* ctx, const char* format, ...) {
-    char buffer[2048];
-    va_list args;
-    va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
+/* Arena block holding constants; text follows the header */
+struct ConstantArenaBlock {
+    ConstantArenaBlock* next;
+    size_t used;
+    size_t capacity;
+};
+
+/* Most blocks hold many constants; larger ones get a block of their own */
+#define CONSTANT_ARENA_BLOCK_SIZE (64 * 1024)
+
+static char* constant_arena_alloc(ConstantSection* section, size_t size) {
+    const size_t align = alignof(GlobalConstant);
+    size = (size + align - 1) & ~(align - 1);
+
+    ConstantArenaBlock* block = section->blocks;
+    if (!block || block->capacity - block->used < size) {
+        size_t capacity =
+            size > CONSTANT_ARENA_BLOCK_SIZE ? size : CONSTANT_ARENA_BLOCK_SIZE;
+        block = static_cast<ConstantArenaBlock*>(
+            safe_malloc(sizeof(ConstantArenaBlock) + capacity));
+        block->used = 0;
+        block->capacity = capacity;
+        block->next = section->blocks;
+        section->blocks = block;
+    }
 
-    auto gc = static_cast<GlobalConstant*>(safe_malloc(sizeof(GlobalConstant)));
-    gc->declaration = safe_strdup(buffer);
-    gc->next = NULL;
+    char* memory = reinterpret_cast<char*>(block + 1) + block->used;
+    block->used += size;
+    return memory;
+}
 
-    if (!ctx->global_constants) {
-        ctx->global_constants = gc;
-    } else {
-        GlobalConstant* current = ctx->global_constants;
-        while (current->next) {
-            current = current->next;
-        }
-        current->next = gc;
-    }
+static char* constant_arena_copy(ConstantSection* section, const char* text,
+                                 size_t length) {
+    char* copy = constant_arena_alloc(section, length + 1);
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    return copy;
 }
 
-static void emit_all_global_constants(CodeGenContext* ctx) {
-    auto current = ctx->global_constants;
-    if (current) {
-        fprintf(ctx->output, "\n; Global constants\n");
+void constant_section_init(ConstantSection* section) {
+    memset(section, 0, sizeof(ConstantSection));
+    ir_buffer_init(&section->scratch, NULL);
+}
+
+static void free_constant_blocks(ConstantSection* section) {
+    while (section->blocks) {
+        ConstantArenaBlock* next = section->blocks->next;
+        free(section->blocks);
+        section->blocks = next;
     }
-    while (current) {
-        fprintf(ctx->output, "%s\n", current->declaration);
-        current = current->next;
+}
+
+void constant_section_free(ConstantSection* section) {
+    free_constant_blocks(section);
+    ir_buffer_free(&section->scratch);
+    section->head = NULL;
+    section->tail = NULL;
+    section->count = 0;
+}
+
+GlobalConstant* constant_section_append(ConstantSection* section,
+                                        const char* text, size_t length) {
+    auto gc = reinterpret_cast<GlobalConstant*>(
+        constant_arena_alloc(section, sizeof(GlobalConstant)));
+    gc->declaration = constant_arena_copy(section, text, length);
+    gc->length = length;
+    gc->next = NULL;
+
+    if (section->tail) {
+        section->tail->next = gc;
+    } else {
+        section->head = gc;
     }
+    section->tail = gc;
+    section->count++;
+    return gc;
 }
 
-void emit_function_header(CodeGenContext* ctx, const char* format, ...) {
-    va_list args;
-    va_start(args, format);
+void constant_section_replace(ConstantSection* section,
+                              GlobalConstant* constant, const char* text,
+                              size_t length) {
+    constant->declaration = constant_arena_copy(section, text, length);
+    constant->length = length;
+}
 
-    vfprintf(ctx->output, format, args);
-    fprintf(ctx->output, "\n");
+void constant_section_adopt(ConstantSection* section, ConstantSection* other) {
+    if (other->blocks) {
+        ConstantArenaBlock* last = other->blocks;
+        while (last->next) {
+            last = last->next;
+        }
+        /* Keep the current block first so it keeps filling */
+        if (section->blocks) {
+            last->next = section->blocks->next;
+            section->blocks->next = other->blocks;
+        } else {
+            section->blocks = other->blocks;
+        }
+        other->blocks = NULL;
+    }
+    constant_section_free(other);
+}
 
-    va_end(args);
+void constant_section_write(ConstantSection* section, IRBuffer* out) {
+    for (GlobalConstant* gc = section->head; gc; gc = gc->next) {
+        ir_buffer_append(out, gc->declaration, gc->length);
+        ir_buffer_append_char(out, '\n');
+    }
+    section->head = NULL;
+    section->tail = NULL;
+    section->count = 0;
+    free_constant_blocks(section);
 }
 
 void emit_comment(CodeGenContext* ctx, const char* comment) {
-    fprintf(ctx->output, "; %s\n", comment);
+    print_pending_ir(ctx);
+    if (ctx->ir_flags & IR_PRINT_COMPACT)
+        return;
+    ir_buffer_append(&ctx->out, "; ", 2);
+    ir_buffer_append_str(&ctx->out, comment);
+    ir_buffer_append_char(&ctx->out, '\n');
 }
 
-void emit_basic_block_label(CodeGenContext* ctx, const char* label) {
-    fprintf(ctx->output, "%s:\n", label);
+/* Runtime support */
+
+/* declare <return_type> @name(<parameter>[, ...]) */
+static void declare_runtime_function(CodeGenContext* ctx, const char* name,
+                                     TypeInfo* return_type,
+                                     TypeInfo* parameter, int is_variadic) {
+    if (!ctx->consumer) {
+        emit_global_declaration(ctx, "declare %s @%s(%s%s)",
+                                llvm_type_name(ctx, return_type), name,
+                                llvm_type_name(ctx, parameter),
+                                is_variadic ? ", ..." : "");
+        return;
+    }
+    IRGlobal global = ir_global(IR_GLOBAL_DECLARATION, name, return_type);
+    global.parameter_types = &parameter;
+    global.parameter_count = 1;
+    global.is_variadic = is_variadic;
+    add_module_global(ctx, &global);
 }
 
-/* Runtime support */
 void generate_runtime_declarations(CodeGenContext* ctx) {
+    TypeInfo* char_pointer =
+        canonical_pointer_type(ctx, canonical_basic_type(ctx, TYPE_CHAR));
+
     emit_comment(ctx, "Runtime function declarations");
 
     /* Register printf */
-    emit_global_declaration(ctx, "declare i32 @printf(i8*, ...)");
+    declare_runtime_function(ctx, "printf", int_type(ctx), char_pointer, 1);
     Symbol* printf_sym =
         create_symbol("printf", create_type_info(TYPE_INT));
     printf_sym->is_global = 1;
     add_global_symbol(ctx, printf_sym);
 
     /* Register scanf */
-    emit_global_declaration(ctx, "declare i32 @scanf(i8*, ...)");
+    declare_runtime_function(ctx, "scanf", int_type(ctx), char_pointer, 1);
     Symbol* scanf_sym =
         create_symbol("scanf", create_type_info(TYPE_INT));
     scanf_sym->is_global = 1;
     add_global_symbol(ctx, scanf_sym);
 
     /* Register malloc */
-    emit_global_declaration(ctx, "declare i8* @malloc(i64)");
+    declare_runtime_function(ctx, "malloc", char_pointer,
+                             canonical_basic_type(ctx, TYPE_LONG), 0);
     Symbol* malloc_sym = create_symbol(
         "malloc", create_pointer_type(create_type_info(TYPE_CHAR)));
     malloc_sym->is_global = 1;
     add_global_symbol(ctx, malloc_sym);
 
     /* Register free */
-    emit_global_declaration(ctx, "declare void @free(i8*)");
+    declare_runtime_function(ctx, "free",
+                             canonical_basic_type(ctx, TYPE_VOID),
+                             char_pointer, 0);
     Symbol* free_sym =
         create_symbol("free", create_type_info(TYPE_VOID));
     free_sym->is_global = 1;
     add_global_symbol(ctx, free_sym);
 
-    fprintf(ctx->output, "\n");
+    if (!(ctx->ir_flags & IR_PRINT_COMPACT)) {
+        ir_buffer_append_char(&ctx->out, '\n');
+    }
 }
 
 /* Error reporting */
+void codegen_add_diagnostic(CodeGenContext* ctx, DiagnosticSeverity severity,
+                            int line, int column, const char* message) {
+    if (!ctx || !message)
+        return;
+
+    auto diag = static_cast<Diagnostic*>(safe_malloc(sizeof(Diagnostic)));
+    diag->severity = severity;
+    diag->file_name = NULL;
+    diag->line = line;
+    diag->column = column;
+    diag->message = safe_strdup(message);
+    diag->next = NULL;
+
+    if (ctx->diagnostics_tail) {
+        ctx->diagnostics_tail->next = diag;
+    } else {
+        ctx->diagnostics = diag;
+    }
+    ctx->diagnostics_tail = diag;
+
+    if (severity == DIAGNOSTIC_ERROR) {
+        ctx->error_count++;
+    }
+}
+
 void codegen_error(CodeGenContext* ctx, const char* message, ...) {
-    (void)ctx; /* Suppress unused parameter warning */
+    char buffer[MAX_TEMP_BUFFER_SIZE];
     va_list args;
     va_start(args, message);
-
-    fprintf(stderr, "Code generation error: ");
-    vfprintf(stderr, message, args);
-    fprintf(stderr, "\n");
-
+    vsnprintf(buffer, sizeof(buffer), message, args);
     va_end(args);
+
+    codegen_add_diagnostic(ctx, DIAGNOSTIC_ERROR, 0, 0, buffer);
+    if (!ctx || !ctx->quiet_diagnostics) {
+        fprintf(stderr, "Code generation error: %s\n", buffer);
+    }
     /* For now, return instead of aborting to let tests continue */
     /* TODO: Properly handle errors */
     return;
 }
 
 void codegen_warning(CodeGenContext* ctx, const char* message, ...) {
-    (void)ctx; /* Suppress unused parameter warning */
+    char buffer[MAX_TEMP_BUFFER_SIZE];
     va_list args;
     va_start(args, message);
+    vsnprintf(buffer, sizeof(buffer), message, args);
+    va_end(args);
 
-    fprintf(stderr, "Code generation warning: ");
-    vfprintf(stderr, message, args);
-    fprintf(stderr, "\n");
+    codegen_add_diagnostic(ctx, DIAGNOSTIC_WARNING, 0, 0, buffer);
+    if (!ctx || !ctx->quiet_diagnostics) {
+        fprintf(stderr, "Code generation warning: %s\n", buffer);
+    }
+}
 
-    va_end(args);
+/* Hand a global variable to the consumer; initializers other than integer
+ * constant expressions and string literals become zero */
+static void add_global_variable(CodeGenContext* ctx, const Symbol* symbol,
+                                ASTNode* initializer, int is_external) {
+    IRGlobal global =
+        ir_global(is_external ? IR_GLOBAL_EXTERNAL : IR_GLOBAL_VARIABLE,
+                  symbol->name, canonical_type(ctx, symbol->type));
+    global.linkage = symbol_linkage(ctx, symbol->name);
+    ConstantValue value;
+    if (initializer && initializer->type != AST_STRING_LITERAL &&
+        evaluate_constant_expression(ctx, initializer, &value)) {
+        global.has_constant = 1;
+        global.constant = constant_for_type(ctx, &value, symbol->type);
+    } else if (initializer && initializer->type == AST_STRING_LITERAL) {
+        global.bytes = initializer->data.string_literal.string;
+        global.length = initializer->data.string_literal.length;
+    }
+    add_module_global(ctx, &global);
 }
 
 /* Declaration generation */
+
+/* Enumerators become int constants in the current scope; one without a
+ * value is one more than the previous */
+static void generate_enum_declaration(CodeGenContext* ctx, ASTNode* decl) {
+    long long next_value = 0;
+    for (ASTNode* item = decl->data.enum_decl.enumerators; item;
+         item = item->next) {
+        ASTNode* name = item;
+        if (item->type == AST_BINARY_OP) {
+            name = item->data.binary_op.left;
+            ConstantValue value;
+            if (!evaluate_constant_expression(ctx, item->data.binary_op.right,
+                                              &value)) {
+                codegen_error(ctx,
+                              "Value of enumerator '%s' is not an integer "
+                              "constant expression",
+                              name->data.identifier.name);
+                return;
+            }
+            next_value = value.value;
+            if (value.is_unsigned && value.value < 0) {
+                next_value = LLONG_MAX; /* above 2^63, so out of range */
+            }
+        }
+        if (next_value < INT_MIN || next_value > INT_MAX) {
+            codegen_error(ctx, "Value of enumerator '%s' does not fit in int",
+                          name->data.identifier.name);
+            return;
+        }
+
+        Symbol* symbol = create_symbol(name->data.identifier.name,
+                                       create_type_info(TYPE_INT));
+        symbol->is_constant = 1;
+        symbol->constant_value = (int)next_value;
+        if (ctx->current_function_name == NULL) {
+            symbol->is_global = 1;
+            add_global_symbol(ctx, symbol);
+        } else {
+            add_local_symbol(ctx, symbol);
+        }
+        next_value++;
+    }
+}
+
+static void generate_static_assert(CodeGenContext* ctx, ASTNode* decl) {
+    ConstantValue value;
+    if (!evaluate_constant_expression(
+            ctx, decl->data.static_assert_decl.condition, &value)) {
+        codegen_error(ctx, "Static assertion is not an integer constant "
+                           "expression");
+    } else if (value.value == 0) {
+        codegen_error(ctx, "Static assertion failed: \"%s\"",
+                      decl->data.static_assert_decl.message->data
+                          .string_literal.string);
+    }
+}
+
 void generate_declaration(CodeGenContext* ctx, ASTNode* decl) {
     if (!ctx || !decl)
         return;
@@ -1973,11 +3275,20 @@ void generate_declaration(CodeGenContext* ctx, ASTNode* decl) {
     /* If it's an array, wrap the type */
     ASTNode* dim = decl->data.variable_decl.array_dimensions;
     while (dim) {
-        if (dim->type == AST_CONSTANT) {
-            int size = dim->data.constant.value.int_val;
-            TypeInfo* array_type = create_array_type(symbol_type, size);
-            symbol_type = array_type;
+        ConstantValue size;
+        if (!evaluate_constant_expression(ctx, dim, &size)) {
+            codegen_error(ctx,
+                          "Size of array '%s' is not an integer constant "
+                          "expression",
+                          decl->data.variable_decl.name);
+            size.value = 0;
+        } else if (size.value < 0 || size.value > INT_MAX) {
+            codegen_error(ctx, "Size of array '%s' is %s",
+                          decl->data.variable_decl.name,
+                          size.value < 0 ? "negative" : "too large");
+            size.value = 0;
         }
+        symbol_type = create_array_type(symbol_type, (int)size.value);
         dim = dim->next;
     }
 
@@ -1995,15 +3306,18 @@ void generate_declaration(CodeGenContext* ctx, ASTNode* decl) {
     if (ctx->current_function_name == NULL) {
         /* Global variable */
         symbol->is_global = 1;
-        char* type_str = llvm_type_to_string(symbol->type); /* Use symbol->type which has correct size */
+        const char* type_str = llvm_type_name(ctx, symbol->type); /* Use symbol->type which has correct size */
         char init_val_str[1024]; /* Increase buffer size for string */
 
         /* Check for initializer */
+        ConstantValue init_val;
         if (decl->data.variable_decl.initializer &&
-            decl->data.variable_decl.initializer->type == AST_CONSTANT) {
-            /* Use constant initializer value */
-            int init_val = decl->data.variable_decl.initializer->data.constant.value.int_val;
-            snprintf(init_val_str, sizeof(init_val_str), "%d", init_val);
+            decl->data.variable_decl.initializer->type != AST_STRING_LITERAL &&
+            evaluate_constant_expression(
+                ctx, decl->data.variable_decl.initializer, &init_val)) {
+            /* Integer constant initializer, at the variable's width */
+            snprintf(init_val_str, sizeof(init_val_str), "%lld",
+                     constant_for_type(ctx, &init_val, symbol->type));
         } else if (decl->data.variable_decl.initializer &&
                    decl->data.variable_decl.initializer->type == AST_STRING_LITERAL) {
             /* String literal initializer */
@@ -2033,13 +3347,27 @@ void generate_declaration(CodeGenContext* ctx, ASTNode* decl) {
             free(default_val);
         }
 
-        emit_global_declaration(ctx, "@%s = global %s %s", symbol->name,
-                                type_str, init_val_str);
+        int is_external = ctx->whole_program &&
+                          declared_storage(decl->data.variable_decl.type) ==
+                              STORAGE_EXTERN;
+        if (ctx->consumer) {
+            add_global_variable(ctx, symbol, decl->data.variable_decl.initializer,
+                                is_external);
+        } else if (is_external) {
+            /* No unit defines it: it comes from outside the program */
+            emit_global_declaration(ctx, "@%s = external global %s",
+                                    symbol->name, type_str);
+        } else {
+            emit_global_declaration(ctx, "@%s = %sglobal %s %s",
+                                    symbol->name,
+                                    symbol_linkage(ctx, symbol->name),
+                                    type_str, init_val_str);
+        }
 
         add_global_symbol(ctx, symbol);
-        free(type_str);
     } else {
-        /* Local variable */
+        /* Local variable, in scope from its own initializer on */
+        add_local_symbol(ctx, symbol);
         int array_size = 0;
         if (symbol->type->base_type == TYPE_ARRAY) {
             array_size = symbol->type->array_size;
@@ -2047,37 +3375,37 @@ void generate_declaration(CodeGenContext* ctx, ASTNode* decl) {
 
         if (array_size > 0) {
             /* Array declaration: allocate [N x type] and store as pointer to element */
-            char* type_str = llvm_type_to_string(symbol->type);
-            emit_instruction(ctx, "%%%s = alloca %s", symbol->name, type_str);
-            free(type_str);
+            TypeInfo* array_type = canonical_type(ctx, symbol->type);
+            IRValue array = ir_local(storage_name(symbol),
+                                     canonical_pointer_type(ctx, array_type));
+            ir_build_alloca(&ctx->builder, array, array_type);
 
             /* Handle array initialization */
             if (decl->data.variable_decl.initializer) {
-                char* element_type_str = llvm_type_to_string(symbol->type->return_type);
+                TypeInfo* element_type = array_type->return_type;
+                TypeInfo* element_pointer =
+                    canonical_pointer_type(ctx, element_type);
+                IRValue indices[2] = {ir_constant(0, int_type(ctx)),
+                                      ir_constant(0, int_type(ctx))};
 
                 if (decl->data.variable_decl.initializer->type == AST_INITIALIZER_LIST) {
                     ASTNode* item = decl->data.variable_decl.initializer->data.initializer_list.items;
                     int index = 0;
                     while (item && index < array_size) {
-                        LLVMValue* val = generate_expression(ctx, item);
-                        if (val) {
+                        LLVMValue val = generate_expression(ctx, item);
+                        if (val.type != LLVM_VALUE_NONE) {
                              val = load_value_if_needed(ctx, val);
                              /* Verify type match? For now verify strictness or implicit cast logic */
 
-                             char val_operand[MAX_OPERAND_STRING_LENGTH];
-                             format_operand(val, val_operand, sizeof(val_operand));
-
-                             char* gep_reg = get_next_register(ctx);
+                             IRValue element = ir_register(
+                                 get_next_register(ctx), element_pointer);
+                             indices[1].id = index;
                              /* symbol->name is pointer to array [N x T]* */
-                             emit_instruction(ctx, "%%%s = getelementptr [%d x %s], [%d x %s]* %%%s, i32 0, i32 %d",
-                                              gep_reg, array_size, element_type_str,
-                                              array_size, element_type_str, symbol->name, index);
-
-                             emit_instruction(ctx, "store %s %s, %s* %%%s",
-                                              element_type_str, val_operand, element_type_str, gep_reg);
+                             ir_build_gep(&ctx->builder, element, array_type,
+                                          array, indices, 2);
 
-                             free(gep_reg);
-                             free_llvm_value(val);
+                             ir_build_store(&ctx->builder, element_type,
+                                            ir_operand(&val, NULL), element);
                         }
                         item = item->next;
                         index++;
@@ -2088,88 +3416,72 @@ void generate_declaration(CodeGenContext* ctx, ASTNode* decl) {
                     int len = decl->data.variable_decl.initializer->data.string_literal.length;
 
                     for (int i = 0; i < array_size; i++) {
-                        char val_operand[16];
                         /* Fill with string chars, then 0 */
                         unsigned char c = (i < len) ? (unsigned char)s[i] : (i == len ? 0 : 0);
-                        snprintf(val_operand, sizeof(val_operand), "%d", c);
 
-                        char* gep_reg = get_next_register(ctx);
-                        emit_instruction(ctx, "%%%s = getelementptr [%d x %s], [%d x %s]* %%%s, i32 0, i32 %d",
-                                         gep_reg, array_size, element_type_str,
-                                         array_size, element_type_str, symbol->name, i);
+                        IRValue element = ir_register(get_next_register(ctx),
+                                                      element_pointer);
+                        indices[1].id = i;
+                        ir_build_gep(&ctx->builder, element, array_type, array,
+                                     indices, 2);
 
-                        emit_instruction(ctx, "store %s %s, %s* %%%s",
-                                         element_type_str, val_operand, element_type_str, gep_reg);
-                        free(gep_reg);
+                        ir_build_store(&ctx->builder, element_type,
+                                       ir_constant(c, element_type), element);
                     }
                 }
-                free(element_type_str);
             }
             /* Symbol type remains TYPE_ARRAY, so load_value_if_needed will handle decay properly */
 
 
         } else {
             /* Regular variable */
-            char* type_str = llvm_type_to_string(decl->data.variable_decl.type);
-            emit_instruction(ctx, "%%%s = alloca %s", symbol->name, type_str);
-            free(type_str);
+            TypeInfo* slot_type =
+                canonical_type(ctx, decl->data.variable_decl.type);
+            ir_build_alloca(&ctx->builder,
+                            ir_local(storage_name(symbol),
+                                     canonical_pointer_type(ctx, slot_type)),
+                            slot_type);
 
             if (decl->data.variable_decl.initializer) {
-                LLVMValue* init_val =
+                LLVMValue init_val =
                     generate_expression(ctx, decl->data.variable_decl.initializer);
-                if (init_val) {
-                    char init_operand[MAX_OPERAND_STRING_LENGTH];
-                    format_operand(init_val, init_operand, sizeof(init_operand));
-
-                    char* value_type_str = llvm_type_to_string(symbol->type);
-                    TypeInfo* pointer_type_info =
-                        create_pointer_type(duplicate_type_info(symbol->type));
-                    char* pointer_type_str = llvm_type_to_string(pointer_type_info);
-
-                    emit_instruction(ctx, "store %s %s, %s %%%s", value_type_str,
-                                     init_operand, pointer_type_str, symbol->name);
-
-                    free(value_type_str);
-                    free(pointer_type_str);
-                    free_type_info(pointer_type_info);
-                    free_llvm_value(init_val);
+                if (init_val.type != LLVM_VALUE_NONE) {
+                    ir_build_store(&ctx->builder,
+                                   canonical_type(ctx, symbol->type),
+                                   ir_operand(&init_val, NULL),
+                                   ir_local(storage_name(symbol),
+                                            canonical_pointer_type(
+                                                ctx, symbol->type)));
                 }
             }
         }
-
-        add_local_symbol(ctx, symbol);
     }
 }
 
 /* Utility functions */
-LLVMValue* create_llvm_value(LLVMValueType type, const char* name,
-                             TypeInfo* llvm_type) {
-    auto value = static_cast<LLVMValue*>(safe_malloc(sizeof(LLVMValue)));
-    value->type = type;
-    value->name = safe_strdup(name);
-    value->llvm_type = llvm_type;
-    value->is_lvalue = 0;
-    return value;
-}
-
-void free_llvm_value(LLVMValue* value) {
-    if (!value)
-        return;
-    free(value->name);
-    free_type_info(value->llvm_type);
-    free(value);
+int get_next_register(CodeGenContext* ctx) {
+    return ctx->next_reg_id++;
+}
+
+int get_next_basic_block(CodeGenContext* ctx) {
+    return ctx->next_bb_id++;
+}
+
+/* Canonical types, interned in the context's table (see ir.h) */
+TypeInfo* canonical_type(CodeGenContext* ctx, const TypeInfo* type) {
+    return type_table_canonical(&ctx->types, type);
+}
+
+TypeInfo* canonical_basic_type(CodeGenContext* ctx, DataType base_type) {
+    return type_table_basic(&ctx->types, base_type);
 }
 
-char* get_next_register(CodeGenContext* ctx) {
-    auto reg_name = static_cast<char*>(safe_malloc(MAX_REGISTER_NAME_LENGTH));
-    snprintf(reg_name, 32, "%d", ctx->next_reg_id++);
-    return reg_name;
+TypeInfo* canonical_pointer_type(CodeGenContext* ctx, const TypeInfo* pointee) {
+    return type_table_pointer(&ctx->types, pointee);
 }
 
-char* get_next_basic_block(CodeGenContext* ctx) {
-    auto bb_name = static_cast<char*>(safe_malloc(MAX_BASIC_BLOCK_NAME_LENGTH));
-    snprintf(bb_name, 32, "bb%d", ctx->next_bb_id++);
-    return bb_name;
+const char* llvm_type_name(CodeGenContext* ctx, const TypeInfo* type) {
+    return ir_type_name(canonical_type(ctx, type), ctx->ir_flags);
 }
 
 /* Type utilities */
@@ -2259,37 +3571,18 @@ static int is_integer_type(DataType type) {
     }
 }
 
-int get_type_size(TypeInfo* type) {
-    if (!type)
-        return INT_SIZE_BYTES;
-
-    switch (type->base_type) {
-    case TYPE_BOOL:
-        return 1;
-    case TYPE_CHAR:
-        return 1;
-    case TYPE_SHORT:
-        return 2;
-    case TYPE_INT:
-        return INT_SIZE_BYTES;
-    case TYPE_LONG:
-        return 8;
-    case TYPE_FLOAT:
-        return FLOAT_SIZE_BYTES;
-    case TYPE_DOUBLE:
-        return DOUBLE_SIZE_BYTES;
-    case TYPE_POINTER:
-    case TYPE_FUNCTION:
-        return POINTER_SIZE_BYTES;
-    case TYPE_ARRAY:
-        return type->array_size * get_type_size(type->return_type);
-    case TYPE_STRUCT:
-    case TYPE_UNION:
-        /* TODO: compute actual aggregate size once layout is available */
-        return POINTER_SIZE_BYTES;
-    default:
-        return INT_SIZE_BYTES;
+/* Sizes of structs and unions are 0 on every target and reported here */
+int get_type_size(CodeGenContext* ctx, TypeInfo* type) {
+    const TypeInfo* element = type;
+    while (element && element->base_type == TYPE_ARRAY) {
+        element = element->return_type;
     }
+    if (element && (element->base_type == TYPE_STRUCT ||
+                    element->base_type == TYPE_UNION)) {
+        codegen_error(ctx, "Struct layout unsupported: size of '%s' is unknown",
+                      canonical_type_name(canonical_type(ctx, type)));
+    }
+    return target_type_size(ctx->target, type);
 }
 
 static int compare_struct_names(const TypeInfo* lhs, const TypeInfo* rhs) {
@@ -2330,143 +3623,108 @@ int types_compatible(TypeInfo* type1, TypeInfo* type2) {
     return 0;
 }
 
-void generate_if_statement(CodeGenContext* ctx, ASTNode* stmt) {
-    emit_instruction(ctx, "; if statement");
-
-    /* Generate condition */
-    LLVMValue* condition =
-        generate_expression(ctx, stmt->data.if_stmt.condition);
-    if (!condition)
-        return;
+/* Whether the current block already ends in a branch or return; comments
+ * do not count */
+static int block_is_terminated(CodeGenContext* ctx) {
+    const IRInstruction* last = NULL;
+    for (const IRInstruction* instruction =
+             ctx->builder.block ? ctx->builder.block->first : NULL;
+         instruction; instruction = instruction->next) {
+        if (instruction->opcode != IR_COMMENT)
+            last = instruction;
+    }
+    return last && (last->opcode == IR_BR || last->opcode == IR_COND_BR ||
+                    last->opcode == IR_SWITCH || last->opcode == IR_RET);
+}
 
-    condition = load_value_if_needed(ctx, condition);
+void generate_if_statement(CodeGenContext* ctx, ASTNode* stmt) {
+    ir_build_comment(&ctx->builder, "if statement");
 
     /* Create basic blocks */
-    char* then_label = get_next_basic_block(ctx);
-    char* else_label = get_next_basic_block(ctx);
-    char* end_label = get_next_basic_block(ctx);
-
-    /* Convert condition to i1 for branch */
-    char cond_operand[MAX_OPERAND_STRING_LENGTH];
-    format_operand(condition, cond_operand, sizeof(cond_operand));
+    int then_label = get_next_basic_block(ctx);
+    int else_label = get_next_basic_block(ctx);
+    int end_label = get_next_basic_block(ctx);
 
     /* Branch based on condition */
-    if (condition->llvm_type && condition->llvm_type->base_type == TYPE_BOOL) {
-        emit_instruction(ctx, "br i1 %s, label %%%s, label %%%s", cond_operand, then_label, else_label);
-    } else {
-        char* cmp_reg = get_next_register(ctx);
-        emit_instruction(ctx, "%%%s = icmp ne i32 %s, 0", cmp_reg, cond_operand);
-        emit_instruction(ctx, "br i1 %%%s, label %%%s, label %%%s", cmp_reg, then_label, else_label);
-        free(cmp_reg);
-    }
+    generate_condition_branch(ctx, stmt->data.if_stmt.condition, then_label,
+                              else_label);
 
     /* Then block */
-    emit_basic_block_label(ctx, then_label);
+    ir_builder_set_block(&ctx->builder, then_label);
     generate_statement(ctx, stmt->data.if_stmt.then_stmt);
-    /* Generate fallthrough br if then_stmt is not a compound statement */
-    /* Compound statements in loops handle their own fallthrough */
-    if (stmt->data.if_stmt.then_stmt->type != AST_COMPOUND_STMT) {
-        emit_instruction(ctx, "br label %%%s", end_label);
-    } else if (!ctx->loop_continue_label) {
-        /* Compound statement not in a loop - need fallthrough */
-        emit_instruction(ctx, "br label %%%s", end_label);
-    }
+    /* Fall through to the end unless the branch left already */
+    if (!block_is_terminated(ctx))
+        ir_build_br(&ctx->builder, end_label);
 
     /* Else block */
     if (stmt->data.if_stmt.else_stmt) {
-        emit_basic_block_label(ctx, else_label);
+        ir_builder_set_block(&ctx->builder, else_label);
         generate_statement(ctx, stmt->data.if_stmt.else_stmt);
-        /* Generate fallthrough br if else_stmt is not a compound statement */
-        if (stmt->data.if_stmt.else_stmt->type != AST_COMPOUND_STMT) {
-            emit_instruction(ctx, "br label %%%s", end_label);
-        } else if (!ctx->loop_continue_label) {
-            /* Compound statement not in a loop - need fallthrough */
-            emit_instruction(ctx, "br label %%%s", end_label);
-        }
+        if (!block_is_terminated(ctx))
+            ir_build_br(&ctx->builder, end_label);
     } else {
         /* No else clause - else_label just falls through to end_label */
-        emit_basic_block_label(ctx, else_label);
-        emit_instruction(ctx, "br label %%%s", end_label);
+        ir_builder_set_block(&ctx->builder, else_label);
+        ir_build_br(&ctx->builder, end_label);
     }
 
     /* End block */
-    emit_basic_block_label(ctx, end_label);
-
-    free_llvm_value(condition);
-    free(then_label);
-    free(else_label);
-    free(end_label);
+    ir_builder_set_block(&ctx->builder, end_label);
 }
 
 void generate_while_statement(CodeGenContext* ctx, ASTNode* stmt) {
-    emit_instruction(ctx, "; while statement");
+    ir_build_comment(&ctx->builder, "while statement");
 
-    char* cond_bb = get_next_basic_block(ctx);
-    char* body_bb = get_next_basic_block(ctx);
-    char* end_bb = get_next_basic_block(ctx);
+    int cond_bb = get_next_basic_block(ctx);
+    int body_bb = get_next_basic_block(ctx);
+    int end_bb = get_next_basic_block(ctx);
 
     /* Save previous loop labels */
-    char* saved_break = ctx->loop_break_label;
-    char* saved_continue = ctx->loop_continue_label;
+    int saved_break = ctx->loop_break_block;
+    int saved_continue = ctx->loop_continue_block;
 
     /* Set current loop labels */
-    ctx->loop_break_label = end_bb;
-    ctx->loop_continue_label = cond_bb;
+    ctx->loop_break_block = end_bb;
+    ctx->loop_continue_block = cond_bb;
 
     /* Jump to condition */
-    emit_instruction(ctx, "br label %%%s", cond_bb);
+    ir_build_br(&ctx->builder, cond_bb);
 
     /* Condition block */
-    emit_basic_block_label(ctx, cond_bb);
-    LLVMValue* condition = generate_expression(ctx, stmt->data.while_stmt.condition);
-    if (condition) {
-        condition = load_value_if_needed(ctx, condition);
-        char cond_operand[MAX_OPERAND_STRING_LENGTH];
-        format_operand(condition, cond_operand, sizeof(cond_operand));
-
-        if (condition->llvm_type && condition->llvm_type->base_type == TYPE_BOOL) {
-            emit_instruction(ctx, "br i1 %s, label %%%s, label %%%s", cond_operand, body_bb, end_bb);
-        } else {
-            char* cmp_reg = get_next_register(ctx);
-            emit_instruction(ctx, "%%%s = icmp ne i32 %s, 0", cmp_reg, cond_operand);
-            emit_instruction(ctx, "br i1 %%%s, label %%%s, label %%%s", cmp_reg, body_bb, end_bb);
-            free(cmp_reg);
-        }
-        free_llvm_value(condition);
-    }
+    ir_builder_set_block(&ctx->builder, cond_bb);
+    generate_condition_branch(ctx, stmt->data.while_stmt.condition, body_bb,
+                              end_bb);
 
     /* Body block */
-    emit_basic_block_label(ctx, body_bb);
+    ir_builder_set_block(&ctx->builder, body_bb);
     generate_statement(ctx, stmt->data.while_stmt.body);
-    emit_instruction(ctx, "br label %%%s", cond_bb);
+    if (!block_is_terminated(ctx))
+        ir_build_br(&ctx->builder, cond_bb);
 
     /* End block */
-    emit_basic_block_label(ctx, end_bb);
+    ir_builder_set_block(&ctx->builder, end_bb);
 
     /* Restore loop labels */
-    ctx->loop_break_label = saved_break;
-    ctx->loop_continue_label = saved_continue;
-
-    free(cond_bb);
-    free(body_bb);
-    free(end_bb);
+    ctx->loop_break_block = saved_break;
+    ctx->loop_continue_block = saved_continue;
 }
 
 void generate_for_statement(CodeGenContext* ctx, ASTNode* stmt) {
-    emit_instruction(ctx, "; for statement");
+    ir_build_comment(&ctx->builder, "for statement");
 
-    char* cond_bb = get_next_basic_block(ctx);
-    char* body_bb = get_next_basic_block(ctx);
-    char* update_bb = get_next_basic_block(ctx);
-    char* end_bb = get_next_basic_block(ctx);
+    int cond_bb = get_next_basic_block(ctx);
+    int body_bb = get_next_basic_block(ctx);
+    int update_bb = get_next_basic_block(ctx);
+    int end_bb = get_next_basic_block(ctx);
 
     /* Save previous loop labels */
-    char* saved_break = ctx->loop_break_label;
-    char* saved_continue = ctx->loop_continue_label;
+    int saved_break = ctx->loop_break_block;
+    int saved_continue = ctx->loop_continue_block;
 
     /* Set current loop labels */
-    ctx->loop_break_label = end_bb;
-    ctx->loop_continue_label = update_bb;
+    ctx->loop_break_block = end_bb;
+    ctx->loop_continue_block = update_bb;
+    const Symbol* scope = ctx->local_symbols;
 
     /* Init */
     if (stmt->data.for_stmt.init) {
@@ -2479,235 +3737,242 @@ void generate_for_statement(CodeGenContext* ctx, ASTNode* stmt) {
     }
 
     /* Jump to condition */
-    emit_instruction(ctx, "br label %%%s", cond_bb);
+    ir_build_br(&ctx->builder, cond_bb);
 
     /* Condition block */
-    emit_basic_block_label(ctx, cond_bb);
-    if (stmt->data.for_stmt.condition) {
-        LLVMValue* condition = generate_expression(ctx, stmt->data.for_stmt.condition);
-        if (condition) {
-            condition = load_value_if_needed(ctx, condition);
-            char cond_operand[MAX_OPERAND_STRING_LENGTH];
-            format_operand(condition, cond_operand, sizeof(cond_operand));
-
-            if (condition->llvm_type && condition->llvm_type->base_type == TYPE_BOOL) {
-                emit_instruction(ctx, "br i1 %s, label %%%s, label %%%s", cond_operand, body_bb, end_bb);
-            } else {
-                char* cmp_reg = get_next_register(ctx);
-                emit_instruction(ctx, "%%%s = icmp ne i32 %s, 0", cmp_reg, cond_operand);
-                emit_instruction(ctx, "br i1 %%%s, label %%%s, label %%%s", cmp_reg, body_bb, end_bb);
-                free(cmp_reg);
-            }
-            free_llvm_value(condition);
-        }
+    ir_builder_set_block(&ctx->builder, cond_bb);
+    /* The condition clause is an expression statement */
+    ASTNode* condition = stmt->data.for_stmt.condition;
+    if (condition && condition->type == AST_EXPRESSION_STMT) {
+        condition = condition->data.return_stmt.expression;
+    }
+    if (condition) {
+        generate_condition_branch(ctx, condition, body_bb, end_bb);
     } else {
         /* No condition = always true */
-        emit_instruction(ctx, "br label %%%s", body_bb);
+        ir_build_br(&ctx->builder, body_bb);
     }
 
     /* Body block - must be a compound statement for proper control flow */
-    emit_basic_block_label(ctx, body_bb);
+    ir_builder_set_block(&ctx->builder, body_bb);
     generate_statement(ctx, stmt->data.for_stmt.body);
-    /* Don't generate fallthrough br - compound statement handles it */
+    if (!block_is_terminated(ctx))
+        ir_build_br(&ctx->builder, update_bb);
 
     /* Update block (implicit fallthrough target for normal statements) */
-    emit_basic_block_label(ctx, update_bb);
+    ir_builder_set_block(&ctx->builder, update_bb);
     if (stmt->data.for_stmt.update) {
-        LLVMValue* update_result = generate_expression(ctx, stmt->data.for_stmt.update);
-        if (update_result) {
-            free_llvm_value(update_result);
-        }
+        generate_expression(ctx, stmt->data.for_stmt.update);
     }
-    emit_instruction(ctx, "br label %%%s", cond_bb);
+    ir_build_br(&ctx->builder, cond_bb);
 
     /* End block */
-    emit_basic_block_label(ctx, end_bb);
+    ir_builder_set_block(&ctx->builder, end_bb);
+    leave_scope(ctx, scope);
 
     /* Restore loop labels */
-    ctx->loop_break_label = saved_break;
-    ctx->loop_continue_label = saved_continue;
+    ctx->loop_break_block = saved_break;
+    ctx->loop_continue_block = saved_continue;
+}
 
-    free(cond_bb);
-    free(body_bb);
-    free(update_bb);
-    free(end_bb);
+/* The case and default labels of a switch body, in source order. Labels
+ * nested in blocks, ifs and loops belong to the switch too; those of a
+ * nested switch do not. */
+static void collect_cases(CodeGenContext* ctx, ASTNode* node,
+                          std::vector<SwitchCase>& cases) {
+    if (!node)
+        return;
+    switch (node->type) {
+    case AST_CASE_STMT:
+    case AST_DEFAULT_STMT: {
+        SwitchCase entry = {node, 0, 0};
+        ConstantValue label;
+        if (node->type == AST_DEFAULT_STMT) {
+            entry.block = get_next_basic_block(ctx);
+        } else if (evaluate_constant_expression(
+                       ctx, node->data.case_stmt.value, &label)) {
+            entry.value = (int)label.value;
+            entry.block = get_next_basic_block(ctx);
+        } else {
+            codegen_error(ctx, "Case label is not an integer "
+                               "constant expression");
+        }
+        if (entry.block)
+            cases.push_back(entry);
+        collect_cases(ctx, node->data.case_stmt.statement, cases);
+        break;
+    }
+    case AST_COMPOUND_STMT:
+        for (ASTNode* item = node->data.compound_stmt.statements; item;
+             item = item->next) {
+            collect_cases(ctx, item, cases);
+        }
+        break;
+    case AST_IF_STMT:
+        collect_cases(ctx, node->data.if_stmt.then_stmt, cases);
+        collect_cases(ctx, node->data.if_stmt.else_stmt, cases);
+        break;
+    case AST_WHILE_STMT:
+    case AST_DO_WHILE_STMT:
+        collect_cases(ctx, node->data.while_stmt.body, cases);
+        break;
+    case AST_FOR_STMT:
+        collect_cases(ctx, node->data.for_stmt.body, cases);
+        break;
+    default:
+        break;
+    }
 }
 
+/* One switch instruction dispatches to a block per label. The body is
+ * generated in source order, so a case without a break falls through into
+ * the next label's block; break goes to the end. */
 void generate_switch_statement(CodeGenContext* ctx, ASTNode* stmt) {
     if (!stmt || !stmt->data.switch_stmt.expression) {
         codegen_error(ctx, "Invalid switch statement");
         return;
     }
 
-    emit_comment(ctx, "switch statement");
+    ir_build_comment(&ctx->builder, "switch statement");
 
     /* Generate switch expression */
-    LLVMValue* switch_val = generate_expression(ctx, stmt->data.switch_stmt.expression);
-    if (!switch_val) return;
+    LLVMValue switch_val = generate_expression(ctx, stmt->data.switch_stmt.expression);
+    if (switch_val.type == LLVM_VALUE_NONE) return;
     switch_val = load_value_if_needed(ctx, switch_val);
 
-    char switch_operand[MAX_OPERAND_STRING_LENGTH];
-    format_operand(switch_val, switch_operand, sizeof(switch_operand));
-
-    /* Create end label for break statements */
-    char* end_bb = get_next_basic_block(ctx);
-    char* saved_break = ctx->loop_break_label;
-    ctx->loop_break_label = end_bb;
-
-    /* Collect case statements from the body */
+    IRValue switch_operand = ir_operand(&switch_val, int_type(ctx));
     ASTNode* body = stmt->data.switch_stmt.body;
-    if (body && body->type == AST_COMPOUND_STMT) {
-        ASTNode* current = body->data.compound_stmt.statements;
-        ASTNode* default_stmt = NULL;
-        char* default_bb = NULL;
-
-        /* First pass: generate labels for each case */
-        while (current) {
-            if (current->type == AST_CASE_STMT) {
-                char* case_bb = get_next_basic_block(ctx);
-                int case_val = current->data.case_stmt.value->data.constant.value.int_val;
-
-                /* Compare and branch */
-                char* cmp_reg = get_next_register(ctx);
-                emit_instruction(ctx, "%%%s = icmp eq i32 %s, %d", cmp_reg, switch_operand, case_val);
-
-                char* next_check_bb = get_next_basic_block(ctx);
-                emit_instruction(ctx, "br i1 %%%s, label %%%s, label %%%s", cmp_reg, case_bb, next_check_bb);
-
-                /* Case body */
-                emit_basic_block_label(ctx, case_bb);
-                generate_statement(ctx, current->data.case_stmt.statement);
-                emit_instruction(ctx, "br label %%%s", end_bb);
-
-                /* Continue checking */
-                emit_basic_block_label(ctx, next_check_bb);
-
-                free(cmp_reg);
-                free(case_bb);
-                free(next_check_bb);
-            } else if (current->type == AST_DEFAULT_STMT) {
-                default_stmt = current;
-                default_bb = get_next_basic_block(ctx);
-            }
-            current = current->next;
-        }
 
-        /* Handle default case or fall through to end */
-        if (default_stmt && default_bb) {
-            emit_instruction(ctx, "br label %%%s", default_bb);
-            emit_basic_block_label(ctx, default_bb);
-            generate_statement(ctx, default_stmt->data.case_stmt.statement);
-            emit_instruction(ctx, "br label %%%s", end_bb);
-            free(default_bb);
+    std::vector<SwitchCase> cases;
+    collect_cases(ctx, body, cases);
+
+    int end_bb = get_next_basic_block(ctx);
+    int default_bb = 0;
+    std::vector<IRValue> values;
+    std::vector<int> blocks;
+    std::unordered_set<long long> seen;
+    for (const SwitchCase& entry : cases) {
+        if (entry.label->type == AST_DEFAULT_STMT) {
+            if (default_bb)
+                codegen_error(ctx, "Multiple default labels in one switch");
+            default_bb = entry.block;
+        } else if (!seen.insert(entry.value).second) {
+            codegen_error(ctx, "Duplicate case value %lld", entry.value);
         } else {
-            emit_instruction(ctx, "br label %%%s", end_bb);
+            values.push_back(ir_constant((int)entry.value, int_type(ctx)));
+            blocks.push_back(entry.block);
         }
     }
+    ir_build_switch(&ctx->builder, switch_operand,
+                    default_bb ? default_bb : end_bb, values.data(),
+                    blocks.data(), (int)values.size());
+
+    int saved_break = ctx->loop_break_block;
+    SwitchCase* saved_cases = ctx->switch_cases;
+    int saved_case_count = ctx->switch_case_count;
+    ctx->loop_break_block = end_bb;
+    ctx->switch_cases = cases.data();
+    ctx->switch_case_count = (int)cases.size();
+
+    /* Statements before the first label are unreachable */
+    ASTNode* first = body && body->type == AST_COMPOUND_STMT
+                         ? body->data.compound_stmt.statements
+                         : body;
+    if (first && first->type != AST_CASE_STMT &&
+        first->type != AST_DEFAULT_STMT) {
+        ir_builder_set_block(&ctx->builder, get_next_basic_block(ctx));
+    }
+    generate_statement(ctx, body);
+    if (!block_is_terminated(ctx))
+        ir_build_br(&ctx->builder, end_bb);
 
     /* End block */
-    emit_basic_block_label(ctx, end_bb);
+    ir_builder_set_block(&ctx->builder, end_bb);
 
-    /* Restore break label */
-    ctx->loop_break_label = saved_break;
+    ctx->loop_break_block = saved_break;
+    ctx->switch_cases = saved_cases;
+    ctx->switch_case_count = saved_case_count;
+}
 
-    free(end_bb);
-    free_llvm_value(switch_val);
+/* A label starts its block; the code before it falls through */
+static void generate_case_label(CodeGenContext* ctx, ASTNode* stmt) {
+    const SwitchCase* entry = NULL;
+    for (int i = 0; i < ctx->switch_case_count; i++) {
+        if (ctx->switch_cases[i].label == stmt) {
+            entry = &ctx->switch_cases[i];
+            break;
+        }
+    }
+    if (entry) {
+        if (!block_is_terminated(ctx))
+            ir_build_br(&ctx->builder, entry->block);
+        ir_builder_set_block(&ctx->builder, entry->block);
+    } else if (!ctx->switch_cases) {
+        codegen_error(ctx, "%s label not within a switch statement",
+                      stmt->type == AST_CASE_STMT ? "Case" : "Default");
+    }
+    generate_statement(ctx, stmt->data.case_stmt.statement);
 }
 
 /* Expression generation */
-LLVMValue* generate_function_call(CodeGenContext* ctx, ASTNode* call) {
+LLVMValue generate_function_call(CodeGenContext* ctx, ASTNode* call) {
     if (!call || !call->data.function_call.function) {
         codegen_error(ctx, "Invalid function call");
-        return NULL;
+        return llvm_no_value();
     }
 
     /* Get function name - don't generate it as expression */
     char* func_name = call->data.function_call.function->data.identifier.name;
 
     /* Process arguments */
-    char arg_list[1024] = "";
+    std::vector<IRValue> args;
     ASTNode* arg = call->data.function_call.arguments;
     int arg_count = 0;
 
     while (arg) {
-        LLVMValue* arg_val = generate_expression(ctx, arg);
-        if (!arg_val) {
+        LLVMValue arg_val = generate_expression(ctx, arg);
+        if (arg_val.type == LLVM_VALUE_NONE) {
             codegen_error(ctx,
                           "Failed to generate argument %d for function call",
                           arg_count);
-            return NULL;
+            return arg_val;
         }
 
         arg_val = load_value_if_needed(ctx, arg_val);
 
         /* Promote i1 (bool) to i32 (int) for varargs compatibility */
-        if (arg_val->llvm_type && arg_val->llvm_type->base_type == TYPE_BOOL) {
-            char cond_operand[MAX_OPERAND_STRING_LENGTH];
-            format_operand(arg_val, cond_operand, sizeof(cond_operand));
-
-            char* zext_reg = get_next_register(ctx);
-            emit_instruction(ctx, "%%%s = zext i1 %s to i32", zext_reg, cond_operand);
-
-            /* Create new LLVMValue for the promoted argument */
-            TypeInfo* i32_type = create_type_info(TYPE_INT);
-            // We need to manage memory for i32_type correctly, but simplify for now
-            // Or better, reuse existing type info creation if possible, but create_type_info mallocs new.
-            // It will leak if not freed, but let's accept it for now or free arg_val->llvm_type?
-
-            LLVMValue* promoted_val = create_llvm_value(LLVM_VALUE_REGISTER, zext_reg, i32_type);
-
-            free_llvm_value(arg_val);
-            arg_val = promoted_val;
-            free(zext_reg);
-        }
+        if (arg_val.llvm_type && arg_val.llvm_type->base_type == TYPE_BOOL) {
+            int zext_reg = build_cast(ctx, IR_ZEXT, ir_operand(&arg_val, NULL),
+                                      int_type(ctx));
 
-        if (arg_count > 0) {
-            strcat(arg_list, ", ");
+            arg_val = llvm_register(zext_reg, int_type(ctx));
         }
 
-        char arg_spec[256];
-        char* type_str = llvm_type_to_string(arg_val->llvm_type);
+        args.push_back(ir_operand(&arg_val, NULL));
 
-        if (arg_val->type == LLVM_VALUE_CONSTANT) {
-            /* For constants, use the value directly */
-            snprintf(arg_spec, sizeof(arg_spec), "%s %s", type_str, arg_val->name);
-        } else if (arg_val->type == LLVM_VALUE_GLOBAL) {
-            /* For global values (like string literals), use @ notation */
-            snprintf(arg_spec, sizeof(arg_spec), "%s @%s", type_str, arg_val->name);
-        } else {
-            /* For variables/registers, use register notation */
-            snprintf(arg_spec, sizeof(arg_spec), "%s %%%s", type_str, arg_val->name);
-        }
-        strcat(arg_list, arg_spec);
-        free(type_str);
-
-        free_llvm_value(arg_val);
         arg = arg->next;
         arg_count++;
     }
 
-    char* result_reg = get_next_register(ctx);
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                                          create_type_info(TYPE_INT));
+    int result_reg = get_next_register(ctx);
 
-    /* Build function prototype for the call instruction (needed for variadic calls) */
-    char proto[1024] = "";
-    if (strcmp(func_name, "printf") == 0 || strcmp(func_name, "scanf") == 0) {
-        snprintf(proto, sizeof(proto), "(i8*, ...) ");
-    }
+    /* Variadic calls spell out the callee's prototype */
+    int is_variadic =
+        strcmp(func_name, "printf") == 0 || strcmp(func_name, "scanf") == 0;
+    TypeInfo* format_type =
+        canonical_pointer_type(ctx, canonical_basic_type(ctx, TYPE_CHAR));
 
-    emit_instruction(ctx, "%%%s = call i32 %s@%s(%s)", result->name, proto, func_name,
-                     arg_list);
+    ir_build_call(&ctx->builder, ir_register(result_reg, int_type(ctx)),
+                  int_type(ctx), func_name, &format_type, 1, is_variadic,
+                  args.data(), (int)args.size());
 
-    /* Free the original result_reg since create_llvm_value duplicated it */
-    free(result_reg);
-    return result;
+    return llvm_register(result_reg, int_type(ctx));
 }
 
-LLVMValue* generate_array_access(CodeGenContext* ctx, ASTNode* access) {
+LLVMValue generate_array_access(CodeGenContext* ctx, ASTNode* access) {
     if (!access || access->type != AST_ARRAY_ACCESS) {
         codegen_error(ctx, "Invalid array access node");
-        return NULL;
+        return llvm_no_value();
     }
 
     ASTNode* array_node = access->data.array_access.array;
@@ -2715,87 +3980,77 @@ LLVMValue* generate_array_access(CodeGenContext* ctx, ASTNode* access) {
 
     if (!array_node || !index_node) {
         codegen_error(ctx, "Invalid array access: missing array or index");
-        return NULL;
+        return llvm_no_value();
     }
 
     /* Generate array (should evaluate to pointer) */
-    LLVMValue* array_value = generate_expression(ctx, array_node);
-    if (!array_value) {
+    LLVMValue array_value = generate_expression(ctx, array_node);
+    if (array_value.type == LLVM_VALUE_NONE) {
         codegen_error(ctx, "Failed to generate array expression");
-        return NULL;
+        return array_value;
     }
 
     /* Generate index */
-    LLVMValue* index_value = generate_expression(ctx, index_node);
-    if (!index_value) {
+    LLVMValue index_value = generate_expression(ctx, index_node);
+    if (index_value.type == LLVM_VALUE_NONE) {
         codegen_error(ctx, "Failed to generate index expression");
-        free_llvm_value(array_value);
-        return NULL;
+        return index_value;
     }
 
     index_value = load_value_if_needed(ctx, index_value);
 
     /* Get element pointer */
-    char* gep_reg = get_next_register(ctx);
-    char array_operand[MAX_OPERAND_STRING_LENGTH];
-    char index_operand[MAX_OPERAND_STRING_LENGTH];
-    format_operand(array_value, array_operand, sizeof(array_operand));
-    format_operand(index_value, index_operand, sizeof(index_operand));
+    int gep_reg = get_next_register(ctx);
 
     /* Determine the element type from the array's pointer type */
+    TypeInfo* array_type = array_value.llvm_type;
     TypeInfo* element_type = NULL;
-    if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_POINTER) {
-        element_type = array_value->llvm_type->return_type;
-    } else if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_ARRAY) {
-        element_type = array_value->llvm_type->return_type;
+    if (array_type && (array_type->base_type == TYPE_POINTER ||
+                       array_type->base_type == TYPE_ARRAY)) {
+        element_type = array_type->return_type;
     }
 
     if (!element_type) {
         /* Default to int */
-        element_type = create_type_info(TYPE_INT);
+        element_type = canonical_basic_type(ctx, TYPE_INT);
     }
 
-    char* element_type_str = llvm_type_to_string(element_type);
-    char* pointer_type_str = llvm_type_to_string(array_value->llvm_type);
-
-    if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_ARRAY) {
-        emit_instruction(ctx, "%%%s = getelementptr %s, %s* %s, i32 0, i32 %s",
-                         gep_reg, pointer_type_str, pointer_type_str,
-                         array_operand, index_operand);
-    } else if (array_value->llvm_type && array_value->llvm_type->base_type == TYPE_POINTER &&
-               array_value->llvm_type->return_type &&
-               array_value->llvm_type->return_type->base_type == TYPE_ARRAY) {
+    TypeInfo* element = canonical_type(ctx, element_type);
+    IRValue gep_result =
+        ir_register(gep_reg, canonical_pointer_type(ctx, element_type));
+    IRValue indices[2] = {ir_constant(0, int_type(ctx)),
+                          ir_operand(&index_value, int_type(ctx))};
+
+    if (array_type && array_type->base_type == TYPE_ARRAY) {
+        ir_build_gep(&ctx->builder, gep_result, canonical_type(ctx, array_type),
+                     ir_operand(&array_value,
+                                canonical_pointer_type(ctx, array_type)),
+                     indices, 2);
+    } else if (array_type && array_type->base_type == TYPE_POINTER &&
+               array_type->return_type &&
+               array_type->return_type->base_type == TYPE_ARRAY) {
         /* Pointer to array: decay to pointer to first element (GEP 0, index) */
-        emit_instruction(ctx, "%%%s = getelementptr %s, %s %s, i32 0, i32 %s",
-                         gep_reg, element_type_str, pointer_type_str,
-                         array_operand, index_operand);
+        ir_build_gep(&ctx->builder, gep_result, element,
+                     ir_operand(&array_value, canonical_type(ctx, array_type)),
+                     indices, 2);
     } else {
-        emit_instruction(ctx, "%%%s = getelementptr %s, %s %s, i32 %s",
-                         gep_reg, element_type_str, pointer_type_str,
-                         array_operand, index_operand);
+        ir_build_gep(&ctx->builder, gep_result, element,
+                     ir_operand(&array_value, canonical_type(ctx, array_type)),
+                     indices + 1, 1);
     }
 
-    free(element_type_str);
-    free(pointer_type_str);
 
     /* Return the GEP result as lvalue (address) */
     /* If the caller needs the value, it will call load_value_if_needed */
-    TypeInfo* result_type = duplicate_type_info(element_type);
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, gep_reg, result_type);
-    result->is_lvalue = 1; /* Result is an address */
-
-    free(gep_reg);
-
-    free_llvm_value(array_value);
-    free_llvm_value(index_value);
-
+    LLVMValue result = llvm_register(gep_reg, element_type);
+    result.is_lvalue = 1; /* Result is an address */
     return result;
 }
 
-LLVMValue* generate_member_access(CodeGenContext* ctx, ASTNode* access) {
+LLVMValue generate_member_access(CodeGenContext* ctx, ASTNode* access) {
     if (!access || access->type != AST_MEMBER_ACCESS) {
         codegen_error(ctx, "Invalid member access node");
-        return NULL;
+        return llvm_no_value();
     }
 
     ASTNode* object = access->data.member_access.object;
@@ -2805,25 +4060,24 @@ LLVMValue* generate_member_access(CodeGenContext* ctx, ASTNode* access) {
     if (!object || !member_name) {
         codegen_error(ctx,
                       "Invalid member access: missing object or member name");
-        return NULL;
+        return llvm_no_value();
     }
 
     /* Generate code for the object being accessed */
-    LLVMValue* object_value = generate_expression(ctx, object);
-    if (!object_value) {
+    LLVMValue object_value = generate_expression(ctx, object);
+    if (object_value.type == LLVM_VALUE_NONE) {
         codegen_error(ctx, "Failed to generate object for member access");
-        return NULL;
+        return object_value;
     }
 
     /* Determine the struct type */
-    TypeInfo* struct_type = object_value->llvm_type;
+    TypeInfo* struct_type = object_value.llvm_type;
 
     /* If this is pointer access (->), dereference the pointer */
     if (is_pointer_access) {
         if (!struct_type || struct_type->base_type != TYPE_POINTER) {
             codegen_error(ctx, "Arrow operator used on non-pointer type");
-            free_llvm_value(object_value);
-            return NULL;
+            return llvm_no_value();
         }
         /* Get the pointed-to type */
         struct_type = struct_type->return_type;
@@ -2832,50 +4086,33 @@ LLVMValue* generate_member_access(CodeGenContext* ctx, ASTNode* access) {
     /* Verify we have a struct type */
     if (!struct_type || struct_type->base_type != TYPE_STRUCT) {
         codegen_error(ctx, "Member access on non-struct type");
-        free_llvm_value(object_value);
-        return NULL;
+        return llvm_no_value();
     }
 
     /* For now, assume all struct members are integers at offset 0 */
     /* This is a basic implementation - real implementation would need */
     /* struct layout and member offset calculation */
 
-    char* result_reg = get_next_register(ctx);
-    LLVMValue* result = create_llvm_value(LLVM_VALUE_REGISTER, result_reg,
-                                          create_type_info(TYPE_INT));
-
-    if (is_pointer_access) {
-        /* ptr->member: load from pointer + member offset */
-        emit_instruction(ctx,
-                         "%%%s = getelementptr %%struct.%s, %%struct.%s* %%%s, "
-                         "i32 0, i32 0",
-                         result_reg,
-                         struct_type->struct_name ? struct_type->struct_name
-                                                  : "unknown",
-                         struct_type->struct_name ? struct_type->struct_name
-                                                  : "unknown",
-                         object_value->name);
-        emit_instruction(ctx, "%%%s = load i32, i32* %%%s", result_reg,
-                         result_reg);
-    } else {
-        /* obj.member: get address of member and load */
-        char* member_ptr = get_next_register(ctx);
-        emit_instruction(ctx,
-                         "%%%s = getelementptr %%struct.%s, %%struct.%s* %%%s, "
-                         "i32 0, i32 0",
-                         member_ptr,
-                         struct_type->struct_name ? struct_type->struct_name
-                                                  : "unknown",
-                         struct_type->struct_name ? struct_type->struct_name
-                                                  : "unknown",
-                         object_value->name);
-        emit_instruction(ctx, "%%%s = load i32, i32* %%%s", result_reg,
-                         member_ptr);
-        free(member_ptr);
-    }
-
-    /* Clean up */
-    free_llvm_value(object_value);
-    free(result_reg);
-    return result;
-}
\ No newline at end of file
+    int result_reg = get_next_register(ctx);
+    TypeInfo* record_type = canonical_type(ctx, struct_type);
+    if (!struct_type->struct_name) {
+        TypeInfo named = *struct_type;
+        named.struct_name = const_cast<char*>("unknown");
+        record_type = canonical_type(ctx, &named);
+    }
+    IRValue object_operand = ir_operand(
+        &object_value, canonical_pointer_type(ctx, record_type));
+    TypeInfo* member_pointer = canonical_pointer_type(ctx, int_type(ctx));
+    IRValue indices[2] = {ir_constant(0, int_type(ctx)),
+                          ir_constant(0, int_type(ctx))};
+
+    /* ptr->member reuses the result register for the member address */
+    int member_ptr = is_pointer_access ? result_reg : get_next_register(ctx);
+    IRValue member = ir_register(member_ptr, member_pointer);
+    ir_build_gep(&ctx->builder, member, record_type, object_operand, indices,
+                 2);
+    ir_build_load(&ctx->builder, ir_register(result_reg, int_type(ctx)),
+                  int_type(ctx), member);
+
+    return llvm_register(result_reg, int_type(ctx));
+}
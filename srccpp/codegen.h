@@ -3,7 +3,11 @@
 
 extern "C" {
 
+#include "../src/string_pool.h"
 #include "ast.h"
+#include "ir.h"
+#include "ir_buffer.h"
+#include "target.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -14,15 +18,54 @@ typedef struct CodeGenContext CodeGenContext;
 typedef struct LLVMValue LLVMValue;
 typedef struct BasicBlock BasicBlock;
 typedef struct GlobalConstant GlobalConstant;
+typedef struct Diagnostic Diagnostic;
 
 /* Global constant for module-level emission */
 struct GlobalConstant {
-    char* declaration;
+    char* declaration; /* Stored in the owning section's arena */
+    size_t length;
     GlobalConstant* next;
 };
 
+typedef struct ConstantArenaBlock ConstantArenaBlock;
+
+/* Module-level constants in emission order. Entries and their text are
+ * carved out of arena blocks, so an append costs one formatting pass and a
+ * bump allocation, and the section is released block by block. */
+typedef struct ConstantSection {
+    GlobalConstant* head;
+    GlobalConstant* tail;
+    int count;
+    ConstantArenaBlock* blocks;
+    IRBuffer scratch; /* Formatting space reused between appends */
+} ConstantSection;
+
+/* A case or default label of the switch being generated and the block it
+ * starts; value is unused for default */
+typedef struct SwitchCase {
+    ASTNode* label;
+    long long value;
+    int block;
+} SwitchCase;
+
+/* Diagnostic collected during parsing or code generation */
+typedef enum {
+    DIAGNOSTIC_WARNING,
+    DIAGNOSTIC_ERROR
+} DiagnosticSeverity;
+
+struct Diagnostic {
+    DiagnosticSeverity severity;
+    const char* file_name; /* Translation unit, or NULL when unknown */
+    int line;   /* 0 when unknown */
+    int column; /* 0 when unknown */
+    char* message;
+    Diagnostic* next;
+};
+
 /* LLVM value representation */
 typedef enum {
+    LLVM_VALUE_NONE, /* No value: generation failed or produced nothing */
     LLVM_VALUE_REGISTER,
     LLVM_VALUE_GLOBAL,
     LLVM_VALUE_CONSTANT,
@@ -30,17 +73,17 @@ typedef enum {
     LLVM_VALUE_BASIC_BLOCK
 } LLVMValueType;
 
+/* Values are small and passed by copy. Numbered registers and constants
+ * are plain integers, formatted only when an instruction is emitted; named
+ * registers and globals point at names owned by the symbol table or the
+ * string pool. Types are canonical and owned by the context. */
 struct LLVMValue {
     LLVMValueType type;
-    char* name;
-    TypeInfo* llvm_type;
+    int id;              /* Register number or constant value */
+    const char* name;    /* Named register or global, else NULL */
+    TypeInfo* llvm_type; /* Canonical, see canonical_type */
     int is_lvalue;
     int is_array_pointer; /* true if this value is a pointer to an array (needs decay) */
-    union {
-        int reg_id;
-        int constant_val;
-        char* global_name;
-    } data;
 };
 
 /* Basic block for control flow */
@@ -52,9 +95,13 @@ struct BasicBlock {
 
 /* Code generation context */
 struct CodeGenContext {
-    FILE* output;
+    FILE* output; /* Sink of out */
+    IRBuffer out; /* All IR text goes through this buffer */
+    IRBuilder builder; /* Function being lowered; printed to out when done */
+    IRConsumer* consumer; /* Takes functions and globals instead; NULL: text */
     int next_reg_id;
     int next_bb_id;
+    TypeTable types;
     int current_function_id;
 
     /* Symbol tables */
@@ -65,49 +112,100 @@ struct CodeGenContext {
     BasicBlock* current_bb;
     BasicBlock* bb_list;
 
-    /* Loop labels for break/continue */
-    char* loop_break_label;
-    char* loop_continue_label;
+    /* Blocks for break/continue (0: none) */
+    int loop_break_block;
+    int loop_continue_block;
+    /* Labels of the innermost switch (NULL outside a switch body) */
+    SwitchCase* switch_cases;
+    int switch_case_count;
     int needs_fallthrough;  /* Flag to track if fallthrough is needed */
 
     /* Function information */
     char* current_function_name;
     TypeInfo* current_function_return_type;
 
-    /* Temporary storage */
-    char temp_buffer[1024];
     int indent_level;
 
     /* Global constants to be emitted at module level */
-    GlobalConstant* global_constants;
+    ConstantSection constants;
+    /* Write constants as soon as the current top-level construct is done
+     * instead of collecting them for the end of the module */
+    int stream_constants;
+    /* IRPrintFlags of the text output */
+    int ir_flags;
+    /* Promote scalar locals to SSA registers before a function is printed
+     * or consumed (-fssa) */
+    int ssa;
+    /* ABI of the generated module (--target); the host unless set */
+    const TargetInfo* target;
+
+    /* String literals, pooled per function; entry n is @.str.<function>.<n> */
+    StringPool strings;
+
+    /* Worker threads for function bodies; <= 1 generates them in order */
+    int codegen_jobs;
+
+    /* Whole-program mode: the AST holds every translation unit, and all
+     * symbols except main and the exported ones get internal linkage */
+    int whole_program;
+    const char* const* exported_symbols;
+    int exported_count;
+
+    /* Diagnostics, in report order; echoed to stderr unless quiet */
+    Diagnostic* diagnostics;
+    Diagnostic* diagnostics_tail;
+    int error_count;
+    int quiet_diagnostics;
 };
 
 /* Function prototypes */
 CodeGenContext* create_codegen_context(FILE* output);
+/* Context whose IR stays in ctx->out, taken with ir_buffer_release */
+CodeGenContext* create_buffered_codegen_context(void);
 void free_codegen_context(CodeGenContext* ctx);
+/* Print any IR still being built and hand buffered IR to the output;
+ * returns 0 on success */
+int codegen_flush_output(CodeGenContext* ctx);
 
 /* Main code generation functions */
 void generate_llvm_ir(CodeGenContext* ctx, ASTNode* ast);
-LLVMValue* generate_expression(CodeGenContext* ctx, ASTNode* expr);
+/* Whole-program mode: rename the file-scope static functions and variables
+ * of one unit to NAME.<unit_index>, with their uses in that unit */
+void qualify_unit_statics(ASTNode* unit, int unit_index);
+LLVMValue generate_expression(CodeGenContext* ctx, ASTNode* expr);
 void generate_statement(CodeGenContext* ctx, ASTNode* stmt);
 void generate_declaration(CodeGenContext* ctx, ASTNode* decl);
 void generate_function_definition(CodeGenContext* ctx, ASTNode* func_def);
 
 /* Expression generation */
-LLVMValue* generate_binary_op(CodeGenContext* ctx, ASTNode* expr);
-LLVMValue* generate_conditional_op(CodeGenContext* ctx, ASTNode* expr);
-LLVMValue* generate_cast(CodeGenContext* ctx, ASTNode* expr);
-
-LLVMValue* generate_assignment_op(CodeGenContext* ctx, ASTNode* expr);
-LLVMValue* generate_unary_op(CodeGenContext* ctx, ASTNode* expr);
-LLVMValue* generate_function_call(CodeGenContext* ctx, ASTNode* call);
-LLVMValue* generate_array_access(CodeGenContext* ctx, ASTNode* access);
-LLVMValue* generate_member_access(CodeGenContext* ctx, ASTNode* access);
-LLVMValue* generate_pointer_arithmetic_op(CodeGenContext* ctx, BinaryOp op,
-                                          LLVMValue* left, LLVMValue* right);
-LLVMValue* generate_identifier(CodeGenContext* ctx, ASTNode* identifier);
-LLVMValue* generate_constant(CodeGenContext* ctx, ASTNode* constant);
-LLVMValue* generate_string_literal(CodeGenContext* ctx, ASTNode* string_lit);
+LLVMValue generate_binary_op(CodeGenContext* ctx, ASTNode* expr);
+LLVMValue generate_conditional_op(CodeGenContext* ctx, ASTNode* expr);
+LLVMValue generate_cast(CodeGenContext* ctx, ASTNode* expr);
+
+LLVMValue generate_assignment_op(CodeGenContext* ctx, ASTNode* expr);
+LLVMValue generate_unary_op(CodeGenContext* ctx, ASTNode* expr);
+LLVMValue generate_function_call(CodeGenContext* ctx, ASTNode* call);
+LLVMValue generate_array_access(CodeGenContext* ctx, ASTNode* access);
+LLVMValue generate_member_access(CodeGenContext* ctx, ASTNode* access);
+LLVMValue generate_pointer_arithmetic_op(CodeGenContext* ctx, BinaryOp op,
+                                         LLVMValue left, LLVMValue right);
+LLVMValue generate_identifier(CodeGenContext* ctx, ASTNode* identifier);
+LLVMValue generate_constant(CodeGenContext* ctx, ASTNode* constant);
+LLVMValue generate_string_literal(CodeGenContext* ctx, ASTNode* string_lit);
+
+/* Integer constant expressions (C11 6.6): literals, enumeration constants,
+ * sizeof, casts to integer types and the arithmetic, bitwise, relational,
+ * logical and conditional operators, evaluated at the width and signedness
+ * C gives them. Returns 1 and fills value when expr is one; returns 0 for
+ * anything else and for undefined operations such as division by zero. */
+typedef struct ConstantValue {
+    long long value; /* sign- or zero-extended from bits */
+    int bits;        /* 32 or 64 */
+    int is_unsigned;
+} ConstantValue;
+
+int evaluate_constant_expression(CodeGenContext* ctx, ASTNode* expr,
+                                 ConstantValue* value);
 
 /* Statement generation */
 void generate_compound_statement(CodeGenContext* ctx, ASTNode* stmt);
@@ -120,16 +218,42 @@ void generate_expression_statement(CodeGenContext* ctx, ASTNode* stmt);
 /* Type conversion */
 char* llvm_type_to_string(TypeInfo* type);
 char* get_default_value(const TypeInfo* type);
-int get_type_size(TypeInfo* type);
+int get_type_size(CodeGenContext* ctx, TypeInfo* type);
 int types_compatible(TypeInfo* type1, TypeInfo* type2);
 
-/* Utility functions */
-LLVMValue* create_llvm_value(LLVMValueType type, const char* name,
-                             TypeInfo* llvm_type);
-void free_llvm_value(LLVMValue* value);
+/* Canonical types: one shared, immutable TypeInfo per shape, freed with
+ * the context. Qualifiers, storage classes and parameters are dropped. */
+TypeInfo* canonical_type(CodeGenContext* ctx, const TypeInfo* type);
+TypeInfo* canonical_basic_type(CodeGenContext* ctx, DataType base_type);
+TypeInfo* canonical_pointer_type(CodeGenContext* ctx, const TypeInfo* pointee);
+/* llvm_type_name spells any type through its canonical one (see
+ * canonical_type_name); it does not allocate once a type has been spelled */
+const char* llvm_type_name(CodeGenContext* ctx, const TypeInfo* type);
+
+/* Value constructors */
+static inline LLVMValue llvm_value(LLVMValueType type, int id,
+                                   const char* name, TypeInfo* llvm_type) {
+    LLVMValue value = {type, id, name, llvm_type, 0, 0};
+    return value;
+}
+
+static inline LLVMValue llvm_no_value(void) {
+    return llvm_value(LLVM_VALUE_NONE, 0, NULL, NULL);
+}
+
+static inline LLVMValue llvm_register(int id, TypeInfo* llvm_type) {
+    return llvm_value(LLVM_VALUE_REGISTER, id, NULL, llvm_type);
+}
+
+static inline LLVMValue llvm_constant(int constant, TypeInfo* llvm_type) {
+    return llvm_value(LLVM_VALUE_CONSTANT, constant, NULL, llvm_type);
+}
+
+/* Write the operand spelling (%7, %x, @g or 42) into buffer */
+void format_operand(const LLVMValue* value, char* buffer, size_t buffer_size);
 
-char* get_next_register(CodeGenContext* ctx);
-char* get_next_basic_block(CodeGenContext* ctx);
+int get_next_register(CodeGenContext* ctx);
+int get_next_basic_block(CodeGenContext* ctx);
 BasicBlock* create_basic_block(CodeGenContext* ctx, const char* label);
 
 /* Symbol table management */
@@ -139,10 +263,22 @@ Symbol* lookup_symbol(CodeGenContext* ctx, const char* name);
 void clear_local_symbols(CodeGenContext* ctx);
 
 /* Output functions */
-void emit_instruction(CodeGenContext* ctx, const char* format, ...);
 void emit_global_declaration(CodeGenContext* ctx, const char* format, ...);
-void emit_function_header(CodeGenContext* ctx, const char* format, ...);
-void emit_basic_block_label(CodeGenContext* ctx, const char* label);
+
+/* Constant section */
+void constant_section_init(ConstantSection* section);
+void constant_section_free(ConstantSection* section);
+GlobalConstant* constant_section_append(ConstantSection* section,
+                                        const char* text, size_t length);
+/* Point constant at new text stored in the section */
+void constant_section_replace(ConstantSection* section,
+                              GlobalConstant* constant, const char* text,
+                              size_t length);
+/* Take over the arena of other; its entries stay valid, linked nowhere */
+void constant_section_adopt(ConstantSection* section, ConstantSection* other);
+/* Write every constant, one per line, and empty the section */
+void constant_section_write(ConstantSection* section, IRBuffer* out);
+/* Module-level comment */
 void emit_comment(CodeGenContext* ctx, const char* comment);
 
 /* Built-in functions and runtime support */
@@ -152,5 +288,7 @@ void generate_main_function_wrapper(CodeGenContext* ctx);
 /* Debugging and error reporting */
 void codegen_error(CodeGenContext* ctx, const char* message, ...);
 void codegen_warning(CodeGenContext* ctx, const char* message, ...);
+void codegen_add_diagnostic(CodeGenContext* ctx, DiagnosticSeverity severity,
+                            int line, int column, const char* message);
 }
 #endif /* CODEGEN_H */
\ No newline at end of file
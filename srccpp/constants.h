@@ -1,12 +1,6 @@
 #ifndef CONSTANTS_H
 #define CONSTANTS_H
 
-/* Type sizes in bytes */
-#define INT_SIZE_BYTES 4
-#define POINTER_SIZE_BYTES 8
-#define FLOAT_SIZE_BYTES 4
-#define DOUBLE_SIZE_BYTES 8
-
 /* Buffer sizes */
 #define MAX_REGISTER_NAME_LENGTH 32
 #define MAX_BASIC_BLOCK_NAME_LENGTH 32
@@ -0,0 +1,358 @@
+#include "driver.h"
+
+#include "constants.h"
+#include "error_handling.h"
+#include "tinyc.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <errno.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <string.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/* One translation unit in the batch */
+typedef struct BatchJob {
+    const char* input_file;
+    char* output_file; /* NULL when writing to stdout */
+    tc_result result;
+    int status;
+    char* io_error; /* Set when the input or output file failed */
+    int codegen_jobs;
+    const char* target;
+    int ssa;
+    int ir_flags;
+    bool done;
+} BatchJob;
+
+/* Shared state between the workers and the reporting thread */
+typedef struct BatchQueue {
+    std::vector<BatchJob>* jobs;
+    std::atomic<size_t> next_job;
+    std::mutex mutex;
+    std::condition_variable job_done;
+} BatchQueue;
+
+static char* format_io_error(const char* what, const char* path) {
+    char buffer[MAX_TEMP_BUFFER_SIZE];
+    snprintf(buffer, sizeof(buffer), "Cannot %s '%s': %s", what, path,
+             strerror(errno));
+    return strdup(buffer);
+}
+
+/* Read a whole file into a malloc'd buffer */
+static char* read_source_file(const char* path, size_t* length) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+
+    size_t capacity = 4096;
+    size_t size = 0;
+    char* buffer = static_cast<char*>(malloc(capacity));
+    while (buffer) {
+        size_t read_bytes = fread(buffer + size, 1, capacity - size, file);
+        size += read_bytes;
+        if (size < capacity) {
+            break;
+        }
+        capacity *= 2;
+        char* grown = static_cast<char*>(realloc(buffer, capacity));
+        if (!grown) {
+            free(buffer);
+            buffer = NULL;
+            break;
+        }
+        buffer = grown;
+    }
+
+    int failed = ferror(file);
+    fclose(file);
+    if (!buffer || failed) {
+        free(buffer);
+        return NULL;
+    }
+    *length = size;
+    return buffer;
+}
+
+static void run_job(BatchJob* job) {
+    size_t length = 0;
+    char* source = read_source_file(job->input_file, &length);
+    if (!source) {
+        job->io_error = format_io_error("read input file", job->input_file);
+        job->status = ERROR_IO;
+        memset(&job->result, 0, sizeof(tc_result));
+        return;
+    }
+
+    tc_options options = {job->input_file, job->codegen_jobs, NULL, 0,
+                          job->target, job->ssa, job->ir_flags};
+    job->status = tc_compile(source, length, &options, &job->result);
+    free(source);
+
+    if (job->output_file && job->status == ERROR_NONE) {
+        FILE* output = fopen(job->output_file, "w");
+        if (!output ||
+            fwrite(job->result.ir, 1, job->result.ir_length, output) !=
+                job->result.ir_length) {
+            job->io_error =
+                format_io_error("write output file", job->output_file);
+            job->status = ERROR_IO;
+        }
+        if (output) {
+            fclose(output);
+        }
+    }
+}
+
+static void worker_loop(BatchQueue* queue) {
+    for (;;) {
+        size_t index = queue->next_job.fetch_add(1);
+        if (index >= queue->jobs->size()) {
+            return;
+        }
+
+        BatchJob* job = &(*queue->jobs)[index];
+        run_job(job);
+
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        job->done = true;
+        queue->job_done.notify_all();
+    }
+}
+
+static void report_diagnostics(const tc_result* result,
+                               const char* default_file) {
+    for (size_t i = 0; i < result->diagnostic_count; i++) {
+        const tc_diagnostic* diag = &result->diagnostics[i];
+        const char* kind =
+            diag->severity == TC_SEVERITY_ERROR ? "error" : "warning";
+        const char* file = diag->file_name ? diag->file_name : default_file;
+        if (diag->line > 0) {
+            fprintf(stderr, "%s:%d:%d: %s: %s\n", file, diag->line,
+                    diag->column, kind, diag->message);
+        } else {
+            fprintf(stderr, "%s: %s: %s\n", file, kind, diag->message);
+        }
+    }
+}
+
+static void report_job(const BatchJob* job, int verbose) {
+    report_diagnostics(&job->result, job->input_file);
+    if (job->io_error) {
+        fprintf(stderr, "Error: %s\n", job->io_error);
+    }
+
+    if (!job->output_file && job->status == ERROR_NONE) {
+        fwrite(job->result.ir, 1, job->result.ir_length, stdout);
+    }
+
+    if (verbose) {
+        fprintf(stderr, "%s %s%s%s\n",
+                job->status == ERROR_NONE ? "Compiled" : "Failed",
+                job->input_file, job->output_file ? " -> " : "",
+                job->output_file ? job->output_file : "");
+    }
+}
+
+char* batch_output_path(const char* output_dir, const char* input_file) {
+    const char* base = strrchr(input_file, '/');
+    base = base ? base + 1 : input_file;
+    const char* dot = strrchr(base, '.');
+    size_t base_length = dot && dot != base ? (size_t)(dot - base)
+                                            : strlen(base);
+
+    size_t dir_length = strlen(output_dir);
+    while (dir_length > 1 && output_dir[dir_length - 1] == '/') {
+        dir_length--;
+    }
+
+    /* dir + '/' + base + ".ll" + NUL */
+    size_t size = dir_length + 1 + base_length + 4;
+    char* path = static_cast<char*>(malloc(size));
+    if (!path) {
+        return NULL;
+    }
+    snprintf(path, size, "%.*s/%.*s.ll", (int)dir_length, output_dir,
+             (int)base_length, base);
+    return path;
+}
+
+int compile_batch(char** input_files, int file_count, const char* output_dir,
+                  int jobs, int codegen_jobs, const char* target, int ssa,
+                  int ir_flags, int verbose) {
+    if (file_count <= 0) {
+        return 0;
+    }
+
+    /* Outputs are named by basename; two workers must not share a file */
+    if (output_dir) {
+        int collisions = 0;
+        std::unordered_map<std::string, const char*> writers;
+        for (int i = 0; i < file_count; i++) {
+            char* path = batch_output_path(output_dir, input_files[i]);
+            if (!path) {
+                continue;
+            }
+            auto inserted = writers.emplace(path, input_files[i]);
+            if (!inserted.second) {
+                fprintf(stderr,
+                        "Error: '%s' and '%s' would both be written to "
+                        "'%s'\n",
+                        inserted.first->second, input_files[i], path);
+                collisions++;
+            }
+            free(path);
+        }
+        if (collisions > 0) {
+            return file_count;
+        }
+    }
+
+    if (output_dir && mkdir(output_dir, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Error: Cannot create output directory '%s': %s\n",
+                output_dir, strerror(errno));
+        return file_count;
+    }
+
+    std::vector<BatchJob> batch(file_count);
+    for (int i = 0; i < file_count; i++) {
+        BatchJob* job = &batch[i];
+        memset(&job->result, 0, sizeof(tc_result));
+        job->input_file = input_files[i];
+        job->output_file =
+            output_dir ? batch_output_path(output_dir, input_files[i]) : NULL;
+        job->status = ERROR_NONE;
+        job->io_error = NULL;
+        job->codegen_jobs = codegen_jobs;
+        job->target = target;
+        job->ssa = ssa;
+        job->ir_flags = ir_flags;
+        job->done = false;
+    }
+
+    if (jobs <= 0) {
+        jobs = (int)std::thread::hardware_concurrency();
+    }
+    if (jobs <= 0) {
+        jobs = 1;
+    }
+    if (jobs > file_count) {
+        jobs = file_count;
+    }
+
+    BatchQueue queue;
+    queue.jobs = &batch;
+    queue.next_job = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < jobs; i++) {
+        workers.emplace_back(worker_loop, &queue);
+    }
+
+    /* Report each unit as soon as it and everything before it are done */
+    int failures = 0;
+    for (int i = 0; i < file_count; i++) {
+        BatchJob* job = &batch[i];
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.job_done.wait(lock, [job]() { return job->done; });
+        }
+        report_job(job, verbose);
+        if (job->status != ERROR_NONE) {
+            failures++;
+        }
+        tc_result_free(&job->result);
+        free(job->output_file);
+        free(job->io_error);
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (verbose) {
+        double elapsed_ms = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+        fprintf(stderr,
+                "Batch: %d file(s), %d failed, %d job(s), %.3f ms "
+                "(%.1f files/s)\n",
+                file_count, failures, jobs, elapsed_ms,
+                elapsed_ms > 0 ? file_count * 1000.0 / elapsed_ms : 0.0);
+    }
+
+    return failures;
+}
+
+int compile_whole_program(char** input_files, int file_count,
+                          const char* output_file, const char* const* exports,
+                          int export_count, int codegen_jobs,
+                          const char* target, int ssa, int ir_flags,
+                          int verbose) {
+    std::vector<tc_unit> units(file_count);
+    int status = ERROR_NONE;
+    for (int i = 0; i < file_count; i++) {
+        units[i].file_name = input_files[i];
+        units[i].src = read_source_file(input_files[i], &units[i].len);
+        if (!units[i].src) {
+            char* message = format_io_error("read input file", input_files[i]);
+            fprintf(stderr, "Error: %s\n", message);
+            free(message);
+            status = ERROR_IO;
+        }
+    }
+
+    tc_result result;
+    memset(&result, 0, sizeof(tc_result));
+    if (status == ERROR_NONE) {
+        tc_options options = {NULL, codegen_jobs, exports,
+                              (size_t)(export_count > 0 ? export_count : 0),
+                              target, ssa, ir_flags};
+        auto start = std::chrono::steady_clock::now();
+        status = tc_compile_program(units.data(), units.size(), &options,
+                                    &result);
+        report_diagnostics(&result, "<whole-program>");
+
+        if (verbose) {
+            double elapsed_ms = std::chrono::duration<double, std::milli>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count();
+            fprintf(stderr, "Whole program: %d file(s), %.3f ms\n",
+                    file_count, elapsed_ms);
+        }
+    }
+
+    if (status == ERROR_NONE) {
+        FILE* output = output_file ? fopen(output_file, "w") : stdout;
+        if (!output ||
+            fwrite(result.ir, 1, result.ir_length, output) !=
+                result.ir_length) {
+            char* message = format_io_error("write output file",
+                                            output_file ? output_file
+                                                        : "<stdout>");
+            fprintf(stderr, "Error: %s\n", message);
+            free(message);
+            status = ERROR_IO;
+        }
+        if (output && output != stdout) {
+            fclose(output);
+        }
+    }
+
+    tc_result_free(&result);
+    for (auto& unit : units) {
+        free(const_cast<char*>(unit.src));
+    }
+    return status;
+}
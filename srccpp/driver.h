@@ -0,0 +1,45 @@
+#ifndef DRIVER_H
+#define DRIVER_H
+
+extern "C" {
+
+/*
+ * Batch driver: compiles several translation units concurrently on a
+ * bounded pool of worker threads, one library compiler instance
+ * (tc_compile) per file. Diagnostics and output are reported in input
+ * order regardless of completion order.
+ *
+ * output_dir:   directory receiving one <basename>.ll per input (created
+ *               if missing), or NULL to write all IR to stdout in order.
+ *               Inputs whose outputs would share a name are rejected
+ *               before anything is compiled.
+ * jobs:         worker count; <= 0 uses the hardware concurrency.
+ * codegen_jobs: threads generating function bodies within each file.
+ * target:       target triple (target.h), or NULL for the host.
+ * ssa:          promote scalar locals to SSA registers (-fssa).
+ * ir_flags:     IRPrintFlags for the IR text (ir.h).
+ *
+ * Returns the number of translation units that failed to compile.
+ */
+int compile_batch(char** input_files, int file_count, const char* output_dir,
+                  int jobs, int codegen_jobs, const char* target, int ssa,
+                  int ir_flags, int verbose);
+
+/*
+ * Whole-program driver: compiles all inputs into one module written to
+ * output_file (NULL: stdout), with every definition except main and the
+ * exported symbols internalized (see tc_compile_program).
+ *
+ * Returns 0 on success or an ErrorType code.
+ */
+int compile_whole_program(char** input_files, int file_count,
+                          const char* output_file, const char* const* exports,
+                          int export_count, int codegen_jobs,
+                          const char* target, int ssa, int ir_flags,
+                          int verbose);
+
+/* Build "<output_dir>/<basename of input without extension>.ll" */
+char* batch_output_path(const char* output_dir, const char* input_file);
+}
+
+#endif /* DRIVER_H */
@@ -16,11 +16,47 @@ extern int yyparse(void);
 extern char* yytext;
 extern int column;
 extern FILE* yyin;
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int yylineno;
+#ifdef __cplusplus
+}
+#endif
 
 /* Global variables */
 ASTNode* program_ast = NULL;
 CodeGenContext* codegen_ctx = NULL;
 
+/* Enum specifiers define constants but yield only a type; their AST_ENUM_DECL
+ * nodes wait here for the enclosing declaration to pick them up */
+static ASTNode* pending_enums = NULL;
+
+static void queue_enum(const char* name, ASTNode* enumerators) {
+	ASTNode* decl = create_ast_node(AST_ENUM_DECL);
+	decl->data.enum_decl.name = name ? strdup(name) : NULL;
+	decl->data.enum_decl.enumerators = enumerators;
+	if (!pending_enums) {
+		pending_enums = decl;
+		return;
+	}
+	ASTNode* last = pending_enums;
+	while (last->next) last = last->next;
+	last->next = decl;
+}
+
+/* Put the pending enum declarations in front of list */
+static ASTNode* take_pending_enums(ASTNode* list) {
+	if (!pending_enums)
+		return list;
+	ASTNode* head = pending_enums;
+	ASTNode* last = head;
+	while (last->next) last = last->next;
+	last->next = list;
+	pending_enums = NULL;
+	return head;
+}
+
 /* Error handling */
 #ifdef __cplusplus
 extern "C" {
@@ -60,7 +96,7 @@ int yyerror(const char* s);
 
 %token TYPEDEF EXTERN STATIC AUTO REGISTER
 %token CHAR SHORT INT LONG SIGNED UNSIGNED FLOAT DOUBLE CONST VOLATILE VOID
-%token STRUCT UNION ENUM ELLIPSIS BOOL
+%token STRUCT UNION ENUM ELLIPSIS BOOL STATIC_ASSERT
 
 %token CASE DEFAULT IF ELSE SWITCH WHILE DO FOR GOTO CONTINUE BREAK RETURN
 
@@ -97,13 +133,15 @@ int yyerror(const char* s);
 
 %start translation_unit
 
+%initial-action { pending_enums = NULL; }
+
 %%
 
 primary_expression
 	: IDENTIFIER
 		{ $$ = create_identifier_node($1); }
 	| CONSTANT
-		{ $$ = create_constant_node(parse_constant_value($1), TYPE_INT); }
+		{ $$ = create_constant_node(parse_constant_value($1), constant_literal_type($1)); }
 	| STRING_LITERAL
 		{ $$ = create_string_literal_node($1); }
 	| '(' expression ')'
@@ -169,21 +207,9 @@ unary_expression
 		{ $$ = create_unary_op_node(UOP_SIZEOF, $2); }
 	| SIZEOF '(' type_name ')'
 		{
-			/* Create a constant node with the size of the type */
-			int size = 4; /* Default size for most types */
-			if ($3) {
-				switch ($3->base_type) {
-					case TYPE_CHAR: size = 1; break;
-					case TYPE_SHORT: size = 2; break;
-					case TYPE_INT: size = 4; break;
-					case TYPE_LONG: size = 8; break;
-					case TYPE_FLOAT: size = 4; break;
-					case TYPE_DOUBLE: size = 8; break;
-					case TYPE_POINTER: size = 8; break; /* 64-bit pointers */
-					default: size = 4; break;
-				}
-			}
-			$$ = create_constant_node(size, TYPE_INT);
+			/* Sized by code generation, which knows the target */
+			$$ = create_unary_op_node(UOP_SIZEOF, NULL);
+			$$->data_type = $3;
 		}
 	;
 
@@ -340,7 +366,7 @@ constant_expression
 
 declaration
 	: declaration_specifiers ';'
-		{ $$ = NULL; /* Empty declaration */ free_type_info($1); }
+		{ $$ = take_pending_enums(NULL); /* Empty declaration */ free_type_info($1); }
 	| declaration_specifiers init_declarator_list ';'
 		{
 			$$ = $2;
@@ -364,6 +390,13 @@ declaration
 				curr = curr->next;
 			}
 			free_type_info($1);
+			$$ = take_pending_enums($$);
+		}
+	| STATIC_ASSERT '(' constant_expression ',' STRING_LITERAL ')' ';'
+		{
+			$$ = create_ast_node(AST_STATIC_ASSERT);
+			$$->data.static_assert_decl.condition = $3;
+			$$->data.static_assert_decl.message = create_string_literal_node($5);
 		}
 	;
 
@@ -446,7 +479,7 @@ type_specifier
 	| SIGNED    { $$ = create_type_info(TYPE_SIGNED); }
 	| UNSIGNED  { $$ = create_type_info(TYPE_UNSIGNED); }
 	| struct_or_union_specifier { $$ = NULL; }
-	| enum_specifier            { $$ = NULL; }
+	| enum_specifier            { $$ = create_type_info(TYPE_INT); }
 	| TYPE_NAME                 { $$ = NULL; }
 	;
 
@@ -513,9 +546,13 @@ struct_declarator
 
 enum_specifier
 	: ENUM '{' enumerator_list '}'
-		{ $$ = NULL; }
+		{ $$ = NULL; queue_enum(NULL, $3); }
+	| ENUM '{' enumerator_list ',' '}'
+		{ $$ = NULL; queue_enum(NULL, $3); }
 	| ENUM IDENTIFIER '{' enumerator_list '}'
-		{ $$ = NULL; }
+		{ $$ = NULL; queue_enum($2, $4); }
+	| ENUM IDENTIFIER '{' enumerator_list ',' '}'
+		{ $$ = NULL; queue_enum($2, $4); }
 	| ENUM IDENTIFIER
 		{ $$ = NULL; }
 	;
@@ -524,14 +561,19 @@ enumerator_list
 	: enumerator
 		{ $$ = $1; }
 	| enumerator_list ',' enumerator
-		{ $$ = $1; }
+		{
+			$$ = $1;
+			ASTNode* current = $1;
+			while (current->next) current = current->next;
+			current->next = $3;
+		}
 	;
 
 enumerator
 	: IDENTIFIER
 		{ $$ = create_identifier_node($1); }
 	| IDENTIFIER '=' constant_expression
-		{ $$ = create_identifier_node($1); }
+		{ $$ = create_binary_op_node(OP_ASSIGN, create_identifier_node($1), $3); }
 	;
 
 type_qualifier
@@ -564,15 +606,10 @@ direct_declarator
 	| direct_declarator '[' constant_expression ']'
 		{
 			$$ = $1;
-			/* Prepend array dimension to dimension list */
-			if ($3 && $3->type == AST_CONSTANT) {
-				$3->next = $$->data.identifier.array_dimensions;
-				$$->data.identifier.array_dimensions = $3;
-			} else {
-				ASTNode* zero = create_constant_node(0, TYPE_INT);
-				zero->next = $$->data.identifier.array_dimensions;
-				$$->data.identifier.array_dimensions = zero;
-			}
+			/* Prepend array dimension to dimension list; code generation
+			 * evaluates the size */
+			$3->next = $$->data.identifier.array_dimensions;
+			$$->data.identifier.array_dimensions = $3;
 		}
 	| direct_declarator '[' ']'
 		{
@@ -911,7 +948,7 @@ translation_unit
 
 external_declaration
 	: function_definition
-		{ $$ = $1; }
+		{ $$ = take_pending_enums($1); }
 	| declaration
 		{ $$ = $1; }
 	;
@@ -938,6 +975,12 @@ extern "C" {
 #endif
 
 int yyerror(const char* s) {
+	/* Record the error on the active context, if any */
+	if (codegen_ctx) {
+		codegen_add_diagnostic(codegen_ctx, DIAGNOSTIC_ERROR, yylineno, column, s);
+		if (codegen_ctx->quiet_diagnostics)
+			return 0;
+	}
 	fflush(stdout);
 	printf("\n%*s\n%*s\n", column, "^", column, s);
 	return 0;
@@ -0,0 +1,809 @@
+#include "ir.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void* ir_malloc(size_t size) {
+    auto ptr = malloc(size);
+    if (!ptr) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
+    return ptr;
+}
+
+static char* ir_strdup(const char* str) {
+    if (!str)
+        return NULL;
+    size_t length = strlen(str) + 1;
+    auto copy = static_cast<char*>(ir_malloc(length));
+    memcpy(copy, str, length);
+    return copy;
+}
+
+/* Canonical types */
+
+/* A canonical type and its spelling; type comes first, so every canonical
+ * TypeInfo* is also a CanonicalType* */
+typedef struct CanonicalType {
+    TypeInfo type;
+    char* name;        /* LLVM spelling, built on first use */
+    char* opaque_name; /* Spelling with opaque pointers; name when equal */
+} CanonicalType;
+
+static unsigned int type_shape_hash(DataType base_type, int array_size,
+                                    const TypeInfo* element,
+                                    const char* struct_name) {
+    unsigned int hash = (unsigned int)base_type * 31u + (unsigned int)array_size;
+    hash = hash * 31u + (unsigned int)((uintptr_t)element >> 4);
+    for (const char* p = struct_name; p && *p; p++) {
+        hash = (hash * 33u) ^ (unsigned char)*p;
+    }
+    return hash;
+}
+
+static unsigned int type_hash(const TypeInfo* type) {
+    return type_shape_hash(type->base_type, type->array_size,
+                           type->return_type, type->struct_name);
+}
+
+/* Rebuild the slot table with twice the slots; keeps the load under half */
+static void grow_type_table(TypeTable* table) {
+    int slot_count = table->slot_count ? table->slot_count * 2 : 64;
+    auto slots =
+        static_cast<TypeInfo**>(calloc((size_t)slot_count, sizeof(TypeInfo*)));
+    if (!slots) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        exit(1);
+    }
+
+    for (int i = 0; i < table->slot_count; i++) {
+        TypeInfo* type = table->slots[i];
+        if (!type)
+            continue;
+        int slot = (int)(type_hash(type) & (unsigned int)(slot_count - 1));
+        while (slots[slot])
+            slot = (slot + 1) & (slot_count - 1);
+        slots[slot] = type;
+    }
+    free(table->slots);
+    table->slots = slots;
+    table->slot_count = slot_count;
+}
+
+/* The one type with this shape; element must already be canonical */
+static TypeInfo* intern_type(TypeTable* table, DataType base_type,
+                             int array_size, TypeInfo* element,
+                             const char* struct_name) {
+    if ((table->count + 1) * 2 > table->slot_count) {
+        grow_type_table(table);
+    }
+
+    unsigned int hash =
+        type_shape_hash(base_type, array_size, element, struct_name);
+    int mask = table->slot_count - 1;
+    int slot = (int)(hash & (unsigned int)mask);
+    for (TypeInfo* type; (type = table->slots[slot]); slot = (slot + 1) & mask) {
+        if (type->base_type == base_type && type->array_size == array_size &&
+            type->return_type == element &&
+            (type->struct_name == struct_name ||
+             (type->struct_name && struct_name &&
+              strcmp(type->struct_name, struct_name) == 0))) {
+            return type;
+        }
+    }
+
+    auto entry =
+        static_cast<CanonicalType*>(ir_malloc(sizeof(CanonicalType)));
+    memset(entry, 0, sizeof(CanonicalType));
+    TypeInfo* type = &entry->type;
+    type->base_type = base_type;
+    type->qualifiers = QUAL_NONE;
+    type->storage_class = STORAGE_NONE;
+    type->array_size = array_size;
+    type->return_type = element;
+    type->struct_name = ir_strdup(struct_name);
+    if (base_type == TYPE_POINTER) {
+        type->pointer_level = element && element->base_type == TYPE_POINTER
+                                  ? element->pointer_level + 1
+                                  : 1;
+    }
+    table->slots[slot] = type;
+    table->count++;
+    return type;
+}
+
+TypeInfo* type_table_canonical(TypeTable* table, const TypeInfo* type) {
+    if (!type)
+        return NULL;
+    TypeInfo* element = type_table_canonical(table, type->return_type);
+    return intern_type(table, type->base_type, type->array_size, element,
+                       type->struct_name);
+}
+
+TypeInfo* type_table_basic(TypeTable* table, DataType base_type) {
+    return intern_type(table, base_type, 0, NULL, NULL);
+}
+
+TypeInfo* type_table_pointer(TypeTable* table, const TypeInfo* pointee) {
+    return intern_type(table, TYPE_POINTER, 0,
+                       type_table_canonical(table, pointee), NULL);
+}
+
+/* Canonical types share their elements, so each is freed on its own */
+void type_table_free(TypeTable* table) {
+    for (int i = 0; i < table->slot_count; i++) {
+        auto entry = reinterpret_cast<CanonicalType*>(table->slots[i]);
+        if (entry) {
+            free(entry->type.struct_name);
+            if (entry->opaque_name != entry->name) {
+                free(entry->opaque_name);
+            }
+            free(entry->name);
+            free(entry);
+        }
+    }
+    free(table->slots);
+    table->slots = NULL;
+    table->slot_count = 0;
+    table->count = 0;
+}
+
+/* Spell a canonical type from the cached spellings of its elements */
+static char* spell_canonical_type(TypeInfo* type, int flags) {
+    const char* leaf;
+    switch (type->base_type) {
+    case TYPE_POINTER:
+    case TYPE_ARRAY: {
+        if (type->base_type == TYPE_POINTER &&
+            (flags & IR_PRINT_OPAQUE_POINTERS)) {
+            return ir_strdup("ptr");
+        }
+        const char* element = type->return_type
+                                  ? ir_type_name(type->return_type, flags)
+                                  : "i8";
+        const char* format =
+            type->base_type == TYPE_POINTER ? "%s*" : "[%d x %s]";
+        int length = type->base_type == TYPE_POINTER
+                         ? snprintf(NULL, 0, format, element)
+                         : snprintf(NULL, 0, format, type->array_size, element);
+        auto name = static_cast<char*>(ir_malloc((size_t)length + 1));
+        if (type->base_type == TYPE_POINTER) {
+            snprintf(name, (size_t)length + 1, format, element);
+        } else {
+            snprintf(name, (size_t)length + 1, format, type->array_size,
+                     element);
+        }
+        return name;
+    }
+    case TYPE_STRUCT: {
+        const char* struct_name =
+            type->struct_name ? type->struct_name : "anon";
+        size_t length = strlen(struct_name) + strlen("%struct.");
+        auto name = static_cast<char*>(ir_malloc(length + 1));
+        snprintf(name, length + 1, "%%struct.%s", struct_name);
+        return name;
+    }
+    case TYPE_VOID:
+        leaf = "void";
+        break;
+    case TYPE_BOOL:
+        leaf = "i1";
+        break;
+    case TYPE_CHAR:
+        leaf = "i8";
+        break;
+    case TYPE_SHORT:
+        leaf = "i16";
+        break;
+    case TYPE_LONG:
+        leaf = "i64";
+        break;
+    case TYPE_FLOAT:
+        leaf = "float";
+        break;
+    case TYPE_DOUBLE:
+        leaf = "double";
+        break;
+    default:
+        leaf = "i32";
+        break;
+    }
+    return ir_strdup(leaf);
+}
+
+const char* canonical_type_name(TypeInfo* canonical) {
+    if (!canonical)
+        return "void";
+    auto entry = reinterpret_cast<CanonicalType*>(canonical);
+    if (!entry->name) {
+        entry->name = spell_canonical_type(canonical, 0);
+    }
+    return entry->name;
+}
+
+const char* ir_type_name(TypeInfo* canonical, int flags) {
+    if (!(flags & IR_PRINT_OPAQUE_POINTERS) || !canonical)
+        return canonical_type_name(canonical);
+    auto entry = reinterpret_cast<CanonicalType*>(canonical);
+    if (!entry->opaque_name) {
+        char* name = spell_canonical_type(canonical, IR_PRINT_OPAQUE_POINTERS);
+        const char* typed = canonical_type_name(canonical);
+        if (strcmp(name, typed) == 0) {
+            free(name);
+            name = entry->name;
+        }
+        entry->opaque_name = name;
+    }
+    return entry->opaque_name;
+}
+
+/* Arena */
+
+/* Arena block; objects follow the header */
+struct IRArenaBlock {
+    IRArenaBlock* next;
+    size_t used;
+    size_t capacity;
+};
+
+/* Most functions fit in one block; larger ones chain more */
+#define IR_ARENA_BLOCK_SIZE (64 * 1024)
+
+void* ir_arena_alloc(IRArena* arena, size_t size) {
+    const size_t align = alignof(IRInstruction);
+    size = (size + align - 1) & ~(align - 1);
+
+    IRArenaBlock* block = arena->blocks;
+    if (!block || block->capacity - block->used < size) {
+        size_t capacity =
+            size > IR_ARENA_BLOCK_SIZE ? size : IR_ARENA_BLOCK_SIZE;
+        block = static_cast<IRArenaBlock*>(
+            ir_malloc(sizeof(IRArenaBlock) + capacity));
+        block->used = 0;
+        block->capacity = capacity;
+        block->next = arena->blocks;
+        arena->blocks = block;
+    }
+
+    char* memory = reinterpret_cast<char*>(block + 1) + block->used;
+    block->used += size;
+    return memory;
+}
+
+void ir_arena_reset(IRArena* arena) {
+    IRArenaBlock* block = arena->blocks;
+    if (!block)
+        return;
+    while (block->next) {
+        IRArenaBlock* next = block->next->next;
+        free(block->next);
+        block->next = next;
+    }
+    block->used = 0;
+}
+
+void ir_arena_free(IRArena* arena) {
+    while (arena->blocks) {
+        IRArenaBlock* next = arena->blocks->next;
+        free(arena->blocks);
+        arena->blocks = next;
+    }
+}
+
+static char* arena_strdup(IRArena* arena, const char* str) {
+    if (!str)
+        return NULL;
+    size_t length = strlen(str) + 1;
+    auto copy = static_cast<char*>(ir_arena_alloc(arena, length));
+    memcpy(copy, str, length);
+    return copy;
+}
+
+/* Builder */
+
+void ir_builder_init(IRBuilder* builder) {
+    memset(builder, 0, sizeof(IRBuilder));
+}
+
+void ir_builder_free(IRBuilder* builder) {
+    ir_arena_free(&builder->arena);
+    builder->function = NULL;
+    builder->block = NULL;
+    builder->alloca_point = NULL;
+}
+
+void ir_builder_reset(IRBuilder* builder) {
+    ir_arena_reset(&builder->arena);
+    builder->function = NULL;
+    builder->block = NULL;
+    builder->alloca_point = NULL;
+}
+
+static IRBlock* append_block(IRBuilder* builder, int id) {
+    auto block =
+        static_cast<IRBlock*>(ir_arena_alloc(&builder->arena, sizeof(IRBlock)));
+    block->id = id;
+    block->first = NULL;
+    block->last = NULL;
+    block->next = NULL;
+
+    IRFunction* function = builder->function;
+    if (function->last_block) {
+        function->last_block->next = block;
+    } else {
+        function->first_block = block;
+    }
+    function->last_block = block;
+    builder->block = block;
+    return block;
+}
+
+IRFunction* ir_builder_begin_function(IRBuilder* builder, const char* name,
+                                      const char* linkage,
+                                      TypeInfo* return_type,
+                                      const IRValue* parameters, int count) {
+    auto function = static_cast<IRFunction*>(
+        ir_arena_alloc(&builder->arena, sizeof(IRFunction)));
+    function->name = arena_strdup(&builder->arena, name);
+    function->linkage = arena_strdup(&builder->arena, linkage ? linkage : "");
+    function->return_type = return_type;
+    function->parameters = NULL;
+    function->parameter_count = count;
+    if (count > 0) {
+        function->parameters = static_cast<IRValue*>(
+            ir_arena_alloc(&builder->arena, (size_t)count * sizeof(IRValue)));
+        memcpy(function->parameters, parameters,
+               (size_t)count * sizeof(IRValue));
+    }
+    function->first_block = NULL;
+    function->last_block = NULL;
+
+    builder->function = function;
+    builder->alloca_point = NULL;
+    append_block(builder, 0);
+    return function;
+}
+
+void ir_builder_set_block(IRBuilder* builder, int id) {
+    if (!builder->function) {
+        ir_builder_begin_function(builder, NULL, NULL, NULL, NULL, 0);
+    }
+    append_block(builder, id);
+}
+
+/* New instruction, not yet in any block; instructions built outside a
+ * function go to a loose one */
+static IRInstruction* new_instruction(IRBuilder* builder, IROpcode opcode,
+                                      int operand_count) {
+    if (!builder->function) {
+        ir_builder_begin_function(builder, NULL, NULL, NULL, NULL, 0);
+    }
+
+    auto instruction = static_cast<IRInstruction*>(
+        ir_arena_alloc(&builder->arena, sizeof(IRInstruction)));
+    memset(instruction, 0, sizeof(IRInstruction));
+    instruction->opcode = opcode;
+    instruction->operand_count = operand_count;
+    if (operand_count > 0) {
+        instruction->operands = static_cast<IRValue*>(ir_arena_alloc(
+            &builder->arena, (size_t)operand_count * sizeof(IRValue)));
+    }
+    return instruction;
+}
+
+/* New instruction at the end of the current block */
+static IRInstruction* append_instruction(IRBuilder* builder, IROpcode opcode,
+                                         int operand_count) {
+    IRInstruction* instruction =
+        new_instruction(builder, opcode, operand_count);
+    IRBlock* block = builder->block;
+    if (block->last) {
+        block->last->next = instruction;
+    } else {
+        block->first = instruction;
+    }
+    block->last = instruction;
+    return instruction;
+}
+
+static int* copy_blocks(IRBuilder* builder, const int* blocks, int count) {
+    auto copy = static_cast<int*>(
+        ir_arena_alloc(&builder->arena, (size_t)count * sizeof(int)));
+    if (count > 0) {
+        memcpy(copy, blocks, (size_t)count * sizeof(int));
+    }
+    return copy;
+}
+
+void ir_build_alloca(IRBuilder* builder, IRValue result, TypeInfo* type) {
+    IRInstruction* instruction = new_instruction(builder, IR_ALLOCA, 0);
+    instruction->result = result;
+    instruction->type = type;
+
+    IRBlock* entry = builder->function->first_block;
+    IRInstruction* point = builder->alloca_point;
+    instruction->next = point ? point->next : entry->first;
+    if (point) {
+        point->next = instruction;
+    } else {
+        entry->first = instruction;
+    }
+    if (!instruction->next) {
+        entry->last = instruction;
+    }
+    builder->alloca_point = instruction;
+}
+
+void ir_build_load(IRBuilder* builder, IRValue result, TypeInfo* type,
+                   IRValue address) {
+    IRInstruction* instruction = append_instruction(builder, IR_LOAD, 1);
+    instruction->result = result;
+    instruction->type = type;
+    instruction->operands[0] = address;
+}
+
+void ir_build_store(IRBuilder* builder, TypeInfo* type, IRValue value,
+                    IRValue address) {
+    IRInstruction* instruction = append_instruction(builder, IR_STORE, 2);
+    instruction->type = type;
+    instruction->operands[0] = value;
+    instruction->operands[1] = address;
+}
+
+void ir_build_gep(IRBuilder* builder, IRValue result, TypeInfo* source_type,
+                  IRValue base, const IRValue* indices, int index_count) {
+    IRInstruction* instruction =
+        append_instruction(builder, IR_GEP, index_count + 1);
+    instruction->result = result;
+    instruction->type = source_type;
+    instruction->operands[0] = base;
+    if (index_count > 0) {
+        memcpy(instruction->operands + 1, indices,
+               (size_t)index_count * sizeof(IRValue));
+    }
+}
+
+void ir_build_binary(IRBuilder* builder, IRBinaryOp op, IRValue result,
+                     TypeInfo* type, IRValue left, IRValue right) {
+    IRInstruction* instruction = append_instruction(builder, IR_BINARY, 2);
+    instruction->op = op;
+    instruction->result = result;
+    instruction->type = type;
+    instruction->operands[0] = left;
+    instruction->operands[1] = right;
+}
+
+void ir_build_icmp(IRBuilder* builder, IRPredicate predicate, IRValue result,
+                   TypeInfo* type, IRValue left, IRValue right) {
+    IRInstruction* instruction = append_instruction(builder, IR_ICMP, 2);
+    instruction->op = predicate;
+    instruction->result = result;
+    instruction->type = type;
+    instruction->operands[0] = left;
+    instruction->operands[1] = right;
+}
+
+void ir_build_cast(IRBuilder* builder, IRCastOp op, IRValue result,
+                   IRValue value, TypeInfo* type) {
+    IRInstruction* instruction = append_instruction(builder, IR_CAST, 1);
+    instruction->op = op;
+    instruction->result = result;
+    instruction->type = type;
+    instruction->operands[0] = value;
+}
+
+void ir_build_phi(IRBuilder* builder, IRValue result, TypeInfo* type,
+                  const IRValue* values, const int* blocks, int count) {
+    IRInstruction* instruction = append_instruction(builder, IR_PHI, count);
+    instruction->result = result;
+    instruction->type = type;
+    if (count > 0) {
+        memcpy(instruction->operands, values, (size_t)count * sizeof(IRValue));
+    }
+    instruction->blocks = copy_blocks(builder, blocks, count);
+}
+
+void ir_build_call(IRBuilder* builder, IRValue result, TypeInfo* type,
+                   const char* callee, TypeInfo* const* parameter_types,
+                   int parameter_count, int is_variadic, const IRValue* args,
+                   int arg_count) {
+    IRInstruction* instruction =
+        append_instruction(builder, IR_CALL, arg_count);
+    instruction->result = result;
+    instruction->type = type;
+    instruction->text = callee;
+    if (arg_count > 0) {
+        memcpy(instruction->operands, args, (size_t)arg_count * sizeof(IRValue));
+    }
+    instruction->is_variadic_call = is_variadic;
+    if (parameter_count > 0) {
+        instruction->parameter_types = static_cast<TypeInfo**>(ir_arena_alloc(
+            &builder->arena, (size_t)parameter_count * sizeof(TypeInfo*)));
+        memcpy(instruction->parameter_types, parameter_types,
+               (size_t)parameter_count * sizeof(TypeInfo*));
+        instruction->parameter_count = parameter_count;
+    }
+}
+
+void ir_build_br(IRBuilder* builder, int block) {
+    IRInstruction* instruction = append_instruction(builder, IR_BR, 0);
+    instruction->blocks = copy_blocks(builder, &block, 1);
+}
+
+void ir_build_cond_br(IRBuilder* builder, IRValue condition, int then_block,
+                      int else_block) {
+    int blocks[2] = {then_block, else_block};
+    IRInstruction* instruction = append_instruction(builder, IR_COND_BR, 1);
+    instruction->operands[0] = condition;
+    instruction->blocks = copy_blocks(builder, blocks, 2);
+}
+
+void ir_build_switch(IRBuilder* builder, IRValue condition,
+                     int default_block, const IRValue* values,
+                     const int* blocks, int count) {
+    IRInstruction* instruction =
+        append_instruction(builder, IR_SWITCH, count + 1);
+    instruction->operands[0] = condition;
+    instruction->blocks = static_cast<int*>(ir_arena_alloc(
+        &builder->arena, (size_t)(count + 1) * sizeof(int)));
+    instruction->blocks[0] = default_block;
+    if (count > 0) {
+        memcpy(instruction->operands + 1, values,
+               (size_t)count * sizeof(IRValue));
+        memcpy(instruction->blocks + 1, blocks, (size_t)count * sizeof(int));
+    }
+}
+
+void ir_build_ret(IRBuilder* builder, TypeInfo* type, IRValue value) {
+    int has_value = value.kind != IR_VALUE_NONE;
+    IRInstruction* instruction =
+        append_instruction(builder, IR_RET, has_value);
+    instruction->type = type;
+    if (has_value) {
+        instruction->operands[0] = value;
+    }
+}
+
+void ir_build_comment(IRBuilder* builder, const char* text) {
+    IRInstruction* instruction = append_instruction(builder, IR_COMMENT, 0);
+    instruction->text = text;
+}
+
+/* Printer */
+
+static const char* const binary_op_names[] = {
+    "add", "sub", "mul", "sdiv", "srem", "and", "or", "xor", "shl", "ashr"};
+static const char* const predicate_names[] = {"eq",  "ne",  "slt",
+                                              "sgt", "sle", "sge"};
+static const char* const cast_op_names[] = {"sext", "zext", "trunc",
+                                            "ptrtoint"};
+
+static void print_type(IRBuffer* out, TypeInfo* type, int flags) {
+    ir_buffer_append_str(out, ir_type_name(type, flags));
+}
+
+void ir_print_value(IRBuffer* out, const IRValue* value) {
+    switch (value->kind) {
+    case IR_VALUE_CONSTANT:
+        if (value->type && value->type->base_type == TYPE_BOOL) {
+            ir_buffer_append_str(out, value->id ? "true" : "false");
+        } else {
+            ir_buffer_append_int(out, value->id);
+        }
+        break;
+    case IR_VALUE_GLOBAL:
+        ir_buffer_append_char(out, '@');
+        ir_buffer_append_str(out, value->name);
+        break;
+    case IR_VALUE_LOCAL:
+        ir_buffer_append_char(out, '%');
+        ir_buffer_append_str(out, value->name);
+        break;
+    default:
+        ir_buffer_append_char(out, '%');
+        ir_buffer_append_int(out, value->id);
+        break;
+    }
+}
+
+/* <type> <value> */
+static void print_typed_value(IRBuffer* out, const IRValue* value,
+                              int flags) {
+    print_type(out, value->type, flags);
+    ir_buffer_append_char(out, ' ');
+    ir_print_value(out, value);
+}
+
+static void print_block_reference(IRBuffer* out, int block) {
+    ir_buffer_append(out, "label %bb", 9);
+    ir_buffer_append_int(out, block);
+}
+
+void ir_print_instruction(IRBuffer* out, const IRInstruction* instruction,
+                          int flags) {
+    const IRValue* operands = instruction->operands;
+
+    if (flags & IR_PRINT_COMPACT) {
+        if (instruction->opcode == IR_COMMENT)
+            return;
+    } else {
+        ir_buffer_append(out, "  ", 2);
+    }
+    if (instruction->result.kind != IR_VALUE_NONE) {
+        ir_print_value(out, &instruction->result);
+        ir_buffer_append(out, " = ", 3);
+    }
+
+    switch (instruction->opcode) {
+    case IR_ALLOCA:
+        ir_buffer_append(out, "alloca ", 7);
+        print_type(out, instruction->type, flags);
+        break;
+    case IR_LOAD:
+        ir_buffer_append(out, "load ", 5);
+        print_type(out, instruction->type, flags);
+        ir_buffer_append(out, ", ", 2);
+        print_typed_value(out, &operands[0], flags);
+        break;
+    case IR_STORE:
+        ir_buffer_append(out, "store ", 6);
+        print_type(out, instruction->type, flags);
+        ir_buffer_append_char(out, ' ');
+        ir_print_value(out, &operands[0]);
+        ir_buffer_append(out, ", ", 2);
+        print_typed_value(out, &operands[1], flags);
+        break;
+    case IR_GEP:
+        ir_buffer_append(out, "getelementptr ", 14);
+        print_type(out, instruction->type, flags);
+        for (int i = 0; i < instruction->operand_count; i++) {
+            ir_buffer_append(out, ", ", 2);
+            print_typed_value(out, &operands[i], flags);
+        }
+        break;
+    case IR_BINARY:
+    case IR_ICMP:
+        if (instruction->opcode == IR_ICMP) {
+            ir_buffer_append(out, "icmp ", 5);
+            ir_buffer_append_str(out, predicate_names[instruction->op]);
+        } else {
+            ir_buffer_append_str(out, binary_op_names[instruction->op]);
+        }
+        ir_buffer_append_char(out, ' ');
+        print_type(out, instruction->type, flags);
+        ir_buffer_append_char(out, ' ');
+        ir_print_value(out, &operands[0]);
+        ir_buffer_append(out, ", ", 2);
+        ir_print_value(out, &operands[1]);
+        break;
+    case IR_CAST:
+        ir_buffer_append_str(out, cast_op_names[instruction->op]);
+        ir_buffer_append_char(out, ' ');
+        print_typed_value(out, &operands[0], flags);
+        ir_buffer_append(out, " to ", 4);
+        print_type(out, instruction->type, flags);
+        break;
+    case IR_PHI:
+        ir_buffer_append(out, "phi ", 4);
+        print_type(out, instruction->type, flags);
+        for (int i = 0; i < instruction->operand_count; i++) {
+            ir_buffer_append(out, i ? ", [ " : " [ ", i ? 4 : 3);
+            ir_print_value(out, &operands[i]);
+            /* The unlabeled entry block is %0 */
+            if (instruction->blocks[i] == 0) {
+                ir_buffer_append(out, ", %0", 4);
+            } else {
+                ir_buffer_append(out, ", %bb", 5);
+                ir_buffer_append_int(out, instruction->blocks[i]);
+            }
+            ir_buffer_append(out, " ]", 2);
+        }
+        break;
+    case IR_CALL:
+        ir_buffer_append(out, "call ", 5);
+        print_type(out, instruction->type, flags);
+        ir_buffer_append_char(out, ' ');
+        if (instruction->is_variadic_call) {
+            ir_buffer_append_char(out, '(');
+            for (int i = 0; i < instruction->parameter_count; i++) {
+                print_type(out, instruction->parameter_types[i], flags);
+                ir_buffer_append(out, ", ", 2);
+            }
+            ir_buffer_append(out, "...) ", 5);
+        }
+        ir_buffer_append_char(out, '@');
+        ir_buffer_append_str(out, instruction->text);
+        ir_buffer_append_char(out, '(');
+        for (int i = 0; i < instruction->operand_count; i++) {
+            if (i > 0) {
+                ir_buffer_append(out, ", ", 2);
+            }
+            print_typed_value(out, &operands[i], flags);
+        }
+        ir_buffer_append_char(out, ')');
+        break;
+    case IR_BR:
+        ir_buffer_append(out, "br ", 3);
+        print_block_reference(out, instruction->blocks[0]);
+        break;
+    case IR_COND_BR:
+        ir_buffer_append(out, "br ", 3);
+        print_typed_value(out, &operands[0], flags);
+        ir_buffer_append(out, ", ", 2);
+        print_block_reference(out, instruction->blocks[0]);
+        ir_buffer_append(out, ", ", 2);
+        print_block_reference(out, instruction->blocks[1]);
+        break;
+    case IR_SWITCH:
+        ir_buffer_append(out, "switch ", 7);
+        print_typed_value(out, &operands[0], flags);
+        ir_buffer_append(out, ", ", 2);
+        print_block_reference(out, instruction->blocks[0]);
+        ir_buffer_append(out, " [", 2);
+        for (int i = 1; i < instruction->operand_count; i++) {
+            ir_buffer_append_char(out, ' ');
+            print_typed_value(out, &operands[i], flags);
+            ir_buffer_append(out, ", ", 2);
+            print_block_reference(out, instruction->blocks[i]);
+        }
+        ir_buffer_append(out, " ]", 2);
+        break;
+    case IR_RET:
+        ir_buffer_append(out, "ret ", 4);
+        if (instruction->operand_count > 0) {
+            print_type(out, instruction->type, flags);
+            ir_buffer_append_char(out, ' ');
+            ir_print_value(out, &operands[0]);
+        } else {
+            ir_buffer_append(out, "void", 4);
+        }
+        break;
+    case IR_COMMENT:
+        ir_buffer_append(out, "; ", 2);
+        ir_buffer_append_str(out, instruction->text);
+        break;
+    }
+    ir_buffer_append_char(out, '\n');
+}
+
+void ir_print_function(IRBuffer* out, const IRFunction* function,
+                       int flags) {
+    if (function->name) {
+        ir_buffer_append(out, "define ", 7);
+        ir_buffer_append_str(out, function->linkage);
+        print_type(out, function->return_type, flags);
+        ir_buffer_append(out, " @", 2);
+        ir_buffer_append_str(out, function->name);
+        ir_buffer_append_char(out, '(');
+        for (int i = 0; i < function->parameter_count; i++) {
+            if (i > 0) {
+                ir_buffer_append(out, ", ", 2);
+            }
+            print_typed_value(out, &function->parameters[i], flags);
+        }
+        ir_buffer_append(out, ") {\n", 4);
+    }
+
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        if (block->id) {
+            ir_buffer_append(out, "bb", 2);
+            ir_buffer_append_int(out, block->id);
+            ir_buffer_append(out, ":\n", 2);
+        }
+        for (const IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            ir_print_instruction(out, instruction, flags);
+        }
+    }
+
+    if (function->name) {
+        if (flags & IR_PRINT_COMPACT) {
+            ir_buffer_append(out, "}\n", 2);
+        } else {
+            ir_buffer_append(out, "  }\n\n", 5);
+        }
+    }
+}
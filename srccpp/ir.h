@@ -0,0 +1,282 @@
+#ifndef IR_H
+#define IR_H
+
+extern "C" {
+
+#include "ast.h"
+#include "ir_buffer.h"
+
+#include <stddef.h>
+
+/*
+ * In-memory IR behind the code generator.
+ *
+ * Lowering builds one IRFunction at a time through an IRBuilder: typed
+ * instructions grouped into basic blocks in layout order. Functions,
+ * blocks, instructions and operand arrays are bump-allocated from the
+ * builder's arena, which is reset once the function has been printed (or
+ * handed to another consumer). Types are canonical TypeInfos from a
+ * TypeTable; names are borrowed from the symbol tables and the string pool
+ * and must stay valid until the function is released.
+ */
+
+/* Canonical types of one context, interned by shape */
+typedef struct TypeTable {
+    TypeInfo** slots; /* Open addressing, NULL: empty */
+    int slot_count;
+    int count;
+} TypeTable;
+
+/* The one type with the shape of type; NULL for NULL. Qualifiers,
+ * storage classes and parameters are dropped. */
+TypeInfo* type_table_canonical(TypeTable* table, const TypeInfo* type);
+TypeInfo* type_table_basic(TypeTable* table, DataType base_type);
+TypeInfo* type_table_pointer(TypeTable* table, const TypeInfo* pointee);
+void type_table_free(TypeTable* table);
+
+/* LLVM spelling of a canonical type, built once and kept with the type;
+ * "void" for NULL */
+const char* canonical_type_name(TypeInfo* canonical);
+
+/* Text printer options */
+typedef enum {
+    IR_PRINT_OPAQUE_POINTERS = 1, /* Every pointer type spelled ptr */
+    IR_PRINT_COMPACT = 2          /* No comments, indentation or blank lines */
+} IRPrintFlags;
+
+/* canonical_type_name under IRPrintFlags flags; also cached */
+const char* ir_type_name(TypeInfo* canonical, int flags);
+
+/* Bump allocator for IR objects */
+typedef struct IRArenaBlock IRArenaBlock;
+
+typedef struct IRArena {
+    IRArenaBlock* blocks; /* Current block first */
+} IRArena;
+
+void* ir_arena_alloc(IRArena* arena, size_t size);
+/* Release everything but the current block, which is reused */
+void ir_arena_reset(IRArena* arena);
+void ir_arena_free(IRArena* arena);
+
+/* Operands */
+typedef enum {
+    IR_VALUE_NONE,
+    IR_VALUE_REGISTER, /* %<id> */
+    IR_VALUE_LOCAL,    /* %<name>: parameters and stack slots */
+    IR_VALUE_GLOBAL,   /* @<name> */
+    IR_VALUE_CONSTANT  /* Integer; i1 constants print as true/false */
+} IRValueKind;
+
+typedef struct IRValue {
+    IRValueKind kind;
+    int id;           /* Register number or constant */
+    const char* name; /* Local or global name */
+    TypeInfo* type;   /* Canonical */
+} IRValue;
+
+static inline IRValue ir_value(IRValueKind kind, int id, const char* name,
+                               TypeInfo* type) {
+    IRValue value = {kind, id, name, type};
+    return value;
+}
+
+static inline IRValue ir_no_value(void) {
+    return ir_value(IR_VALUE_NONE, 0, NULL, NULL);
+}
+
+static inline IRValue ir_register(int id, TypeInfo* type) {
+    return ir_value(IR_VALUE_REGISTER, id, NULL, type);
+}
+
+static inline IRValue ir_constant(int constant, TypeInfo* type) {
+    return ir_value(IR_VALUE_CONSTANT, constant, NULL, type);
+}
+
+/* Instructions */
+typedef enum {
+    IR_ALLOCA,  /* result = alloca type */
+    IR_LOAD,    /* result = load type, operands[0] */
+    IR_STORE,   /* store type operands[0], operands[1] */
+    IR_GEP,     /* result = getelementptr type, operands[0], indices... */
+    IR_BINARY,  /* result = op type operands[0], operands[1] */
+    IR_ICMP,    /* result = icmp op type operands[0], operands[1] */
+    IR_CAST,    /* result = op operands[0] to type */
+    IR_PHI,     /* result = phi type [operands[i], blocks[i]]... */
+    IR_CALL,    /* result = call type callee(operands...) */
+    IR_BR,      /* br blocks[0] */
+    IR_COND_BR, /* br operands[0], blocks[0], blocks[1] */
+    IR_SWITCH,  /* switch operands[0], default blocks[0],
+                   [operands[i], blocks[i]]... for i >= 1 */
+    IR_RET,     /* ret type operands[0]; ret void without operands */
+    IR_COMMENT  /* ; text */
+} IROpcode;
+
+typedef enum {
+    IR_ADD,
+    IR_SUB,
+    IR_MUL,
+    IR_SDIV,
+    IR_SREM,
+    IR_AND,
+    IR_OR,
+    IR_XOR,
+    IR_SHL,
+    IR_ASHR
+} IRBinaryOp;
+
+typedef enum {
+    IR_ICMP_EQ,
+    IR_ICMP_NE,
+    IR_ICMP_SLT,
+    IR_ICMP_SGT,
+    IR_ICMP_SLE,
+    IR_ICMP_SGE
+} IRPredicate;
+
+typedef enum {
+    IR_SEXT,
+    IR_ZEXT,
+    IR_TRUNC,
+    IR_PTRTOINT
+} IRCastOp;
+
+typedef struct IRInstruction IRInstruction;
+typedef struct IRBlock IRBlock;
+typedef struct IRFunction IRFunction;
+
+struct IRInstruction {
+    IROpcode opcode;
+    int op;          /* IRBinaryOp, IRPredicate or IRCastOp */
+    IRValue result;  /* IR_VALUE_NONE when nothing is defined */
+    TypeInfo* type;  /* See IROpcode */
+    IRValue* operands;
+    int operand_count;
+    int* blocks; /* Branch targets, phi predecessors */
+    const char* text;           /* Callee or comment */
+    TypeInfo** parameter_types; /* Fixed parameters of a variadic callee */
+    int parameter_count;
+    int is_variadic_call;
+    IRInstruction* next;
+};
+
+struct IRBlock {
+    int id; /* 0: entry block, printed without a label */
+    IRInstruction* first;
+    IRInstruction* last;
+    IRBlock* next;
+};
+
+struct IRFunction {
+    const char* name; /* NULL: loose instructions outside any function */
+    const char* linkage;
+    TypeInfo* return_type;
+    IRValue* parameters;
+    int parameter_count;
+    IRBlock* first_block;
+    IRBlock* last_block;
+};
+
+/* Builder: appends to the current block of the current function, except
+ * that allocas go to the front of the entry block */
+typedef struct IRBuilder {
+    IRArena arena;
+    IRFunction* function;
+    IRBlock* block;
+    IRInstruction* alloca_point; /* Last hoisted alloca; NULL: none yet */
+} IRBuilder;
+
+void ir_builder_init(IRBuilder* builder);
+void ir_builder_free(IRBuilder* builder);
+/* Start a function whose entry block becomes current; name and linkage
+ * are copied, parameters are copied into the arena */
+IRFunction* ir_builder_begin_function(IRBuilder* builder, const char* name,
+                                      const char* linkage,
+                                      TypeInfo* return_type,
+                                      const IRValue* parameters, int count);
+/* Append block id to the function and make it current */
+void ir_builder_set_block(IRBuilder* builder, int id);
+/* Drop the current function and everything it owns */
+void ir_builder_reset(IRBuilder* builder);
+
+/* Allocas are hoisted: they follow the allocas already at the start of
+ * the entry block, so a slot is allocated once per call wherever its
+ * declaration is */
+void ir_build_alloca(IRBuilder* builder, IRValue result, TypeInfo* type);
+void ir_build_load(IRBuilder* builder, IRValue result, TypeInfo* type,
+                   IRValue address);
+void ir_build_store(IRBuilder* builder, TypeInfo* type, IRValue value,
+                    IRValue address);
+void ir_build_gep(IRBuilder* builder, IRValue result, TypeInfo* source_type,
+                  IRValue base, const IRValue* indices, int index_count);
+void ir_build_binary(IRBuilder* builder, IRBinaryOp op, IRValue result,
+                     TypeInfo* type, IRValue left, IRValue right);
+void ir_build_icmp(IRBuilder* builder, IRPredicate predicate, IRValue result,
+                   TypeInfo* type, IRValue left, IRValue right);
+void ir_build_cast(IRBuilder* builder, IRCastOp op, IRValue result,
+                   IRValue value, TypeInfo* type);
+void ir_build_phi(IRBuilder* builder, IRValue result, TypeInfo* type,
+                  const IRValue* values, const int* blocks, int count);
+/* parameter_types are only needed, and only printed, for variadic callees */
+void ir_build_call(IRBuilder* builder, IRValue result, TypeInfo* type,
+                   const char* callee, TypeInfo* const* parameter_types,
+                   int parameter_count, int is_variadic, const IRValue* args,
+                   int arg_count);
+void ir_build_br(IRBuilder* builder, int block);
+void ir_build_cond_br(IRBuilder* builder, IRValue condition, int then_block,
+                      int else_block);
+/* switch on condition: values[i] goes to blocks[i], anything else to
+ * default_block. The values are constants of condition's type. */
+void ir_build_switch(IRBuilder* builder, IRValue condition,
+                     int default_block, const IRValue* values,
+                     const int* blocks, int count);
+/* ret void when value is IR_VALUE_NONE */
+void ir_build_ret(IRBuilder* builder, TypeInfo* type, IRValue value);
+void ir_build_comment(IRBuilder* builder, const char* text);
+
+/* Module-level definitions, as handed to an IRConsumer */
+typedef enum {
+    IR_GLOBAL_DECLARATION, /* declare type @name(parameter_types...) */
+    IR_GLOBAL_VARIABLE,    /* @name = <linkage>global type <initializer> */
+    IR_GLOBAL_EXTERNAL,    /* @name = external global type */
+    IR_GLOBAL_STRING       /* @name = private constant c"bytes\00" */
+} IRGlobalKind;
+
+typedef struct IRGlobal {
+    IRGlobalKind kind;
+    const char* name;
+    const char* linkage;
+    TypeInfo* type; /* Variable type, or return type of a declaration */
+    TypeInfo* const* parameter_types;
+    int parameter_count;
+    int is_variadic;
+    const char* bytes; /* String contents, or a char array initializer */
+    size_t length;     /* Without the terminating zero */
+    int has_constant;  /* Integer initializer; zero when neither is set */
+    long long constant;
+} IRGlobal;
+
+static inline IRGlobal ir_global(IRGlobalKind kind, const char* name,
+                                 TypeInfo* type) {
+    IRGlobal global = {kind, name, "", type, NULL, 0, 0, NULL, 0, 0, 0};
+    return global;
+}
+
+/* Receives finished functions and module globals in place of the text
+ * printer. Globals arrive before the functions that refer to them; both
+ * are only valid during the call. */
+typedef struct IRConsumer {
+    void* data;
+    void (*add_global)(void* data, const IRGlobal* global);
+    void (*add_function)(void* data, const IRFunction* function);
+} IRConsumer;
+
+/* Text printer */
+void ir_print_value(IRBuffer* out, const IRValue* value);
+void ir_print_instruction(IRBuffer* out, const IRInstruction* instruction,
+                          int flags);
+/* Loose functions print their blocks only */
+void ir_print_function(IRBuffer* out, const IRFunction* function, int flags);
+}
+
+#endif /* IR_H */
@@ -0,0 +1,353 @@
+#include "ir_buffer.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* Sink buffers flush whenever this much text has accumulated */
+#define IR_BUFFER_BLOCK_SIZE (1024 * 1024)
+/* Starting size of in-memory and mapped buffers */
+#define IR_BUFFER_INITIAL_SIZE (64 * 1024)
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+static int write_all(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+    return 0;
+}
+
+/* writev every span, resuming after partial writes; spans is modified */
+static int writev_all(int fd, struct iovec* spans, int count) {
+    while (count > 0) {
+        int batch = count < IOV_MAX ? count : IOV_MAX;
+        ssize_t written = writev(fd, spans, batch);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        while (count > 0 && (size_t)written >= spans->iov_len) {
+            written -= (ssize_t)spans->iov_len;
+            spans++;
+            count--;
+        }
+        if (count > 0) {
+            spans->iov_base = static_cast<char*>(spans->iov_base) + written;
+            spans->iov_len -= (size_t)written;
+        }
+    }
+    return 0;
+}
+
+void ir_buffer_init(IRBuffer* buffer, FILE* stream) {
+    memset(buffer, 0, sizeof(IRBuffer));
+    buffer->stream = stream;
+    buffer->fd = stream ? fileno(stream) : -1;
+    if (stream) {
+        buffer->flush_threshold = IR_BUFFER_BLOCK_SIZE;
+    }
+}
+
+/* Replace the mapping of the output file with one of capacity bytes */
+static int remap_file(IRBuffer* buffer, size_t capacity) {
+    if (ftruncate(buffer->fd, (off_t)capacity) != 0) {
+        return -1;
+    }
+    void* data = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      buffer->fd, 0);
+    if (data == MAP_FAILED) {
+        return -1;
+    }
+    if (buffer->data) {
+        munmap(buffer->data, buffer->capacity);
+    }
+    buffer->data = static_cast<char*>(data);
+    buffer->capacity = capacity;
+    return 0;
+}
+
+int ir_buffer_map_file(IRBuffer* buffer, const char* path) {
+    ir_buffer_free(buffer);
+    ir_buffer_init(buffer, NULL);
+
+    buffer->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (buffer->fd < 0) {
+        return -1;
+    }
+    buffer->mapped = 1;
+    if (remap_file(buffer, IR_BUFFER_INITIAL_SIZE) != 0) {
+        close(buffer->fd);
+        buffer->fd = -1;
+        buffer->mapped = 0;
+        return -1;
+    }
+    return 0;
+}
+
+void ir_buffer_free(IRBuffer* buffer) {
+    if (buffer->mapped) {
+        /* Cut the file back from the mapped capacity to the text */
+        munmap(buffer->data, buffer->capacity);
+        if (ftruncate(buffer->fd, (off_t)buffer->length) != 0) {
+            buffer->error = 1;
+        }
+        close(buffer->fd);
+    } else {
+        free(buffer->data);
+    }
+    buffer->data = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+    buffer->mapped = 0;
+    buffer->fd = -1;
+}
+
+void ir_buffer_grow(IRBuffer* buffer, size_t extra) {
+    if (buffer->flush_threshold && buffer->length > 0) {
+        ir_buffer_flush(buffer);
+        if (buffer->capacity - buffer->length >= extra) {
+            return;
+        }
+    }
+
+    size_t capacity = buffer->capacity;
+    if (capacity == 0) {
+        capacity = buffer->flush_threshold ? buffer->flush_threshold
+                                           : IR_BUFFER_INITIAL_SIZE;
+    }
+    while (capacity - buffer->length < extra) {
+        capacity *= 2;
+    }
+
+    if (buffer->mapped) {
+        if (remap_file(buffer, capacity) != 0) {
+            buffer->error = 1;
+        }
+        return;
+    }
+
+    char* data = static_cast<char*>(realloc(buffer->data, capacity));
+    if (!data) {
+        buffer->error = 1;
+        return;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+}
+
+void ir_buffer_append_uint(IRBuffer* buffer, unsigned long long value) {
+    char digits[20];
+    char* end = digits + sizeof(digits);
+    char* start = end;
+    do {
+        *--start = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    ir_buffer_append(buffer, start, (size_t)(end - start));
+}
+
+void ir_buffer_append_int(IRBuffer* buffer, long long value) {
+    if (value < 0) {
+        ir_buffer_append_char(buffer, '-');
+        ir_buffer_append_uint(buffer, 0ULL - (unsigned long long)value);
+    } else {
+        ir_buffer_append_uint(buffer, (unsigned long long)value);
+    }
+}
+
+/* True when every conversion is one ir_buffer_vformat handles itself */
+static int is_simple_format(const char* format) {
+    for (const char* p = strchr(format, '%'); p; p = strchr(p, '%')) {
+        p++;
+        if (*p == 'l') {
+            p += p[1] == 'l' ? 2 : 1;
+        } else if (*p == 'z') {
+            p++;
+        }
+        if (!*p || !strchr("%sdiuc", *p)) {
+            return 0;
+        }
+        p++;
+    }
+    return 1;
+}
+
+static void append_vsnprintf(IRBuffer* buffer, const char* format,
+                             va_list args) {
+    va_list copy;
+    va_copy(copy, args);
+    size_t room = buffer->capacity - buffer->length;
+    int length = vsnprintf(room ? buffer->data + buffer->length : NULL, room,
+                           format, copy);
+    va_end(copy);
+    if (length < 0) {
+        buffer->error = 1;
+        return;
+    }
+
+    if ((size_t)length >= room) {
+        ir_buffer_grow(buffer, (size_t)length + 1);
+        if (buffer->capacity - buffer->length < (size_t)length + 1) {
+            return;
+        }
+        vsnprintf(buffer->data + buffer->length, (size_t)length + 1, format,
+                  args);
+    }
+    buffer->length += (size_t)length;
+}
+
+void ir_buffer_vformat(IRBuffer* buffer, const char* format, va_list args) {
+    if (!is_simple_format(format)) {
+        append_vsnprintf(buffer, format, args);
+        return;
+    }
+
+    const char* p = format;
+    while (*p) {
+        const char* run = p;
+        while (*p && *p != '%') {
+            p++;
+        }
+        if (p > run) {
+            ir_buffer_append(buffer, run, (size_t)(p - run));
+        }
+        if (!*p) {
+            break;
+        }
+
+        p++;
+        int size = 0; /* 0: int, 1: long, 2: long long, 3: size_t */
+        if (*p == 'l') {
+            size = p[1] == 'l' ? 2 : 1;
+            p += size;
+        } else if (*p == 'z') {
+            size = 3;
+            p++;
+        }
+
+        switch (*p) {
+        case '%':
+            ir_buffer_append_char(buffer, '%');
+            break;
+        case 's': {
+            const char* text = va_arg(args, const char*);
+            ir_buffer_append_str(buffer, text ? text : "(null)");
+            break;
+        }
+        case 'c':
+            ir_buffer_append_char(buffer, (char)va_arg(args, int));
+            break;
+        case 'd':
+        case 'i':
+            ir_buffer_append_int(
+                buffer, size == 0   ? (long long)va_arg(args, int)
+                        : size == 1 ? (long long)va_arg(args, long)
+                        : size == 2 ? va_arg(args, long long)
+                                    : (long long)va_arg(args, ssize_t));
+            break;
+        case 'u':
+            ir_buffer_append_uint(
+                buffer,
+                size == 0   ? (unsigned long long)va_arg(args, unsigned int)
+                : size == 1 ? (unsigned long long)va_arg(args, unsigned long)
+                : size == 2 ? va_arg(args, unsigned long long)
+                            : (unsigned long long)va_arg(args, size_t));
+            break;
+        }
+        p++;
+    }
+}
+
+void ir_buffer_format(IRBuffer* buffer, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    ir_buffer_vformat(buffer, format, args);
+    va_end(args);
+}
+
+int ir_buffer_flush(IRBuffer* buffer) {
+    if (buffer->mapped || buffer->length == 0 ||
+        (buffer->fd < 0 && !buffer->stream)) {
+        return buffer->error ? -1 : 0;
+    }
+
+    int status;
+    if (buffer->fd >= 0) {
+        /* Anything already sitting in the stream's buffer goes first */
+        if (buffer->stream) {
+            fflush(buffer->stream);
+        }
+        status = write_all(buffer->fd, buffer->data, buffer->length);
+    } else {
+        status = fwrite(buffer->data, 1, buffer->length, buffer->stream) ==
+                         buffer->length
+                     ? 0
+                     : -1;
+    }
+    buffer->length = 0;
+    if (status != 0) {
+        buffer->error = 1;
+    }
+    return buffer->error ? -1 : 0;
+}
+
+void ir_buffer_append_spans(IRBuffer* buffer, const struct iovec* spans,
+                            int count) {
+    if (buffer->fd < 0 || buffer->mapped) {
+        for (int i = 0; i < count; i++) {
+            ir_buffer_append(buffer, static_cast<const char*>(spans[i].iov_base),
+                             spans[i].iov_len);
+        }
+        return;
+    }
+
+    struct iovec* all =
+        static_cast<struct iovec*>(malloc((count + 1) * sizeof(struct iovec)));
+    if (!all) {
+        buffer->error = 1;
+        return;
+    }
+    all[0].iov_base = buffer->data;
+    all[0].iov_len = buffer->length;
+    memcpy(all + 1, spans, count * sizeof(struct iovec));
+
+    if (buffer->stream) {
+        fflush(buffer->stream);
+    }
+    if (writev_all(buffer->fd, all, count + 1) != 0) {
+        buffer->error = 1;
+    }
+    buffer->length = 0;
+    free(all);
+}
+
+char* ir_buffer_release(IRBuffer* buffer, size_t* length) {
+    ir_buffer_append_char(buffer, '\0');
+    if (buffer->error || buffer->mapped) {
+        return NULL;
+    }
+
+    char* data = buffer->data;
+    if (length) {
+        *length = buffer->length - 1;
+    }
+    buffer->data = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+    return data;
+}
@@ -0,0 +1,86 @@
+#ifndef IR_BUFFER_H
+#define IR_BUFFER_H
+
+extern "C" {
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+
+/*
+ * Output buffer for generated IR
+ *
+ * Text is appended to one growable byte buffer and handed to the kernel in
+ * large blocks with write(2)/writev(2), so emitting an instruction costs a
+ * few memcpy calls instead of several locked stdio calls. A buffer either
+ * flushes to a file descriptor, falls back to a FILE* that has none (e.g.
+ * open_memstream), or keeps everything in memory for the caller to take
+ * with ir_buffer_release. Mapped buffers write straight into an mmap'd
+ * output file instead.
+ */
+typedef struct IRBuffer {
+    char* data;
+    size_t length;
+    size_t capacity;
+    size_t flush_threshold; /* Flush once length reaches this (0: never) */
+    int fd;                 /* Flush target, or -1 */
+    FILE* stream;           /* Flush target when fd is -1, or NULL */
+    int mapped;             /* data is a shared mapping of fd */
+    int error;              /* Set when a write or allocation failed */
+} IRBuffer;
+
+/* Sink selection; a NULL stream keeps all output in memory */
+void ir_buffer_init(IRBuffer* buffer, FILE* stream);
+/* Write directly into the file at path through a growing shared mapping */
+int ir_buffer_map_file(IRBuffer* buffer, const char* path);
+void ir_buffer_free(IRBuffer* buffer);
+
+/* Make room for extra bytes, flushing or growing as needed */
+void ir_buffer_grow(IRBuffer* buffer, size_t extra);
+
+static inline void ir_buffer_append(IRBuffer* buffer, const char* text,
+                                    size_t length) {
+    if (buffer->capacity - buffer->length < length) {
+        ir_buffer_grow(buffer, length);
+        if (buffer->capacity - buffer->length < length)
+            return;
+    }
+    memcpy(buffer->data + buffer->length, text, length);
+    buffer->length += length;
+}
+
+static inline void ir_buffer_append_char(IRBuffer* buffer, char c) {
+    if (buffer->length == buffer->capacity) {
+        ir_buffer_grow(buffer, 1);
+        if (buffer->length == buffer->capacity)
+            return;
+    }
+    buffer->data[buffer->length++] = c;
+}
+
+static inline void ir_buffer_append_str(IRBuffer* buffer, const char* text) {
+    ir_buffer_append(buffer, text, strlen(text));
+}
+
+void ir_buffer_append_int(IRBuffer* buffer, long long value);
+void ir_buffer_append_uint(IRBuffer* buffer, unsigned long long value);
+
+/* printf-style append. %s, %d, %i, %u, %c, %% with l/ll/z sizes are
+ * formatted in place; anything else falls back to vsnprintf */
+void ir_buffer_format(IRBuffer* buffer, const char* format, ...);
+void ir_buffer_vformat(IRBuffer* buffer, const char* format, va_list args);
+
+/* Append the buffered text and then the spans, in order. With a file
+ * descriptor sink the spans go out with writev without being copied */
+void ir_buffer_append_spans(IRBuffer* buffer, const struct iovec* spans,
+                            int count);
+
+/* Hand the buffered text to the sink; returns 0 on success */
+int ir_buffer_flush(IRBuffer* buffer);
+
+/* Take the NUL-terminated in-memory text; the buffer is left empty */
+char* ir_buffer_release(IRBuffer* buffer, size_t* length);
+}
+
+#endif /* IR_BUFFER_H */
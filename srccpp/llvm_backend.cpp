@@ -0,0 +1,934 @@
+#include "llvm_backend.h"
+
+#ifdef TINYC_HAVE_LLVM
+
+#include <llvm-c/Analysis.h>
+#include <llvm-c/Core.h>
+#include <llvm-c/Error.h>
+#include <llvm-c/LLJIT.h>
+#include <llvm-c/Orc.h>
+#include <llvm-c/Target.h>
+#include <llvm-c/TargetMachine.h>
+#include <llvm-c/Transforms/PassBuilder.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct LLVMBackend {
+    LLVMOrcThreadSafeContextRef ts_context; /* Owns context */
+    LLVMContextRef context;
+    LLVMModuleRef module; /* NULL once handed to jit */
+    LLVMOrcLLJITRef jit;  /* Set by llvm_backend_jit_main */
+    LLVMBuilderRef builder;
+    /* By spelling: canonical types belong to the context that made them,
+     * and function jobs each have their own */
+    std::unordered_map<std::string, LLVMTypeRef> types;
+    IRConsumer consumer;
+    int error_count;
+};
+
+/* Values of the function being translated */
+typedef struct FunctionState {
+    LLVMValueRef function;
+    LLVMTypeRef return_type;
+    std::unordered_map<int, LLVMValueRef> registers;
+    std::unordered_map<std::string, LLVMValueRef> locals;
+    std::unordered_map<int, LLVMBasicBlockRef> blocks;
+    std::vector<std::pair<const IRInstruction*, LLVMValueRef>> phis;
+} FunctionState;
+
+static void backend_error(LLVMBackend* backend, const char* format,
+                          const char* name) {
+    fprintf(stderr, "Error: ");
+    fprintf(stderr, format, name);
+    fprintf(stderr, "\n");
+    backend->error_count++;
+}
+
+/* Types */
+
+/* type must be canonical */
+static LLVMTypeRef lower_type(LLVMBackend* backend, TypeInfo* type) {
+    LLVMContextRef context = backend->context;
+    if (!type)
+        return LLVMVoidTypeInContext(context);
+
+    const char* name = canonical_type_name(type);
+    auto found = backend->types.find(name);
+    if (found != backend->types.end())
+        return found->second;
+
+    LLVMTypeRef result;
+    switch (type->base_type) {
+    case TYPE_VOID:
+        result = LLVMVoidTypeInContext(context);
+        break;
+    case TYPE_BOOL:
+        result = LLVMInt1TypeInContext(context);
+        break;
+    case TYPE_CHAR:
+        result = LLVMInt8TypeInContext(context);
+        break;
+    case TYPE_SHORT:
+        result = LLVMInt16TypeInContext(context);
+        break;
+    case TYPE_LONG:
+        result = LLVMInt64TypeInContext(context);
+        break;
+    case TYPE_FLOAT:
+        result = LLVMFloatTypeInContext(context);
+        break;
+    case TYPE_DOUBLE:
+        result = LLVMDoubleTypeInContext(context);
+        break;
+    case TYPE_POINTER: {
+        /* void* has no LLVM spelling; it is an i8* like in C front ends */
+        LLVMTypeRef pointee = lower_type(backend, type->return_type);
+        if (!type->return_type ||
+            LLVMGetTypeKind(pointee) == LLVMVoidTypeKind) {
+            pointee = LLVMInt8TypeInContext(context);
+        }
+        result = LLVMPointerType(pointee, 0);
+        break;
+    }
+    case TYPE_ARRAY: {
+        LLVMTypeRef element = type->return_type
+                                  ? lower_type(backend, type->return_type)
+                                  : LLVMInt8TypeInContext(context);
+        result = LLVMArrayType(element, (unsigned)type->array_size);
+        break;
+    }
+    case TYPE_STRUCT: {
+        /* Members are not tracked, so the struct stays opaque */
+        result = LLVMStructCreateNamed(context, name + 1);
+        break;
+    }
+    default:
+        result = LLVMInt32TypeInContext(context);
+        break;
+    }
+
+    backend->types.emplace(name, result);
+    return result;
+}
+
+/* Type of a value of type; void stands in for an int as in the text */
+static LLVMTypeRef lower_value_type(LLVMBackend* backend, TypeInfo* type) {
+    LLVMTypeRef result = lower_type(backend, type);
+    if (LLVMGetTypeKind(result) == LLVMVoidTypeKind)
+        return LLVMInt32TypeInContext(backend->context);
+    return result;
+}
+
+static int has_unknown_layout(LLVMTypeRef type) {
+    while (LLVMGetTypeKind(type) == LLVMArrayTypeKind) {
+        type = LLVMGetElementType(type);
+    }
+    return LLVMGetTypeKind(type) == LLVMStructTypeKind &&
+           LLVMIsOpaqueStruct(type);
+}
+
+/* Values */
+
+static LLVMValueRef constant_of(LLVMBackend* backend, LLVMTypeRef type,
+                                long long constant) {
+    switch (LLVMGetTypeKind(type)) {
+    case LLVMPointerTypeKind:
+        if (constant == 0)
+            return LLVMConstNull(type);
+        return LLVMConstIntToPtr(
+            LLVMConstInt(LLVMInt64TypeInContext(backend->context),
+                         (unsigned long long)constant, 1),
+            type);
+    case LLVMFloatTypeKind:
+    case LLVMDoubleTypeKind:
+        return LLVMConstReal(type, (double)constant);
+    case LLVMIntegerTypeKind:
+        return LLVMConstInt(type, (unsigned long long)constant, 1);
+    default:
+        return LLVMConstNull(type);
+    }
+}
+
+/* Global @name, declared as an external variable of the pointee type when
+ * nothing defined it */
+static LLVMValueRef lower_global(LLVMBackend* backend, const char* name,
+                                 LLVMTypeRef address_type) {
+    LLVMValueRef global = LLVMGetNamedGlobal(backend->module, name);
+    if (!global)
+        global = LLVMGetNamedFunction(backend->module, name);
+    if (!global) {
+        LLVMTypeRef element = LLVMGetTypeKind(address_type) ==
+                                      LLVMPointerTypeKind
+                                  ? LLVMGetElementType(address_type)
+                                  : LLVMInt32TypeInContext(backend->context);
+        global = LLVMAddGlobal(backend->module, element, name);
+    }
+    return global;
+}
+
+/* Values that were never defined, such as uses in unreachable code, are
+ * undefined rather than an error */
+static LLVMValueRef lower_value(LLVMBackend* backend, FunctionState* state,
+                                const IRValue* value) {
+    LLVMTypeRef type = lower_value_type(backend, value->type);
+    switch (value->kind) {
+    case IR_VALUE_REGISTER: {
+        auto found = state->registers.find(value->id);
+        if (found != state->registers.end())
+            return found->second;
+        break;
+    }
+    case IR_VALUE_LOCAL: {
+        auto found = state->locals.find(value->name);
+        if (found != state->locals.end())
+            return found->second;
+        break;
+    }
+    case IR_VALUE_GLOBAL:
+        return lower_global(backend, value->name, type);
+    case IR_VALUE_CONSTANT:
+        if (LLVMGetTypeKind(type) == LLVMIntegerTypeKind &&
+            LLVMGetIntTypeWidth(type) == 1) {
+            return LLVMConstInt(type, value->id != 0, 0);
+        }
+        return constant_of(backend, type, value->id);
+    case IR_VALUE_NONE:
+        break;
+    }
+    return LLVMGetUndef(type);
+}
+
+/* value as type. The text IR leaves many conversions implicit (an i32
+ * returned as a pointer, an i8* stored through an i32*); they are made
+ * explicit here so the module verifies. */
+static LLVMValueRef convert(LLVMBackend* backend, LLVMValueRef value,
+                            LLVMTypeRef type) {
+    LLVMTypeRef from = LLVMTypeOf(value);
+    if (from == type)
+        return value;
+
+    LLVMBuilderRef builder = backend->builder;
+    LLVMTypeKind from_kind = LLVMGetTypeKind(from);
+    LLVMTypeKind to_kind = LLVMGetTypeKind(type);
+    int from_float =
+        from_kind == LLVMFloatTypeKind || from_kind == LLVMDoubleTypeKind;
+    int to_float = to_kind == LLVMFloatTypeKind || to_kind == LLVMDoubleTypeKind;
+
+    if (from_kind == LLVMIntegerTypeKind && to_kind == LLVMIntegerTypeKind) {
+        unsigned from_width = LLVMGetIntTypeWidth(from);
+        unsigned to_width = LLVMGetIntTypeWidth(type);
+        if (from_width > to_width)
+            return LLVMBuildTrunc(builder, value, type, "");
+        if (from_width == 1)
+            return LLVMBuildZExt(builder, value, type, "");
+        return LLVMBuildSExt(builder, value, type, "");
+    }
+    if (from_kind == LLVMPointerTypeKind && to_kind == LLVMPointerTypeKind)
+        return LLVMBuildBitCast(builder, value, type, "");
+    if (from_kind == LLVMPointerTypeKind && to_kind == LLVMIntegerTypeKind)
+        return LLVMBuildPtrToInt(builder, value, type, "");
+    if (from_kind == LLVMIntegerTypeKind && to_kind == LLVMPointerTypeKind)
+        return LLVMBuildIntToPtr(builder, value, type, "");
+    if (from_kind == LLVMIntegerTypeKind && to_float)
+        return LLVMBuildSIToFP(builder, value, type, "");
+    if (from_float && to_kind == LLVMIntegerTypeKind)
+        return LLVMBuildFPToSI(builder, value, type, "");
+    if (from_float && to_float)
+        return LLVMBuildFPCast(builder, value, type, "");
+    return LLVMGetUndef(type);
+}
+
+static LLVMValueRef lower_operand(LLVMBackend* backend, FunctionState* state,
+                                  const IRValue* value, LLVMTypeRef type) {
+    return convert(backend, lower_value(backend, state, value), type);
+}
+
+/* Branch conditions are i1; anything else is compared against zero */
+static LLVMValueRef lower_condition(LLVMBackend* backend, FunctionState* state,
+                                    const IRValue* value) {
+    LLVMValueRef condition = lower_value(backend, state, value);
+    LLVMTypeRef type = LLVMTypeOf(condition);
+    if (LLVMGetTypeKind(type) == LLVMIntegerTypeKind &&
+        LLVMGetIntTypeWidth(type) == 1) {
+        return condition;
+    }
+    if (LLVMGetTypeKind(type) == LLVMPointerTypeKind)
+        return LLVMBuildIsNotNull(backend->builder, condition, "");
+    condition = convert(backend, condition,
+                        LLVMInt32TypeInContext(backend->context));
+    return LLVMBuildICmp(backend->builder, LLVMIntNE, condition,
+                         LLVMConstNull(LLVMTypeOf(condition)), "");
+}
+
+static void define_result(FunctionState* state, const IRValue* result,
+                          LLVMValueRef value) {
+    if (result->kind == IR_VALUE_REGISTER) {
+        state->registers[result->id] = value;
+    } else if (result->kind == IR_VALUE_LOCAL) {
+        state->locals[result->name] = value;
+    }
+}
+
+static LLVMBasicBlockRef lower_block(LLVMBackend* backend,
+                                     FunctionState* state, int id) {
+    auto found = state->blocks.find(id);
+    if (found != state->blocks.end())
+        return found->second;
+
+    char name[32];
+    snprintf(name, sizeof(name), "bb%d", id);
+    LLVMBasicBlockRef block = LLVMAppendBasicBlockInContext(
+        backend->context, state->function, id == 0 ? "" : name);
+    state->blocks.emplace(id, block);
+    return block;
+}
+
+/* Functions */
+
+static LLVMValueRef declare_function(LLVMBackend* backend, const char* name,
+                                     LLVMTypeRef return_type,
+                                     std::vector<LLVMTypeRef>& parameters,
+                                     int is_variadic) {
+    LLVMValueRef function = LLVMGetNamedFunction(backend->module, name);
+    if (function)
+        return function;
+    LLVMTypeRef type = LLVMFunctionType(return_type, parameters.data(),
+                                        (unsigned)parameters.size(),
+                                        is_variadic);
+    return LLVMAddFunction(backend->module, name, type);
+}
+
+/* The function to give a body. A declaration of another type, made by a
+ * call ahead of the definition, is replaced and its uses cast. */
+static LLVMValueRef define_function(LLVMBackend* backend, const char* name,
+                                    LLVMTypeRef type) {
+    LLVMValueRef existing = LLVMGetNamedFunction(backend->module, name);
+    if (existing && LLVMCountBasicBlocks(existing) > 0) {
+        backend_error(backend, "Redefinition of function '%s'", name);
+        return NULL;
+    }
+    if (existing && LLVMGlobalGetValueType(existing) == type)
+        return existing;
+
+    LLVMValueRef function = LLVMAddFunction(backend->module, name, type);
+    if (existing) {
+        LLVMReplaceAllUsesWith(
+            existing, LLVMConstBitCast(function, LLVMTypeOf(existing)));
+        LLVMDeleteFunction(existing);
+        LLVMSetValueName2(function, name, strlen(name));
+    }
+    return function;
+}
+
+static LLVMValueRef lower_call(LLVMBackend* backend, FunctionState* state,
+                               const IRInstruction* instruction) {
+    std::vector<LLVMValueRef> args;
+    for (int i = 0; i < instruction->operand_count; i++) {
+        args.push_back(lower_value(backend, state, &instruction->operands[i]));
+    }
+
+    LLVMValueRef callee =
+        LLVMGetNamedFunction(backend->module, instruction->text);
+    if (!callee) {
+        /* Undeclared: the prototype is whatever the call passes */
+        std::vector<LLVMTypeRef> parameters;
+        if (instruction->is_variadic_call) {
+            for (int i = 0; i < instruction->parameter_count; i++) {
+                parameters.push_back(lower_value_type(
+                    backend, instruction->parameter_types[i]));
+            }
+        } else {
+            for (LLVMValueRef arg : args) {
+                parameters.push_back(LLVMTypeOf(arg));
+            }
+        }
+        callee = declare_function(backend, instruction->text,
+                                  lower_type(backend, instruction->type),
+                                  parameters, instruction->is_variadic_call);
+    }
+
+    LLVMTypeRef type = LLVMGlobalGetValueType(callee);
+    unsigned fixed = LLVMCountParamTypes(type);
+    if (args.size() < fixed ||
+        (args.size() > fixed && !LLVMIsFunctionVarArg(type))) {
+        /* Called with the wrong arity: call through a cast, as C would */
+        std::vector<LLVMTypeRef> parameters;
+        for (LLVMValueRef arg : args) {
+            parameters.push_back(LLVMTypeOf(arg));
+        }
+        type = LLVMFunctionType(LLVMGetReturnType(type), parameters.data(),
+                                (unsigned)parameters.size(), 0);
+        callee = LLVMConstBitCast(callee, LLVMPointerType(type, 0));
+    } else if (fixed) {
+        std::vector<LLVMTypeRef> parameters(fixed);
+        LLVMGetParamTypes(type, parameters.data());
+        for (unsigned i = 0; i < fixed; i++) {
+            args[i] = convert(backend, args[i], parameters[i]);
+        }
+    }
+
+    LLVMValueRef call = LLVMBuildCall2(backend->builder, type, callee,
+                                       args.data(), (unsigned)args.size(), "");
+    if (LLVMGetTypeKind(LLVMGetReturnType(type)) == LLVMVoidTypeKind)
+        return LLVMGetUndef(lower_value_type(backend, instruction->type));
+    return call;
+}
+
+static LLVMOpcode binary_opcode(int op) {
+    switch (op) {
+    case IR_ADD:
+        return LLVMAdd;
+    case IR_SUB:
+        return LLVMSub;
+    case IR_MUL:
+        return LLVMMul;
+    case IR_SDIV:
+        return LLVMSDiv;
+    case IR_SREM:
+        return LLVMSRem;
+    case IR_AND:
+        return LLVMAnd;
+    case IR_OR:
+        return LLVMOr;
+    case IR_XOR:
+        return LLVMXor;
+    case IR_SHL:
+        return LLVMShl;
+    default:
+        return LLVMAShr;
+    }
+}
+
+static LLVMIntPredicate int_predicate(int op) {
+    switch (op) {
+    case IR_ICMP_EQ:
+        return LLVMIntEQ;
+    case IR_ICMP_NE:
+        return LLVMIntNE;
+    case IR_ICMP_SLT:
+        return LLVMIntSLT;
+    case IR_ICMP_SGT:
+        return LLVMIntSGT;
+    case IR_ICMP_SLE:
+        return LLVMIntSLE;
+    default:
+        return LLVMIntSGE;
+    }
+}
+
+/* ret for a block that runs off the end of the function */
+static void build_default_return(LLVMBackend* backend, FunctionState* state) {
+    if (LLVMGetTypeKind(state->return_type) == LLVMVoidTypeKind) {
+        LLVMBuildRetVoid(backend->builder);
+    } else {
+        LLVMBuildRet(backend->builder, LLVMConstNull(state->return_type));
+    }
+}
+
+/* Translate one instruction; returns 1 for terminators */
+static int lower_instruction(LLVMBackend* backend, FunctionState* state,
+                             const IRInstruction* instruction) {
+    LLVMBuilderRef builder = backend->builder;
+    const IRValue* operands = instruction->operands;
+    LLVMValueRef value = NULL;
+
+    switch (instruction->opcode) {
+    case IR_ALLOCA: {
+        LLVMTypeRef type = lower_value_type(backend, instruction->type);
+        if (has_unknown_layout(type)) {
+            backend_error(backend, "Layout of '%s' is unknown",
+                          canonical_type_name(instruction->type));
+            value = LLVMGetUndef(LLVMPointerType(type, 0));
+            break;
+        }
+        value = LLVMBuildAlloca(builder, type,
+                                instruction->result.kind == IR_VALUE_LOCAL
+                                    ? instruction->result.name
+                                    : "");
+        break;
+    }
+    case IR_LOAD: {
+        LLVMTypeRef type = lower_value_type(backend, instruction->type);
+        LLVMValueRef address = lower_operand(backend, state, &operands[0],
+                                             LLVMPointerType(type, 0));
+        value = LLVMBuildLoad2(builder, type, address, "");
+        break;
+    }
+    case IR_STORE: {
+        LLVMTypeRef type = lower_value_type(backend, instruction->type);
+        LLVMValueRef stored = lower_operand(backend, state, &operands[0], type);
+        LLVMValueRef address = lower_operand(backend, state, &operands[1],
+                                             LLVMPointerType(type, 0));
+        LLVMBuildStore(builder, stored, address);
+        return 0;
+    }
+    case IR_GEP: {
+        LLVMTypeRef type = lower_value_type(backend, instruction->type);
+        if (has_unknown_layout(type)) {
+            backend_error(backend, "Layout of '%s' is unknown",
+                          canonical_type_name(instruction->type));
+            value = LLVMGetUndef(
+                lower_value_type(backend, instruction->result.type));
+            break;
+        }
+        LLVMValueRef base = lower_operand(backend, state, &operands[0],
+                                          LLVMPointerType(type, 0));
+        std::vector<LLVMValueRef> indices;
+        for (int i = 1; i < instruction->operand_count; i++) {
+            indices.push_back(lower_value(backend, state, &operands[i]));
+        }
+        value = LLVMBuildGEP2(builder, type, base, indices.data(),
+                              (unsigned)indices.size(), "");
+        break;
+    }
+    case IR_BINARY: {
+        LLVMTypeRef type = lower_value_type(backend, instruction->type);
+        value = LLVMBuildBinOp(
+            builder, binary_opcode(instruction->op),
+            lower_operand(backend, state, &operands[0], type),
+            lower_operand(backend, state, &operands[1], type), "");
+        break;
+    }
+    case IR_ICMP: {
+        LLVMTypeRef type = lower_value_type(backend, instruction->type);
+        value = LLVMBuildICmp(
+            builder, int_predicate(instruction->op),
+            lower_operand(backend, state, &operands[0], type),
+            lower_operand(backend, state, &operands[1], type), "");
+        break;
+    }
+    case IR_CAST: {
+        LLVMTypeRef type = lower_value_type(backend, instruction->type);
+        LLVMValueRef source = lower_value(backend, state, &operands[0]);
+        LLVMTypeRef from = LLVMTypeOf(source);
+        if (instruction->op == IR_ZEXT &&
+            LLVMGetTypeKind(from) == LLVMIntegerTypeKind &&
+            LLVMGetTypeKind(type) == LLVMIntegerTypeKind &&
+            LLVMGetIntTypeWidth(from) < LLVMGetIntTypeWidth(type)) {
+            value = LLVMBuildZExt(builder, source, type, "");
+        } else {
+            value = convert(backend, source, type);
+        }
+        break;
+    }
+    case IR_PHI:
+        /* Incoming values may come from blocks not translated yet */
+        value = LLVMBuildPhi(builder,
+                             lower_value_type(backend, instruction->type), "");
+        state->phis.emplace_back(instruction, value);
+        break;
+    case IR_CALL:
+        value = lower_call(backend, state, instruction);
+        break;
+    case IR_BR:
+        LLVMBuildBr(builder, lower_block(backend, state, instruction->blocks[0]));
+        return 1;
+    case IR_COND_BR:
+        LLVMBuildCondBr(builder, lower_condition(backend, state, &operands[0]),
+                        lower_block(backend, state, instruction->blocks[0]),
+                        lower_block(backend, state, instruction->blocks[1]));
+        return 1;
+    case IR_SWITCH: {
+        LLVMValueRef condition = lower_value(backend, state, &operands[0]);
+        LLVMValueRef dispatch = LLVMBuildSwitch(
+            builder, condition,
+            lower_block(backend, state, instruction->blocks[0]),
+            (unsigned)(instruction->operand_count - 1));
+        for (int i = 1; i < instruction->operand_count; i++) {
+            LLVMAddCase(dispatch,
+                        lower_operand(backend, state, &operands[i],
+                                      LLVMTypeOf(condition)),
+                        lower_block(backend, state, instruction->blocks[i]));
+        }
+        return 1;
+    }
+    case IR_RET:
+        if (LLVMGetTypeKind(state->return_type) == LLVMVoidTypeKind) {
+            LLVMBuildRetVoid(builder);
+        } else if (instruction->operand_count == 0) {
+            build_default_return(backend, state);
+        } else {
+            LLVMBuildRet(builder, lower_operand(backend, state, &operands[0],
+                                                state->return_type));
+        }
+        return 1;
+    case IR_COMMENT:
+        return 0;
+    }
+
+    if (value) {
+        define_result(state, &instruction->result, value);
+    }
+    return 0;
+}
+
+static void add_incoming_values(LLVMBackend* backend, FunctionState* state) {
+    for (auto& phi : state->phis) {
+        const IRInstruction* instruction = phi.first;
+        LLVMTypeRef type = LLVMTypeOf(phi.second);
+        for (int i = 0; i < instruction->operand_count; i++) {
+            LLVMBasicBlockRef block =
+                lower_block(backend, state, instruction->blocks[i]);
+            /* Conversions go at the end of the predecessor */
+            LLVMValueRef terminator = LLVMGetBasicBlockTerminator(block);
+            if (terminator) {
+                LLVMPositionBuilderBefore(backend->builder, terminator);
+            } else {
+                LLVMPositionBuilderAtEnd(backend->builder, block);
+            }
+            LLVMValueRef value = lower_operand(
+                backend, state, &instruction->operands[i], type);
+            LLVMAddIncoming(phi.second, &value, &block, 1);
+        }
+    }
+}
+
+static void add_function(void* data, const IRFunction* function) {
+    auto backend = static_cast<LLVMBackend*>(data);
+
+    std::vector<LLVMTypeRef> parameters;
+    for (int i = 0; i < function->parameter_count; i++) {
+        parameters.push_back(
+            lower_value_type(backend, function->parameters[i].type));
+    }
+    FunctionState state;
+    state.return_type = lower_type(backend, function->return_type);
+    state.function = define_function(
+        backend, function->name,
+        LLVMFunctionType(state.return_type, parameters.data(),
+                         (unsigned)parameters.size(), 0));
+    if (!state.function)
+        return;
+    if (strncmp(function->linkage, "internal", 8) == 0) {
+        LLVMSetLinkage(state.function, LLVMInternalLinkage);
+    }
+
+    for (int i = 0; i < function->parameter_count; i++) {
+        const char* name = function->parameters[i].name;
+        LLVMValueRef parameter = LLVMGetParam(state.function, (unsigned)i);
+        LLVMSetValueName2(parameter, name, strlen(name));
+        state.locals[name] = parameter;
+    }
+
+    /* Blocks in layout order, the entry block first */
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        lower_block(backend, &state, block->id);
+    }
+
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        LLVMPositionBuilderAtEnd(backend->builder,
+                                 lower_block(backend, &state, block->id));
+        int terminated = 0;
+        for (const IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            if (terminated) {
+                /* Code after a branch or return is unreachable */
+                LLVMPositionBuilderAtEnd(
+                    backend->builder,
+                    LLVMAppendBasicBlockInContext(backend->context,
+                                                  state.function, ""));
+            }
+            terminated = lower_instruction(backend, &state, instruction);
+        }
+        /* A block without terminator falls through to the next one */
+        if (!terminated) {
+            if (block->next) {
+                LLVMBuildBr(backend->builder,
+                            lower_block(backend, &state, block->next->id));
+            } else {
+                build_default_return(backend, &state);
+            }
+        }
+    }
+
+    /* Branch targets that were never laid out */
+    for (LLVMBasicBlockRef block = LLVMGetFirstBasicBlock(state.function);
+         block; block = LLVMGetNextBasicBlock(block)) {
+        if (!LLVMGetBasicBlockTerminator(block)) {
+            LLVMPositionBuilderAtEnd(backend->builder, block);
+            LLVMBuildUnreachable(backend->builder);
+        }
+    }
+
+    add_incoming_values(backend, &state);
+}
+
+/* Globals */
+
+/* Character array initializer: bytes, zero padded to the array length */
+static LLVMValueRef char_array_initializer(LLVMBackend* backend,
+                                           LLVMTypeRef type,
+                                           const IRGlobal* global) {
+    if (LLVMGetTypeKind(type) != LLVMArrayTypeKind)
+        return LLVMConstNull(type);
+    std::string bytes(global->bytes, global->length);
+    bytes.resize(LLVMGetArrayLength(type), '\0');
+    return LLVMConstStringInContext(backend->context, bytes.data(),
+                                    (unsigned)bytes.size(), 1);
+}
+
+static void add_global(void* data, const IRGlobal* global) {
+    auto backend = static_cast<LLVMBackend*>(data);
+    LLVMModuleRef module = backend->module;
+
+    switch (global->kind) {
+    case IR_GLOBAL_DECLARATION: {
+        std::vector<LLVMTypeRef> parameters;
+        for (int i = 0; i < global->parameter_count; i++) {
+            parameters.push_back(
+                lower_value_type(backend, global->parameter_types[i]));
+        }
+        declare_function(backend, global->name,
+                         lower_type(backend, global->type), parameters,
+                         global->is_variadic);
+        break;
+    }
+    case IR_GLOBAL_VARIABLE:
+    case IR_GLOBAL_EXTERNAL: {
+        LLVMTypeRef type = lower_value_type(backend, global->type);
+        LLVMValueRef variable = LLVMGetNamedGlobal(module, global->name);
+        if (variable && (global->kind == IR_GLOBAL_EXTERNAL ||
+                         LLVMGetInitializer(variable))) {
+            break; /* Declared again, or a tentative definition */
+        }
+        if (!variable)
+            variable = LLVMAddGlobal(module, type, global->name);
+        if (global->kind == IR_GLOBAL_EXTERNAL)
+            break;
+        if (has_unknown_layout(type)) {
+            backend_error(backend, "Layout of '%s' is unknown",
+                          canonical_type_name(global->type));
+            break;
+        }
+
+        LLVMValueRef initializer;
+        if (global->has_constant) {
+            initializer = constant_of(backend, type, global->constant);
+        } else if (global->bytes) {
+            initializer = char_array_initializer(backend, type, global);
+        } else {
+            initializer = LLVMConstNull(type);
+        }
+        LLVMSetInitializer(variable, initializer);
+        if (strncmp(global->linkage, "internal", 8) == 0) {
+            LLVMSetLinkage(variable, LLVMInternalLinkage);
+        }
+        break;
+    }
+    case IR_GLOBAL_STRING: {
+        LLVMValueRef initializer = LLVMConstStringInContext(
+            backend->context, global->bytes, (unsigned)global->length, 0);
+        LLVMValueRef string =
+            LLVMAddGlobal(module, LLVMTypeOf(initializer), global->name);
+        LLVMSetInitializer(string, initializer);
+        LLVMSetGlobalConstant(string, 1);
+        LLVMSetLinkage(string, LLVMPrivateLinkage);
+        LLVMSetUnnamedAddress(string, LLVMGlobalUnnamedAddr);
+        break;
+    }
+    }
+}
+
+/* Public interface */
+
+int llvm_backend_available(void) {
+    return 1;
+}
+
+LLVMBackend* llvm_backend_create(const char* module_name) {
+    auto backend = new LLVMBackend();
+    /* A thread-safe context, so that --run can hand the module to ORC */
+    backend->ts_context = LLVMOrcCreateNewThreadSafeContext();
+    backend->context = LLVMOrcThreadSafeContextGetContext(backend->ts_context);
+    backend->module = LLVMModuleCreateWithNameInContext(
+        module_name ? module_name : "module", backend->context);
+    backend->jit = NULL;
+    backend->builder = LLVMCreateBuilderInContext(backend->context);
+    backend->consumer.data = backend;
+    backend->consumer.add_global = add_global;
+    backend->consumer.add_function = add_function;
+    backend->error_count = 0;
+    return backend;
+}
+
+void llvm_backend_attach(LLVMBackend* backend, CodeGenContext* ctx) {
+    ctx->consumer = &backend->consumer;
+}
+
+/* Report and consume error; returns -1 when there was one */
+static int report_llvm_error(LLVMErrorRef error) {
+    if (!error)
+        return 0;
+    char* message = LLVMGetErrorMessage(error);
+    fprintf(stderr, "Error: %s\n", message);
+    LLVMDisposeErrorMessage(message);
+    return -1;
+}
+
+/* Verify the module, give it the host's triple and layout and run the
+ * default<O opt_level> pipeline. Returns the host target machine, or NULL
+ * after reporting to stderr. */
+static LLVMTargetMachineRef optimize_for_host(LLVMBackend* backend,
+                                              int opt_level) {
+    if (backend->error_count > 0)
+        return NULL;
+
+    char* message = NULL;
+    if (LLVMVerifyModule(backend->module, LLVMReturnStatusAction, &message)) {
+        fprintf(stderr, "Error: Invalid module: %s\n", message);
+        LLVMDisposeMessage(message);
+        return NULL;
+    }
+    LLVMDisposeMessage(message);
+
+    LLVMInitializeNativeTarget();
+    LLVMInitializeNativeAsmPrinter();
+
+    char* triple = LLVMGetDefaultTargetTriple();
+    LLVMTargetRef target;
+    if (LLVMGetTargetFromTriple(triple, &target, &message)) {
+        fprintf(stderr, "Error: %s\n", message);
+        LLVMDisposeMessage(message);
+        LLVMDisposeMessage(triple);
+        return NULL;
+    }
+
+    LLVMCodeGenOptLevel level = opt_level <= 0   ? LLVMCodeGenLevelNone
+                                : opt_level == 1 ? LLVMCodeGenLevelLess
+                                : opt_level == 2 ? LLVMCodeGenLevelDefault
+                                                 : LLVMCodeGenLevelAggressive;
+    LLVMTargetMachineRef machine =
+        LLVMCreateTargetMachine(target, triple, "generic", "", level,
+                                LLVMRelocPIC, LLVMCodeModelDefault);
+    LLVMSetTarget(backend->module, triple);
+    LLVMTargetDataRef layout = LLVMCreateTargetDataLayout(machine);
+    LLVMSetModuleDataLayout(backend->module, layout);
+    LLVMDisposeTargetData(layout);
+    LLVMDisposeMessage(triple);
+
+    char pipeline[32];
+    snprintf(pipeline, sizeof(pipeline), "default<O%d>",
+             opt_level < 0 ? 0 : opt_level > 3 ? 3 : opt_level);
+    LLVMPassBuilderOptionsRef pass_options = LLVMCreatePassBuilderOptions();
+    LLVMErrorRef error =
+        LLVMRunPasses(backend->module, pipeline, machine, pass_options);
+    LLVMDisposePassBuilderOptions(pass_options);
+    if (report_llvm_error(error) != 0) {
+        LLVMDisposeTargetMachine(machine);
+        return NULL;
+    }
+    return machine;
+}
+
+int llvm_backend_write_object(LLVMBackend* backend, int opt_level,
+                              const char* path) {
+    LLVMTargetMachineRef machine = optimize_for_host(backend, opt_level);
+    if (!machine)
+        return -1;
+
+    int result = 0;
+    char* message = NULL;
+    if (LLVMTargetMachineEmitToFile(machine, backend->module,
+                                    const_cast<char*>(path), LLVMObjectFile,
+                                    &message)) {
+        fprintf(stderr, "Error: Cannot write object file '%s': %s\n", path,
+                message);
+        LLVMDisposeMessage(message);
+        result = -1;
+    }
+
+    LLVMDisposeTargetMachine(machine);
+    return result;
+}
+
+LLVMBackendMain llvm_backend_jit_main(LLVMBackend* backend, int opt_level) {
+    if (!backend->module)
+        return NULL;
+    LLVMTargetMachineRef machine = optimize_for_host(backend, opt_level);
+    if (!machine)
+        return NULL;
+    LLVMDisposeTargetMachine(machine);
+
+    if (report_llvm_error(LLVMOrcCreateLLJIT(&backend->jit, NULL)) != 0) {
+        backend->jit = NULL;
+        return NULL;
+    }
+
+    /* printf, malloc and the rest resolve to this process's definitions */
+    LLVMOrcDefinitionGeneratorRef generator;
+    if (report_llvm_error(LLVMOrcCreateDynamicLibrarySearchGeneratorForProcess(
+            &generator, LLVMOrcLLJITGetGlobalPrefix(backend->jit), NULL,
+            NULL)) != 0)
+        return NULL;
+    LLVMOrcJITDylibRef dylib = LLVMOrcLLJITGetMainJITDylib(backend->jit);
+    LLVMOrcJITDylibAddGenerator(dylib, generator);
+
+    LLVMOrcThreadSafeModuleRef module =
+        LLVMOrcCreateNewThreadSafeModule(backend->module, backend->ts_context);
+    backend->module = NULL;
+    if (report_llvm_error(
+            LLVMOrcLLJITAddLLVMIRModule(backend->jit, dylib, module)) != 0)
+        return NULL;
+
+    LLVMOrcExecutorAddress address = 0;
+    if (report_llvm_error(
+            LLVMOrcLLJITLookup(backend->jit, &address, "main")) != 0)
+        return NULL;
+    return reinterpret_cast<LLVMBackendMain>(address);
+}
+
+void llvm_backend_free(LLVMBackend* backend) {
+    if (!backend)
+        return;
+    LLVMDisposeBuilder(backend->builder);
+    if (backend->module) {
+        LLVMDisposeModule(backend->module);
+    }
+    if (backend->jit) {
+        report_llvm_error(LLVMOrcDisposeLLJIT(backend->jit));
+    }
+    LLVMOrcDisposeThreadSafeContext(backend->ts_context);
+    delete backend;
+}
+
+#else /* !TINYC_HAVE_LLVM */
+
+int llvm_backend_available(void) {
+    return 0;
+}
+
+LLVMBackend* llvm_backend_create(const char* module_name) {
+    (void)module_name;
+    return NULL;
+}
+
+void llvm_backend_attach(LLVMBackend* backend, CodeGenContext* ctx) {
+    (void)backend;
+    (void)ctx;
+}
+
+int llvm_backend_write_object(LLVMBackend* backend, int opt_level,
+                              const char* path) {
+    (void)backend;
+    (void)opt_level;
+    (void)path;
+    fprintf(stderr, "Error: Built without LLVM\n");
+    return -1;
+}
+
+LLVMBackendMain llvm_backend_jit_main(LLVMBackend* backend, int opt_level) {
+    (void)backend;
+    (void)opt_level;
+    fprintf(stderr, "Error: Built without LLVM\n");
+    return NULL;
+}
+
+void llvm_backend_free(LLVMBackend* backend) {
+    (void)backend;
+}
+
+#endif /* TINYC_HAVE_LLVM */
@@ -0,0 +1,44 @@
+#ifndef LLVM_BACKEND_H
+#define LLVM_BACKEND_H
+
+extern "C" {
+
+#include "codegen.h"
+
+/*
+ * Object file backend on the LLVM C API (--backend=llvm-api).
+ *
+ * Attached to a code generation context, it takes each function and module
+ * global as lowering finishes them and rebuilds them in an LLVM module with
+ * an LLVMBuilderRef, so no IR text is printed or parsed. The module is then
+ * optimized in process by the new pass manager and written as a native
+ * object file, or JIT-compiled and run (--run). Builds without LLVM (TINYC_HAVE_LLVM unset) keep these entry
+ * points, but the backend is unavailable and only the text output exists.
+ */
+
+typedef struct LLVMBackend LLVMBackend;
+
+/* 1 when the compiler was built against LLVM */
+int llvm_backend_available(void);
+
+/* Backend for an empty module; NULL when unavailable */
+LLVMBackend* llvm_backend_create(const char* module_name);
+/* Route everything ctx generates from now on to backend. One thread at a
+ * time: the context stops splitting functions across codegen jobs. */
+void llvm_backend_attach(LLVMBackend* backend, CodeGenContext* ctx);
+/* Verify the module, run the default<O opt_level> pipeline and write an
+ * object file for the host; returns 0 on success, else reports to stderr */
+int llvm_backend_write_object(LLVMBackend* backend, int opt_level,
+                              const char* path);
+
+typedef int (*LLVMBackendMain)(int argc, char** argv);
+/* Optimize the module like llvm_backend_write_object, then compile it in
+ * process with ORC LLJIT (--run), resolving undefined symbols such as
+ * printf and malloc from this process. Returns the JIT'd main, valid until
+ * llvm_backend_free, or NULL after reporting to stderr. Either way the
+ * module can no longer be written. */
+LLVMBackendMain llvm_backend_jit_main(LLVMBackend* backend, int opt_level);
+void llvm_backend_free(LLVMBackend* backend);
+}
+
+#endif /* LLVM_BACKEND_H */
@@ -1,6 +1,12 @@
 #include "ast.h"
 #include "codegen.h"
+#include "driver.h"
+#include "bitcode_writer.h"
+#include "bytecode_vm.h"
+#include "llvm_backend.h"
+#include "x86_backend.h"
 
+#include <chrono>
 #include <getopt.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -28,7 +34,56 @@ struct CompilerOptions {
     int verbose;
     int dump_ast;
     int dump_tokens;
-} options = {NULL, NULL, 0, 0, 0, 0};
+    int jobs;           /* -j N: batch mode worker count (0 = not set) */
+    char** input_files; /* All non-option arguments */
+    int input_count;
+    int codegen_jobs;   /* --codegen-jobs N: threads per translation unit */
+    int whole_program;  /* --whole-program: merge inputs into one module */
+    const char** exports; /* --export NAME: symbols left external */
+    int export_count;
+    int mmap_output;    /* --mmap-output: write -o FILE through a mapping */
+    int stream_constants; /* --stream-constants: emit constants early */
+    int backend;          /* --backend NAME: BACKEND_TEXT, _LLVM_API, _X86_64 */
+    int opt_level;        /* -O N: pass pipeline of the llvm-api backend */
+    int emit;             /* --emit KIND: EMIT_LL or EMIT_BC */
+    int ir_flags;         /* --opaque-pointers, --compact-ir: IRPrintFlags */
+    const char* target;   /* --target TRIPLE: NULL for the host */
+    int run;              /* --run: JIT the input and exit with main's status */
+    char** run_args;      /* argv of the run main: input, then args */
+    int run_arg_count;
+    int interp;           /* --interp: run the input on the bytecode VM */
+    int ssa;              /* -fssa: promote scalar locals to registers */
+} options = {NULL, NULL, 0, 0, 0, 0, 0, NULL, 0, 0, 0,
+             NULL, 0, 0, 0, 0, 0, 0, 0, NULL, 0, NULL, 0, 0, 0};
+
+/* Code generation backends */
+enum {
+    BACKEND_TEXT,     /* LLVM IR text */
+    BACKEND_LLVM_API, /* Object file through the LLVM C API */
+    BACKEND_X86_64    /* Object file from the native x86-64 backend */
+};
+
+/* Output formats of the text backend */
+enum {
+    EMIT_LL, /* LLVM IR text */
+    EMIT_BC  /* LLVM bitcode, written without libLLVM */
+};
+
+/* Long-only options */
+enum {
+    OPTION_CODEGEN_JOBS = 256,
+    OPTION_WHOLE_PROGRAM,
+    OPTION_EXPORT,
+    OPTION_MMAP_OUTPUT,
+    OPTION_STREAM_CONSTANTS,
+    OPTION_BACKEND,
+    OPTION_EMIT,
+    OPTION_OPAQUE_POINTERS,
+    OPTION_COMPACT_IR,
+    OPTION_TARGET,
+    OPTION_RUN,
+    OPTION_INTERP
+};
 
 /* Function prototypes */
 void print_usage(const char* program_name);
@@ -38,10 +93,46 @@ int yyerror(const char* s);
 
 /* Print usage information */
 void print_usage(const char* program_name) {
-    printf("Usage: %s [options] [input_file]\n", program_name);
+    printf("Usage: %s [options] [input_file...]\n", program_name);
     printf("\nOptions:\n");
     printf(
         "  -o, --output FILE      Write LLVM IR to FILE (default: stdout)\n");
+    printf("  -j, --jobs N          Compile inputs on N worker threads; with\n"
+           "                        several inputs, -o names an output directory\n");
+    printf("      --codegen-jobs N  Generate function bodies on N threads\n");
+    printf("      --whole-program   Compile all inputs into one module with\n"
+           "                        internal linkage for everything but main\n");
+    printf("      --export NAME     Keep NAME externally visible in\n"
+           "                        --whole-program mode (repeatable)\n");
+    printf("      --mmap-output     Write the -o file through a memory mapping\n");
+    printf("      --stream-constants\n"
+           "                        Write module constants after each top-level\n"
+           "                        declaration instead of at the end\n");
+    printf("      --backend NAME    text (default): write LLVM IR; llvm-api:\n"
+           "                        build the module with the LLVM C API and\n"
+           "                        write an object file to -o FILE; x86-64:\n"
+           "                        write an unoptimized x86-64 ELF object\n"
+           "                        directly, without LLVM\n");
+    printf("      --emit KIND       ll (default): LLVM IR text; bc: LLVM\n"
+           "                        bitcode for llvm-dis, llc or clang\n");
+    printf("      --opaque-pointers Spell every pointer type ptr in LLVM IR\n"
+           "                        text (LLVM 15 and later)\n");
+    printf("      --compact-ir      Leave comments, indentation and blank\n"
+           "                        lines out of LLVM IR text\n");
+    printf("      --target TRIPLE   Generate code for TRIPLE (default: the\n"
+           "                        host): x86_64 or aarch64/arm64 on Linux\n"
+           "                        or Darwin, riscv64 or powerpc64le Linux\n");
+    printf("      --run FILE [-- ARGS]\n"
+           "                        Compile FILE in memory, JIT it with LLVM\n"
+           "                        ORC and exit with the status of its main\n");
+    printf("      --interp FILE [-- ARGS]\n"
+           "                        Like --run, but on the built-in bytecode\n"
+           "                        interpreter; starts in milliseconds and\n"
+           "                        needs no LLVM\n");
+    printf("  -fssa                 Keep scalar locals in SSA registers with\n"
+           "                        phis instead of stack slots\n");
+    printf("  -O N                  Optimization level 0-3 for llvm-api and\n"
+           "                        --run (default: 0)\n");
     printf("  -d, --debug           Enable debug mode\n");
     printf("  -v, --verbose         Enable verbose output\n");
     printf("  -a, --dump-ast        Dump Abstract Syntax Tree\n");
@@ -51,6 +142,15 @@ void print_usage(const char* program_name) {
     printf("  %s program.c -o program.ll\n", program_name);
     printf("  %s -v -a program.c\n", program_name);
     printf("  cat program.c | %s > program.ll\n", program_name);
+    printf("  %s -j 8 a.c b.c c.c -o out/\n", program_name);
+    printf("  %s --whole-program a.c b.c -o all.ll\n", program_name);
+    printf("  %s --backend=llvm-api -O2 program.c -o program.o\n",
+           program_name);
+    printf("  %s --backend=x86-64 program.c -o program.o\n", program_name);
+    printf("  %s --emit=bc program.c -o program.bc\n", program_name);
+    printf("  %s --run program.c -- arg1 arg2\n", program_name);
+    printf("  %s --interp program.c -- arg1 arg2\n", program_name);
+    printf("  %s -fssa program.c -o program.ll\n", program_name);
 }
 
 /* Parse command line arguments */
@@ -61,13 +161,37 @@ int parse_arguments(int argc, char* argv[]) {
                                            {"verbose", no_argument, 0, 'v'},
                                            {"dump-ast", no_argument, 0, 'a'},
                                            {"dump-tokens", no_argument, 0, 't'},
+                                           {"jobs", required_argument, 0, 'j'},
+                                           {"codegen-jobs", required_argument,
+                                            0, OPTION_CODEGEN_JOBS},
+                                           {"whole-program", no_argument, 0,
+                                            OPTION_WHOLE_PROGRAM},
+                                           {"export", required_argument, 0,
+                                            OPTION_EXPORT},
+                                           {"mmap-output", no_argument, 0,
+                                            OPTION_MMAP_OUTPUT},
+                                           {"stream-constants", no_argument,
+                                            0, OPTION_STREAM_CONSTANTS},
+                                           {"backend", required_argument, 0,
+                                            OPTION_BACKEND},
+                                           {"emit", required_argument, 0,
+                                            OPTION_EMIT},
+                                           {"opaque-pointers", no_argument, 0,
+                                            OPTION_OPAQUE_POINTERS},
+                                           {"compact-ir", no_argument, 0,
+                                            OPTION_COMPACT_IR},
+                                           {"target", required_argument, 0,
+                                            OPTION_TARGET},
+                                           {"run", no_argument, 0, OPTION_RUN},
+                                           {"interp", no_argument, 0,
+                                            OPTION_INTERP},
                                            {"help", no_argument, 0, 'h'},
                                            {0, 0, 0, 0}};
 
     int option_index = 0;
     int c;
 
-    while ((c = getopt_long(argc, argv, "o:dvath", long_options,
+    while ((c = getopt_long(argc, argv, "o:dvatj:f:O:h", long_options,
                             &option_index)) != -1) {
         switch (c) {
         case 'o':
@@ -85,6 +209,99 @@ int parse_arguments(int argc, char* argv[]) {
         case 't':
             options.dump_tokens = 1;
             break;
+        case 'j':
+            options.jobs = atoi(optarg);
+            if (options.jobs <= 0) {
+                fprintf(stderr, "Error: Invalid job count '%s'\n", optarg);
+                return -1;
+            }
+            break;
+        case OPTION_CODEGEN_JOBS:
+            options.codegen_jobs = atoi(optarg);
+            if (options.codegen_jobs <= 0) {
+                fprintf(stderr, "Error: Invalid job count '%s'\n", optarg);
+                return -1;
+            }
+            break;
+        case OPTION_WHOLE_PROGRAM:
+            options.whole_program = 1;
+            break;
+        case OPTION_EXPORT: {
+            auto exports = static_cast<const char**>(
+                realloc(options.exports,
+                        (options.export_count + 1) * sizeof(const char*)));
+            if (!exports) {
+                fprintf(stderr, "Error: Memory allocation failed\n");
+                return -1;
+            }
+            exports[options.export_count++] = optarg;
+            options.exports = exports;
+            break;
+        }
+        case OPTION_MMAP_OUTPUT:
+            options.mmap_output = 1;
+            break;
+        case OPTION_STREAM_CONSTANTS:
+            options.stream_constants = 1;
+            break;
+        case OPTION_BACKEND:
+            if (strcmp(optarg, "text") == 0) {
+                options.backend = BACKEND_TEXT;
+            } else if (strcmp(optarg, "llvm-api") == 0) {
+                options.backend = BACKEND_LLVM_API;
+            } else if (strcmp(optarg, "x86-64") == 0) {
+                options.backend = BACKEND_X86_64;
+            } else {
+                fprintf(stderr, "Error: Unknown backend '%s'\n", optarg);
+                return -1;
+            }
+            break;
+        case OPTION_EMIT:
+            if (strcmp(optarg, "ll") == 0) {
+                options.emit = EMIT_LL;
+            } else if (strcmp(optarg, "bc") == 0) {
+                options.emit = EMIT_BC;
+            } else {
+                fprintf(stderr, "Error: Unknown output format '%s'\n",
+                        optarg);
+                return -1;
+            }
+            break;
+        case OPTION_OPAQUE_POINTERS:
+            options.ir_flags |= IR_PRINT_OPAQUE_POINTERS;
+            break;
+        case OPTION_COMPACT_IR:
+            options.ir_flags |= IR_PRINT_COMPACT;
+            break;
+        case OPTION_TARGET:
+            if (!target_lookup(optarg)) {
+                fprintf(stderr, "Error: Unsupported target '%s'\n", optarg);
+                return -1;
+            }
+            options.target = optarg;
+            break;
+        case OPTION_RUN:
+            options.run = 1;
+            break;
+        case OPTION_INTERP:
+            options.interp = 1;
+            break;
+        case 'f':
+            if (strcmp(optarg, "ssa") == 0) {
+                options.ssa = 1;
+            } else {
+                fprintf(stderr, "Error: Unknown option '-f%s'\n", optarg);
+                return -1;
+            }
+            break;
+        case 'O':
+            if (optarg[0] < '0' || optarg[0] > '3' || optarg[1] != '\0') {
+                fprintf(stderr, "Error: Invalid optimization level '%s'\n",
+                        optarg);
+                return -1;
+            }
+            options.opt_level = optarg[0] - '0';
+            break;
         case 'h':
             print_usage(argv[0]);
             exit(0);
@@ -100,6 +317,16 @@ int parse_arguments(int argc, char* argv[]) {
     if (optind < argc) {
         options.input_file = argv[optind];
     }
+    options.input_files = argv + optind;
+    options.input_count = argc > optind ? argc - optind : 0;
+
+    /* --run, --interp: the input is followed by the program's own
+     * arguments */
+    if ((options.run || options.interp) && options.input_count > 0) {
+        options.run_args = argv + optind;
+        options.run_arg_count = options.input_count;
+        options.input_count = 1;
+    }
 
     return 0;
 }
@@ -121,8 +348,14 @@ void cleanup_resources(void) {
 int main(int argc, char* argv[]) {
     FILE* output_file = stdout;
     CodeGenContext* ctx = NULL;
+    LLVMBackend* backend = NULL;
+    X86Backend* native = NULL;
+    BytecodeVM* vm = NULL;
+    BitcodeWriter* bitcode = NULL;
     int exit_code = 0;
     int result = 0;
+    double codegen_ms = 0.0;
+    auto compile_start = std::chrono::steady_clock::now();
 
     /* Parse command line arguments */
     if (parse_arguments(argc, argv) != 0) {
@@ -130,6 +363,138 @@ int main(int argc, char* argv[]) {
         goto cleanup;
     }
 
+    /* --backend=llvm-api: one translation unit to one object file */
+    if (options.backend == BACKEND_LLVM_API) {
+        if (!llvm_backend_available()) {
+            fprintf(stderr, "Warning: Built without LLVM; writing LLVM IR "
+                            "text instead\n");
+            options.backend = BACKEND_TEXT;
+        } else if (options.whole_program || options.input_count > 1 ||
+                   options.jobs > 0) {
+            fprintf(stderr,
+                    "Error: --backend=llvm-api compiles a single input\n");
+            exit_code = 1;
+            goto cleanup;
+        } else if (!options.output_file) {
+            fprintf(stderr, "Error: --backend=llvm-api needs -o FILE\n");
+            exit_code = 1;
+            goto cleanup;
+        } else if (options.target) {
+            fprintf(stderr, "Error: --backend=llvm-api writes objects for "
+                            "the host; --target does not apply\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+    }
+
+    /* --backend=x86-64: one translation unit to one x86-64 ELF object */
+    if (options.backend == BACKEND_X86_64) {
+        const TargetInfo* x86_64 = target_lookup("x86_64-pc-linux-gnu");
+        if (options.whole_program || options.input_count > 1 ||
+            options.jobs > 0) {
+            fprintf(stderr,
+                    "Error: --backend=x86-64 compiles a single input\n");
+            exit_code = 1;
+            goto cleanup;
+        } else if (!options.output_file) {
+            fprintf(stderr, "Error: --backend=x86-64 needs -o FILE\n");
+            exit_code = 1;
+            goto cleanup;
+        } else if (options.target && target_lookup(options.target) != x86_64) {
+            fprintf(stderr, "Error: --backend=x86-64 writes objects for "
+                            "x86_64 Linux; --target does not apply\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+    }
+
+    /* --emit=bc: one translation unit to one bitcode file */
+    if (options.emit == EMIT_BC) {
+        if (options.backend != BACKEND_TEXT) {
+            fprintf(stderr, "Error: --emit=bc writes LLVM IR; it does not "
+                            "apply to --backend=%s\n",
+                    options.backend == BACKEND_LLVM_API ? "llvm-api"
+                                                        : "x86-64");
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (options.whole_program || options.input_count > 1 ||
+            options.jobs > 0) {
+            fprintf(stderr, "Error: --emit=bc compiles a single input\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+    }
+
+    /* --run: one translation unit, JIT-compiled for this process */
+    if (options.run) {
+        if (!llvm_backend_available()) {
+            fprintf(stderr, "Error: --run needs a build with LLVM\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (!options.input_file) {
+            fprintf(stderr, "Error: --run needs an input file\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (options.whole_program || options.jobs > 0 || options.output_file ||
+            options.target || options.emit != EMIT_LL ||
+            options.backend != BACKEND_TEXT) {
+            fprintf(stderr, "Error: --run compiles one input for this "
+                            "process and writes no output\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+    }
+
+    /* --interp: one translation unit, run on the bytecode VM */
+    if (options.interp) {
+        if (!options.input_file) {
+            fprintf(stderr, "Error: --interp needs an input file\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (options.run || options.whole_program || options.jobs > 0 ||
+            options.output_file || options.target ||
+            options.emit != EMIT_LL || options.backend != BACKEND_TEXT) {
+            fprintf(stderr, "Error: --interp runs one input on the bytecode "
+                            "VM and writes no output\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+    }
+
+    /* --whole-program: all inputs become one module */
+    if (options.whole_program) {
+        if (options.input_count == 0) {
+            fprintf(stderr, "Error: --whole-program needs input files\n");
+            exit_code = 1;
+            goto cleanup;
+        }
+        exit_code = compile_whole_program(
+                        options.input_files, options.input_count,
+                        options.output_file, options.exports,
+                        options.export_count, options.codegen_jobs,
+                        options.target, options.ssa, options.ir_flags,
+                        options.verbose) != 0
+                        ? 1
+                        : 0;
+        goto cleanup;
+    }
+
+    /* Several inputs: compile them on the batch driver; a single input
+     * keeps -o FILE even with -j */
+    if (options.input_count > 1) {
+        int failures =
+            compile_batch(options.input_files, options.input_count,
+                          options.output_file, options.jobs,
+                          options.codegen_jobs, options.target, options.ssa,
+                          options.ir_flags, options.verbose);
+        exit_code = failures > 0 ? 1 : 0;
+        goto cleanup;
+    }
+
     /* Setup input file */
     if (options.input_file) {
         if (options.verbose) {
@@ -151,13 +516,28 @@ int main(int argc, char* argv[]) {
     }
 
     /* Setup output file */
-    if (options.output_file) {
+    if (options.run || options.interp) {
+        output_file = NULL;
+    } else if (options.backend != BACKEND_TEXT) {
+        if (options.verbose) {
+            fprintf(stderr, "Writing object file to: %s\n",
+                    options.output_file);
+        }
+        output_file = NULL;
+    } else if (options.emit == EMIT_BC) {
+        if (options.verbose) {
+            fprintf(stderr, "Writing bitcode to: %s\n",
+                    options.output_file ? options.output_file : "stdout");
+        }
+        output_file = NULL;
+    } else if (options.output_file) {
         if (options.verbose) {
             fprintf(stderr, "Writing output to: %s\n", options.output_file);
         }
 
-        output_file = fopen(options.output_file, "w");
-        if (!output_file) {
+        output_file = options.mmap_output ? NULL
+                                          : fopen(options.output_file, "w");
+        if (!output_file && !options.mmap_output) {
             fprintf(stderr, "Error: Cannot open output file '%s'\n",
                     options.output_file);
             exit_code = 1;
@@ -175,12 +555,59 @@ int main(int argc, char* argv[]) {
         yydebug = 1;
     }
 
-    ctx = create_codegen_context(output_file);
+    if (options.backend == BACKEND_LLVM_API || options.run) {
+        /* Functions and globals go to the backend; the text is dropped */
+        ctx = create_buffered_codegen_context();
+        backend = llvm_backend_create(options.input_file);
+        if (ctx) {
+            llvm_backend_attach(backend, ctx);
+        }
+    } else if (options.interp) {
+        /* Functions and globals go to the VM, which sets the target */
+        ctx = create_buffered_codegen_context();
+        vm = bytecode_vm_create();
+        if (ctx) {
+            bytecode_vm_attach(vm, ctx);
+        }
+    } else if (options.backend == BACKEND_X86_64) {
+        /* Functions and globals go to the native backend, which sets the
+         * target */
+        ctx = create_buffered_codegen_context();
+        native = x86_backend_create();
+        if (ctx) {
+            x86_backend_attach(native, ctx);
+        }
+    } else if (options.emit == EMIT_BC) {
+        /* Functions and globals go to the bitcode writer, attached once
+         * the target is set */
+        ctx = create_buffered_codegen_context();
+        bitcode = bitcode_writer_create();
+    } else if (output_file) {
+        ctx = create_codegen_context(output_file);
+    } else {
+        ctx = create_buffered_codegen_context();
+        if (ctx && ir_buffer_map_file(&ctx->out, options.output_file) != 0) {
+            fprintf(stderr, "Error: Cannot map output file '%s'\n",
+                    options.output_file);
+            exit_code = 1;
+            goto cleanup;
+        }
+    }
     if (!ctx) {
         fprintf(stderr, "Error: Failed to create code generation context\n");
         exit_code = 1;
         goto cleanup;
     }
+    ctx->codegen_jobs = options.codegen_jobs;
+    ctx->stream_constants = options.stream_constants;
+    ctx->ir_flags = options.ir_flags;
+    ctx->ssa = options.ssa;
+    if (options.target && !native) {
+        ctx->target = target_lookup(options.target);
+    }
+    if (bitcode) {
+        bitcode_writer_attach(bitcode, ctx);
+    }
 
     if (options.verbose) {
         fprintf(stderr, "Parsing input...\n");
@@ -215,10 +642,97 @@ int main(int argc, char* argv[]) {
         fprintf(stderr, "Generating LLVM IR...\n");
     }
 
-    generate_llvm_ir(ctx, program_ast);
+    {
+        auto codegen_start = std::chrono::steady_clock::now();
+        generate_llvm_ir(ctx, program_ast);
+        codegen_ms = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - codegen_start)
+                         .count();
+    }
+
+    if (options.verbose) {
+        fprintf(stderr, "LLVM IR generation completed (%.3f ms)\n",
+                codegen_ms);
+    }
+
+    if (options.run) {
+        LLVMBackendMain entry =
+            ctx->error_count > 0
+                ? NULL
+                : llvm_backend_jit_main(backend, options.opt_level);
+        if (!entry) {
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (options.verbose) {
+            fprintf(stderr, "JIT compiled at -O%d; main starts %.3f ms after "
+                            "compilation began\n",
+                    options.opt_level,
+                    std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - compile_start)
+                        .count());
+        }
+        exit_code = entry(options.run_arg_count, options.run_args);
+        fflush(stdout);
+    } else if (backend) {
+        auto emit_start = std::chrono::steady_clock::now();
+        if (ctx->error_count > 0 ||
+            llvm_backend_write_object(backend, options.opt_level,
+                                      options.output_file) != 0) {
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (options.verbose) {
+            fprintf(stderr, "Object file written at -O%d (%.3f ms)\n",
+                    options.opt_level,
+                    std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - emit_start)
+                        .count());
+        }
+    }
+
+    if (vm) {
+        int status = 0;
+        if (ctx->error_count > 0) {
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (options.verbose) {
+            fprintf(stderr, "Bytecode ready; main starts %.3f ms after "
+                            "compilation began\n",
+                    std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - compile_start)
+                        .count());
+        }
+        exit_code = bytecode_vm_run(vm, options.run_arg_count,
+                                    options.run_args, &status) == 0
+                        ? status
+                        : 1;
+        fflush(stdout);
+    }
+
+    if (native) {
+        auto emit_start = std::chrono::steady_clock::now();
+        if (ctx->error_count > 0 ||
+            x86_backend_write_object(native, options.output_file) != 0) {
+            exit_code = 1;
+            goto cleanup;
+        }
+        if (options.verbose) {
+            fprintf(stderr, "Object file written (%.3f ms)\n",
+                    std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - emit_start)
+                        .count());
+        }
+    }
+
+    if (bitcode && (ctx->error_count > 0 ||
+                    bitcode_writer_write(bitcode, options.output_file) != 0)) {
+        exit_code = 1;
+        goto cleanup;
+    }
 
     if (options.verbose) {
-        fprintf(stderr, "LLVM IR generation completed\n");
         fprintf(stderr, "Starting cleanup...\n");
     }
 
@@ -230,6 +744,10 @@ cleanup:
         free_codegen_context(ctx);
         ctx = NULL;
     }
+    llvm_backend_free(backend);
+    x86_backend_free(native);
+    bytecode_vm_free(vm);
+    bitcode_writer_free(bitcode);
 
     if (options.verbose) {
         fprintf(stderr, "Freeing AST...\n");
@@ -239,6 +757,9 @@ cleanup:
     if (output_file && output_file != stdout) {
         fclose(output_file);
     }
+    free(options.exports);
+    options.exports = NULL;
+    options.export_count = 0;
 
     return exit_code;
 }
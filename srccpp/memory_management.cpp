@@ -2,12 +2,192 @@
 
 #include "error_handling.h"
 
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
+/* Counter shards; threads beyond this share shards through atomics */
+#define MEMORY_STAT_SHARDS 64
+/* Unpublished usage a shard may hold before updating the global peak */
+#define MEMORY_PEAK_PUBLISH_BYTES (64 * 1024)
+/* Independently locked live-block tables */
+#define LIVE_BLOCK_STRIPES 16
+#define LIVE_BLOCK_INITIAL_CAPACITY 64
+
+/* Marks a removed slot so probe chains stay intact */
+#define LIVE_BLOCK_TOMBSTONE ((void*)1)
+
+/* Per-thread counters, padded so shards never share a cache line */
+typedef struct alignas(64) MemoryStatShard {
+    std::atomic<size_t> allocations;
+    std::atomic<size_t> deallocations;
+    std::atomic<size_t> bytes_allocated;
+    std::atomic<size_t> bytes_freed;
+    std::atomic<long long> pending_usage; /* Not yet added to peak_usage */
+    std::atomic<size_t> sample_tick;
+} MemoryStatShard;
+
+typedef struct MemoryCounters {
+    MemoryStatShard shards[MEMORY_STAT_SHARDS];
+    /* Usage published by the shards, used only to maintain the peak */
+    alignas(64) std::atomic<long long> published_usage;
+    std::atomic<size_t> published_peak;
+} MemoryCounters;
+
+/* One stripe of the live-block map: open addressing, linear probing */
+typedef struct LiveBlockTable {
+    std::mutex mutex;
+    MemoryBlock* slots;
+    size_t capacity; /* Power of two, or 0 before first use */
+    size_t count;
+    size_t tombstones;
+} LiveBlockTable;
+
 /* Global memory context */
 MemoryContext* g_memory_context = NULL;
 
+static std::mutex context_mutex;
+
+static size_t hash_address(const void* address) {
+    uint64_t key = (uint64_t)(uintptr_t)address >> 4;
+    key *= 0x9E3779B97F4A7C15ULL;
+    return (size_t)(key ^ (key >> 32));
+}
+
+static MemoryStatShard* current_shard(const MemoryContext* ctx) {
+    static std::atomic<unsigned> next_slot(0);
+    thread_local unsigned slot = next_slot.fetch_add(1) % MEMORY_STAT_SHARDS;
+    return &ctx->counters->shards[slot];
+}
+
+/* Add size (negative when freeing) to the shard's unpublished usage, and
+ * fold it into the context-wide peak once it passes the threshold */
+static void account_usage(MemoryContext* ctx, MemoryStatShard* shard,
+                          long long size) {
+    long long pending = shard->pending_usage.fetch_add(size) + size;
+    if (pending < MEMORY_PEAK_PUBLISH_BYTES &&
+        pending > -MEMORY_PEAK_PUBLISH_BYTES) {
+        return;
+    }
+
+    MemoryCounters* counters = ctx->counters;
+    long long delta = shard->pending_usage.exchange(0);
+    long long usage = counters->published_usage.fetch_add(delta) + delta;
+    if (usage <= 0) {
+        return;
+    }
+    size_t peak = counters->published_peak.load(std::memory_order_relaxed);
+    while ((size_t)usage > peak &&
+           !counters->published_peak.compare_exchange_weak(peak,
+                                                           (size_t)usage)) {
+    }
+}
+
+/* Find the slot holding address, or the slot to insert it into */
+static MemoryBlock* find_slot(LiveBlockTable* table, const void* address) {
+    size_t mask = table->capacity - 1;
+    size_t index = hash_address(address) & mask;
+    MemoryBlock* reusable = NULL;
+    for (;;) {
+        MemoryBlock* slot = &table->slots[index];
+        if (slot->address == address) {
+            return slot;
+        }
+        if (!slot->address) {
+            return reusable ? reusable : slot;
+        }
+        if (slot->address == LIVE_BLOCK_TOMBSTONE && !reusable) {
+            reusable = slot;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+/* Rehash into a table sized for the live blocks, dropping tombstones */
+static int resize_table(LiveBlockTable* table) {
+    size_t capacity = table->capacity ? table->capacity
+                                      : LIVE_BLOCK_INITIAL_CAPACITY;
+    while ((table->count + 1) * 2 > capacity) {
+        capacity *= 2;
+    }
+
+    auto slots =
+        static_cast<MemoryBlock*>(calloc(capacity, sizeof(MemoryBlock)));
+    if (!slots) {
+        return 0;
+    }
+
+    MemoryBlock* old_slots = table->slots;
+    size_t old_capacity = table->capacity;
+    table->slots = slots;
+    table->capacity = capacity;
+    table->tombstones = 0;
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_slots[i].address &&
+            old_slots[i].address != LIVE_BLOCK_TOMBSTONE) {
+            *find_slot(table, old_slots[i].address) = old_slots[i];
+        }
+    }
+    free(old_slots);
+    return 1;
+}
+
+static LiveBlockTable* table_for(const MemoryContext* ctx,
+                                 const void* address) {
+    /* High hash bits pick the stripe, low bits the slot within it */
+    size_t hash = hash_address(address);
+    return &ctx->live_blocks[(hash >> 28) % LIVE_BLOCK_STRIPES];
+}
+
+static void track_block(MemoryContext* ctx, void* ptr, size_t size,
+                        const char* file, int line, const char* function) {
+    LiveBlockTable* table = table_for(ctx, ptr);
+    std::lock_guard<std::mutex> lock(table->mutex);
+
+    /* Keep at least a quarter of the slots empty so probes stay short */
+    if ((table->count + table->tombstones + 1) * 4 > table->capacity * 3 &&
+        !resize_table(table)) {
+        return;
+    }
+
+    MemoryBlock* slot = find_slot(table, ptr);
+    if (slot->address == LIVE_BLOCK_TOMBSTONE) {
+        table->tombstones--;
+    }
+    if (slot->address != ptr) {
+        table->count++;
+    }
+    slot->address = ptr;
+    slot->size = size;
+    slot->file = file;
+    slot->line = line;
+    slot->function = function;
+}
+
+/* Remove ptr from tracking; returns its size, or 0 when it is not tracked */
+static size_t untrack_block(MemoryContext* ctx, const void* ptr) {
+    LiveBlockTable* table = table_for(ctx, ptr);
+    std::lock_guard<std::mutex> lock(table->mutex);
+
+    if (table->count == 0) {
+        return 0;
+    }
+    MemoryBlock* slot = find_slot(table, ptr);
+    if (slot->address != ptr) {
+        return 0;
+    }
+
+    size_t size = slot->size;
+    slot->address = LIVE_BLOCK_TOMBSTONE;
+    table->count--;
+    table->tombstones++;
+    return size;
+}
+
 /* Create memory management context */
 MemoryContext* create_memory_context(void) {
     auto ctx = static_cast<MemoryContext*>(malloc(sizeof(MemoryContext)));
@@ -16,16 +196,16 @@ MemoryContext* create_memory_context(void) {
         exit(ERROR_MEMORY_ALLOCATION);
     }
 
-    /* Initialize statistics */
-    ctx->stats.allocations = 0;
-    ctx->stats.deallocations = 0;
-    ctx->stats.bytes_allocated = 0;
-    ctx->stats.bytes_freed = 0;
-    ctx->stats.peak_usage = 0;
-    ctx->stats.current_usage = 0;
+    /* Statistics start at zero in every shard */
+    ctx->counters = new (std::nothrow) MemoryCounters();
+    ctx->live_blocks = new (std::nothrow) LiveBlockTable[LIVE_BLOCK_STRIPES]();
+    if (!ctx->counters || !ctx->live_blocks) {
+        fprintf(stderr, "Fatal: Cannot allocate memory context\n");
+        exit(ERROR_MEMORY_ALLOCATION);
+    }
 
-    ctx->allocated_blocks = NULL;
     ctx->debug_mode = 0;
+    ctx->sample_rate = 1;
 
     return ctx;
 }
@@ -35,17 +215,24 @@ void free_memory_context(MemoryContext* ctx) {
     if (!ctx)
         return;
 
-    /* Free any remaining blocks */
-    MemoryBlock* block = ctx->allocated_blocks;
-    while (block) {
-        MemoryBlock* next = block->next;
-        fprintf(stderr,
-                "Memory leak detected: %zu bytes allocated at %s:%d in %s()\n",
-                block->size, block->file, block->line, block->function);
-        free(block);
-        block = next;
+    /* Report any remaining blocks */
+    for (int stripe = 0; stripe < LIVE_BLOCK_STRIPES; stripe++) {
+        LiveBlockTable* table = &ctx->live_blocks[stripe];
+        for (size_t i = 0; i < table->capacity; i++) {
+            const MemoryBlock* block = &table->slots[i];
+            if (block->address && block->address != LIVE_BLOCK_TOMBSTONE) {
+                fprintf(stderr,
+                        "Memory leak detected: %zu bytes allocated at %s:%d "
+                        "in %s()\n",
+                        block->size, block->file, block->line,
+                        block->function);
+            }
+        }
+        free(table->slots);
     }
 
+    delete[] ctx->live_blocks;
+    delete ctx->counters;
     free(ctx);
 }
 
@@ -61,12 +248,31 @@ void disable_memory_debugging(MemoryContext* ctx) {
         ctx->debug_mode = 0;
 }
 
+/* Track only every Nth allocation in debug mode (1 tracks all) */
+void set_memory_sample_rate(MemoryContext* ctx, int sample_rate) {
+    if (ctx)
+        ctx->sample_rate = sample_rate > 1 ? sample_rate : 1;
+}
+
+/* Return the global context, creating it once even under concurrent use */
+static MemoryContext* acquire_memory_context(void) {
+    MemoryContext* ctx = __atomic_load_n(&g_memory_context, __ATOMIC_ACQUIRE);
+    if (ctx) {
+        return ctx;
+    }
+
+    std::lock_guard<std::mutex> lock(context_mutex);
+    if (!g_memory_context) {
+        __atomic_store_n(&g_memory_context, create_memory_context(),
+                         __ATOMIC_RELEASE);
+    }
+    return g_memory_context;
+}
+
 /* Safe malloc with debugging */
 void* safe_malloc_debug(size_t size, const char* file, int line,
                         const char* function) {
-    if (!g_memory_context) {
-        init_memory_management();
-    }
+    MemoryContext* ctx = acquire_memory_context();
 
     void* ptr = malloc(size);
     if (!ptr) {
@@ -78,33 +284,17 @@ void* safe_malloc_debug(size_t size, const char* file, int line,
     }
 
     /* Update statistics */
-    g_memory_context->stats.allocations++;
-    g_memory_context->stats.bytes_allocated += size;
-    g_memory_context->stats.current_usage += size;
-
-    if (g_memory_context->stats.current_usage >
-        g_memory_context->stats.peak_usage) {
-        g_memory_context->stats.peak_usage =
-            g_memory_context->stats.current_usage;
-    }
+    MemoryStatShard* shard = current_shard(ctx);
+    shard->allocations.fetch_add(1, std::memory_order_relaxed);
+    shard->bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+    account_usage(ctx, shard, (long long)size);
 
     /* Track allocation in debug mode */
-    if (g_memory_context->debug_mode) {
-        auto block = static_cast<MemoryBlock*>(malloc(sizeof(MemoryBlock)));
-        if (block) {
-            block->address = ptr;
-            block->size = size;
-            block->file = file;
-            block->line = line;
-            block->function = function;
-            block->next = g_memory_context->allocated_blocks;
-            block->prev = NULL;
-
-            if (g_memory_context->allocated_blocks) {
-                g_memory_context->allocated_blocks->prev = block;
-            }
-            g_memory_context->allocated_blocks = block;
-        }
+    if (ctx->debug_mode &&
+        shard->sample_tick.fetch_add(1, std::memory_order_relaxed) %
+                ctx->sample_rate ==
+            0) {
+        track_block(ctx, ptr, size, file, line, function);
     }
 
     return ptr;
@@ -142,7 +332,8 @@ void safe_free_debug(void* ptr, const char* file, int line,
     if (!ptr)
         return;
 
-    if (!g_memory_context) {
+    MemoryContext* ctx = __atomic_load_n(&g_memory_context, __ATOMIC_ACQUIRE);
+    if (!ctx) {
         fprintf(stderr,
                 "Warning: Freeing memory without memory context at %s:%d in "
                 "%s()\n",
@@ -151,58 +342,81 @@ void safe_free_debug(void* ptr, const char* file, int line,
         return;
     }
 
+    /* Find and remove block from tracking in debug mode; a sampled block
+     * stands for sample_rate blocks of the same size */
     size_t freed_size = 0;
-
-    /* Find and remove block from tracking in debug mode */
-    if (g_memory_context->debug_mode) {
-        MemoryBlock* block = g_memory_context->allocated_blocks;
-        while (block) {
-            if (block->address == ptr) {
-                freed_size = block->size;
-
-                if (block->prev) {
-                    block->prev->next = block->next;
-                } else {
-                    g_memory_context->allocated_blocks = block->next;
-                }
-                if (block->next) {
-                    block->next->prev = block->prev;
-                }
-
-                free(block);
-                break;
-            }
-            block = block->next;
-        }
+    if (ctx->debug_mode) {
+        freed_size = untrack_block(ctx, ptr) * ctx->sample_rate;
     }
 
+    MemoryStatShard* shard = current_shard(ctx);
     if (freed_size > 0) {
-        g_memory_context->stats.bytes_freed += freed_size;
-        if (g_memory_context->stats.current_usage >= freed_size) {
-            g_memory_context->stats.current_usage -= freed_size;
-        } else {
-            g_memory_context->stats.current_usage = 0;
-        }
+        shard->bytes_freed.fetch_add(freed_size, std::memory_order_relaxed);
+        account_usage(ctx, shard, -(long long)freed_size);
     }
 
-    g_memory_context->stats.deallocations++;
+    shard->deallocations.fetch_add(1, std::memory_order_relaxed);
     free(ptr);
 }
 
+/* Sum the shards; the peak is exact to within the publish threshold of
+ * each shard */
+MemoryStats get_memory_stats(const MemoryContext* ctx) {
+    MemoryStats stats;
+    memset(&stats, 0, sizeof(stats));
+    if (!ctx)
+        return stats;
+
+    for (int i = 0; i < MEMORY_STAT_SHARDS; i++) {
+        const MemoryStatShard* shard = &ctx->counters->shards[i];
+        stats.allocations += shard->allocations.load();
+        stats.deallocations += shard->deallocations.load();
+        stats.bytes_allocated += shard->bytes_allocated.load();
+        stats.bytes_freed += shard->bytes_freed.load();
+    }
+
+    stats.current_usage = stats.bytes_allocated > stats.bytes_freed
+                              ? stats.bytes_allocated - stats.bytes_freed
+                              : 0;
+    stats.peak_usage = ctx->counters->published_peak.load();
+    if (stats.current_usage > stats.peak_usage) {
+        stats.peak_usage = stats.current_usage;
+    }
+    return stats;
+}
+
+/* Count the blocks currently tracked in debug mode */
+size_t count_live_blocks(const MemoryContext* ctx) {
+    if (!ctx)
+        return 0;
+
+    size_t count = 0;
+    for (int stripe = 0; stripe < LIVE_BLOCK_STRIPES; stripe++) {
+        LiveBlockTable* table = &ctx->live_blocks[stripe];
+        std::lock_guard<std::mutex> lock(table->mutex);
+        count += table->count;
+    }
+    return count;
+}
+
 /* Print memory statistics */
 void print_memory_stats(const MemoryContext* ctx) {
     if (!ctx)
         return;
 
+    MemoryStats stats = get_memory_stats(ctx);
     printf("Memory Statistics:\n");
-    printf("  Allocations: %zu\n", ctx->stats.allocations);
-    printf("  Deallocations: %zu\n", ctx->stats.deallocations);
-    printf("  Bytes allocated: %zu\n", ctx->stats.bytes_allocated);
-    printf("  Bytes freed: %zu\n", ctx->stats.bytes_freed);
-    printf("  Peak usage: %zu bytes\n", ctx->stats.peak_usage);
-    printf("  Current usage: %zu bytes\n", ctx->stats.current_usage);
+    printf("  Allocations: %zu\n", stats.allocations);
+    printf("  Deallocations: %zu\n", stats.deallocations);
+    printf("  Bytes allocated: %zu\n", stats.bytes_allocated);
+    printf("  Bytes freed: %zu\n", stats.bytes_freed);
+    printf("  Peak usage: %zu bytes\n", stats.peak_usage);
+    printf("  Current usage: %zu bytes\n", stats.current_usage);
     printf("  Balance: %ld allocations\n",
-           (long)(ctx->stats.allocations - ctx->stats.deallocations));
+           (long)(stats.allocations - stats.deallocations));
+    if (ctx->debug_mode && ctx->sample_rate > 1) {
+        printf("  Tracking: 1 in %d allocations\n", ctx->sample_rate);
+    }
 }
 
 /* Print memory leaks */
@@ -210,18 +424,26 @@ void print_memory_leaks(const MemoryContext* ctx) {
     if (!ctx)
         return;
 
-    if (ctx->stats.allocations != ctx->stats.deallocations) {
+    MemoryStats stats = get_memory_stats(ctx);
+    if (stats.allocations != stats.deallocations) {
         printf("Memory leaks detected: %ld unfreed allocations\n",
-               (long)(ctx->stats.allocations - ctx->stats.deallocations));
+               (long)(stats.allocations - stats.deallocations));
     }
 
-    if (ctx->debug_mode && ctx->allocated_blocks) {
+    if (ctx->debug_mode && count_live_blocks(ctx) > 0) {
         printf("Detailed leak information:\n");
-        const MemoryBlock* block = ctx->allocated_blocks;
-        while (block) {
-            printf("  Leak: %zu bytes at %s:%d in %s()\n", block->size,
-                   block->file, block->line, block->function);
-            block = block->next;
+        for (int stripe = 0; stripe < LIVE_BLOCK_STRIPES; stripe++) {
+            LiveBlockTable* table = &ctx->live_blocks[stripe];
+            std::lock_guard<std::mutex> lock(table->mutex);
+            for (size_t i = 0; i < table->capacity; i++) {
+                const MemoryBlock* block = &table->slots[i];
+                if (block->address &&
+                    block->address != LIVE_BLOCK_TOMBSTONE) {
+                    printf("  Leak: %zu bytes at %s:%d in %s()\n",
+                           block->size, block->file, block->line,
+                           block->function);
+                }
+            }
         }
     }
 }
@@ -230,5 +452,6 @@ void print_memory_leaks(const MemoryContext* ctx) {
 int check_memory_leaks(const MemoryContext* ctx) {
     if (!ctx)
         return 0;
-    return (ctx->stats.allocations != ctx->stats.deallocations) ? 1 : 0;
-}
\ No newline at end of file
+    MemoryStats stats = get_memory_stats(ctx);
+    return (stats.allocations != stats.deallocations) ? 1 : 0;
+}
@@ -15,22 +15,29 @@ typedef struct MemoryStats {
     size_t current_usage;
 } MemoryStats;
 
-/* Memory block header for tracking */
+/* Live allocation recorded in debug mode */
 typedef struct MemoryBlock {
     void* address;
     size_t size;
     const char* file;
     int line;
     const char* function;
-    struct MemoryBlock* next;
-    struct MemoryBlock* prev;
 } MemoryBlock;
 
-/* Memory management context */
+/*
+ * Memory management context
+ *
+ * Counters are kept in per-thread shards and summed by get_memory_stats, so
+ * allocating threads never contend on shared counters. In debug mode live
+ * blocks are tracked in lock-striped open-addressing hash tables keyed by
+ * address. With a sample rate N > 1 only every Nth allocation of a thread is
+ * tracked, and the bytes freed through tracked blocks are scaled by N.
+ */
 typedef struct MemoryContext {
-    MemoryStats stats;
-    MemoryBlock* allocated_blocks;
+    struct MemoryCounters* counters;
+    struct LiveBlockTable* live_blocks;
     int debug_mode;
+    int sample_rate;
 } MemoryContext;
 
 /* Global memory context */
@@ -41,6 +48,11 @@ MemoryContext* create_memory_context(void);
 void free_memory_context(MemoryContext* ctx);
 void enable_memory_debugging(MemoryContext* ctx);
 void disable_memory_debugging(MemoryContext* ctx);
+void set_memory_sample_rate(MemoryContext* ctx, int sample_rate);
+
+/* Sum the per-thread counters into a snapshot */
+MemoryStats get_memory_stats(const MemoryContext* ctx);
+size_t count_live_blocks(const MemoryContext* ctx);
 
 /* Safe allocation functions */
 void* safe_malloc_debug(size_t size, const char* file, int line,
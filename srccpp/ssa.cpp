@@ -0,0 +1,628 @@
+#include "ssa.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/* A block of the function being promoted; indices are layout positions
+ * among the reachable blocks */
+typedef struct SSABlock {
+    IRBlock* block;
+    std::vector<IRInstruction*> code;
+    std::vector<int> successors;   /* Without duplicates */
+    std::vector<int> predecessors; /* Without duplicates */
+    int order;                     /* Reverse postorder position */
+    int idom;                      /* Immediate dominator; itself for entry */
+    std::vector<int> children;     /* In the dominator tree */
+    std::vector<int> frontier;
+    std::vector<std::pair<int, IRInstruction*>> phis; /* Slot, phi */
+} SSABlock;
+
+/* A stack slot: an alloca'd local */
+typedef struct SSASlot {
+    const char* name;
+    TypeInfo* type;
+    int promotable;
+    std::vector<int> store_blocks;
+    std::vector<IRValue> values; /* Reaching definitions while renaming */
+} SSASlot;
+
+typedef struct SSAState {
+    IRBuilder* builder;
+    IRFunction* function;
+    std::vector<SSABlock> blocks;
+    std::unordered_map<int, int> block_index; /* Block id to index */
+    std::vector<SSASlot> slots;
+    std::unordered_map<std::string, int> slot_index;
+    std::unordered_map<int, IRValue> replacements; /* Register id to value */
+    int next_register;
+} SSAState;
+
+static int is_terminator(const IRInstruction* instruction) {
+    return instruction->opcode == IR_BR || instruction->opcode == IR_COND_BR ||
+           instruction->opcode == IR_SWITCH || instruction->opcode == IR_RET;
+}
+
+/* Number of blocks a block ending in last branches to */
+static int successor_count(const IRInstruction* last) {
+    if (!last)
+        return 0;
+    switch (last->opcode) {
+    case IR_BR:
+        return 1;
+    case IR_COND_BR:
+        return 2;
+    case IR_SWITCH:
+        return last->operand_count;
+    default:
+        return 0;
+    }
+}
+
+static int is_integer_slot(const TypeInfo* type) {
+    switch (type ? type->base_type : TYPE_VOID) {
+    case TYPE_BOOL:
+    case TYPE_CHAR:
+    case TYPE_SHORT:
+    case TYPE_INT:
+    case TYPE_LONG:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int same_value(const IRValue* a, const IRValue* b) {
+    if (a->kind != b->kind || a->id != b->id || a->type != b->type)
+        return 0;
+    if (a->name == b->name)
+        return 1;
+    return a->name && b->name && strcmp(a->name, b->name) == 0;
+}
+
+/* The value a promoted load or trivial phi stands for */
+static IRValue resolve(const SSAState* state, IRValue value) {
+    while (value.kind == IR_VALUE_REGISTER) {
+        auto found = state->replacements.find(value.id);
+        if (found == state->replacements.end())
+            break;
+        value = found->second;
+    }
+    return value;
+}
+
+/* Control-flow graph */
+
+/* Cut each block at its first terminator and end blocks that run off
+ * their end the way the consumers would */
+static void terminate_blocks(SSAState* state) {
+    IRBuilder* builder = state->builder;
+    IRFunction* function = state->function;
+    TypeInfo* return_type = function->return_type;
+    IRBlock* saved = builder->block;
+
+    for (IRBlock* block = function->first_block; block; block = block->next) {
+        for (IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            if (is_terminator(instruction)) {
+                instruction->next = NULL;
+                block->last = instruction;
+                break;
+            }
+        }
+        if (block->last && is_terminator(block->last))
+            continue;
+
+        builder->block = block;
+        if (block->next) {
+            ir_build_br(builder, block->next->id);
+        } else if (!return_type || return_type->base_type == TYPE_VOID) {
+            ir_build_ret(builder, NULL, ir_no_value());
+        } else if (is_integer_slot(return_type)) {
+            ir_build_ret(builder, return_type, ir_constant(0, return_type));
+        }
+    }
+    builder->block = saved;
+}
+
+static void add_unique(std::vector<int>& list, int value) {
+    for (int existing : list) {
+        if (existing == value)
+            return;
+    }
+    list.push_back(value);
+}
+
+/* Keep the blocks reachable from the entry, in layout order, with their
+ * edges; returns the blocks in reverse postorder */
+static std::vector<int> build_graph(SSAState* state) {
+    IRFunction* function = state->function;
+    std::unordered_map<int, IRBlock*> by_id;
+    for (IRBlock* block = function->first_block; block; block = block->next)
+        by_id.emplace(block->id, block);
+
+    /* Depth-first search from the entry for reachability and postorder */
+    std::unordered_map<int, int> visited; /* Block id to postorder number */
+    std::vector<IRBlock*> postorder;
+    std::vector<std::pair<IRBlock*, int>> stack;
+    stack.emplace_back(function->first_block, 0);
+    visited.emplace(function->first_block->id, -1);
+    while (!stack.empty()) {
+        IRBlock* block = stack.back().first;
+        int next = stack.back().second++;
+        const IRInstruction* last = block->last;
+        if (next < successor_count(last)) {
+            auto target = by_id.find(last->blocks[next]);
+            if (target != by_id.end() &&
+                visited.emplace(target->first, -1).second) {
+                stack.emplace_back(target->second, 0);
+            }
+            continue;
+        }
+        visited[block->id] = (int)postorder.size();
+        postorder.push_back(block);
+        stack.pop_back();
+    }
+
+    /* Unreachable blocks go; the consumers never run them */
+    IRBlock** link = &function->first_block;
+    function->last_block = NULL;
+    for (IRBlock* block = function->first_block; block; block = block->next) {
+        if (!visited.count(block->id))
+            continue;
+        *link = block;
+        link = &block->next;
+        function->last_block = block;
+
+        SSABlock entry;
+        entry.block = block;
+        entry.order = 0;
+        entry.idom = -1;
+        for (IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            entry.code.push_back(instruction);
+        }
+        state->block_index.emplace(block->id, (int)state->blocks.size());
+        state->blocks.push_back(std::move(entry));
+    }
+    *link = NULL;
+
+    for (size_t i = 0; i < state->blocks.size(); i++) {
+        const IRInstruction* last = state->blocks[i].block->last;
+        int count = successor_count(last);
+        for (int j = 0; j < count; j++) {
+            auto target = state->block_index.find(last->blocks[j]);
+            if (target == state->block_index.end())
+                continue;
+            add_unique(state->blocks[i].successors, target->second);
+            add_unique(state->blocks[target->second].predecessors, (int)i);
+        }
+    }
+
+    /* Phi entries for edges from dropped blocks go with them */
+    for (SSABlock& block : state->blocks) {
+        for (IRInstruction* instruction : block.code) {
+            if (instruction->opcode != IR_PHI)
+                continue;
+            int kept = 0;
+            for (int i = 0; i < instruction->operand_count; i++) {
+                if (!state->block_index.count(instruction->blocks[i]))
+                    continue;
+                instruction->operands[kept] = instruction->operands[i];
+                instruction->blocks[kept] = instruction->blocks[i];
+                kept++;
+            }
+            instruction->operand_count = kept;
+        }
+    }
+
+    std::vector<int> order;
+    for (size_t i = postorder.size(); i-- > 0;) {
+        int index = state->block_index[postorder[i]->id];
+        state->blocks[index].order = (int)order.size();
+        order.push_back(index);
+    }
+    return order;
+}
+
+/* Immediate dominators (Cooper, Harvey and Kennedy), the dominator tree
+ * and dominance frontiers */
+static void compute_dominance(SSAState* state, const std::vector<int>& order) {
+    std::vector<SSABlock>& blocks = state->blocks;
+    int entry = order[0];
+    blocks[entry].idom = entry;
+
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (size_t i = 1; i < order.size(); i++) {
+            SSABlock& block = blocks[order[i]];
+            int idom = -1;
+            for (int predecessor : block.predecessors) {
+                if (blocks[predecessor].idom < 0)
+                    continue;
+                if (idom < 0) {
+                    idom = predecessor;
+                    continue;
+                }
+                int a = predecessor;
+                int b = idom;
+                while (a != b) {
+                    while (blocks[a].order > blocks[b].order)
+                        a = blocks[a].idom;
+                    while (blocks[b].order > blocks[a].order)
+                        b = blocks[b].idom;
+                }
+                idom = a;
+            }
+            if (block.idom != idom) {
+                block.idom = idom;
+                changed = 1;
+            }
+        }
+    }
+
+    for (int index : order) {
+        SSABlock& block = blocks[index];
+        if (index != entry)
+            blocks[block.idom].children.push_back(index);
+        if (block.predecessors.size() < 2)
+            continue;
+        for (int runner : block.predecessors) {
+            while (runner != block.idom) {
+                add_unique(blocks[runner].frontier, index);
+                runner = blocks[runner].idom;
+            }
+        }
+    }
+}
+
+/* Promotion */
+
+/* Find the slots whose address is only loaded from and stored to */
+static void find_slots(SSAState* state) {
+    IRFunction* function = state->function;
+    for (SSABlock& block : state->blocks) {
+        for (IRInstruction* instruction : block.code) {
+            if (instruction->opcode != IR_ALLOCA ||
+                instruction->result.kind != IR_VALUE_LOCAL)
+                continue;
+            auto inserted = state->slot_index.emplace(
+                instruction->result.name, (int)state->slots.size());
+            if (!inserted.second) {
+                /* Two slots with one name: leave both alone */
+                state->slots[inserted.first->second].promotable = 0;
+                continue;
+            }
+            SSASlot slot;
+            slot.name = instruction->result.name;
+            slot.type = instruction->type;
+            slot.promotable = is_integer_slot(instruction->type);
+            state->slots.push_back(slot);
+        }
+    }
+    for (int i = 0; i < function->parameter_count; i++) {
+        const char* name = function->parameters[i].name;
+        auto found = name ? state->slot_index.find(name)
+                          : state->slot_index.end();
+        if (found != state->slot_index.end())
+            state->slots[found->second].promotable = 0;
+    }
+
+    for (size_t b = 0; b < state->blocks.size(); b++) {
+        for (IRInstruction* instruction : state->blocks[b].code) {
+            for (int i = 0; i < instruction->operand_count; i++) {
+                const IRValue* operand = &instruction->operands[i];
+                if (operand->kind != IR_VALUE_LOCAL)
+                    continue;
+                auto found = state->slot_index.find(operand->name);
+                if (found == state->slot_index.end())
+                    continue;
+                SSASlot& slot = state->slots[found->second];
+                int is_load = instruction->opcode == IR_LOAD && i == 0;
+                int is_store = instruction->opcode == IR_STORE && i == 1;
+                if ((!is_load && !is_store) || instruction->type != slot.type) {
+                    slot.promotable = 0;
+                } else if (is_store) {
+                    add_unique(slot.store_blocks, (int)b);
+                }
+            }
+        }
+    }
+}
+
+/* Promotable slot an address operand names, or -1 */
+static int promoted_slot(const SSAState* state, const IRValue* address) {
+    if (address->kind != IR_VALUE_LOCAL)
+        return -1;
+    auto found = state->slot_index.find(address->name);
+    if (found == state->slot_index.end() ||
+        !state->slots[found->second].promotable)
+        return -1;
+    return found->second;
+}
+
+/* Phis on the iterated dominance frontier of each slot's stores */
+static void insert_phis(SSAState* state) {
+    IRArena* arena = &state->builder->arena;
+    for (size_t s = 0; s < state->slots.size(); s++) {
+        SSASlot& slot = state->slots[s];
+        if (!slot.promotable)
+            continue;
+        std::vector<char> has_phi(state->blocks.size(), 0);
+        std::vector<int> work = slot.store_blocks;
+        while (!work.empty()) {
+            int index = work.back();
+            work.pop_back();
+            for (int target : state->blocks[index].frontier) {
+                if (has_phi[target])
+                    continue;
+                has_phi[target] = 1;
+                SSABlock& block = state->blocks[target];
+                int count = (int)block.predecessors.size();
+                auto phi = static_cast<IRInstruction*>(
+                    ir_arena_alloc(arena, sizeof(IRInstruction)));
+                memset(phi, 0, sizeof(IRInstruction));
+                phi->opcode = IR_PHI;
+                phi->result = ir_register(state->next_register++, slot.type);
+                phi->type = slot.type;
+                phi->operand_count = count;
+                phi->operands = static_cast<IRValue*>(
+                    ir_arena_alloc(arena, (size_t)count * sizeof(IRValue)));
+                phi->blocks = static_cast<int*>(
+                    ir_arena_alloc(arena, (size_t)count * sizeof(int)));
+                for (int i = 0; i < count; i++) {
+                    phi->operands[i] = ir_constant(0, slot.type);
+                    phi->blocks[i] =
+                        state->blocks[block.predecessors[i]].block->id;
+                }
+                block.phis.emplace_back((int)s, phi);
+                if (std::find(slot.store_blocks.begin(), slot.store_blocks.end(),
+                              target) == slot.store_blocks.end()) {
+                    work.push_back(target);
+                }
+            }
+        }
+    }
+}
+
+static IRValue current_value(const SSASlot* slot) {
+    return slot->values.empty() ? ir_constant(0, slot->type)
+                                : slot->values.back();
+}
+
+/* Walk the dominator tree replacing loads by the reaching stores */
+static void rename_slots(SSAState* state, int entry) {
+    std::vector<std::vector<int>> pushed(state->blocks.size());
+    std::vector<std::pair<int, int>> stack; /* Block, 1 when leaving */
+    stack.emplace_back(entry, 0);
+    while (!stack.empty()) {
+        int index = stack.back().first;
+        int leaving = stack.back().second;
+        stack.pop_back();
+        SSABlock& block = state->blocks[index];
+        if (leaving) {
+            for (int s : pushed[index])
+                state->slots[s].values.pop_back();
+            continue;
+        }
+
+        for (auto& phi : block.phis) {
+            state->slots[phi.first].values.push_back(phi.second->result);
+            pushed[index].push_back(phi.first);
+        }
+
+        std::vector<IRInstruction*> kept;
+        for (IRInstruction* instruction : block.code) {
+            int s = -1;
+            if (instruction->opcode == IR_LOAD || instruction->opcode == IR_STORE)
+                s = promoted_slot(state, &instruction->operands[
+                                             instruction->opcode == IR_STORE]);
+            else if (instruction->opcode == IR_ALLOCA)
+                s = promoted_slot(state, &instruction->result);
+            if (s < 0) {
+                kept.push_back(instruction);
+                continue;
+            }
+            SSASlot& slot = state->slots[s];
+            if (instruction->opcode == IR_LOAD) {
+                state->replacements[instruction->result.id] =
+                    current_value(&slot);
+            } else if (instruction->opcode == IR_STORE) {
+                IRValue value = resolve(state, instruction->operands[0]);
+                if (value.kind == IR_VALUE_CONSTANT)
+                    value.type = slot.type;
+                slot.values.push_back(value);
+                pushed[index].push_back(s);
+            }
+        }
+        block.code.swap(kept);
+
+        for (int successor : block.successors) {
+            SSABlock& target = state->blocks[successor];
+            for (auto& phi : target.phis) {
+                for (int i = 0; i < phi.second->operand_count; i++) {
+                    if (phi.second->blocks[i] == block.block->id)
+                        phi.second->operands[i] =
+                            current_value(&state->slots[phi.first]);
+                }
+            }
+        }
+
+        stack.emplace_back(index, 1);
+        for (size_t i = block.children.size(); i-- > 0;)
+            stack.emplace_back(block.children[i], 0);
+    }
+}
+
+/* Drop phis whose incoming values are all one value, or that nothing
+ * uses */
+static void remove_redundant_phis(SSAState* state) {
+    std::vector<IRInstruction*> phis;
+    for (SSABlock& block : state->blocks) {
+        for (auto& phi : block.phis)
+            phis.push_back(phi.second);
+    }
+    std::unordered_set<IRInstruction*> removed;
+
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (IRInstruction* phi : phis) {
+            if (removed.count(phi))
+                continue;
+            IRValue unique = ir_no_value();
+            int trivial = 1;
+            for (int i = 0; i < phi->operand_count; i++) {
+                IRValue value = resolve(state, phi->operands[i]);
+                if (value.kind == IR_VALUE_REGISTER &&
+                    value.id == phi->result.id)
+                    continue;
+                if (unique.kind == IR_VALUE_NONE) {
+                    unique = value;
+                } else if (!same_value(&unique, &value)) {
+                    trivial = 0;
+                    break;
+                }
+            }
+            if (!trivial)
+                continue;
+            if (unique.kind == IR_VALUE_NONE)
+                unique = ir_constant(0, phi->type);
+            state->replacements[phi->result.id] = unique;
+            removed.insert(phi);
+            changed = 1;
+        }
+    }
+
+    /* Uses from everything but the phi itself */
+    std::unordered_map<int, int> uses;
+    std::unordered_map<int, IRInstruction*> phi_of;
+    auto count_uses = [state, &uses](IRInstruction* instruction, int delta) {
+        for (int i = 0; i < instruction->operand_count; i++) {
+            IRValue value = resolve(state, instruction->operands[i]);
+            if (value.kind == IR_VALUE_REGISTER &&
+                !(instruction->opcode == IR_PHI &&
+                  value.id == instruction->result.id))
+                uses[value.id] += delta;
+        }
+    };
+    for (SSABlock& block : state->blocks) {
+        for (IRInstruction* instruction : block.code)
+            count_uses(instruction, 1);
+        for (auto& phi : block.phis) {
+            if (removed.count(phi.second))
+                continue;
+            count_uses(phi.second, 1);
+            phi_of[phi.second->result.id] = phi.second;
+        }
+    }
+    std::vector<IRInstruction*> work;
+    for (auto& entry : phi_of) {
+        if (uses[entry.first] == 0)
+            work.push_back(entry.second);
+    }
+    while (!work.empty()) {
+        IRInstruction* phi = work.back();
+        work.pop_back();
+        if (!removed.insert(phi).second)
+            continue;
+        for (int i = 0; i < phi->operand_count; i++) {
+            IRValue value = resolve(state, phi->operands[i]);
+            if (value.kind != IR_VALUE_REGISTER || value.id == phi->result.id)
+                continue;
+            auto found = phi_of.find(value.id);
+            if (--uses[value.id] == 0 && found != phi_of.end())
+                work.push_back(found->second);
+        }
+    }
+
+    for (SSABlock& block : state->blocks) {
+        std::vector<IRInstruction*> code;
+        for (auto& phi : block.phis) {
+            if (!removed.count(phi.second))
+                code.push_back(phi.second);
+        }
+        code.insert(code.end(), block.code.begin(), block.code.end());
+        block.code.swap(code);
+    }
+}
+
+/* Relink the instructions, substituting promoted values, and number the
+ * registers in layout order */
+static void rewrite_function(SSAState* state) {
+    std::unordered_map<int, int> numbers;
+    int next = 1;
+    for (SSABlock& block : state->blocks) {
+        IRInstruction* previous = NULL;
+        block.block->first = NULL;
+        for (IRInstruction* instruction : block.code) {
+            if (previous)
+                previous->next = instruction;
+            else
+                block.block->first = instruction;
+            previous = instruction;
+            if (instruction->result.kind == IR_VALUE_REGISTER)
+                numbers[instruction->result.id] = next++;
+        }
+        if (previous)
+            previous->next = NULL;
+        block.block->last = previous;
+    }
+
+    for (SSABlock& block : state->blocks) {
+        for (IRInstruction* instruction : block.code) {
+            for (int i = 0; i < instruction->operand_count; i++) {
+                IRValue value = resolve(state, instruction->operands[i]);
+                if (value.kind == IR_VALUE_REGISTER) {
+                    auto found = numbers.find(value.id);
+                    if (found != numbers.end())
+                        value.id = found->second;
+                }
+                instruction->operands[i] = value;
+            }
+            if (instruction->result.kind == IR_VALUE_REGISTER)
+                instruction->result.id = numbers[instruction->result.id];
+        }
+    }
+}
+
+int ssa_promote_locals(IRBuilder* builder) {
+    IRFunction* function = builder->function;
+    if (!function || !function->name || !function->first_block)
+        return 0;
+
+    SSAState state;
+    state.builder = builder;
+    state.function = function;
+    state.next_register = 1;
+
+    terminate_blocks(&state);
+    std::vector<int> order = build_graph(&state);
+    compute_dominance(&state, order);
+
+    for (SSABlock& block : state.blocks) {
+        for (IRInstruction* instruction : block.code) {
+            if (instruction->result.kind == IR_VALUE_REGISTER &&
+                instruction->result.id >= state.next_register)
+                state.next_register = instruction->result.id + 1;
+        }
+    }
+
+    find_slots(&state);
+    int promoted = 0;
+    for (const SSASlot& slot : state.slots)
+        promoted += slot.promotable;
+
+    if (promoted > 0) {
+        insert_phis(&state);
+        rename_slots(&state, order[0]);
+        remove_redundant_phis(&state);
+    }
+    rewrite_function(&state);
+    return promoted;
+}
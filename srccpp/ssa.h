@@ -0,0 +1,28 @@
+#ifndef SSA_H
+#define SSA_H
+
+extern "C" {
+
+#include "ir.h"
+
+/*
+ * SSA promotion of stack slots (-fssa), the front end's mem2reg.
+ *
+ * Runs on the function a builder has just finished, before it is printed
+ * or handed to a consumer. The control-flow graph is made explicit first:
+ * code after a block's terminator and blocks that cannot be reached are
+ * dropped, and a block that runs off its end gets the branch (or return)
+ * the consumers would have assumed. Integer stack slots whose address is
+ * only ever loaded from and stored to then become SSA values: phis go on
+ * the iterated dominance frontiers of their stores, loads are replaced by
+ * the reaching value, and the slot, its loads and stores disappear. Phis
+ * that turn out trivial or unused are removed again, and the registers
+ * are renumbered in layout order. A slot read before any store reads 0.
+ */
+
+/* Promote the slots of builder's current function; new instructions come
+ * from the builder's arena. Returns the number of slots promoted. */
+int ssa_promote_locals(IRBuilder* builder);
+}
+
+#endif /* SSA_H */
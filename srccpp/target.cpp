@@ -0,0 +1,122 @@
+#include "target.h"
+
+#include <string.h>
+
+/* Supported targets; the first one is also the fallback host */
+static const struct TargetEntry {
+    const char* arch; /* After alias folding */
+    const char* os;   /* "darwin" or "linux" */
+    TargetInfo info;
+} targets[] = {
+    {"aarch64", "darwin",
+     {"arm64-apple-darwin", "e-m:o-i64:64-i128:128-n32:64-S128", 2, 4, 8, 8,
+      4, 8}},
+    {"x86_64", "darwin",
+     {"x86_64-apple-darwin",
+      "e-m:o-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128",
+      2, 4, 8, 8, 4, 8}},
+    {"x86_64", "linux",
+     {"x86_64-pc-linux-gnu",
+      "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128",
+      2, 4, 8, 8, 4, 8}},
+    {"aarch64", "linux",
+     {"aarch64-unknown-linux-gnu",
+      "e-m:e-i8:8:32-i16:16:32-i64:64-i128:128-n32:64-S128", 2, 4, 8, 8, 4,
+      8}},
+    {"riscv64", "linux",
+     {"riscv64-unknown-linux-gnu", "e-m:e-p:64:64-i64:64-i128:128-n64-S128",
+      2, 4, 8, 8, 4, 8}},
+    {"powerpc64le", "linux",
+     {"powerpc64le-unknown-linux-gnu",
+      "e-m:e-i64:64-n32:64-S128-v256:256:256-v512:512:512", 2, 4, 8, 8, 4,
+      8}},
+};
+
+#define TARGET_COUNT (sizeof(targets) / sizeof(targets[0]))
+
+#if defined(__APPLE__) && defined(__x86_64__)
+#define HOST_TRIPLE "x86_64-apple-darwin"
+#elif defined(__linux__) && defined(__x86_64__)
+#define HOST_TRIPLE "x86_64-pc-linux-gnu"
+#elif defined(__linux__) && defined(__aarch64__)
+#define HOST_TRIPLE "aarch64-unknown-linux-gnu"
+#elif defined(__linux__) && defined(__riscv) && __riscv_xlen == 64
+#define HOST_TRIPLE "riscv64-unknown-linux-gnu"
+#elif defined(__linux__) && defined(__powerpc64__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define HOST_TRIPLE "powerpc64le-unknown-linux-gnu"
+#else
+#define HOST_TRIPLE "arm64-apple-darwin"
+#endif
+
+const TargetInfo* target_host(void) {
+    const TargetInfo* host = target_lookup(HOST_TRIPLE);
+    return host ? host : &targets[0].info;
+}
+
+const TargetInfo* target_lookup(const char* triple) {
+    if (!triple)
+        return NULL;
+
+    const char* dash = strchr(triple, '-');
+    if (!dash)
+        return NULL;
+    size_t arch_length = (size_t)(dash - triple);
+    const char* arch = triple;
+    if (arch_length == 5 && strncmp(triple, "arm64", 5) == 0) {
+        arch = "aarch64";
+    } else if (arch_length == 5 && strncmp(triple, "amd64", 5) == 0) {
+        arch = "x86_64";
+    }
+    if (arch != triple) {
+        arch_length = strlen(arch);
+    }
+
+    const char* os = NULL;
+    if (strstr(dash, "-darwin") || strstr(dash, "-macos")) {
+        os = "darwin";
+    } else if (strstr(dash, "-linux")) {
+        os = "linux";
+    } else {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < TARGET_COUNT; i++) {
+        if (strlen(targets[i].arch) == arch_length &&
+            strncmp(targets[i].arch, arch, arch_length) == 0 &&
+            strcmp(targets[i].os, os) == 0) {
+            return &targets[i].info;
+        }
+    }
+    return NULL;
+}
+
+int target_type_size(const TargetInfo* target, const TypeInfo* type) {
+    if (!type)
+        return target->int_size;
+
+    switch (type->base_type) {
+    case TYPE_VOID:
+    case TYPE_BOOL:
+    case TYPE_CHAR:
+        return 1;
+    case TYPE_SHORT:
+        return target->short_size;
+    case TYPE_LONG:
+        return target->long_size;
+    case TYPE_FLOAT:
+        return target->float_size;
+    case TYPE_DOUBLE:
+        return target->double_size;
+    case TYPE_POINTER:
+    case TYPE_FUNCTION:
+        return target->pointer_size;
+    case TYPE_ARRAY:
+        return type->array_size * target_type_size(target, type->return_type);
+    case TYPE_STRUCT:
+    case TYPE_UNION:
+        return 0; /* The parser drops member lists */
+    default:
+        return target->int_size;
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef TARGET_H
+#define TARGET_H
+
+extern "C" {
+
+#include "ast.h"
+
+/*
+ * Target ABI tables (--target)
+ *
+ * Each supported target has its triple, the datalayout string LLVM uses
+ * for it, and the sizes of the C scalar types. The module header, sizeof
+ * and pointer arithmetic all read them from the context's target, so the
+ * optimizer sees the same layout the code was generated for. Alignments
+ * reach LLVM through the datalayout. The IR always spells long as i64,
+ * so only LP64 targets are listed.
+ */
+
+typedef struct TargetInfo {
+    const char* triple; /* Emitted as the module's target triple */
+    const char* datalayout;
+    int short_size;
+    int int_size;
+    int long_size;
+    int pointer_size;
+    int float_size;
+    int double_size;
+} TargetInfo;
+
+/* The target this compiler was built for */
+const TargetInfo* target_host(void);
+/* Entry matching triple's architecture and OS; NULL when unsupported */
+const TargetInfo* target_lookup(const char* triple);
+/* sizeof(type) in bytes on target; 0 for structs, unions and arrays of
+ * them, whose layout is unknown */
+int target_type_size(const TargetInfo* target, const TypeInfo* type);
+}
+
+#endif /* TARGET_H */
@@ -0,0 +1,213 @@
+#include "tinyc.h"
+
+#include "ast.h"
+#include "codegen.h"
+#include "error_handling.h"
+
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* tc_ir_flags pass straight through as IRPrintFlags */
+static_assert((int)TC_IR_OPAQUE_POINTERS == (int)IR_PRINT_OPAQUE_POINTERS &&
+                  (int)TC_IR_COMPACT == (int)IR_PRINT_COMPACT,
+              "tc_ir_flags must match IRPrintFlags");
+
+/* External declarations from lexer and parser */
+extern "C" {
+extern int yyparse(void);
+void lexer_begin_buffer(const char* src, size_t len);
+void lexer_end_buffer(void);
+}
+extern ASTNode* program_ast;
+extern CodeGenContext* codegen_ctx;
+
+/* The parser and scanner keep their state in globals (program_ast,
+ * codegen_ctx, yylineno, the flex buffer stack), so only one translation
+ * unit is parsed at a time. Code generation only touches its own context. */
+static std::mutex parser_mutex;
+
+static ASTNode* parse_source(CodeGenContext* ctx, const char* src,
+                             size_t len) {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
+    program_ast = NULL;
+    codegen_ctx = ctx;
+    lexer_begin_buffer(src, len);
+
+    int status = yyparse();
+
+    lexer_end_buffer();
+    ASTNode* ast = program_ast;
+    program_ast = NULL;
+    codegen_ctx = NULL;
+
+    if (status != 0 && ast) {
+        free_ast_node(ast);
+        ast = NULL;
+    }
+    return ast;
+}
+
+/* Attribute diagnostics added after mark (NULL: from the start) to a unit */
+static void tag_diagnostics(CodeGenContext* ctx, Diagnostic* mark,
+                            const char* file_name) {
+    Diagnostic* diag = mark ? mark->next : ctx->diagnostics;
+    for (; diag; diag = diag->next) {
+        diag->file_name = file_name;
+    }
+}
+
+/* Move the context's diagnostics into the result as a flat array */
+static int collect_diagnostics(CodeGenContext* ctx, const tc_options* options,
+                               tc_result* result) {
+    size_t count = 0;
+    for (Diagnostic* diag = ctx->diagnostics; diag; diag = diag->next) {
+        count++;
+    }
+    result->error_count = ctx->error_count;
+    if (count == 0) {
+        return ERROR_NONE;
+    }
+
+    result->diagnostics =
+        static_cast<tc_diagnostic*>(calloc(count, sizeof(tc_diagnostic)));
+    if (!result->diagnostics) {
+        return ERROR_MEMORY;
+    }
+
+    size_t index = 0;
+    for (Diagnostic* diag = ctx->diagnostics; diag; diag = diag->next) {
+        tc_diagnostic* out = &result->diagnostics[index++];
+        out->severity = diag->severity == DIAGNOSTIC_ERROR
+                            ? TC_SEVERITY_ERROR
+                            : TC_SEVERITY_WARNING;
+        out->file_name = diag->file_name
+                             ? diag->file_name
+                             : (options ? options->file_name : NULL);
+        out->line = diag->line;
+        out->column = diag->column;
+        out->message = diag->message;
+        diag->message = NULL; /* Ownership moves to the result */
+    }
+    result->diagnostic_count = count;
+    return ERROR_NONE;
+}
+
+/* Parse every unit, append their top-level lists and generate one module */
+static int compile_units(const tc_unit* units, size_t count,
+                         const tc_options* options, int whole_program,
+                         tc_result* result) {
+    if (!result) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    memset(result, 0, sizeof(tc_result));
+    if (!units && count > 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!units[i].src && units[i].len > 0) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    const TargetInfo* target = target_host();
+    if (options && options->target) {
+        target = target_lookup(options->target);
+        if (!target) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    CodeGenContext* ctx = create_buffered_codegen_context();
+    ctx->quiet_diagnostics = 1;
+    ctx->target = target;
+    if (options) {
+        ctx->codegen_jobs = options->codegen_jobs;
+        ctx->exported_symbols = options->exports;
+        ctx->exported_count = (int)options->export_count;
+        ctx->ssa = options->ssa;
+        ctx->ir_flags = options->ir_flags;
+    }
+    ctx->whole_program = whole_program;
+
+    int status = ERROR_NONE;
+    ASTNode* program = NULL;
+    ASTNode* tail = NULL;
+    for (size_t i = 0; i < count; i++) {
+        Diagnostic* mark = ctx->diagnostics_tail;
+        ASTNode* ast = parse_source(ctx, units[i].src ? units[i].src : "",
+                                    units[i].len);
+        if (!ast && ctx->diagnostics_tail == mark) {
+            codegen_add_diagnostic(ctx, DIAGNOSTIC_ERROR, 0, 0,
+                                   "Parsing failed");
+        }
+        if (whole_program) {
+            tag_diagnostics(ctx, mark, units[i].file_name);
+        }
+        if (!ast) {
+            status = ERROR_PARSE;
+            continue;
+        }
+        if (whole_program) {
+            qualify_unit_statics(ast, (int)i);
+        }
+
+        if (tail) {
+            tail->next = ast;
+        } else {
+            program = ast;
+        }
+        for (tail = ast; tail->next; tail = tail->next) {
+        }
+    }
+
+    if (status == ERROR_NONE && program) {
+        generate_llvm_ir(ctx, program);
+        if (ctx->error_count > 0) {
+            status = ERROR_CODEGEN;
+        }
+    }
+    free_ast_node(program);
+
+    result->ir = ir_buffer_release(&ctx->out, &result->ir_length);
+    if (!result->ir) {
+        status = ERROR_MEMORY;
+    }
+
+    if (collect_diagnostics(ctx, options, result) != ERROR_NONE) {
+        status = ERROR_MEMORY;
+    }
+    free_codegen_context(ctx);
+    return status;
+}
+
+int tc_compile(const char* src, size_t len, const tc_options* options,
+               tc_result* result) {
+    if (!src && len > 0) {
+        if (result) {
+            memset(result, 0, sizeof(tc_result));
+        }
+        return ERROR_INVALID_ARGUMENT;
+    }
+    tc_unit unit = {options ? options->file_name : NULL, src, len};
+    return compile_units(&unit, 1, options, 0, result);
+}
+
+int tc_compile_program(const tc_unit* units, size_t count,
+                       const tc_options* options, tc_result* result) {
+    return compile_units(units, count, options, 1, result);
+}
+
+void tc_result_free(tc_result* result) {
+    if (!result)
+        return;
+
+    for (size_t i = 0; i < result->diagnostic_count; i++) {
+        free(result->diagnostics[i].message);
+    }
+    free(result->diagnostics);
+    free(result->ir);
+    memset(result, 0, sizeof(tc_result));
+}
@@ -0,0 +1,88 @@
+#ifndef TINYC_H
+#define TINYC_H
+
+/*
+ * Embeddable compiler API (libtinyc.a)
+ *
+ * Compiles a C translation unit held in memory to LLVM IR held in memory,
+ * with diagnostics returned as data instead of being printed. No files are
+ * read or written. tc_compile may be called repeatedly and from multiple
+ * threads: parsing is serialized internally because the bison/flex front end
+ * keeps its state in globals, while code generation runs concurrently on a
+ * private context per call.
+ */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    TC_SEVERITY_WARNING,
+    TC_SEVERITY_ERROR
+} tc_severity;
+
+/* tc_options::ir_flags */
+typedef enum {
+    TC_IR_OPAQUE_POINTERS = 1, /* Every pointer type spelled ptr */
+    TC_IR_COMPACT = 2          /* No comments, indentation or blank lines */
+} tc_ir_flags;
+
+typedef struct tc_diagnostic {
+    tc_severity severity;
+    const char* file_name; /* Unit or tc_options::file_name, or NULL */
+    int line;              /* 1-based; 0 when unknown */
+    int column;            /* 0 when unknown */
+    char* message;
+} tc_diagnostic;
+
+typedef struct tc_options {
+    const char* file_name; /* Name reported in diagnostics (not opened) */
+    int codegen_jobs;      /* Threads generating function bodies; <= 1: one */
+    const char* const* exports; /* tc_compile_program: symbols kept external */
+    size_t export_count;
+    const char* target; /* Target triple, e.g. "x86_64-pc-linux-gnu"; NULL:
+                         * the host. Unsupported triples fail with
+                         * ERROR_INVALID_ARGUMENT. */
+    int ssa;            /* Keep scalar locals in SSA registers (-fssa) */
+    int ir_flags;       /* tc_ir_flags: --opaque-pointers, --compact-ir */
+} tc_options;
+
+/* One translation unit of a whole program */
+typedef struct tc_unit {
+    const char* file_name; /* Name reported in diagnostics (not opened) */
+    const char* src;
+    size_t len;
+} tc_unit;
+
+typedef struct tc_result {
+    char* ir;         /* NUL-terminated LLVM IR text */
+    size_t ir_length; /* Length of ir, excluding the terminator */
+    tc_diagnostic* diagnostics;
+    size_t diagnostic_count;
+    int error_count;
+} tc_result;
+
+/* Compile len bytes of C source. options may be NULL. Returns 0 on success
+ * or an ErrorType code (error_handling.h). Unless result is NULL it is
+ * always filled in, and must be released with tc_result_free. */
+int tc_compile(const char* src, size_t len, const tc_options* options,
+               tc_result* result);
+
+/* Compile several translation units into one module. Their global symbol
+ * tables are merged, duplicate declarations and identical string constants
+ * are emitted once, and every definition except main and options->exports
+ * gets internal linkage, so the optimizer can inline and drop them across
+ * units. Returns and fills result like tc_compile. */
+int tc_compile_program(const tc_unit* units, size_t count,
+                       const tc_options* options, tc_result* result);
+
+/* Release everything owned by result and reset it to empty */
+void tc_result_free(tc_result* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TINYC_H */
@@ -0,0 +1,1391 @@
+#include "x86_backend.h"
+
+#include "target.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* ELF64 (spelled out: elf.h is not available everywhere) */
+enum {
+    SHT_PROGBITS = 1,
+    SHT_SYMTAB = 2,
+    SHT_STRTAB = 3,
+    SHT_RELA = 4
+};
+
+enum { SHF_WRITE = 1, SHF_ALLOC = 2, SHF_EXECINSTR = 4, SHF_INFO_LINK = 0x40 };
+
+enum { STB_LOCAL = 0, STB_GLOBAL = 1 };
+enum { STT_NOTYPE = 0, STT_OBJECT = 1, STT_FUNC = 2 };
+
+enum {
+    R_X86_64_PC32 = 2,
+    R_X86_64_PLT32 = 4,
+    R_X86_64_GOTPCREL = 9
+};
+
+/* Sections of the object, by section header index */
+enum {
+    SECTION_UNDEFINED,
+    SECTION_TEXT,
+    SECTION_DATA,
+    SECTION_RODATA,
+    SECTION_RELA_TEXT,
+    SECTION_SYMTAB,
+    SECTION_STRTAB,
+    SECTION_SHSTRTAB,
+    SECTION_NOTE_STACK, /* Empty .note.GNU-stack: no executable stack */
+    SECTION_COUNT
+};
+
+/* Registers by encoding */
+enum { RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9 };
+
+static const int argument_registers[] = {RDI, RSI, RDX, RCX, R8, R9};
+
+typedef struct X86Symbol {
+    std::string name;
+    int section; /* SECTION_UNDEFINED until defined */
+    uint64_t value;
+    uint64_t size;
+    int is_function;
+    int is_local; /* Internal linkage or a private string */
+} X86Symbol;
+
+/* Relocations are all in .text, 4 bytes wide, with addend -4 */
+enum {
+    RELOCATION_CALL,   /* call rel32 */
+    RELOCATION_ADDRESS /* mov reg, [rip+GOT]; lea once the symbol is local */
+};
+
+typedef struct X86Relocation {
+    size_t offset;
+    int symbol;
+    int kind;
+} X86Relocation;
+
+/* Signature of a declared or defined function, for argument conversions;
+ * types live in the backend's table, outliving each function's own */
+typedef struct X86Prototype {
+    TypeInfo* return_type;
+    std::vector<TypeInfo*> parameters;
+    int is_variadic;
+} X86Prototype;
+
+struct X86Backend {
+    std::vector<uint8_t> text;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> rodata;
+    std::vector<X86Symbol> symbols;
+    std::unordered_map<std::string, int> symbol_index;
+    std::vector<X86Relocation> relocations;
+    std::unordered_map<std::string, X86Prototype> prototypes;
+    TypeTable types; /* Prototype types */
+    const TargetInfo* target;
+    IRConsumer consumer;
+    int error_count;
+};
+
+/* Where a value lives: in its frame slot, or it is the slot's address */
+typedef struct X86Location {
+    int offset; /* From rbp */
+    int is_address;
+} X86Location;
+
+/* Function being translated */
+typedef struct X86FunctionState {
+    X86Backend* backend;
+    TypeInfo* return_type;
+    int frame_size;
+    size_t frame_size_offset; /* imm32 of the prologue's sub rsp */
+    std::unordered_map<int, X86Location> registers;
+    std::unordered_map<std::string, X86Location> locals;
+    std::unordered_map<int, size_t> blocks; /* Code offset by block id */
+    std::vector<std::pair<size_t, int>> branches; /* rel32 offset, block */
+    std::unordered_map<int, std::vector<const IRInstruction*>> phis;
+    int current_block;
+} X86FunctionState;
+
+static void backend_error(X86Backend* backend, const char* format,
+                          const char* name) {
+    fprintf(stderr, "Error: ");
+    fprintf(stderr, format, name);
+    fprintf(stderr, "\n");
+    backend->error_count++;
+}
+
+/* Types */
+
+enum { CLASS_INTEGER, CLASS_FLOAT, CLASS_DOUBLE };
+
+/* Pointers count as integers; void stands in for an int as in the text */
+static int value_class(const TypeInfo* type) {
+    if (type && type->base_type == TYPE_FLOAT)
+        return CLASS_FLOAT;
+    if (type && type->base_type == TYPE_DOUBLE)
+        return CLASS_DOUBLE;
+    return CLASS_INTEGER;
+}
+
+static int value_bits(const TypeInfo* type) {
+    if (!type)
+        return 32;
+    switch (type->base_type) {
+    case TYPE_BOOL:
+        return 1;
+    case TYPE_CHAR:
+        return 8;
+    case TYPE_SHORT:
+        return 16;
+    case TYPE_LONG:
+    case TYPE_DOUBLE:
+    case TYPE_POINTER:
+    case TYPE_ARRAY:
+    case TYPE_FUNCTION:
+    case TYPE_STRUCT:
+    case TYPE_UNION:
+        return 64;
+    default:
+        return 32;
+    }
+}
+
+static int has_unknown_layout(const TypeInfo* type) {
+    while (type && type->base_type == TYPE_ARRAY) {
+        type = type->return_type;
+    }
+    return type &&
+           (type->base_type == TYPE_STRUCT || type->base_type == TYPE_UNION);
+}
+
+static int type_size(X86Backend* backend, const TypeInfo* type) {
+    if (!type || type->base_type == TYPE_VOID)
+        return backend->target->int_size;
+    return target_type_size(backend->target, type);
+}
+
+/* Symbols */
+
+static int symbol_for(X86Backend* backend, const char* name) {
+    auto found = backend->symbol_index.find(name);
+    if (found != backend->symbol_index.end())
+        return found->second;
+
+    X86Symbol symbol;
+    symbol.name = name;
+    symbol.section = SECTION_UNDEFINED;
+    symbol.value = 0;
+    symbol.size = 0;
+    symbol.is_function = 0;
+    symbol.is_local = 0;
+    backend->symbols.push_back(symbol);
+    int index = (int)backend->symbols.size() - 1;
+    backend->symbol_index.emplace(name, index);
+    return index;
+}
+
+/* Machine code */
+
+static void emit(X86Backend* backend, std::initializer_list<int> bytes) {
+    for (int byte : bytes) {
+        backend->text.push_back((uint8_t)byte);
+    }
+}
+
+static void put_u32(std::vector<uint8_t>& out, size_t at, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[at + i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static void emit_u32(X86Backend* backend, uint32_t value) {
+    backend->text.resize(backend->text.size() + 4);
+    put_u32(backend->text, backend->text.size() - 4, value);
+}
+
+/* REX prefix for a 64-bit operation on reg and rm */
+static void emit_rex_w(X86Backend* backend, int reg, int rm) {
+    emit(backend, {0x48 | ((reg & 8) ? 4 : 0) | ((rm & 8) ? 1 : 0)});
+}
+
+/* opcode reg, [rbp+offset] */
+static void emit_frame_op(X86Backend* backend, int opcode, int reg,
+                          int offset) {
+    emit_rex_w(backend, reg, RBP);
+    emit(backend, {opcode, 0x85 | ((reg & 7) << 3)});
+    emit_u32(backend, (uint32_t)offset);
+}
+
+static void emit_mov_reg(X86Backend* backend, int to, int from) {
+    if (to == from)
+        return;
+    emit_rex_w(backend, from, to);
+    emit(backend, {0x89, 0xC0 | ((from & 7) << 3) | (to & 7)});
+}
+
+static void emit_mov_imm(X86Backend* backend, int reg, int64_t value) {
+    emit_rex_w(backend, 0, reg);
+    if (value >= INT32_MIN && value <= INT32_MAX) {
+        emit(backend, {0xC7, 0xC0 | (reg & 7)});
+        emit_u32(backend, (uint32_t)value);
+    } else {
+        emit(backend, {0xB8 | (reg & 7)});
+        emit_u32(backend, (uint32_t)value);
+        emit_u32(backend, (uint32_t)((uint64_t)value >> 32));
+    }
+}
+
+/* reg = address of name */
+static void emit_symbol_address(X86Backend* backend, int reg,
+                                const char* name) {
+    emit_rex_w(backend, reg, 0);
+    emit(backend, {0x8B, 0x05 | ((reg & 7) << 3)});
+    X86Relocation relocation = {backend->text.size(),
+                                symbol_for(backend, name), RELOCATION_ADDRESS};
+    backend->relocations.push_back(relocation);
+    emit_u32(backend, 0);
+}
+
+/* Sign-extend rax from bits, or reduce it to 0/1 for i1 */
+static void emit_normalize(X86Backend* backend, int bits) {
+    switch (bits) {
+    case 1:
+        emit(backend, {0x83, 0xE0, 0x01}); /* and eax, 1 */
+        break;
+    case 8:
+        emit(backend, {0x48, 0x0F, 0xBE, 0xC0}); /* movsx rax, al */
+        break;
+    case 16:
+        emit(backend, {0x48, 0x0F, 0xBF, 0xC0}); /* movsx rax, ax */
+        break;
+    case 32:
+        emit(backend, {0x48, 0x63, 0xC0}); /* movsxd rax, eax */
+        break;
+    }
+}
+
+/* rax from type from to type to; the C API backend's implicit conversions */
+static void emit_convert(X86Backend* backend, const TypeInfo* from,
+                         const TypeInfo* to) {
+    int from_class = value_class(from);
+    int to_class = value_class(to);
+
+    if (from_class == CLASS_INTEGER && to_class == CLASS_INTEGER) {
+        /* Slots hold integers sign-extended, so only narrowing costs */
+        if (value_bits(to) < value_bits(from))
+            emit_normalize(backend, value_bits(to));
+        return;
+    }
+    if (from_class == to_class)
+        return;
+
+    if (from_class == CLASS_INTEGER) {
+        /* cvtsi2ss/sd xmm0, rax */
+        emit(backend, {to_class == CLASS_FLOAT ? 0xF3 : 0xF2, 0x48, 0x0F, 0x2A,
+                       0xC0});
+    } else {
+        /* movd/movq xmm0, rax */
+        if (from_class == CLASS_FLOAT) {
+            emit(backend, {0x66, 0x0F, 0x6E, 0xC0});
+        } else {
+            emit(backend, {0x66, 0x48, 0x0F, 0x6E, 0xC0});
+        }
+        if (to_class == CLASS_INTEGER) {
+            /* cvttss2si/sd rax, xmm0 */
+            emit(backend, {from_class == CLASS_FLOAT ? 0xF3 : 0xF2, 0x48, 0x0F,
+                           0x2C, 0xC0});
+            emit_normalize(backend, value_bits(to));
+            return;
+        }
+        /* cvtss2sd or cvtsd2ss xmm0, xmm0 */
+        emit(backend,
+             {from_class == CLASS_FLOAT ? 0xF3 : 0xF2, 0x0F, 0x5A, 0xC0});
+    }
+    /* movd/movq rax, xmm0 */
+    if (to_class == CLASS_FLOAT) {
+        emit(backend, {0x66, 0x0F, 0x7E, 0xC0});
+    } else {
+        emit(backend, {0x66, 0x48, 0x0F, 0x7E, 0xC0});
+    }
+}
+
+/* movd/movq between rax and xmm register; to_xmm selects the direction */
+static void emit_xmm_move(X86Backend* backend, int xmm, int is_double,
+                          int to_xmm) {
+    emit(backend, {0x66});
+    if (is_double)
+        emit(backend, {0x48});
+    emit(backend, {0x0F, to_xmm ? 0x6E : 0x7E, 0xC0 | (xmm << 3)});
+}
+
+/* A memory operand: [rcx], or [rbp+offset] for a known frame slot */
+typedef struct X86Memory {
+    int in_frame;
+    int offset;
+} X86Memory;
+
+static void emit_memory_modrm(X86Backend* backend, int reg,
+                              X86Memory memory) {
+    if (memory.in_frame) {
+        emit(backend, {0x85 | (reg << 3)});
+        emit_u32(backend, (uint32_t)memory.offset);
+    } else {
+        emit(backend, {0x01 | (reg << 3)});
+    }
+}
+
+/* rax = value of type at memory, sign-extended */
+static void emit_load(X86Backend* backend, const TypeInfo* type,
+                      X86Memory memory) {
+    int bits = value_bits(type);
+    if (value_class(type) == CLASS_FLOAT) {
+        emit(backend, {0x8B});
+    } else if (bits == 1) {
+        emit(backend, {0x48, 0x0F, 0xB6});
+    } else if (bits == 8) {
+        emit(backend, {0x48, 0x0F, 0xBE});
+    } else if (bits == 16) {
+        emit(backend, {0x48, 0x0F, 0xBF});
+    } else if (bits == 32) {
+        emit(backend, {0x48, 0x63});
+    } else {
+        emit(backend, {0x48, 0x8B});
+    }
+    emit_memory_modrm(backend, RAX, memory);
+}
+
+/* Store the low bytes of rax for type to memory */
+static void emit_store(X86Backend* backend, const TypeInfo* type,
+                       X86Memory memory) {
+    int bits = value_class(type) == CLASS_FLOAT ? 32 : value_bits(type);
+    if (bits <= 8) {
+        emit(backend, {0x88});
+    } else if (bits == 16) {
+        emit(backend, {0x66, 0x89});
+    } else if (bits == 32) {
+        emit(backend, {0x89});
+    } else {
+        emit(backend, {0x48, 0x89});
+    }
+    emit_memory_modrm(backend, RAX, memory);
+}
+
+/* Values */
+
+static X86Location new_slot(X86FunctionState* state, int size) {
+    state->frame_size += (size + 7) & ~7;
+    X86Location location = {-state->frame_size, 0};
+    return location;
+}
+
+static const X86Location* find_location(X86FunctionState* state,
+                                        const IRValue* value) {
+    if (value->kind == IR_VALUE_REGISTER) {
+        auto found = state->registers.find(value->id);
+        if (found != state->registers.end())
+            return &found->second;
+    } else if (value->kind == IR_VALUE_LOCAL) {
+        auto found = state->locals.find(value->name);
+        if (found != state->locals.end())
+            return &found->second;
+    }
+    return NULL;
+}
+
+/* Slot for result, made on first definition */
+static X86Location result_location(X86FunctionState* state,
+                                   const IRValue* result) {
+    const X86Location* found = find_location(state, result);
+    if (found && !found->is_address)
+        return *found;
+    X86Location location = new_slot(state, 8);
+    if (result->kind == IR_VALUE_REGISTER) {
+        state->registers[result->id] = location;
+    } else if (result->kind == IR_VALUE_LOCAL) {
+        state->locals[result->name] = location;
+    }
+    return location;
+}
+
+static void store_result(X86FunctionState* state, const IRValue* result) {
+    if (result->kind != IR_VALUE_REGISTER && result->kind != IR_VALUE_LOCAL)
+        return;
+    X86Location location = result_location(state, result);
+    emit_frame_op(state->backend, 0x89, RAX, location.offset);
+}
+
+static int64_t constant_bits_of(const TypeInfo* type, int64_t constant) {
+    switch (value_class(type)) {
+    case CLASS_FLOAT: {
+        float real = (float)constant;
+        uint32_t bits;
+        memcpy(&bits, &real, sizeof(bits));
+        return bits;
+    }
+    case CLASS_DOUBLE: {
+        double real = (double)constant;
+        int64_t bits;
+        memcpy(&bits, &real, sizeof(bits));
+        return bits;
+    }
+    default:
+        switch (value_bits(type)) {
+        case 1:
+            return constant != 0;
+        case 8:
+            return (int8_t)constant;
+        case 16:
+            return (int16_t)constant;
+        case 32:
+            return (int32_t)constant;
+        default:
+            return constant;
+        }
+    }
+}
+
+static int64_t constant_bits(const IRValue* value) {
+    return constant_bits_of(value->type, value->id);
+}
+
+/* rax = value; values that were never defined, such as uses in
+ * unreachable code, read as zero */
+static void emit_value(X86FunctionState* state, const IRValue* value) {
+    X86Backend* backend = state->backend;
+    switch (value->kind) {
+    case IR_VALUE_REGISTER:
+    case IR_VALUE_LOCAL: {
+        const X86Location* location = find_location(state, value);
+        if (location) {
+            emit_frame_op(backend, location->is_address ? 0x8D : 0x8B, RAX,
+                          location->offset);
+            return;
+        }
+        break;
+    }
+    case IR_VALUE_GLOBAL:
+        emit_symbol_address(backend, RAX, value->name);
+        return;
+    case IR_VALUE_CONSTANT:
+        emit_mov_imm(backend, RAX, constant_bits(value));
+        return;
+    case IR_VALUE_NONE:
+        break;
+    }
+    emit_mov_imm(backend, RAX, 0);
+}
+
+/* rax = value as type */
+static void emit_operand(X86FunctionState* state, const IRValue* value,
+                         const TypeInfo* type) {
+    emit_value(state, value);
+    emit_convert(state->backend, value->type, type);
+}
+
+/* Memory at address: the slot itself when address is a stack slot, else
+ * [rcx] with rcx loaded; rax is clobbered */
+static X86Memory emit_address(X86FunctionState* state, const IRValue* address) {
+    const X86Location* location = find_location(state, address);
+    if (location && location->is_address) {
+        X86Memory memory = {1, location->offset};
+        return memory;
+    }
+    emit_value(state, address);
+    emit_mov_reg(state->backend, RCX, RAX);
+    X86Memory memory = {0, 0};
+    return memory;
+}
+
+/* Control flow */
+
+/* jmp/jcc rel32 to block, patched once the function is laid out */
+static void emit_branch(X86FunctionState* state,
+                        std::initializer_list<int> opcode, int block) {
+    emit(state->backend, opcode);
+    state->branches.emplace_back(state->backend->text.size(), block);
+    emit_u32(state->backend, 0);
+}
+
+/* Phi results of target set to their values for the edge from the
+ * current block */
+/* Phis take their values at once: with several, one may read another's
+ * result (a swap), so all values go on the stack before any is stored */
+static void emit_phi_moves(X86FunctionState* state, int target) {
+    auto found = state->phis.find(target);
+    if (found == state->phis.end())
+        return;
+    std::vector<std::pair<const IRInstruction*, const IRValue*>> moves;
+    for (const IRInstruction* phi : found->second) {
+        for (int i = 0; i < phi->operand_count; i++) {
+            if (phi->blocks[i] == state->current_block) {
+                moves.emplace_back(phi, &phi->operands[i]);
+                break;
+            }
+        }
+    }
+    if (moves.size() == 1) {
+        emit_operand(state, moves[0].second, moves[0].first->type);
+        store_result(state, &moves[0].first->result);
+        return;
+    }
+    for (const auto& move : moves) {
+        emit_operand(state, move.second, move.first->type);
+        emit(state->backend, {0x50}); /* push rax */
+    }
+    for (size_t i = moves.size(); i-- > 0;) {
+        emit(state->backend, {0x58}); /* pop rax */
+        store_result(state, &moves[i].first->result);
+    }
+}
+
+static void emit_jump(X86FunctionState* state, int target) {
+    emit_phi_moves(state, target);
+    emit_branch(state, {0xE9}, target);
+}
+
+/* Case values spanning at most this many table entries per case get a
+ * jump table; sparser switches compare case by case */
+#define X86_JUMP_TABLE_SPREAD 3
+#define X86_JUMP_TABLE_MIN_CASES 4
+
+/* jcc rel32 to target; through a stub that makes the phi moves when
+ * target has phis. rax survives the branch not being taken. */
+static void emit_conditional_jump(X86FunctionState* state, int condition,
+                                  int target) {
+    X86Backend* backend = state->backend;
+    if (!state->phis.count(target)) {
+        emit_branch(state, {0x0F, condition}, target);
+        return;
+    }
+    emit(backend, {0x0F, condition ^ 1}); /* Inverted: skip the stub */
+    size_t skip = backend->text.size();
+    emit_u32(backend, 0);
+    emit_jump(state, target);
+    put_u32(backend->text, skip,
+            (uint32_t)(backend->text.size() - (skip + 4)));
+}
+
+/* A dense switch jumps into a table of jmp rel32, one per value from the
+ * lowest case up and a last one for the default. Targets whose phis need
+ * moves are reached through a stub per target after the table. */
+static void emit_switch(X86FunctionState* state,
+                        const IRInstruction* instruction) {
+    X86Backend* backend = state->backend;
+    const IRValue* operands = instruction->operands;
+    int count = instruction->operand_count - 1;
+    int64_t low = 0, high = 0;
+    for (int i = 1; i <= count; i++) {
+        if (i == 1 || operands[i].id < low)
+            low = operands[i].id;
+        if (i == 1 || operands[i].id > high)
+            high = operands[i].id;
+    }
+    emit_operand(state, &operands[0], operands[0].type);
+
+    if (count < X86_JUMP_TABLE_MIN_CASES ||
+        high - low >= (int64_t)count * X86_JUMP_TABLE_SPREAD) {
+        for (int i = 1; i <= count; i++) {
+            emit(backend, {0x3D}); /* cmp eax, imm32 */
+            emit_u32(backend, (uint32_t)operands[i].id);
+            emit_conditional_jump(state, 0x84 /* je */,
+                                  instruction->blocks[i]);
+        }
+        emit_jump(state, instruction->blocks[0]);
+        return;
+    }
+
+    int size = (int)(high - low) + 1;
+    emit(backend, {0x2D}); /* sub eax, imm32; zero-extends into rax */
+    emit_u32(backend, (uint32_t)low);
+    emit(backend, {0x3D}); /* cmp eax, size */
+    emit_u32(backend, (uint32_t)size);
+    emit(backend, {0x0F, 0x83}); /* jae default entry */
+    size_t out_of_range = backend->text.size();
+    emit_u32(backend, 0);
+    emit(backend, {0x48, 0x8D, 0x0D}); /* lea rcx, [rip + table] */
+    size_t table_address = backend->text.size();
+    emit_u32(backend, 0);
+    emit(backend, {0x48, 0x8D, 0x04, 0x80}); /* lea rax, [rax + rax * 4] */
+    emit(backend, {0x48, 0x01, 0xC1});       /* add rcx, rax */
+    emit(backend, {0xFF, 0xE1});             /* jmp rcx */
+
+    size_t table = backend->text.size();
+    put_u32(backend->text, table_address,
+            (uint32_t)(table - (table_address + 4)));
+    std::vector<int> targets(size + 1, instruction->blocks[0]);
+    for (int i = count; i >= 1; i--)
+        targets[operands[i].id - low] = instruction->blocks[i];
+    put_u32(backend->text, out_of_range,
+            (uint32_t)(table + 5 * (size_t)size - (out_of_range + 4)));
+
+    std::vector<size_t> entries;
+    for (int i = 0; i <= size; i++) {
+        if (!state->phis.count(targets[i])) {
+            emit_branch(state, {0xE9}, targets[i]);
+            entries.push_back(0);
+        } else {
+            emit(backend, {0xE9});
+            entries.push_back(backend->text.size());
+            emit_u32(backend, 0);
+        }
+    }
+    std::unordered_map<int, size_t> stubs;
+    for (int i = 0; i <= size; i++) {
+        if (!entries[i])
+            continue;
+        auto stub = stubs.find(targets[i]);
+        if (stub == stubs.end()) {
+            stub = stubs.emplace(targets[i], backend->text.size()).first;
+            emit_jump(state, targets[i]);
+        }
+        put_u32(backend->text, entries[i],
+                (uint32_t)(stub->second - (entries[i] + 4)));
+    }
+}
+
+static void emit_epilogue(X86Backend* backend) {
+    emit(backend, {0xC9, 0xC3}); /* leave; ret */
+}
+
+/* ret for a block that runs off the end of the function */
+static void emit_default_return(X86FunctionState* state) {
+    emit_mov_imm(state->backend, RAX, 0);
+    emit_epilogue(state->backend);
+}
+
+/* Calls */
+
+static void emit_call(X86FunctionState* state,
+                      const IRInstruction* instruction) {
+    X86Backend* backend = state->backend;
+    auto found = backend->prototypes.find(instruction->text);
+    const X86Prototype* prototype =
+        found != backend->prototypes.end() ? &found->second : NULL;
+
+    /* Arguments take the declared parameter types when the arity fits */
+    int count = instruction->operand_count;
+    int fixed = prototype ? (int)prototype->parameters.size() : 0;
+    int typed = prototype && (count == fixed ||
+                              (count > fixed && prototype->is_variadic));
+
+    std::vector<int> registers(count, -1); /* Register, or -1: stack */
+    std::vector<const TypeInfo*> types(count);
+    std::vector<int> stack;
+    int integer_count = 0;
+    int float_count = 0;
+    for (int i = 0; i < count; i++) {
+        types[i] = typed && i < fixed ? prototype->parameters[i]
+                                      : instruction->operands[i].type;
+        if (value_class(types[i]) == CLASS_INTEGER) {
+            if (integer_count < 6)
+                registers[i] = argument_registers[integer_count++];
+        } else if (float_count < 8) {
+            registers[i] = float_count++;
+        }
+        if (registers[i] < 0)
+            stack.push_back(i);
+    }
+
+    /* Stack arguments, keeping rsp 16-byte aligned at the call */
+    int stack_bytes = (int)((stack.size() + 1) & ~(size_t)1) * 8;
+    if (stack.size() % 2) {
+        emit(backend, {0x48, 0x83, 0xEC, 0x08}); /* sub rsp, 8 */
+    }
+    for (size_t i = stack.size(); i-- > 0;) {
+        emit_operand(state, &instruction->operands[stack[i]], types[stack[i]]);
+        emit(backend, {0x50}); /* push rax */
+    }
+    for (int i = 0; i < count; i++) {
+        if (registers[i] < 0)
+            continue;
+        emit_operand(state, &instruction->operands[i], types[i]);
+        int value_type = value_class(types[i]);
+        if (value_type == CLASS_INTEGER) {
+            emit_mov_reg(backend, registers[i], RAX);
+        } else {
+            emit_xmm_move(backend, registers[i], value_type == CLASS_DOUBLE,
+                          1);
+        }
+    }
+    /* al: vector registers used, for variadic callees */
+    emit(backend, {0xB8});
+    emit_u32(backend, (uint32_t)float_count);
+
+    emit(backend, {0xE8});
+    X86Relocation relocation = {backend->text.size(),
+                                symbol_for(backend, instruction->text),
+                                RELOCATION_CALL};
+    backend->relocations.push_back(relocation);
+    emit_u32(backend, 0);
+    if (stack_bytes > 0) {
+        emit(backend, {0x48, 0x81, 0xC4}); /* add rsp, stack_bytes */
+        emit_u32(backend, (uint32_t)stack_bytes);
+    }
+
+    TypeInfo* return_type =
+        prototype ? prototype->return_type : instruction->type;
+    int return_class = value_class(return_type);
+    if (return_class == CLASS_INTEGER) {
+        emit_normalize(backend, value_bits(return_type));
+    } else {
+        emit_xmm_move(backend, 0, return_class == CLASS_DOUBLE, 0);
+    }
+    emit_convert(backend, return_type, instruction->type);
+    store_result(state, &instruction->result);
+}
+
+/* Instructions */
+
+static void emit_binary(X86Backend* backend, int op) {
+    switch (op) {
+    case IR_ADD:
+        emit(backend, {0x48, 0x01, 0xC8});
+        break;
+    case IR_SUB:
+        emit(backend, {0x48, 0x29, 0xC8});
+        break;
+    case IR_MUL:
+        emit(backend, {0x48, 0x0F, 0xAF, 0xC1});
+        break;
+    case IR_SDIV:
+        emit(backend, {0x48, 0x99, 0x48, 0xF7, 0xF9}); /* cqo; idiv rcx */
+        break;
+    case IR_SREM:
+        emit(backend, {0x48, 0x99, 0x48, 0xF7, 0xF9, 0x48, 0x89, 0xD0});
+        break;
+    case IR_AND:
+        emit(backend, {0x48, 0x21, 0xC8});
+        break;
+    case IR_OR:
+        emit(backend, {0x48, 0x09, 0xC8});
+        break;
+    case IR_XOR:
+        emit(backend, {0x48, 0x31, 0xC8});
+        break;
+    case IR_SHL:
+        emit(backend, {0x48, 0xD3, 0xE0});
+        break;
+    default:
+        emit(backend, {0x48, 0xD3, 0xF8}); /* sar rax, cl */
+        break;
+    }
+}
+
+/* setcc opcode for an IRPredicate */
+static int condition_code(int op) {
+    switch (op) {
+    case IR_ICMP_EQ:
+        return 0x94;
+    case IR_ICMP_NE:
+        return 0x95;
+    case IR_ICMP_SLT:
+        return 0x9C;
+    case IR_ICMP_SGT:
+        return 0x9F;
+    case IR_ICMP_SLE:
+        return 0x9E;
+    default:
+        return 0x9D;
+    }
+}
+
+/* rax = operands[0], rcx = operands[1], both as type */
+static void emit_operand_pair(X86FunctionState* state,
+                              const IRInstruction* instruction) {
+    emit_operand(state, &instruction->operands[1], instruction->type);
+    emit_mov_reg(state->backend, RCX, RAX);
+    emit_operand(state, &instruction->operands[0], instruction->type);
+}
+
+/* Offset of a getelementptr into rax, which holds the base */
+static void emit_gep(X86FunctionState* state,
+                     const IRInstruction* instruction) {
+    X86Backend* backend = state->backend;
+    const TypeInfo* type = instruction->type;
+    for (int i = 1; i < instruction->operand_count; i++) {
+        if (i > 1)
+            type = type->return_type; /* Array element */
+        int64_t scale = type_size(backend, type);
+        const IRValue* index = &instruction->operands[i];
+        if (index->kind == IR_VALUE_CONSTANT) {
+            int64_t offset = constant_bits(index) * scale;
+            if (offset != 0) {
+                emit(backend, {0x48, 0x05}); /* add rax, imm32 */
+                emit_u32(backend, (uint32_t)offset);
+            }
+            continue;
+        }
+        emit(backend, {0x50}); /* push rax */
+        emit_value(state, index);
+        emit(backend, {0x48, 0x69, 0xC8}); /* imul rcx, rax, imm32 */
+        emit_u32(backend, (uint32_t)scale);
+        emit(backend, {0x58});             /* pop rax */
+        emit(backend, {0x48, 0x01, 0xC8}); /* add rax, rcx */
+    }
+}
+
+/* Translate one instruction; returns 1 for terminators */
+static int lower_instruction(X86FunctionState* state,
+                             const IRInstruction* instruction) {
+    X86Backend* backend = state->backend;
+    const IRValue* operands = instruction->operands;
+
+    switch (instruction->opcode) {
+    case IR_ALLOCA: {
+        if (has_unknown_layout(instruction->type)) {
+            backend_error(backend, "Layout of '%s' is unknown",
+                          canonical_type_name(instruction->type));
+            return 0;
+        }
+        X86Location location =
+            new_slot(state, type_size(backend, instruction->type));
+        location.is_address = 1;
+        if (instruction->result.kind == IR_VALUE_REGISTER) {
+            state->registers[instruction->result.id] = location;
+        } else if (instruction->result.kind == IR_VALUE_LOCAL) {
+            state->locals[instruction->result.name] = location;
+        }
+        return 0;
+    }
+    case IR_LOAD: {
+        X86Memory memory = emit_address(state, &operands[0]);
+        emit_load(backend, instruction->type, memory);
+        store_result(state, &instruction->result);
+        return 0;
+    }
+    case IR_STORE: {
+        const X86Location* location = find_location(state, &operands[1]);
+        X86Memory memory = {0, 0};
+        if (location && location->is_address) {
+            memory.in_frame = 1;
+            memory.offset = location->offset;
+        } else {
+            emit_value(state, &operands[1]);
+            emit_mov_reg(backend, RCX, RAX);
+        }
+        emit_operand(state, &operands[0], instruction->type);
+        emit_store(backend, instruction->type, memory);
+        return 0;
+    }
+    case IR_GEP:
+        if (has_unknown_layout(instruction->type)) {
+            backend_error(backend, "Layout of '%s' is unknown",
+                          canonical_type_name(instruction->type));
+            return 0;
+        }
+        emit_value(state, &operands[0]);
+        emit_gep(state, instruction);
+        store_result(state, &instruction->result);
+        return 0;
+    case IR_BINARY:
+        emit_operand_pair(state, instruction);
+        emit_binary(backend, instruction->op);
+        emit_normalize(backend, value_bits(instruction->type));
+        store_result(state, &instruction->result);
+        return 0;
+    case IR_ICMP:
+        emit_operand_pair(state, instruction);
+        emit(backend, {0x48, 0x39, 0xC8}); /* cmp rax, rcx */
+        emit(backend, {0x0F, condition_code(instruction->op), 0xC0});
+        emit(backend, {0x0F, 0xB6, 0xC0}); /* movzx eax, al */
+        store_result(state, &instruction->result);
+        return 0;
+    case IR_CAST: {
+        const TypeInfo* from = operands[0].type;
+        emit_value(state, &operands[0]);
+        int from_bits = value_bits(from);
+        if (instruction->op == IR_ZEXT && value_class(from) == CLASS_INTEGER &&
+            value_class(instruction->type) == CLASS_INTEGER &&
+            from_bits < value_bits(instruction->type)) {
+            if (from_bits == 8) {
+                emit(backend, {0x0F, 0xB6, 0xC0}); /* movzx eax, al */
+            } else if (from_bits == 16) {
+                emit(backend, {0x0F, 0xB7, 0xC0}); /* movzx eax, ax */
+            } else if (from_bits == 32) {
+                emit(backend, {0x89, 0xC0}); /* mov eax, eax */
+            }
+        } else {
+            emit_convert(backend, from, instruction->type);
+        }
+        store_result(state, &instruction->result);
+        return 0;
+    }
+    case IR_PHI:
+        /* Set by the predecessors, see emit_phi_moves */
+        result_location(state, &instruction->result);
+        return 0;
+    case IR_CALL:
+        emit_call(state, instruction);
+        return 0;
+    case IR_BR:
+        emit_jump(state, instruction->blocks[0]);
+        return 1;
+    case IR_COND_BR: {
+        /* Branch conditions compare against zero; floats as integers */
+        emit_operand(state, &operands[0],
+                     value_class(operands[0].type) == CLASS_INTEGER
+                         ? operands[0].type
+                         : NULL);
+        emit(backend, {0x48, 0x85, 0xC0}); /* test rax, rax */
+        emit(backend, {0x0F, 0x84});       /* je else */
+        size_t else_branch = backend->text.size();
+        emit_u32(backend, 0);
+        emit_jump(state, instruction->blocks[0]);
+        put_u32(backend->text, else_branch,
+                (uint32_t)(backend->text.size() - (else_branch + 4)));
+        emit_jump(state, instruction->blocks[1]);
+        return 1;
+    }
+    case IR_SWITCH:
+        emit_switch(state, instruction);
+        return 1;
+    case IR_RET:
+        if (!state->return_type || state->return_type->base_type == TYPE_VOID) {
+            emit_epilogue(backend);
+        } else if (instruction->operand_count == 0) {
+            emit_default_return(state);
+        } else {
+            emit_operand(state, &operands[0], state->return_type);
+            int return_class = value_class(state->return_type);
+            if (return_class != CLASS_INTEGER) {
+                emit_xmm_move(backend, 0, return_class == CLASS_DOUBLE, 1);
+            }
+            emit_epilogue(backend);
+        }
+        return 1;
+    case IR_COMMENT:
+        return 0;
+    }
+    return 0;
+}
+
+/* Functions */
+
+static void add_prototype(X86Backend* backend, const char* name,
+                          TypeInfo* return_type, TypeInfo* const* parameters,
+                          int count, int is_variadic) {
+    X86Prototype prototype;
+    prototype.return_type = type_table_canonical(&backend->types, return_type);
+    for (int i = 0; i < count; i++) {
+        prototype.parameters.push_back(
+            type_table_canonical(&backend->types, parameters[i]));
+    }
+    prototype.is_variadic = is_variadic;
+    backend->prototypes[name] = prototype;
+}
+
+/* Parameters from their registers or the caller's frame into slots */
+static void store_parameters(X86FunctionState* state,
+                             const IRFunction* function) {
+    X86Backend* backend = state->backend;
+    int integer_count = 0;
+    int float_count = 0;
+    int stack_offset = 16; /* Past the saved rbp and the return address */
+    for (int i = 0; i < function->parameter_count; i++) {
+        const IRValue* parameter = &function->parameters[i];
+        int parameter_class = value_class(parameter->type);
+        if (parameter_class == CLASS_INTEGER && integer_count < 6) {
+            emit_mov_reg(backend, RAX, argument_registers[integer_count++]);
+            emit_normalize(backend, value_bits(parameter->type));
+        } else if (parameter_class != CLASS_INTEGER && float_count < 8) {
+            emit_xmm_move(backend, float_count++,
+                          parameter_class == CLASS_DOUBLE, 0);
+        } else {
+            emit_frame_op(backend, 0x8B, RAX, stack_offset);
+            stack_offset += 8;
+            if (parameter_class == CLASS_INTEGER) {
+                emit_normalize(backend, value_bits(parameter->type));
+            }
+        }
+        X86Location location = new_slot(state, 8);
+        state->locals[parameter->name] = location;
+        emit_frame_op(backend, 0x89, RAX, location.offset);
+    }
+}
+
+static void add_function(void* data, const IRFunction* function) {
+    auto backend = static_cast<X86Backend*>(data);
+    if (!function->name)
+        return;
+
+    int index = symbol_for(backend, function->name);
+    if (backend->symbols[index].section != SECTION_UNDEFINED) {
+        backend_error(backend, "Redefinition of function '%s'",
+                      function->name);
+        return;
+    }
+    std::vector<TypeInfo*> parameter_types;
+    for (int i = 0; i < function->parameter_count; i++) {
+        parameter_types.push_back(function->parameters[i].type);
+    }
+    add_prototype(backend, function->name, function->return_type,
+                  parameter_types.data(), function->parameter_count, 0);
+
+    /* Functions start 16-byte aligned */
+    while (backend->text.size() % 16) {
+        emit(backend, {0x90});
+    }
+    size_t start = backend->text.size();
+
+    X86FunctionState state;
+    state.backend = backend;
+    state.return_type = function->return_type;
+    state.frame_size = 0;
+    state.current_block = 0;
+
+    emit(backend, {0x55, 0x48, 0x89, 0xE5}); /* push rbp; mov rbp, rsp */
+    emit(backend, {0x48, 0x81, 0xEC});       /* sub rsp, frame size */
+    state.frame_size_offset = backend->text.size();
+    emit_u32(backend, 0);
+    store_parameters(&state, function);
+
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        for (const IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            if (instruction->opcode == IR_PHI)
+                state.phis[block->id].push_back(instruction);
+        }
+    }
+    if (!function->first_block)
+        emit_default_return(&state);
+
+    for (const IRBlock* block = function->first_block; block;
+         block = block->next) {
+        state.blocks.emplace(block->id, backend->text.size());
+        state.current_block = block->id;
+        int terminated = 0;
+        for (const IRInstruction* instruction = block->first; instruction;
+             instruction = instruction->next) {
+            /* Code after a branch or return is unreachable but harmless */
+            terminated = lower_instruction(&state, instruction);
+        }
+        /* A block without terminator falls through to the next one */
+        if (!terminated) {
+            if (block->next) {
+                emit_phi_moves(&state, block->next->id);
+            } else {
+                emit_default_return(&state);
+            }
+        }
+    }
+
+    /* Branch targets that were never laid out trap */
+    size_t trap = 0;
+    for (auto& branch : state.branches) {
+        auto target = state.blocks.find(branch.second);
+        size_t offset;
+        if (target != state.blocks.end()) {
+            offset = target->second;
+        } else {
+            if (!trap) {
+                trap = backend->text.size();
+                emit(backend, {0x0F, 0x0B}); /* ud2 */
+            }
+            offset = trap;
+        }
+        put_u32(backend->text, branch.first,
+                (uint32_t)(offset - (branch.first + 4)));
+    }
+    put_u32(backend->text, state.frame_size_offset,
+            (uint32_t)((state.frame_size + 15) & ~15));
+
+    X86Symbol& symbol = backend->symbols[index];
+    symbol.section = SECTION_TEXT;
+    symbol.value = start;
+    symbol.size = backend->text.size() - start;
+    symbol.is_function = 1;
+    symbol.is_local = strncmp(function->linkage, "internal", 8) == 0;
+}
+
+/* Globals */
+
+/* Little-endian bytes of a constant initializer for type */
+static void append_constant(X86Backend* backend, std::vector<uint8_t>& out,
+                            const TypeInfo* type, long long constant) {
+    uint64_t bits = (uint64_t)constant_bits_of(type, constant);
+    int size = type_size(backend, type);
+    for (int i = 0; i < size; i++) {
+        out.push_back(i < 8 ? (uint8_t)(bits >> (8 * i)) : 0);
+    }
+}
+
+static void add_global(void* data, const IRGlobal* global) {
+    auto backend = static_cast<X86Backend*>(data);
+
+    switch (global->kind) {
+    case IR_GLOBAL_DECLARATION:
+        if (!backend->prototypes.count(global->name)) {
+            add_prototype(backend, global->name, global->type,
+                          global->parameter_types, global->parameter_count,
+                          global->is_variadic);
+        }
+        break;
+    case IR_GLOBAL_VARIABLE: {
+        int index = symbol_for(backend, global->name);
+        if (backend->symbols[index].section != SECTION_UNDEFINED)
+            break; /* A tentative definition */
+        if (has_unknown_layout(global->type)) {
+            backend_error(backend, "Layout of '%s' is unknown",
+                          canonical_type_name(global->type));
+            break;
+        }
+
+        int size = type_size(backend, global->type);
+        int alignment = size >= 8 ? 8 : size >= 4 ? 4 : size >= 2 ? 2 : 1;
+        while (backend->data.size() % alignment) {
+            backend->data.push_back(0);
+        }
+        size_t start = backend->data.size();
+        if (global->has_constant) {
+            append_constant(backend, backend->data, global->type,
+                            global->constant);
+        } else if (global->bytes) {
+            backend->data.insert(backend->data.end(), global->bytes,
+                                 global->bytes + global->length);
+        }
+        backend->data.resize(start + size, 0);
+
+        X86Symbol& symbol = backend->symbols[index];
+        symbol.section = SECTION_DATA;
+        symbol.value = start;
+        symbol.size = (uint64_t)size;
+        symbol.is_local = strncmp(global->linkage, "internal", 8) == 0;
+        break;
+    }
+    case IR_GLOBAL_EXTERNAL:
+        break; /* Referenced symbols are made on use */
+    case IR_GLOBAL_STRING: {
+        X86Symbol& symbol =
+            backend->symbols[symbol_for(backend, global->name)];
+        symbol.section = SECTION_RODATA;
+        symbol.value = backend->rodata.size();
+        symbol.size = global->length + 1;
+        symbol.is_local = 1;
+        backend->rodata.insert(backend->rodata.end(), global->bytes,
+                               global->bytes + global->length);
+        backend->rodata.push_back(0);
+        break;
+    }
+    }
+}
+
+/* ELF output */
+
+/* Little-endian; size is at most 8 */
+static void put(std::vector<uint8_t>& out, uint64_t value, int size) {
+    for (int i = 0; i < size; i++) {
+        out.push_back((uint8_t)(value >> (8 * i)));
+    }
+}
+
+static uint32_t add_string(std::string& table, const std::string& name) {
+    uint32_t offset = (uint32_t)table.size();
+    table += name;
+    table += '\0';
+    return offset;
+}
+
+typedef struct X86SectionHeader {
+    uint32_t name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+    uint32_t info;
+    uint64_t alignment;
+    uint64_t entry_size;
+} X86SectionHeader;
+
+static std::vector<uint8_t> build_object(X86Backend* backend) {
+    /* Symbol table: locals first, as ELF requires */
+    std::vector<int> order;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < backend->symbols.size(); i++) {
+            const X86Symbol& symbol = backend->symbols[i];
+            int is_local =
+                symbol.is_local && symbol.section != SECTION_UNDEFINED;
+            if (is_local == (pass == 0))
+                order.push_back((int)i);
+        }
+    }
+    std::vector<uint32_t> elf_index(backend->symbols.size());
+    std::vector<uint8_t> symtab;
+    std::string strtab(1, '\0');
+    symtab.insert(symtab.end(), 24, 0); /* Null symbol */
+    uint32_t first_global = 1;
+    for (size_t i = 0; i < order.size(); i++) {
+        const X86Symbol& symbol = backend->symbols[order[i]];
+        int is_local = symbol.is_local && symbol.section != SECTION_UNDEFINED;
+        int type = symbol.section == SECTION_UNDEFINED ? STT_NOTYPE
+                   : symbol.is_function                ? STT_FUNC
+                                                       : STT_OBJECT;
+        elf_index[order[i]] = (uint32_t)(i + 1);
+        if (is_local)
+            first_global = (uint32_t)(i + 2);
+        put(symtab, add_string(strtab, symbol.name), 4);
+        put(symtab, ((is_local ? STB_LOCAL : STB_GLOBAL) << 4) | type, 1);
+        put(symtab, 0, 1);
+        put(symtab, (uint64_t)symbol.section, 2);
+        put(symtab, symbol.value, 8);
+        put(symtab, symbol.size, 8);
+    }
+
+    /* Address loads of symbols defined here become lea */
+    std::vector<uint8_t> rela;
+    for (const X86Relocation& relocation : backend->relocations) {
+        int type = R_X86_64_PLT32;
+        if (relocation.kind == RELOCATION_ADDRESS) {
+            if (backend->symbols[relocation.symbol].section !=
+                SECTION_UNDEFINED) {
+                backend->text[relocation.offset - 2] = 0x8D;
+                type = R_X86_64_PC32;
+            } else {
+                type = R_X86_64_GOTPCREL;
+            }
+        }
+        put(rela, relocation.offset, 8);
+        put(rela, ((uint64_t)elf_index[relocation.symbol] << 32) | type, 8);
+        put(rela, (uint64_t)-4, 8);
+    }
+
+    std::string shstrtab(1, '\0');
+    X86SectionHeader headers[SECTION_COUNT];
+    memset(headers, 0, sizeof(headers));
+    const std::vector<uint8_t>* contents[SECTION_COUNT] = {NULL};
+    std::vector<uint8_t> strtab_bytes(strtab.begin(), strtab.end());
+
+    struct {
+        int index;
+        const char* name;
+        uint32_t type;
+        uint64_t flags;
+        const std::vector<uint8_t>* bytes;
+        uint64_t alignment;
+    } layout[] = {
+        {SECTION_TEXT, ".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR,
+         &backend->text, 16},
+        {SECTION_DATA, ".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE,
+         &backend->data, 8},
+        {SECTION_RODATA, ".rodata", SHT_PROGBITS, SHF_ALLOC, &backend->rodata,
+         1},
+        {SECTION_RELA_TEXT, ".rela.text", SHT_RELA, SHF_INFO_LINK, &rela, 8},
+        {SECTION_SYMTAB, ".symtab", SHT_SYMTAB, 0, &symtab, 8},
+        {SECTION_STRTAB, ".strtab", SHT_STRTAB, 0, &strtab_bytes, 1},
+        {SECTION_SHSTRTAB, ".shstrtab", SHT_STRTAB, 0, NULL, 1},
+        {SECTION_NOTE_STACK, ".note.GNU-stack", SHT_PROGBITS, 0, NULL, 1},
+    };
+    for (auto& section : layout) {
+        X86SectionHeader& header = headers[section.index];
+        header.name = add_string(shstrtab, section.name);
+        header.type = section.type;
+        header.flags = section.flags;
+        header.alignment = section.alignment;
+        contents[section.index] = section.bytes;
+    }
+    std::vector<uint8_t> shstrtab_bytes(shstrtab.begin(), shstrtab.end());
+    contents[SECTION_SHSTRTAB] = &shstrtab_bytes;
+    headers[SECTION_RELA_TEXT].link = SECTION_SYMTAB;
+    headers[SECTION_RELA_TEXT].info = SECTION_TEXT;
+    headers[SECTION_RELA_TEXT].entry_size = 24;
+    headers[SECTION_SYMTAB].link = SECTION_STRTAB;
+    headers[SECTION_SYMTAB].info = first_global;
+    headers[SECTION_SYMTAB].entry_size = 24;
+
+    /* ELF header, section contents, then the section header table */
+    std::vector<uint8_t> object(64, 0);
+    for (int i = 1; i < SECTION_COUNT; i++) {
+        if (!contents[i])
+            continue;
+        while (object.size() % headers[i].alignment) {
+            object.push_back(0);
+        }
+        headers[i].offset = object.size();
+        headers[i].size = contents[i]->size();
+        object.insert(object.end(), contents[i]->begin(), contents[i]->end());
+    }
+    while (object.size() % 8) {
+        object.push_back(0);
+    }
+    uint64_t section_headers = object.size();
+    for (int i = 0; i < SECTION_COUNT; i++) {
+        const X86SectionHeader& header = headers[i];
+        put(object, header.name, 4);
+        put(object, header.type, 4);
+        put(object, header.flags, 8);
+        put(object, 0, 8); /* Address */
+        put(object, header.offset, 8);
+        put(object, header.size, 8);
+        put(object, header.link, 4);
+        put(object, header.info, 4);
+        put(object, header.alignment, 8);
+        put(object, header.entry_size, 8);
+    }
+
+    std::vector<uint8_t> header;
+    static const uint8_t ident[16] = {0x7F, 'E', 'L', 'F', 2 /* 64-bit */,
+                                      1 /* Little-endian */, 1 /* Version */};
+    header.insert(header.end(), ident, ident + 16);
+    put(header, 1, 2);  /* ET_REL */
+    put(header, 62, 2); /* EM_X86_64 */
+    put(header, 1, 4);  /* Version */
+    put(header, 0, 8);  /* Entry */
+    put(header, 0, 8);  /* Program headers */
+    put(header, section_headers, 8);
+    put(header, 0, 4);  /* Flags */
+    put(header, 64, 2); /* ELF header size */
+    put(header, 0, 2);  /* Program header entry size */
+    put(header, 0, 2);  /* Program header count */
+    put(header, 64, 2); /* Section header entry size */
+    put(header, SECTION_COUNT, 2);
+    put(header, SECTION_SHSTRTAB, 2);
+    memcpy(object.data(), header.data(), header.size());
+    return object;
+}
+
+/* Public interface */
+
+X86Backend* x86_backend_create(void) {
+    auto backend = new X86Backend();
+    backend->consumer.data = backend;
+    backend->consumer.add_global = add_global;
+    backend->consumer.add_function = add_function;
+    backend->target = target_lookup("x86_64-pc-linux-gnu");
+    backend->error_count = 0;
+    return backend;
+}
+
+void x86_backend_attach(X86Backend* backend, CodeGenContext* ctx) {
+    ctx->consumer = &backend->consumer;
+    ctx->target = backend->target;
+}
+
+int x86_backend_write_object(X86Backend* backend, const char* path) {
+    if (backend->error_count > 0)
+        return -1;
+
+    std::vector<uint8_t> object = build_object(backend);
+    FILE* out = fopen(path, "wb");
+    if (!out) {
+        fprintf(stderr, "Error: Cannot open output file '%s'\n", path);
+        return -1;
+    }
+    int result =
+        fwrite(object.data(), 1, object.size(), out) == object.size() ? 0 : -1;
+    if (fclose(out) != 0)
+        result = -1;
+    if (result != 0)
+        fprintf(stderr, "Error: Failed to write object file\n");
+    return result;
+}
+
+void x86_backend_free(X86Backend* backend) {
+    if (!backend)
+        return;
+    type_table_free(&backend->types);
+    delete backend;
+}
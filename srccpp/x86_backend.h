@@ -0,0 +1,34 @@
+#ifndef X86_BACKEND_H
+#define X86_BACKEND_H
+
+extern "C" {
+
+#include "codegen.h"
+
+/*
+ * Native x86-64 backend (--backend=x86-64).
+ *
+ * A single pass over each function as lowering finishes it: every value
+ * gets a stack slot, and each instruction loads its operands into rax and
+ * rcx, computes, and stores the result back. Integers are kept
+ * sign-extended to 64 bits in their slots, so that implicit widenings in
+ * the IR cost nothing. Calls follow the System V ABI. The machine code,
+ * module globals and string constants go into an ELF64 relocatable object
+ * with symbol and relocation tables for the system linker. There is no
+ * optimization, and no libLLVM is needed; it is meant for fast debug
+ * builds.
+ */
+
+typedef struct X86Backend X86Backend;
+
+X86Backend* x86_backend_create(void);
+/* Route everything ctx generates from now on to backend; ctx's target
+ * becomes x86_64 Linux */
+void x86_backend_attach(X86Backend* backend, CodeGenContext* ctx);
+/* Write the object file to path; returns 0 on success, else reports to
+ * stderr */
+int x86_backend_write_object(X86Backend* backend, const char* path);
+void x86_backend_free(X86Backend* backend);
+}
+
+#endif /* X86_BACKEND_H */
@@ -30,6 +30,7 @@ int printf(const char* format, ...);
 int fprintf(FILE* stream, const char* format, ...);
 int sprintf(char* str, const char* format, ...);
 int vfprintf(FILE* stream, const char* format, va_list ap);
+int vsnprintf(char* str, size_t size, const char* format, va_list ap);
 FILE* fopen(const char* filename, const char* mode);
 int fclose(FILE* stream);
 int fputs(const char* s, FILE* stream);
@@ -0,0 +1 @@
+struct Outer { char a; struct Inner { int x; } b; }; int main() { return 0; }
\ No newline at end of file
@@ -0,0 +1,19 @@
+/* Calls after earlier definitions take the callee's parameter and return
+ * types, including when the callee's body has already been compiled */
+
+int scale(int value, int factor) {
+    return value * factor;
+}
+
+long widen(long value) {
+    return value + 1;
+}
+
+int pick(int x) {
+    int y = 7;
+    return (x > 3 ? 1 : 2) + y;
+}
+
+int main() {
+    return pick(1000) + scale(300, 2) / 100 + widen(40) - 40;
+}
@@ -0,0 +1,32 @@
+/* Locals declared inside loop bodies, one of them shadowing an outer
+ * variable: each gets one stack slot for the whole call */
+
+int acc = 0;
+
+int add_to_acc(int value) {
+    acc = acc + value;
+    return acc + 0;
+}
+
+int sum_squares(int n) {
+    int total = 0;
+    int i;
+    for (i = 0; i < n; i = i + 1) {
+        int square = i * i;
+        int total = square % 7;
+        if (total > 3)
+            square = square + total;
+        add_to_acc(square);
+    }
+    return total + 0;
+}
+
+int main() {
+    int count;
+    for (count = 0; count < 1000000;) {
+        int step = 1;
+        count = count + step;
+    }
+    sum_squares(1000);
+    return (count - 1000000) + (acc - 332834644);
+}
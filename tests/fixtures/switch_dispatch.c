@@ -0,0 +1,116 @@
+/* A bytecode interpreter loop: the dense opcode switch becomes a jump
+ * table, and DUP falls through into PUSH1 */
+
+/* The program 1 5 1 7 3 4 6 2 5 0 9 0 */
+int fetch(int pc) {
+    int op = 0;
+    switch (pc) {
+    case 0:
+    case 2:
+        op = 1;
+        break;
+    case 1:
+    case 8:
+        op = 5;
+        break;
+    case 3:
+        op = 7;
+        break;
+    case 4:
+        op = 3;
+        break;
+    case 5:
+        op = 4;
+        break;
+    case 6:
+        op = 6;
+        break;
+    case 7:
+        op = 2;
+        break;
+    case 10:
+        op = 9;
+        break;
+    }
+    return op + 0;
+}
+
+int run(int steps) {
+    int acc = 0;
+    int pc = 0;
+    int executed = 0;
+    for (executed = 0; executed < steps; executed = executed + 1) {
+        switch (fetch(pc)) {
+        case 0:
+            pc = 0;
+            break;
+        case 1:
+            acc = acc + fetch(pc + 1);
+            pc = pc + 2;
+            break;
+        case 2:
+            acc = acc - 3;
+            pc = pc + 1;
+            break;
+        case 3:
+            acc = acc * 2;
+            pc = pc + 1;
+            break;
+        case 4:
+            acc = acc % 1000;
+        case 5:
+            acc = acc + 1;
+            pc = pc + 1;
+            break;
+        case 6:
+            acc = acc ^ 5;
+            pc = pc + 1;
+            break;
+        default:
+            acc = acc + 100;
+            pc = pc + 1;
+        }
+    }
+    return acc + 0;
+}
+
+int classify(int c) {
+    switch (c) {
+    case 10:
+    case 20:
+        return 1;
+    case 1000:
+        return 2;
+    case -7:
+        return 3;
+    }
+    return 0;
+}
+
+/* A braced case body ends in its own break; the statement after the
+ * switch still runs on every iteration */
+int tally() {
+    int i;
+    int n = 0;
+    for (i = 0; i < 3; i = i + 1) {
+        switch (i) {
+        case 0: {
+            n = n + 1;
+        } break;
+        case 1:
+            n = n + 10;
+            break;
+        default: {
+            n = n + 100;
+        }
+        }
+        n = n + 1000;
+    }
+    return n + 0;
+}
+
+int main() {
+    int checks = classify(10) + classify(20) * 10 + classify(1000) * 100 +
+                 classify(-7) * 1000 + classify(3) * 10000;
+    return (run(1000000) - 254) + (checks - 3211) + (tally() - 3111);
+}
@@ -0,0 +1,9 @@
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+define i32 @main() {
+ret i32 10
+}
+declare i32 @printf(ptr, ...)
+declare i32 @scanf(ptr, ...)
+declare ptr @malloc(i64)
+declare void @free(ptr)
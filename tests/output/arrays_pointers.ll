@@ -0,0 +1,83 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @test_arrays() {
+  %val0 = alloca i32
+  %val1 = alloca i32
+  %val2 = alloca i32
+  %val3 = alloca i32
+  %sum = alloca i32
+  %product = alloca i32
+  %complex = alloca i32
+  store i32 100, i32* %val0
+  store i32 200, i32* %val1
+  store i32 300, i32* %val2
+  store i32 400, i32* %val3
+  %1 = load i32, i32* %val0
+  %2 = load i32, i32* %val1
+  %3 = add i32 %1, %2
+  store i32 %3, i32* %sum
+  %4 = load i32, i32* %val2
+  %5 = load i32, i32* %val3
+  %6 = mul i32 %4, %5
+  store i32 %6, i32* %product
+  %7 = load i32, i32* %val0
+  %8 = srem i32 %7, 5
+  %9 = load i32, i32* %val1
+  %10 = srem i32 %9, 5
+  %11 = add i32 %8, %10
+  store i32 %11, i32* %complex
+  %12 = load i32, i32* %sum
+  %13 = load i32, i32* %product
+  %14 = add i32 %12, %13
+  %15 = load i32, i32* %complex
+  %16 = add i32 %14, %15
+  ret i32 %16
+  }
+
+define i32 @test_sizeof() {
+  %x = alloca i32
+  %y = alloca i32
+  %z = alloca i32
+  %w = alloca i32
+  %a = alloca i32
+  %size_of_expr = alloca i32
+  %size_of_complex = alloca i32
+  store i32 4, i32* %x
+  store i32 1, i32* %y
+  store i32 4, i32* %z
+  store i32 8, i32* %w
+  store i32 42, i32* %a
+  store i32 4, i32* %size_of_expr
+  store i32 4, i32* %size_of_complex
+  %1 = load i32, i32* %x
+  %2 = load i32, i32* %y
+  %3 = add i32 %1, %2
+  %4 = load i32, i32* %z
+  %5 = add i32 %3, %4
+  %6 = load i32, i32* %w
+  %7 = add i32 %5, %6
+  %8 = load i32, i32* %size_of_expr
+  %9 = add i32 %7, %8
+  %10 = load i32, i32* %size_of_complex
+  %11 = add i32 %9, %10
+  ret i32 %11
+  }
+
+define i32 @test_address_deref() {
+  %x = alloca i32
+  %value = alloca i32
+  store i32 100, i32* %x
+  store i32 %x, i32* %value
+  ret i32 %value
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,61 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @test_bitwise() {
+  %a = alloca i32
+  %b = alloca i32
+  %c = alloca i32
+  %d = alloca i32
+  %e = alloca i32
+  %f = alloca i32
+  %g = alloca i32
+  %h = alloca i32
+  store i32 5, i32* %a
+  store i32 3, i32* %b
+  %1 = load i32, i32* %a
+  %2 = load i32, i32* %b
+  %3 = and i32 %1, %2
+  store i32 %3, i32* %c
+  %4 = load i32, i32* %a
+  %5 = load i32, i32* %b
+  %6 = or i32 %4, %5
+  store i32 %6, i32* %d
+  %7 = load i32, i32* %a
+  %8 = load i32, i32* %b
+  %9 = xor i32 %7, %8
+  store i32 %9, i32* %e
+  %10 = load i32, i32* %a
+  %11 = xor i32 %10, -1
+  store i32 %11, i32* %f
+  %12 = load i32, i32* %a
+  %13 = shl i32 %12, 1
+  store i32 %13, i32* %g
+  %14 = load i32, i32* %a
+  %15 = ashr i32 %14, 1
+  store i32 %15, i32* %h
+  %16 = load i32, i32* %c
+  %17 = load i32, i32* %d
+  %18 = add i32 %16, %17
+  %19 = load i32, i32* %e
+  %20 = add i32 %18, %19
+  %21 = load i32, i32* %g
+  %22 = add i32 %20, %21
+  %23 = load i32, i32* %h
+  %24 = add i32 %22, %23
+  ret i32 %24
+  }
+
+define i32 @main() {
+  %1 = call i32 @test_bitwise()
+  ret i32 %1
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,53 @@
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+define i32 @test_bitwise() {
+%a = alloca i32
+%b = alloca i32
+%c = alloca i32
+%d = alloca i32
+%e = alloca i32
+%f = alloca i32
+%g = alloca i32
+%h = alloca i32
+store i32 5, ptr %a
+store i32 3, ptr %b
+%1 = load i32, ptr %a
+%2 = load i32, ptr %b
+%3 = and i32 %1, %2
+store i32 %3, ptr %c
+%4 = load i32, ptr %a
+%5 = load i32, ptr %b
+%6 = or i32 %4, %5
+store i32 %6, ptr %d
+%7 = load i32, ptr %a
+%8 = load i32, ptr %b
+%9 = xor i32 %7, %8
+store i32 %9, ptr %e
+%10 = load i32, ptr %a
+%11 = xor i32 %10, -1
+store i32 %11, ptr %f
+%12 = load i32, ptr %a
+%13 = shl i32 %12, 1
+store i32 %13, ptr %g
+%14 = load i32, ptr %a
+%15 = ashr i32 %14, 1
+store i32 %15, ptr %h
+%16 = load i32, ptr %c
+%17 = load i32, ptr %d
+%18 = add i32 %16, %17
+%19 = load i32, ptr %e
+%20 = add i32 %18, %19
+%21 = load i32, ptr %g
+%22 = add i32 %20, %21
+%23 = load i32, ptr %h
+%24 = add i32 %22, %23
+ret i32 %24
+}
+define i32 @main() {
+%1 = call i32 @test_bitwise()
+ret i32 %1
+}
+declare i32 @printf(ptr, ...)
+declare i32 @scanf(ptr, ...)
+declare ptr @malloc(i64)
+declare void @free(ptr)
@@ -0,0 +1,31 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @test_bitwise() {
+  %1 = and i32 5, 3
+  %2 = or i32 5, 3
+  %3 = xor i32 5, 3
+  %4 = xor i32 5, -1
+  %5 = shl i32 5, 1
+  %6 = ashr i32 5, 1
+  %7 = add i32 %1, %2
+  %8 = add i32 %7, %3
+  %9 = add i32 %8, %5
+  %10 = add i32 %9, %6
+  ret i32 %10
+  }
+
+define i32 @main() {
+  %1 = call i32 @test_bitwise()
+  ret i32 %1
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
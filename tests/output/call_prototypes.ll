@@ -0,0 +1,49 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @scale(i32 %value, i32 %factor) {
+  %1 = mul i32 %value, %factor
+  ret i32 %1
+  }
+
+define i64 @widen(i32 %value) {
+  %1 = add i32 %value, 1
+  ret i32 %1
+  }
+
+define i32 @pick(i32 %x) {
+  %y = alloca i32
+  store i32 7, i32* %y
+  %1 = icmp sgt i32 %x, 3
+  br i1 %1, label %bb1, label %bb2
+bb1:
+  br label %bb3
+bb2:
+  br label %bb3
+bb3:
+  %2 = phi i32 [ 1, %bb1 ], [ 2, %bb2 ]
+  %3 = load i32, i32* %y
+  %4 = add i32 %2, %3
+  ret i32 %4
+  }
+
+define i32 @main() {
+  %1 = call i32 @pick(i32 1000)
+  %2 = call i32 @scale(i32 300, i32 2)
+  %3 = sdiv i32 %2, 100
+  %4 = add i32 %1, %3
+  %5 = call i32 @widen(i32 40)
+  %6 = add i32 %4, %5
+  %7 = sub i32 %6, 40
+  ret i32 %7
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
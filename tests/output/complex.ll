@@ -0,0 +1,207 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @add(i32 %a, i32 %b) {
+  %1 = add i32 %a, %b
+  ret i32 %1
+  }
+
+define i32 @multiply(i32 %a, i32 %b) {
+  %1 = mul i32 %a, %b
+  ret i32 %1
+  }
+
+define i32 @nested_calls() {
+  %1 = call i32 @multiply(i32 2, i32 3)
+  %2 = call i32 @add(i32 4, i32 5)
+  %3 = call i32 @add(i32 %1, i32 %2)
+  ret i32 %3
+  }
+
+define i32 @complex_expressions(i32 %x, i32 %y) {
+  %result1 = alloca i32
+  %result2 = alloca i32
+  %result3 = alloca i32
+  %result4 = alloca i32
+  %1 = add i32 %x, %y
+  %2 = sub i32 %x, %y
+  %3 = mul i32 %1, %2
+  %4 = mul i32 %x, 2
+  %5 = sdiv i32 %y, 2
+  %6 = add i32 %4, %5
+  %7 = sdiv i32 %3, %6
+  store i32 %7, i32* %result1
+  %8 = mul i32 %y, 2
+  %9 = add i32 %x, %8
+  %10 = sdiv i32 %x, 3
+  %11 = sub i32 %9, %10
+  %12 = srem i32 %y, 4
+  %13 = add i32 %11, %12
+  store i32 %13, i32* %result2
+  %14 = icmp sgt i32 %x, %y
+  %15 = zext i1 %14 to i32
+  store i32 %15, i32* %result3
+  store i32 0, i32* %result4
+  ; if statement
+  %16 = icmp sgt i32 %x, %y
+  br i1 %16, label %bb1, label %bb2
+bb1:
+  %17 = mul i32 %x, 2
+  store i32 %17, i32* %result4
+  br label %bb3
+bb2:
+  %18 = add i32 %y, 10
+  store i32 %18, i32* %result4
+  br label %bb3
+bb3:
+  %19 = load i32, i32* %result1
+  %20 = load i32, i32* %result2
+  %21 = add i32 %19, %20
+  %22 = load i32, i32* %result3
+  %23 = add i32 %21, %22
+  %24 = load i32, i32* %result4
+  %25 = add i32 %23, %24
+  ret i32 %25
+  }
+
+define i32 @test_scoping() {
+  %x = alloca i32
+  %y = alloca i32
+  %x.1 = alloca i32
+  %z = alloca i32
+  %result = alloca i32
+  %w = alloca i32
+  store i32 10, i32* %x
+  store i32 20, i32* %y
+  store i32 30, i32* %x.1
+  store i32 40, i32* %z
+  %1 = load i32, i32* %x.1
+  %2 = load i32, i32* %y
+  %3 = add i32 %1, %2
+  %4 = load i32, i32* %z
+  %5 = add i32 %3, %4
+  store i32 %5, i32* %result
+  ; if statement
+  %6 = load i32, i32* %result
+  %7 = icmp sgt i32 %6, 80
+  br i1 %7, label %bb1, label %bb2
+bb1:
+  store i32 50, i32* %w
+  %8 = load i32, i32* %result
+  %9 = load i32, i32* %w
+  %10 = add i32 %8, %9
+  store i32 %10, i32* %result
+  br label %bb3
+bb2:
+  br label %bb3
+bb3:
+  ret i32 %result
+  }
+
+define i32 @test_increment_decrement() {
+  %x = alloca i32
+  %y = alloca i32
+  %a = alloca i32
+  %b = alloca i32
+  %result = alloca i32
+  store i32 10, i32* %x
+  store i32 20, i32* %y
+  %1 = load i32, i32* %x
+  %2 = add i32 %1, 1
+  store i32 %2, i32* %x
+  %3 = load i32, i32* %y
+  %4 = sub i32 %3, 1
+  store i32 %4, i32* %y
+  %5 = load i32, i32* %x
+  store i32 %5, i32* %a
+  %6 = load i32, i32* %y
+  store i32 %6, i32* %b
+  %7 = load i32, i32* %x
+  %8 = load i32, i32* %y
+  %9 = add i32 %7, %8
+  store i32 %9, i32* %result
+  %10 = load i32, i32* %a
+  %11 = load i32, i32* %b
+  %12 = add i32 %10, %11
+  %13 = load i32, i32* %result
+  %14 = add i32 %12, %13
+  ret i32 %14
+  }
+
+define i32 @test_strings() {
+  %result = alloca i32
+  store i32 42, i32* %result
+  ret i32 %result
+  }
+
+define i32 @test_empty() {
+  %i = alloca i32
+  ; if statement
+  br label %bb1
+bb1:
+  br label %bb3
+bb2:
+  br label %bb3
+bb3:
+  ; while statement
+  br label %bb4
+bb4:
+  br label %bb6
+bb5:
+  br label %bb4
+bb6:
+  store i32 0, i32* %i
+  ; while statement
+  br label %bb7
+bb7:
+  %1 = load i32, i32* %i
+  %2 = icmp slt i32 %1, 1
+  br i1 %2, label %bb8, label %bb9
+bb8:
+  %3 = load i32, i32* %i
+  %4 = add i32 %3, 1
+  store i32 %4, i32* %i
+  br label %bb7
+bb9:
+  ret i32 0
+  }
+
+define i32 @main() {
+  %result = alloca i32
+  store i32 0, i32* %result
+  %1 = call i32 @nested_calls()
+  %2 = load i32, i32* %result
+  %3 = add i32 %2, %1
+  store i32 %3, i32* %result
+  %4 = call i32 @complex_expressions(i32 10, i32 5)
+  %5 = load i32, i32* %result
+  %6 = add i32 %5, %4
+  store i32 %6, i32* %result
+  %7 = call i32 @test_scoping()
+  %8 = load i32, i32* %result
+  %9 = add i32 %8, %7
+  store i32 %9, i32* %result
+  %10 = call i32 @test_increment_decrement()
+  %11 = load i32, i32* %result
+  %12 = add i32 %11, %10
+  store i32 %12, i32* %result
+  %13 = call i32 @test_strings()
+  %14 = load i32, i32* %result
+  %15 = add i32 %14, %13
+  store i32 %15, i32* %result
+  %16 = call i32 @test_empty()
+  %17 = load i32, i32* %result
+  %18 = add i32 %17, %16
+  store i32 %18, i32* %result
+  ret i32 %result
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
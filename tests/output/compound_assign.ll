@@ -0,0 +1,36 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @main() {
+  %a = alloca i32
+  store i32 10, i32* %a
+  %1 = load i32, i32* %a
+  %2 = add i32 %1, 5
+  store i32 %2, i32* %a
+  %3 = load i32, i32* %a
+  %4 = and i32 %3, 7
+  store i32 %4, i32* %a
+  %5 = load i32, i32* %a
+  %6 = or i32 %5, 8
+  store i32 %6, i32* %a
+  %7 = load i32, i32* %a
+  %8 = xor i32 %7, 3
+  store i32 %8, i32* %a
+  %9 = load i32, i32* %a
+  %10 = shl i32 %9, 1
+  store i32 %10, i32* %a
+  %11 = load i32, i32* %a
+  %12 = ashr i32 %11, 1
+  store i32 %12, i32* %a
+  ret i32 %a
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,34 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @main() {
+  %a = alloca i32
+  %b = alloca i32
+  %c = alloca i32
+  store i32 10, i32* %a
+  store i32 20, i32* %b
+  %1 = load i32, i32* %a
+  %2 = load i32, i32* %b
+  %3 = icmp slt i32 %1, %2
+  br i1 %3, label %bb1, label %bb2
+bb1:
+  %4 = load i32, i32* %a
+  br label %bb3
+bb2:
+  %5 = load i32, i32* %b
+  br label %bb3
+bb3:
+  %6 = phi i32 [ %4, %bb1 ], [ %5, %bb2 ]
+  store i32 %6, i32* %c
+  ret i32 %c
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,24 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @test(i32 %x) {
+  ; if statement
+  %1 = icmp sgt i32 %x, 0
+  br i1 %1, label %bb1, label %bb2
+bb1:
+  ret i32 1
+bb2:
+  br label %bb3
+bb3:
+  ret i32 0
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,41 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @test_expressions() {
+  %1 = add i32 42, 10
+  %2 = add i32 42, 10
+  %3 = sub i32 42, 10
+  %4 = mul i32 42, 10
+  %5 = sdiv i32 42, 10
+  %6 = srem i32 42, 10
+  %7 = icmp slt i32 42, 10
+  %8 = zext i1 %7 to i32
+  %9 = icmp sgt i32 42, 10
+  %10 = zext i1 %9 to i32
+  %11 = icmp sle i32 42, 10
+  %12 = zext i1 %11 to i32
+  %13 = icmp sge i32 42, 10
+  %14 = zext i1 %13 to i32
+  %15 = icmp eq i32 42, 10
+  %16 = zext i1 %15 to i32
+  %17 = icmp ne i32 42, 10
+  %18 = zext i1 %17 to i32
+  %19 = add i32 100, 200
+  %20 = add i32 %19, %1
+  ret i32 %20
+  }
+
+define i32 @main() {
+  %1 = call i32 @test_expressions()
+  ret i32 %1
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,14 @@
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+define i32 @add(i32 %a, i32 %b) {
+%1 = add i32 %a, %b
+ret i32 %1
+}
+define i32 @main() {
+%1 = call i32 @add(i32 5, i32 3)
+ret i32 %1
+}
+declare i32 @printf(ptr, ...)
+declare i32 @scanf(ptr, ...)
+declare ptr @malloc(i64)
+declare void @free(ptr)
@@ -0,0 +1,87 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @modern_func(i32 %a, i32 %b, i32 %c) {
+  %1 = add i32 %a, %b
+  %2 = add i32 %1, %c
+  ret i32 %2
+  }
+
+define i32 @old_style_func(i32 %x, i32 %y) {
+  %1 = mul i32 %x, %y
+  ret i32 %1
+  }
+
+define i32 @no_params_modern() {
+  ret i32 100
+  }
+
+define i32 @no_params_old() {
+  ret i32 200
+  }
+
+define i32 @caller() {
+  %a = alloca i32
+  %b = alloca i32
+  %c = alloca i32
+  %d = alloca i32
+  %1 = call i32 @modern_func(i32 1, i32 2, i32 3)
+  store i32 %1, i32* %a
+  %2 = call i32 @old_style_func(i32 4, i32 5)
+  store i32 %2, i32* %b
+  %3 = call i32 @no_params_modern()
+  store i32 %3, i32* %c
+  %4 = call i32 @no_params_old()
+  store i32 %4, i32* %d
+  %5 = load i32, i32* %a
+  %6 = load i32, i32* %b
+  %7 = add i32 %5, %6
+  %8 = load i32, i32* %c
+  %9 = add i32 %7, %8
+  %10 = load i32, i32* %d
+  %11 = add i32 %9, %10
+  ret i32 %11
+  }
+
+define i32 @fibonacci(i32 %n) {
+  ; if statement
+  %1 = icmp sle i32 %n, 1
+  br i1 %1, label %bb1, label %bb2
+bb1:
+  ret i32 %n
+bb2:
+  br label %bb3
+bb3:
+  %2 = sub i32 %n, 1
+  %3 = call i32 @fibonacci(i32 %2)
+  %4 = sub i32 %n, 2
+  %5 = call i32 @fibonacci(i32 %4)
+  %6 = add i32 %3, %5
+  ret i32 %6
+  }
+
+define i32 @complex_math(i32 %x) {
+  %result = alloca i32
+  %1 = mul i32 %x, 2
+  %2 = add i32 %1, 3
+  %3 = sub i32 %x, 1
+  %4 = mul i32 %2, %3
+  store i32 %4, i32* %result
+  %5 = add i32 %x, 1
+  %6 = load i32, i32* %result
+  %7 = sdiv i32 %6, %5
+  store i32 %7, i32* %result
+  %8 = load i32, i32* %result
+  %9 = srem i32 %8, 100
+  ret i32 %9
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
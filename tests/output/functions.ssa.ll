@@ -0,0 +1,70 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @modern_func(i32 %a, i32 %b, i32 %c) {
+  %1 = add i32 %a, %b
+  %2 = add i32 %1, %c
+  ret i32 %2
+  }
+
+define i32 @old_style_func(i32 %x, i32 %y) {
+  %1 = mul i32 %x, %y
+  ret i32 %1
+  }
+
+define i32 @no_params_modern() {
+  ret i32 100
+  }
+
+define i32 @no_params_old() {
+  ret i32 200
+  }
+
+define i32 @caller() {
+  %1 = call i32 @modern_func(i32 1, i32 2, i32 3)
+  %2 = call i32 @old_style_func(i32 4, i32 5)
+  %3 = call i32 @no_params_modern()
+  %4 = call i32 @no_params_old()
+  %5 = add i32 %1, %2
+  %6 = add i32 %5, %3
+  %7 = add i32 %6, %4
+  ret i32 %7
+  }
+
+define i32 @fibonacci(i32 %n) {
+  ; if statement
+  %1 = icmp sle i32 %n, 1
+  br i1 %1, label %bb1, label %bb2
+bb1:
+  ret i32 %n
+bb2:
+  br label %bb3
+bb3:
+  %2 = sub i32 %n, 1
+  %3 = call i32 @fibonacci(i32 %2)
+  %4 = sub i32 %n, 2
+  %5 = call i32 @fibonacci(i32 %4)
+  %6 = add i32 %3, %5
+  ret i32 %6
+  }
+
+define i32 @complex_math(i32 %x) {
+  %1 = mul i32 %x, 2
+  %2 = add i32 %1, 3
+  %3 = sub i32 %x, 1
+  %4 = mul i32 %2, %3
+  %5 = add i32 %x, 1
+  %6 = sdiv i32 %4, %5
+  %7 = srem i32 %6, 100
+  ret i32 %7
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
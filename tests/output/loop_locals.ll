@@ -0,0 +1,97 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @add_to_acc(i32 %value) {
+  %1 = load i32, i32* @acc
+  %2 = add i32 %1, %value
+  store i32 %2, i32* @acc
+  %3 = load i32, i32* @acc
+  ret i32 %3
+  }
+
+define i32 @sum_squares(i32 %n) {
+  %total = alloca i32
+  %i = alloca i32
+  %square = alloca i32
+  %total.1 = alloca i32
+  store i32 0, i32* %total
+  ; for statement
+  store i32 0, i32* %i
+  br label %bb1
+bb1:
+  %1 = load i32, i32* %i
+  %2 = icmp slt i32 %1, %n
+  br i1 %2, label %bb2, label %bb4
+bb2:
+  %3 = load i32, i32* %i
+  %4 = load i32, i32* %i
+  %5 = mul i32 %3, %4
+  store i32 %5, i32* %square
+  %6 = load i32, i32* %square
+  %7 = srem i32 %6, 7
+  store i32 %7, i32* %total.1
+  ; if statement
+  %8 = load i32, i32* %total.1
+  %9 = icmp sgt i32 %8, 3
+  br i1 %9, label %bb5, label %bb6
+bb5:
+  %10 = load i32, i32* %square
+  %11 = load i32, i32* %total.1
+  %12 = add i32 %10, %11
+  store i32 %12, i32* %square
+  br label %bb7
+bb6:
+  br label %bb7
+bb7:
+  %13 = load i32, i32* %square
+  %14 = call i32 @add_to_acc(i32 %13)
+  br label %bb3
+bb3:
+  %15 = load i32, i32* %i
+  %16 = add i32 %15, 1
+  store i32 %16, i32* %i
+  br label %bb1
+bb4:
+  %17 = load i32, i32* %total
+  ret i32 %17
+  }
+
+define i32 @main() {
+  %count = alloca i32
+  %step = alloca i32
+  ; for statement
+  store i32 0, i32* %count
+  br label %bb1
+bb1:
+  %1 = load i32, i32* %count
+  %2 = icmp slt i32 %1, 1000000
+  br i1 %2, label %bb2, label %bb4
+bb2:
+  store i32 1, i32* %step
+  %3 = load i32, i32* %count
+  %4 = load i32, i32* %step
+  %5 = add i32 %3, %4
+  store i32 %5, i32* %count
+  br label %bb3
+bb3:
+  br label %bb1
+bb4:
+  %6 = call i32 @sum_squares(i32 1000)
+  %7 = load i32, i32* %count
+  %8 = sub i32 %7, 1000000
+  %9 = load i32, i32* @acc
+  %10 = sub i32 %9, 332834644
+  %11 = add i32 %8, %10
+  ret i32 %11
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
+@acc = global i32 0
@@ -0,0 +1,85 @@
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+define i32 @add_to_acc(i32 %value) {
+%1 = load i32, ptr @acc
+%2 = add i32 %1, %value
+store i32 %2, ptr @acc
+%3 = load i32, ptr @acc
+ret i32 %3
+}
+define i32 @sum_squares(i32 %n) {
+%total = alloca i32
+%i = alloca i32
+%square = alloca i32
+%total.1 = alloca i32
+store i32 0, ptr %total
+store i32 0, ptr %i
+br label %bb1
+bb1:
+%1 = load i32, ptr %i
+%2 = icmp slt i32 %1, %n
+br i1 %2, label %bb2, label %bb4
+bb2:
+%3 = load i32, ptr %i
+%4 = load i32, ptr %i
+%5 = mul i32 %3, %4
+store i32 %5, ptr %square
+%6 = load i32, ptr %square
+%7 = srem i32 %6, 7
+store i32 %7, ptr %total.1
+%8 = load i32, ptr %total.1
+%9 = icmp sgt i32 %8, 3
+br i1 %9, label %bb5, label %bb6
+bb5:
+%10 = load i32, ptr %square
+%11 = load i32, ptr %total.1
+%12 = add i32 %10, %11
+store i32 %12, ptr %square
+br label %bb7
+bb6:
+br label %bb7
+bb7:
+%13 = load i32, ptr %square
+%14 = call i32 @add_to_acc(i32 %13)
+br label %bb3
+bb3:
+%15 = load i32, ptr %i
+%16 = add i32 %15, 1
+store i32 %16, ptr %i
+br label %bb1
+bb4:
+%17 = load i32, ptr %total
+ret i32 %17
+}
+define i32 @main() {
+%count = alloca i32
+%step = alloca i32
+store i32 0, ptr %count
+br label %bb1
+bb1:
+%1 = load i32, ptr %count
+%2 = icmp slt i32 %1, 1000000
+br i1 %2, label %bb2, label %bb4
+bb2:
+store i32 1, ptr %step
+%3 = load i32, ptr %count
+%4 = load i32, ptr %step
+%5 = add i32 %3, %4
+store i32 %5, ptr %count
+br label %bb3
+bb3:
+br label %bb1
+bb4:
+%6 = call i32 @sum_squares(i32 1000)
+%7 = load i32, ptr %count
+%8 = sub i32 %7, 1000000
+%9 = load i32, ptr @acc
+%10 = sub i32 %9, 332834644
+%11 = add i32 %8, %10
+ret i32 %11
+}
+declare i32 @printf(ptr, ...)
+declare i32 @scanf(ptr, ...)
+declare ptr @malloc(i64)
+declare void @free(ptr)
+@acc = global i32 0
@@ -0,0 +1,71 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @add_to_acc(i32 %value) {
+  %1 = load i32, i32* @acc
+  %2 = add i32 %1, %value
+  store i32 %2, i32* @acc
+  %3 = load i32, i32* @acc
+  ret i32 %3
+  }
+
+define i32 @sum_squares(i32 %n) {
+  ; for statement
+  br label %bb1
+bb1:
+  %1 = phi i32 [ 0, %0 ], [ %9, %bb3 ]
+  %2 = icmp slt i32 %1, %n
+  br i1 %2, label %bb2, label %bb4
+bb2:
+  %3 = mul i32 %1, %1
+  %4 = srem i32 %3, 7
+  ; if statement
+  %5 = icmp sgt i32 %4, 3
+  br i1 %5, label %bb5, label %bb6
+bb5:
+  %6 = add i32 %3, %4
+  br label %bb7
+bb6:
+  br label %bb7
+bb7:
+  %7 = phi i32 [ %6, %bb5 ], [ %3, %bb6 ]
+  %8 = call i32 @add_to_acc(i32 %7)
+  br label %bb3
+bb3:
+  %9 = add i32 %1, 1
+  br label %bb1
+bb4:
+  ret i32 0
+  }
+
+define i32 @main() {
+  ; for statement
+  br label %bb1
+bb1:
+  %1 = phi i32 [ 0, %0 ], [ %3, %bb3 ]
+  %2 = icmp slt i32 %1, 1000000
+  br i1 %2, label %bb2, label %bb4
+bb2:
+  %3 = add i32 %1, 1
+  br label %bb3
+bb3:
+  br label %bb1
+bb4:
+  %4 = call i32 @sum_squares(i32 1000)
+  %5 = sub i32 %1, 1000000
+  %6 = load i32, i32* @acc
+  %7 = sub i32 %6, 332834644
+  %8 = add i32 %5, %7
+  ret i32 %8
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
+@acc = global i32 0
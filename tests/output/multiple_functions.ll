@@ -0,0 +1,30 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @square(i32 %n) {
+  %1 = mul i32 %n, %n
+  ret i32 %1
+  }
+
+define i32 @cube(i32 %n) {
+  %1 = mul i32 %n, %n
+  %2 = mul i32 %1, %n
+  ret i32 %2
+  }
+
+define i32 @main() {
+  %1 = call i32 @square(i32 3)
+  %2 = call i32 @cube(i32 2)
+  %3 = add i32 %1, %2
+  ret i32 %3
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,23 @@
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+define i32 @factorial(i32 %n) {
+%1 = icmp sle i32 %n, 1
+br i1 %1, label %bb1, label %bb2
+bb1:
+ret i32 1
+bb2:
+br label %bb3
+bb3:
+%2 = sub i32 %n, 1
+%3 = call i32 @factorial(i32 %2)
+%4 = mul i32 %n, %3
+ret i32 %4
+}
+define i32 @main() {
+%1 = call i32 @factorial(i32 5)
+ret i32 %1
+}
+declare i32 @printf(ptr, ...)
+declare i32 @scanf(ptr, ...)
+declare ptr @malloc(i64)
+declare void @free(ptr)
@@ -0,0 +1,115 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @test_statements(i32 %n) {
+  %local = alloca i32
+  %1 = add i32 %n, 1
+  store i32 5, i32* %local
+  %2 = load i32, i32* %local
+  %3 = add i32 %2, 1
+  store i32 %3, i32* %local
+  ; if statement
+  %4 = icmp sgt i32 %n, 0
+  br i1 %4, label %bb1, label %bb2
+bb1:
+  %5 = add i32 %n, 1
+  store i32 %5, i32* %n
+  br label %bb3
+bb2:
+  br label %bb3
+bb3:
+  ; if statement
+  %6 = icmp slt i32 %n, 10
+  br i1 %6, label %bb4, label %bb5
+bb4:
+  %7 = mul i32 %n, 2
+  store i32 %7, i32* %n
+  br label %bb6
+bb5:
+  %8 = sdiv i32 %n, 2
+  store i32 %8, i32* %n
+  br label %bb6
+bb6:
+  ; while statement
+  br label %bb7
+bb7:
+  %9 = icmp sgt i32 %n, 0
+  br i1 %9, label %bb8, label %bb9
+bb8:
+  %10 = sub i32 %n, 1
+  store i32 %10, i32* %n
+  ; if statement
+  %11 = icmp eq i32 %n, 5
+  br i1 %11, label %bb10, label %bb11
+bb10:
+  br label %bb7
+bb11:
+  br label %bb12
+bb12:
+  ; if statement
+  %12 = icmp eq i32 %n, 1
+  br i1 %12, label %bb13, label %bb14
+bb13:
+  br label %bb9
+bb14:
+  br label %bb15
+bb15:
+  br label %bb7
+bb9:
+  ; for statement
+  store i32 0, i32* %n
+  br label %bb16
+bb16:
+  %13 = icmp slt i32 %n, 5
+  br i1 %13, label %bb17, label %bb19
+bb17:
+  ; if statement
+  %14 = icmp eq i32 %n, 3
+  br i1 %14, label %bb20, label %bb21
+bb20:
+  br label %bb19
+bb21:
+  br label %bb22
+bb22:
+  br label %bb18
+bb18:
+  %15 = add i32 %n, 1
+  store i32 %15, i32* %n
+  br label %bb16
+bb19:
+  ; for statement
+  br label %bb23
+bb23:
+  %16 = icmp slt i32 %n, 10
+  br i1 %16, label %bb24, label %bb26
+bb24:
+  %17 = add i32 %n, 1
+  store i32 %17, i32* %n
+  br label %bb25
+bb25:
+  br label %bb23
+bb26:
+  ; if statement
+  %18 = icmp eq i32 %n, 0
+  br i1 %18, label %bb27, label %bb28
+bb27:
+  ret i32 42
+bb28:
+  br label %bb29
+bb29:
+  ret i32 %n
+  }
+
+define i32 @test_no_params() {
+  ret i32 123
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,227 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @fetch(i32 %pc) {
+  %op = alloca i32
+  store i32 0, i32* %op
+  ; switch statement
+  switch i32 %pc, label %bb11 [ i32 0, label %bb1 i32 2, label %bb2 i32 1, label %bb3 i32 8, label %bb4 i32 3, label %bb5 i32 4, label %bb6 i32 5, label %bb7 i32 6, label %bb8 i32 7, label %bb9 i32 10, label %bb10 ]
+bb1:
+  br label %bb2
+bb2:
+  store i32 1, i32* %op
+  br label %bb11
+bb3:
+  br label %bb4
+bb4:
+  store i32 5, i32* %op
+  br label %bb11
+bb5:
+  store i32 7, i32* %op
+  br label %bb11
+bb6:
+  store i32 3, i32* %op
+  br label %bb11
+bb7:
+  store i32 4, i32* %op
+  br label %bb11
+bb8:
+  store i32 6, i32* %op
+  br label %bb11
+bb9:
+  store i32 2, i32* %op
+  br label %bb11
+bb10:
+  store i32 9, i32* %op
+  br label %bb11
+bb11:
+  %1 = load i32, i32* %op
+  ret i32 %1
+  }
+
+define i32 @run(i32 %steps) {
+  %acc = alloca i32
+  %pc = alloca i32
+  %executed = alloca i32
+  store i32 0, i32* %acc
+  store i32 0, i32* %pc
+  store i32 0, i32* %executed
+  ; for statement
+  store i32 0, i32* %executed
+  br label %bb1
+bb1:
+  %1 = load i32, i32* %executed
+  %2 = icmp slt i32 %1, %steps
+  br i1 %2, label %bb2, label %bb4
+bb2:
+  ; switch statement
+  %3 = load i32, i32* %pc
+  %4 = call i32 @fetch(i32 %3)
+  switch i32 %4, label %bb12 [ i32 0, label %bb5 i32 1, label %bb6 i32 2, label %bb7 i32 3, label %bb8 i32 4, label %bb9 i32 5, label %bb10 i32 6, label %bb11 ]
+bb5:
+  store i32 0, i32* %pc
+  br label %bb13
+bb6:
+  %5 = load i32, i32* %pc
+  %6 = add i32 %5, 1
+  %7 = call i32 @fetch(i32 %6)
+  %8 = load i32, i32* %acc
+  %9 = add i32 %8, %7
+  store i32 %9, i32* %acc
+  %10 = load i32, i32* %pc
+  %11 = add i32 %10, 2
+  store i32 %11, i32* %pc
+  br label %bb13
+bb7:
+  %12 = load i32, i32* %acc
+  %13 = sub i32 %12, 3
+  store i32 %13, i32* %acc
+  %14 = load i32, i32* %pc
+  %15 = add i32 %14, 1
+  store i32 %15, i32* %pc
+  br label %bb13
+bb8:
+  %16 = load i32, i32* %acc
+  %17 = mul i32 %16, 2
+  store i32 %17, i32* %acc
+  %18 = load i32, i32* %pc
+  %19 = add i32 %18, 1
+  store i32 %19, i32* %pc
+  br label %bb13
+bb9:
+  %20 = load i32, i32* %acc
+  %21 = srem i32 %20, 1000
+  store i32 %21, i32* %acc
+  br label %bb10
+bb10:
+  %22 = load i32, i32* %acc
+  %23 = add i32 %22, 1
+  store i32 %23, i32* %acc
+  %24 = load i32, i32* %pc
+  %25 = add i32 %24, 1
+  store i32 %25, i32* %pc
+  br label %bb13
+bb11:
+  %26 = load i32, i32* %acc
+  %27 = xor i32 %26, 5
+  store i32 %27, i32* %acc
+  %28 = load i32, i32* %pc
+  %29 = add i32 %28, 1
+  store i32 %29, i32* %pc
+  br label %bb13
+bb12:
+  %30 = load i32, i32* %acc
+  %31 = add i32 %30, 100
+  store i32 %31, i32* %acc
+  %32 = load i32, i32* %pc
+  %33 = add i32 %32, 1
+  store i32 %33, i32* %pc
+  br label %bb13
+bb13:
+  br label %bb3
+bb3:
+  %34 = load i32, i32* %executed
+  %35 = add i32 %34, 1
+  store i32 %35, i32* %executed
+  br label %bb1
+bb4:
+  %36 = load i32, i32* %acc
+  ret i32 %36
+  }
+
+define i32 @classify(i32 %c) {
+  ; switch statement
+  switch i32 %c, label %bb5 [ i32 10, label %bb1 i32 20, label %bb2 i32 1000, label %bb3 i32 -7, label %bb4 ]
+bb1:
+  br label %bb2
+bb2:
+  ret i32 1
+bb3:
+  ret i32 2
+bb4:
+  ret i32 3
+bb5:
+  ret i32 0
+  }
+
+define i32 @tally() {
+  %i = alloca i32
+  %n = alloca i32
+  store i32 0, i32* %n
+  ; for statement
+  store i32 0, i32* %i
+  br label %bb1
+bb1:
+  %1 = load i32, i32* %i
+  %2 = icmp slt i32 %1, 3
+  br i1 %2, label %bb2, label %bb4
+bb2:
+  ; switch statement
+  %3 = load i32, i32* %i
+  switch i32 %3, label %bb7 [ i32 0, label %bb5 i32 1, label %bb6 ]
+bb5:
+  %4 = load i32, i32* %n
+  %5 = add i32 %4, 1
+  store i32 %5, i32* %n
+  br label %bb8
+bb6:
+  %6 = load i32, i32* %n
+  %7 = add i32 %6, 10
+  store i32 %7, i32* %n
+  br label %bb8
+bb7:
+  %8 = load i32, i32* %n
+  %9 = add i32 %8, 100
+  store i32 %9, i32* %n
+  br label %bb8
+bb8:
+  %10 = load i32, i32* %n
+  %11 = add i32 %10, 1000
+  store i32 %11, i32* %n
+  br label %bb3
+bb3:
+  %12 = load i32, i32* %i
+  %13 = add i32 %12, 1
+  store i32 %13, i32* %i
+  br label %bb1
+bb4:
+  %14 = load i32, i32* %n
+  ret i32 %14
+  }
+
+define i32 @main() {
+  %checks = alloca i32
+  %1 = call i32 @classify(i32 10)
+  %2 = call i32 @classify(i32 20)
+  %3 = mul i32 %2, 10
+  %4 = add i32 %1, %3
+  %5 = call i32 @classify(i32 1000)
+  %6 = mul i32 %5, 100
+  %7 = add i32 %4, %6
+  %8 = call i32 @classify(i32 -7)
+  %9 = mul i32 %8, 1000
+  %10 = add i32 %7, %9
+  %11 = call i32 @classify(i32 3)
+  %12 = mul i32 %11, 10000
+  %13 = add i32 %10, %12
+  store i32 %13, i32* %checks
+  %14 = call i32 @run(i32 1000000)
+  %15 = sub i32 %14, 254
+  %16 = load i32, i32* %checks
+  %17 = sub i32 %16, 3211
+  %18 = add i32 %15, %17
+  %19 = call i32 @tally()
+  %20 = sub i32 %19, 3111
+  %21 = add i32 %18, %20
+  ret i32 %21
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,166 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @fetch(i32 %pc) {
+  ; switch statement
+  switch i32 %pc, label %bb11 [ i32 0, label %bb1 i32 2, label %bb2 i32 1, label %bb3 i32 8, label %bb4 i32 3, label %bb5 i32 4, label %bb6 i32 5, label %bb7 i32 6, label %bb8 i32 7, label %bb9 i32 10, label %bb10 ]
+bb1:
+  br label %bb2
+bb2:
+  br label %bb11
+bb3:
+  br label %bb4
+bb4:
+  br label %bb11
+bb5:
+  br label %bb11
+bb6:
+  br label %bb11
+bb7:
+  br label %bb11
+bb8:
+  br label %bb11
+bb9:
+  br label %bb11
+bb10:
+  br label %bb11
+bb11:
+  %1 = phi i32 [ 0, %0 ], [ 1, %bb2 ], [ 5, %bb4 ], [ 7, %bb5 ], [ 3, %bb6 ], [ 4, %bb7 ], [ 6, %bb8 ], [ 2, %bb9 ], [ 9, %bb10 ]
+  ret i32 %1
+  }
+
+define i32 @run(i32 %steps) {
+  ; for statement
+  br label %bb1
+bb1:
+  %1 = phi i32 [ 0, %0 ], [ %22, %bb3 ]
+  %2 = phi i32 [ 0, %0 ], [ %23, %bb3 ]
+  %3 = phi i32 [ 0, %0 ], [ %24, %bb3 ]
+  %4 = icmp slt i32 %3, %steps
+  br i1 %4, label %bb2, label %bb4
+bb2:
+  ; switch statement
+  %5 = call i32 @fetch(i32 %2)
+  switch i32 %5, label %bb12 [ i32 0, label %bb5 i32 1, label %bb6 i32 2, label %bb7 i32 3, label %bb8 i32 4, label %bb9 i32 5, label %bb10 i32 6, label %bb11 ]
+bb5:
+  br label %bb13
+bb6:
+  %6 = add i32 %2, 1
+  %7 = call i32 @fetch(i32 %6)
+  %8 = add i32 %1, %7
+  %9 = add i32 %2, 2
+  br label %bb13
+bb7:
+  %10 = sub i32 %1, 3
+  %11 = add i32 %2, 1
+  br label %bb13
+bb8:
+  %12 = mul i32 %1, 2
+  %13 = add i32 %2, 1
+  br label %bb13
+bb9:
+  %14 = srem i32 %1, 1000
+  br label %bb10
+bb10:
+  %15 = phi i32 [ %1, %bb2 ], [ %14, %bb9 ]
+  %16 = add i32 %15, 1
+  %17 = add i32 %2, 1
+  br label %bb13
+bb11:
+  %18 = xor i32 %1, 5
+  %19 = add i32 %2, 1
+  br label %bb13
+bb12:
+  %20 = add i32 %1, 100
+  %21 = add i32 %2, 1
+  br label %bb13
+bb13:
+  %22 = phi i32 [ %1, %bb5 ], [ %8, %bb6 ], [ %10, %bb7 ], [ %12, %bb8 ], [ %16, %bb10 ], [ %18, %bb11 ], [ %20, %bb12 ]
+  %23 = phi i32 [ 0, %bb5 ], [ %9, %bb6 ], [ %11, %bb7 ], [ %13, %bb8 ], [ %17, %bb10 ], [ %19, %bb11 ], [ %21, %bb12 ]
+  br label %bb3
+bb3:
+  %24 = add i32 %3, 1
+  br label %bb1
+bb4:
+  ret i32 %1
+  }
+
+define i32 @classify(i32 %c) {
+  ; switch statement
+  switch i32 %c, label %bb5 [ i32 10, label %bb1 i32 20, label %bb2 i32 1000, label %bb3 i32 -7, label %bb4 ]
+bb1:
+  br label %bb2
+bb2:
+  ret i32 1
+bb3:
+  ret i32 2
+bb4:
+  ret i32 3
+bb5:
+  ret i32 0
+  }
+
+define i32 @tally() {
+  ; for statement
+  br label %bb1
+bb1:
+  %1 = phi i32 [ 0, %0 ], [ %9, %bb3 ]
+  %2 = phi i32 [ 0, %0 ], [ %8, %bb3 ]
+  %3 = icmp slt i32 %1, 3
+  br i1 %3, label %bb2, label %bb4
+bb2:
+  ; switch statement
+  switch i32 %1, label %bb7 [ i32 0, label %bb5 i32 1, label %bb6 ]
+bb5:
+  %4 = add i32 %2, 1
+  br label %bb8
+bb6:
+  %5 = add i32 %2, 10
+  br label %bb8
+bb7:
+  %6 = add i32 %2, 100
+  br label %bb8
+bb8:
+  %7 = phi i32 [ %4, %bb5 ], [ %5, %bb6 ], [ %6, %bb7 ]
+  %8 = add i32 %7, 1000
+  br label %bb3
+bb3:
+  %9 = add i32 %1, 1
+  br label %bb1
+bb4:
+  ret i32 %2
+  }
+
+define i32 @main() {
+  %1 = call i32 @classify(i32 10)
+  %2 = call i32 @classify(i32 20)
+  %3 = mul i32 %2, 10
+  %4 = add i32 %1, %3
+  %5 = call i32 @classify(i32 1000)
+  %6 = mul i32 %5, 100
+  %7 = add i32 %4, %6
+  %8 = call i32 @classify(i32 -7)
+  %9 = mul i32 %8, 1000
+  %10 = add i32 %7, %9
+  %11 = call i32 @classify(i32 3)
+  %12 = mul i32 %11, 10000
+  %13 = add i32 %10, %12
+  %14 = call i32 @run(i32 1000000)
+  %15 = sub i32 %14, 254
+  %16 = sub i32 %13, 3211
+  %17 = add i32 %15, %16
+  %18 = call i32 @tally()
+  %19 = sub i32 %18, 3111
+  %20 = add i32 %17, %19
+  ret i32 %20
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
@@ -0,0 +1,25 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @main() {
+  %x = alloca i32
+  %y = alloca i32
+  %result = alloca i32
+  store i32 42, i32* %x
+  store i32 10, i32* %y
+  %1 = load i32, i32* %x
+  %2 = load i32, i32* %y
+  %3 = add i32 %1, %2
+  store i32 %3, i32* %result
+  ret i32 %result
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
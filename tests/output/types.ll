@@ -0,0 +1,95 @@
+; Generated LLVM IR
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Runtime function declarations
+
+define i32 @test_types(i32 %i, i32 %c, i32 %f, i32 %d) {
+  %local_int = alloca i32
+  %local_char = alloca i8
+  %local_float = alloca float
+  %local_double = alloca double
+  %init_int = alloca i32
+  %init_char = alloca i8
+  %init_float = alloca float
+  %init_double = alloca double
+  %a = alloca i32
+  %b = alloca i32
+  %c.1 = alloca i32
+  %mixed = alloca i32
+  %float_result = alloca float
+  %double_result = alloca double
+  %char_result = alloca i8
+  store i32 10, i32* %init_int
+  store i8 90, i8* %init_char
+  store float 1, float* %init_float
+  store double 9, double* %init_double
+  store i32 1, i32* %a
+  store i32 2, i32* %b
+  store i32 3, i32* %c.1
+  %1 = load i32, i32* %c.1
+  %2 = add i32 %i, %1
+  store i32 %2, i32* %mixed
+  %3 = mul i32 %f, %i
+  store float %3, float* %float_result
+  %4 = sdiv i32 %d, %f
+  store double %4, double* %double_result
+  %5 = load i32, i32* %c.1
+  %6 = add i32 %5, 1
+  store i8 %6, i8* %char_result
+  %7 = load i32, i32* %mixed
+  %8 = load float, float* %float_result
+  %9 = add i32 %7, %8
+  %10 = load double, double* %double_result
+  %11 = add i32 %9, %10
+  %12 = load i8, i8* %char_result
+  %13 = sext i8 %12 to i32
+  %14 = add i32 %11, %13
+  ret i32 %14
+  }
+
+define i32 @test_signed_unsigned() {
+  %si = alloca i32
+  %ui = alloca i32
+  %sc = alloca i32
+  %uc = alloca i32
+  store i32 -100, i32* %si
+  store i32 200, i32* %ui
+  store i32 -50, i32* %sc
+  store i32 250, i32* %uc
+  %1 = load i32, i32* %si
+  %2 = load i32, i32* %ui
+  %3 = add i32 %1, %2
+  %4 = load i32, i32* %sc
+  %5 = add i32 %3, %4
+  %6 = load i32, i32* %uc
+  %7 = add i32 %5, %6
+  ret i32 %7
+  }
+
+define void @void_function() {
+  %temp = alloca i32
+  store i32 42, i32* %temp
+  %1 = load i32, i32* %temp
+  %2 = add i32 %1, 1
+  store i32 %2, i32* %temp
+  ret void
+  }
+
+define i32 @test_void_return() {
+  %1 = call i32 @void_function()
+  ret i32 0
+  }
+
+
+; Global constants
+declare i32 @printf(i8*, ...)
+declare i32 @scanf(i8*, ...)
+declare i8* @malloc(i64)
+declare void @free(i8*)
+@global_int = global i32 42
+@global_char = global i8 65
+@global_float = global float 3
+@global_double = global double 2
+@static_var = global i32 100
+@extern_var = global i32 0
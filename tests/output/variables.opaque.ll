@@ -0,0 +1,16 @@
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+define i32 @main() {
+%x = alloca i32
+%y = alloca i32
+store i32 10, ptr %x
+store i32 20, ptr %y
+%1 = load i32, ptr %x
+%2 = load i32, ptr %y
+%3 = add i32 %1, %2
+ret i32 %3
+}
+declare i32 @printf(ptr, ...)
+declare i32 @scanf(ptr, ...)
+declare ptr @malloc(i64)
+declare void @free(ptr)
@@ -1,6 +1,9 @@
 #include "../../src/ast.h"
+#include "../../src/memory.h"
+#include "../../src/string_pool.h"
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
 extern ASTNode* program_ast;
 extern int yyparse(void);
@@ -29,7 +32,35 @@ void test_ast_construction() {
     printf("test_ast_construction passed!\n");
 }
 
+void test_string_literal_pool() {
+    printf("Running test_string_literal_pool...\n");
+    mem_init();
+
+    ASTNode* node = create_string_literal_node("\"a\\tb\\\"\\x41\\101\\0z\"");
+    assert(node->data.string_literal.length == 8);
+    assert(memcmp(node->data.string_literal.string, "a\tb\"AA\0z", 8) == 0);
+
+    StringPool pool;
+    string_pool_init(&pool);
+    int is_new = 0;
+    int first = string_pool_intern(&pool, node->data.string_literal.string, 8, &is_new);
+    assert(first == 0 && is_new);
+    assert(string_pool_intern(&pool, "other", 5, &is_new) == 1 && is_new);
+    assert(string_pool_intern(&pool, "a\tb\"AA\0z", 8, &is_new) == first && !is_new);
+    assert(string_pool_intern(&pool, "a\tb\"AA\0y", 8, &is_new) == 2 && is_new);
+
+    char out[64];
+    size_t length = string_pool_encode(&pool, pool.entries[first].bytes, 8, out);
+    assert(length == string_pool_encoded_length(&pool, pool.entries[first].bytes, 8));
+    assert(length == 14 && memcmp(out, "a\\09b\\22AA\\00z", length) == 0);
+
+    string_pool_free(&pool);
+    mem_cleanup();
+    printf("test_string_literal_pool passed!\n");
+}
+
 int main() {
     test_ast_construction();
+    test_string_literal_pool();
     return 0;
 }
\ No newline at end of file
@@ -17,8 +17,19 @@ int yyparse(void) {
 int yylex(void) {
     return 0;
 }
+
+/* Scanner hooks used by the library API (srccpp/tinyc.cpp) */
+void lexer_begin_buffer(const char* src, size_t len) {
+    (void)src;
+    (void)len;
+}
+
+void lexer_end_buffer(void) {}
 }
 
+struct CodeGenContext;
+CodeGenContext* codegen_ctx = NULL;
+
 #define main ccompiler_main
 #line 1 "srccpp/main.cpp"
 #include "../../srccpp/main.cpp"
@@ -5,8 +5,10 @@
 #include <cstdlib>
 #include <cstdio>
 #include <string>
+#include <thread>
 #include <vector>
 #include <getopt.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 extern "C" {
@@ -15,6 +17,9 @@ extern "C" {
     #include "../../srccpp/memory_management.h"
     #include "../../srccpp/codegen.h"
     #include "../../srccpp/constants.h"
+    #include "../../srccpp/driver.h"
+    #include "../../srccpp/llvm_backend.h"
+    #include "../../srccpp/ssa.h"
 }
 
 /* Forward declarations from main.cpp to exercise CLI helpers */
@@ -28,6 +33,25 @@ struct CompilerOptions {
     int verbose;
     int dump_ast;
     int dump_tokens;
+    int jobs;
+    char** input_files;
+    int input_count;
+    int codegen_jobs;
+    int whole_program;
+    const char** exports;
+    int export_count;
+    int mmap_output;
+    int stream_constants;
+    int backend;
+    int opt_level;
+    int emit;
+    int ir_flags;
+    const char* target;
+    int run;
+    char** run_args;
+    int run_arg_count;
+    int interp;
+    int ssa;
 };
 
 extern CompilerOptions options;
@@ -82,6 +106,26 @@ static void reset_compiler_options() {
     options.verbose = 0;
     options.dump_ast = 0;
     options.dump_tokens = 0;
+    options.jobs = 0;
+    options.input_files = NULL;
+    options.input_count = 0;
+    options.codegen_jobs = 0;
+    options.whole_program = 0;
+    free(options.exports);
+    options.exports = NULL;
+    options.export_count = 0;
+    options.mmap_output = 0;
+    options.stream_constants = 0;
+    options.backend = 0;
+    options.opt_level = 0;
+    options.emit = 0;
+    options.ir_flags = 0;
+    options.target = NULL;
+    options.run = 0;
+    options.run_args = NULL;
+    options.run_arg_count = 0;
+    options.interp = 0;
+    options.ssa = 0;
     optind = 1;
     opterr = 0;
 }
@@ -131,6 +175,12 @@ TEST_CASE("AST Node Construction") {
         REQUIRE(strcmp(node->data.string_literal.string, expected) == 0);
         REQUIRE(node->data.string_literal.length == (int)strlen(expected));
         free_ast_node(node);
+
+        char escaped[] = "\"tab\\t\\x41\\101\\\\\\0end\"";
+        node = create_string_literal_node(escaped);
+        REQUIRE(node->data.string_literal.length == 11);
+        REQUIRE(memcmp(node->data.string_literal.string, "tab\tAA\\\0end", 11) == 0);
+        free_ast_node(node);
     }
 
     SECTION("Unary operation node creation") {
@@ -243,6 +293,105 @@ TEST_CASE("Compiler CLI and Main") {
         REQUIRE(result == -1);
     }
 
+    SECTION("Parse arguments - jobs and multiple inputs") {
+        reset_compiler_options();
+        char prog[] = "ccompiler";
+        char jobs_flag[] = "-j";
+        char jobs[] = "4";
+        char first[] = "a.c";
+        char second[] = "b.c";
+        char* argv[] = {prog, jobs_flag, jobs, first, second};
+
+        int result = parse_arguments(5, argv);
+        REQUIRE(result == 0);
+        REQUIRE(options.jobs == 4);
+        REQUIRE(options.input_count == 2);
+        REQUIRE(strcmp(options.input_files[1], second) == 0);
+
+        reset_compiler_options();
+        char bad_jobs[] = "0";
+        char* bad_argv[] = {prog, jobs_flag, bad_jobs, first};
+        REQUIRE(parse_arguments(4, bad_argv) == -1);
+        reset_compiler_options();
+    }
+
+    SECTION("Parse arguments - whole program and exports") {
+        reset_compiler_options();
+        char prog[] = "ccompiler";
+        char whole[] = "--whole-program";
+        char export_flag[] = "--export";
+        char api[] = "api_init";
+        char other[] = "api_run";
+        char first[] = "a.c";
+        char second[] = "b.c";
+        char* argv[] = {prog, whole, export_flag, api, export_flag, other,
+                        first, second};
+
+        REQUIRE(parse_arguments(8, argv) == 0);
+        REQUIRE(options.whole_program == 1);
+        REQUIRE(options.export_count == 2);
+        REQUIRE(strcmp(options.exports[1], other) == 0);
+        REQUIRE(options.input_count == 2);
+        reset_compiler_options();
+    }
+
+    SECTION("Batch output paths") {
+        char* path = batch_output_path("out/", "tests/fixtures/simple.c");
+        REQUIRE(strcmp(path, "out/simple.ll") == 0);
+        free(path);
+
+        path = batch_output_path("out", "noext");
+        REQUIRE(strcmp(path, "out/noext.ll") == 0);
+        free(path);
+    }
+
+    SECTION("Batch inputs sharing a basename are rejected") {
+        char first[] = "d1/x.c";
+        char second[] = "d2/x.c";
+        char* inputs[] = {first, second};
+        const char* output_dir = "unit_batch_collision";
+
+        rmdir(output_dir);
+        REQUIRE(compile_batch(inputs, 2, output_dir, 2, 0, NULL, 0, 0, 0) == 2);
+        struct stat info;
+        REQUIRE(stat(output_dir, &info) != 0);
+    }
+
+    SECTION("ccompiler_main keeps -o FILE for one input with -j") {
+        reset_compiler_options();
+        yyin = NULL;
+
+        program_ast = build_stub_function("stub", 1);
+
+        char prog[] = "ccompiler";
+        char jobs_flag[] = "-j";
+        char jobs[] = "4";
+        char input_file[] = "unit_jobs_input.c";
+        char output_flag[] = "-o";
+        char output_file[] = "unit_jobs.ll";
+        char* argv[] = {prog, jobs_flag, jobs, input_file, output_flag,
+                        output_file};
+
+        FILE* input = fopen(input_file, "w");
+        REQUIRE(input != nullptr);
+        fputs("int stub() { return 1; }\n", input);
+        fclose(input);
+        std::remove(output_file);
+
+        REQUIRE(ccompiler_main(6, argv) == 0);
+        struct stat info;
+        REQUIRE(stat(output_file, &info) == 0);
+        REQUIRE(S_ISREG(info.st_mode));
+        std::remove(output_file);
+        std::remove(input_file);
+
+        if (program_ast) {
+            free_ast_node(program_ast);
+            program_ast = NULL;
+        }
+        reset_compiler_options();
+    }
+
     SECTION("ccompiler_main happy path") {
         reset_compiler_options();
         yyin = NULL;
@@ -272,6 +421,171 @@ TEST_CASE("Compiler CLI and Main") {
         reset_compiler_options();
     }
 
+    SECTION("ccompiler_main writes an object file with the llvm-api backend") {
+        reset_compiler_options();
+        yyin = NULL;
+
+        program_ast = build_stub_function("main", 7);
+
+        char prog[] = "ccompiler";
+        char backend_flag[] = "--backend=llvm-api";
+        char opt_flag[] = "-O2";
+        char output_flag[] = "-o";
+        char output_file[] = "unit_main.o";
+        char* argv[] = {prog, backend_flag, opt_flag, output_flag,
+                        output_file};
+
+        std::remove(output_file);
+        REQUIRE(ccompiler_main(5, argv) == 0);
+
+        /* Without LLVM the text backend takes over */
+        FILE* produced = fopen(output_file, "rb");
+        REQUIRE(produced != nullptr);
+        unsigned char magic[4] = {0, 0, 0, 0};
+        REQUIRE(fread(magic, 1, 4, produced) == 4);
+        fclose(produced);
+        std::remove(output_file);
+        if (llvm_backend_available()) {
+            int elf = memcmp(magic, "\x7f" "ELF", 4) == 0;
+            int mach_o = memcmp(magic, "\xcf\xfa\xed\xfe", 4) == 0;
+            REQUIRE((elf || mach_o));
+        } else {
+            REQUIRE(memcmp(magic, "; Ge", 4) == 0);
+        }
+
+        if (program_ast) {
+            free_ast_node(program_ast);
+            program_ast = NULL;
+        }
+        reset_compiler_options();
+    }
+
+    SECTION("ccompiler_main writes an ELF object with the x86-64 backend") {
+        reset_compiler_options();
+        yyin = NULL;
+
+        program_ast = build_stub_function("main", 7);
+
+        char prog[] = "ccompiler";
+        char backend_flag[] = "--backend=x86-64";
+        char output_flag[] = "-o";
+        char output_file[] = "unit_native.o";
+        char* argv[] = {prog, backend_flag, output_flag, output_file};
+
+        std::remove(output_file);
+        REQUIRE(ccompiler_main(4, argv) == 0);
+
+        FILE* produced = fopen(output_file, "rb");
+        REQUIRE(produced != nullptr);
+        unsigned char header[64] = {0};
+        REQUIRE(fread(header, 1, sizeof(header), produced) == sizeof(header));
+        fclose(produced);
+        std::remove(output_file);
+        /* 64-bit little-endian relocatable object for x86-64 */
+        REQUIRE(memcmp(header, "\x7f" "ELF\x02\x01", 6) == 0);
+        REQUIRE(header[16] == 1);
+        REQUIRE(header[18] == 62);
+
+        if (program_ast) {
+            free_ast_node(program_ast);
+            program_ast = NULL;
+        }
+        reset_compiler_options();
+    }
+
+    SECTION("ccompiler_main JIT-runs main with --run") {
+        reset_compiler_options();
+        yyin = NULL;
+
+        program_ast = build_stub_function("main", 7);
+
+        char prog[] = "ccompiler";
+        char run_flag[] = "--run";
+        char input_file[] = "unit_run.c";
+        char separator[] = "--";
+        char program_arg[] = "x";
+        char* argv[] = {prog, run_flag, input_file, separator, program_arg};
+
+        FILE* input = fopen(input_file, "w");
+        REQUIRE(input != nullptr);
+        fputs("int main() { return 7; }\n", input);
+        fclose(input);
+
+        /* The exit status is main's return value */
+        int status = ccompiler_main(5, argv);
+        std::remove(input_file);
+        REQUIRE(status == (llvm_backend_available() ? 7 : 1));
+
+        if (program_ast) {
+            free_ast_node(program_ast);
+            program_ast = NULL;
+        }
+        reset_compiler_options();
+    }
+
+    SECTION("ccompiler_main interprets main with --interp") {
+        reset_compiler_options();
+        yyin = NULL;
+
+        program_ast = build_stub_function("main", 7);
+
+        char prog[] = "ccompiler";
+        char interp_flag[] = "--interp";
+        char input_file[] = "unit_interp.c";
+        char* argv[] = {prog, interp_flag, input_file};
+
+        FILE* input = fopen(input_file, "w");
+        REQUIRE(input != nullptr);
+        fputs("int main() { return 7; }\n", input);
+        fclose(input);
+
+        /* No LLVM needed: the status is always main's return value */
+        int status = ccompiler_main(3, argv);
+        std::remove(input_file);
+        REQUIRE(status == 7);
+
+        if (program_ast) {
+            free_ast_node(program_ast);
+            program_ast = NULL;
+        }
+        reset_compiler_options();
+    }
+
+    SECTION("ccompiler_main writes LLVM bitcode with --emit=bc") {
+        reset_compiler_options();
+        yyin = NULL;
+
+        program_ast = build_stub_function("main", 7);
+
+        char prog[] = "ccompiler";
+        char emit_flag[] = "--emit=bc";
+        char output_flag[] = "-o";
+        char output_file[] = "unit_main.bc";
+        char* argv[] = {prog, emit_flag, output_flag, output_file};
+
+        std::remove(output_file);
+        REQUIRE(ccompiler_main(4, argv) == 0);
+
+        FILE* produced = fopen(output_file, "rb");
+        REQUIRE(produced != nullptr);
+        unsigned char header[8] = {0};
+        REQUIRE(fread(header, 1, 8, produced) == 8);
+        REQUIRE(fseek(produced, 0, SEEK_END) == 0);
+        long size = ftell(produced);
+        fclose(produced);
+        std::remove(output_file);
+        /* Magic, then the identification block: whole 32-bit words */
+        REQUIRE(memcmp(header, "BC\xc0\xde", 4) == 0);
+        REQUIRE(header[4] == 0x35); /* ENTER_SUBBLOCK 13, width 2 */
+        REQUIRE(size % 4 == 0);
+
+        if (program_ast) {
+            free_ast_node(program_ast);
+            program_ast = NULL;
+        }
+        reset_compiler_options();
+    }
+
     SECTION("ccompiler_main verbose modes") {
         reset_compiler_options();
         yyin = NULL;
@@ -354,8 +668,8 @@ TEST_CASE("Memory Management") {
     SECTION("Context creation") {
         MemoryContext* ctx = create_memory_context();
         REQUIRE(ctx != nullptr);
-        REQUIRE(ctx->stats.allocations == 0);
-        REQUIRE(ctx->stats.deallocations == 0);
+        REQUIRE(get_memory_stats(ctx).allocations == 0);
+        REQUIRE(get_memory_stats(ctx).deallocations == 0);
         free_memory_context(ctx);
     }
 
@@ -367,14 +681,101 @@ TEST_CASE("Memory Management") {
 
         void* ptr = safe_malloc_debug(32, "unit", 120, "test");
         REQUIRE(ptr != nullptr);
-        REQUIRE(ctx->stats.allocations > 0);
+        REQUIRE(get_memory_stats(ctx).allocations > 0);
 
         safe_free_debug(ptr, "unit", 121, "test");
-        REQUIRE(ctx->stats.deallocations == ctx->stats.allocations);
+        MemoryStats stats = get_memory_stats(ctx);
+        REQUIRE(stats.deallocations == stats.allocations);
         REQUIRE(check_memory_leaks(ctx) == false);
 
         cleanup_memory_management();
     }
+
+    SECTION("Debug tracking survives many live blocks") {
+        cleanup_memory_management();
+        init_memory_management();
+        MemoryContext* ctx = g_memory_context;
+        enable_memory_debugging(ctx);
+
+        std::vector<void*> blocks;
+        for (int i = 0; i < 20000; i++) {
+            blocks.push_back(safe_malloc_debug(16, "unit", 130, "test"));
+        }
+        REQUIRE(count_live_blocks(ctx) == 20000);
+
+        /* Free every other block first to leave tombstones in the tables */
+        for (size_t i = 0; i < blocks.size(); i += 2) {
+            safe_free_debug(blocks[i], "unit", 131, "test");
+        }
+        REQUIRE(count_live_blocks(ctx) == 10000);
+        for (size_t i = 1; i < blocks.size(); i += 2) {
+            safe_free_debug(blocks[i], "unit", 132, "test");
+        }
+
+        MemoryStats stats = get_memory_stats(ctx);
+        REQUIRE(count_live_blocks(ctx) == 0);
+        REQUIRE(stats.bytes_freed == stats.bytes_allocated);
+        REQUIRE(stats.current_usage == 0);
+        /* The peak is published in 64 KiB steps per thread */
+        REQUIRE(stats.peak_usage >= 20000 * 16 - 64 * 1024);
+
+        cleanup_memory_management();
+    }
+
+    SECTION("Sampling tracks every Nth allocation") {
+        cleanup_memory_management();
+        init_memory_management();
+        MemoryContext* ctx = g_memory_context;
+        enable_memory_debugging(ctx);
+        set_memory_sample_rate(ctx, 4);
+
+        std::vector<void*> blocks;
+        for (int i = 0; i < 100; i++) {
+            blocks.push_back(safe_malloc_debug(8, "unit", 140, "test"));
+        }
+        REQUIRE(count_live_blocks(ctx) == 25);
+        REQUIRE(get_memory_stats(ctx).allocations == 100);
+
+        for (void* block : blocks) {
+            safe_free_debug(block, "unit", 141, "test");
+        }
+        MemoryStats stats = get_memory_stats(ctx);
+        REQUIRE(count_live_blocks(ctx) == 0);
+        REQUIRE(stats.deallocations == 100);
+        REQUIRE(stats.bytes_freed == stats.bytes_allocated);
+
+        cleanup_memory_management();
+    }
+
+    SECTION("Counters stay exact across threads") {
+        cleanup_memory_management();
+        init_memory_management();
+        MemoryContext* ctx = g_memory_context;
+        enable_memory_debugging(ctx);
+
+        const int thread_count = 4;
+        const int iterations = 5000;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; t++) {
+            threads.emplace_back([]() {
+                for (int i = 0; i < iterations; i++) {
+                    void* ptr = safe_malloc_debug(24, "unit", 150, "test");
+                    safe_free_debug(ptr, "unit", 151, "test");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        MemoryStats stats = get_memory_stats(ctx);
+        REQUIRE(stats.allocations == (size_t)thread_count * iterations);
+        REQUIRE(stats.deallocations == stats.allocations);
+        REQUIRE(stats.current_usage == 0);
+        REQUIRE(count_live_blocks(ctx) == 0);
+
+        cleanup_memory_management();
+    }
 }
 
 TEST_CASE("Code Generation Utilities") {
@@ -412,6 +813,7 @@ TEST_CASE("Code Generation Utilities") {
         generate_return_statement(ctx, void_return);
         free_ast_node(void_return);
 
+        REQUIRE(codegen_flush_output(ctx) == 0);
         std::string ir = read_tmp_file(output);
         REQUIRE(ir.find("ret i32 7") != std::string::npos);
         REQUIRE(ir.find("ret void") != std::string::npos);
@@ -419,6 +821,635 @@ TEST_CASE("Code Generation Utilities") {
         free_codegen_context(ctx);
         fclose(output);
     }
+
+    SECTION("Values are numbered and types are canonical") {
+        CodeGenContext* ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+
+        TypeInfo* int_type = canonical_basic_type(ctx, TYPE_INT);
+        TypeInfo* parsed = create_pointer_type(create_type_info(TYPE_INT));
+        REQUIRE(canonical_type(ctx, parsed) ==
+                canonical_pointer_type(ctx, int_type));
+        REQUIRE(canonical_type(ctx, parsed)->return_type == int_type);
+
+        /* Spellings are built once and shared */
+        const char* spelling = llvm_type_name(ctx, parsed);
+        REQUIRE(std::string(spelling) == "i32*");
+        REQUIRE(canonical_type_name(canonical_type(ctx, parsed)) == spelling);
+        REQUIRE(std::string(canonical_type_name(nullptr)) == "void");
+        free_type_info(parsed);
+
+        TypeInfo* four = create_array_type(create_type_info(TYPE_CHAR), 4);
+        TypeInfo* five = create_array_type(create_type_info(TYPE_CHAR), 5);
+        REQUIRE(canonical_type(ctx, four) != canonical_type(ctx, five));
+        free_type_info(four);
+        free_type_info(five);
+
+        /* Integer operations on constants fold as they are lowered */
+        ASTNode* sum = create_binary_op_node(
+            OP_ADD, create_constant_node(2, TYPE_INT),
+            create_binary_op_node(OP_LSHIFT, create_constant_node(3, TYPE_INT),
+                                  create_constant_node(1, TYPE_INT)));
+        LLVMValue value = generate_binary_op(ctx, sum);
+        free_ast_node(sum);
+        REQUIRE(value.type == LLVM_VALUE_CONSTANT);
+        REQUIRE(value.id == 8);
+        REQUIRE(value.llvm_type == int_type);
+
+        /* Unsigned operands fold as unsigned, like the evaluator */
+        ASTNode* unsigned_ops[3] = {
+            create_binary_op_node(OP_DIV,
+                                  create_constant_node(4000000000u, TYPE_UNSIGNED),
+                                  create_constant_node(3, TYPE_UNSIGNED)),
+            create_binary_op_node(
+                OP_LT, create_unary_op_node(UOP_MINUS, create_constant_node(1, TYPE_INT)),
+                create_constant_node(0, TYPE_UNSIGNED)),
+            create_binary_op_node(OP_GT,
+                                  create_constant_node(4000000000u, TYPE_UNSIGNED),
+                                  create_constant_node(5, TYPE_UNSIGNED))};
+        int unsigned_results[3] = {1333333333, 0, 1};
+        for (int i = 0; i < 3; i++) {
+            value = generate_binary_op(ctx, unsigned_ops[i]);
+            free_ast_node(unsigned_ops[i]);
+            REQUIRE(value.type == LLVM_VALUE_CONSTANT);
+            REQUIRE(value.id == unsigned_results[i]);
+        }
+
+        /* sizeof does not evaluate its operand */
+        char name_y[] = "y";
+        ASTNode* size = create_unary_op_node(
+            UOP_SIZEOF, create_unary_op_node(UOP_POSTINC, create_identifier_node(name_y)));
+        value = generate_unary_op(ctx, size);
+        free_ast_node(size);
+        REQUIRE(value.type == LLVM_VALUE_CONSTANT);
+        REQUIRE(value.id == 4);
+
+        /* Division by zero is left for run time */
+        ASTNode* quotient = create_binary_op_node(
+            OP_DIV, create_constant_node(1, TYPE_INT),
+            create_constant_node(0, TYPE_INT));
+        value = generate_binary_op(ctx, quotient);
+        free_ast_node(quotient);
+        REQUIRE(value.type == LLVM_VALUE_REGISTER);
+        REQUIRE(value.name == nullptr);
+        REQUIRE(value.id == 1);
+        REQUIRE(value.llvm_type == int_type);
+
+        char operand[MAX_OPERAND_STRING_LENGTH];
+        format_operand(&value, operand, sizeof(operand));
+        REQUIRE(std::string(operand) == "%1");
+        REQUIRE(get_next_basic_block(ctx) == 1);
+
+        /* Instructions outside a function are held until flushed */
+        REQUIRE(ctx->out.length == 0);
+        REQUIRE(codegen_flush_output(ctx) == 0);
+        char* ir = ir_buffer_release(&ctx->out, NULL);
+        REQUIRE(std::string(ir) == "  %1 = sdiv i32 1, 0\n");
+        free(ir);
+        free_codegen_context(ctx);
+    }
+
+    SECTION("Functions are built in memory and printed separately") {
+        TypeTable types = {};
+        TypeInfo* i32 = type_table_basic(&types, TYPE_INT);
+        TypeInfo* i1 = type_table_basic(&types, TYPE_BOOL);
+        TypeInfo* i8_ptr =
+            type_table_pointer(&types, type_table_basic(&types, TYPE_CHAR));
+
+        IRBuilder builder;
+        ir_builder_init(&builder);
+        IRValue n = ir_value(IR_VALUE_LOCAL, 0, "n", i32);
+        IRFunction* function =
+            ir_builder_begin_function(&builder, "f", "internal ", i32, &n, 1);
+        REQUIRE(function->first_block->id == 0);
+
+        IRValue slot = ir_value(IR_VALUE_LOCAL, 0, "x",
+                                type_table_pointer(&types, i32));
+        ir_build_alloca(&builder, slot, i32);
+        ir_build_store(&builder, i32, n, slot);
+        ir_build_icmp(&builder, IR_ICMP_SGT, ir_register(1, i1), i32, n,
+                      ir_constant(0, i32));
+        ir_build_cond_br(&builder, ir_register(1, i1), 1, 2);
+        ir_builder_set_block(&builder, 1);
+        IRValue format = ir_value(IR_VALUE_GLOBAL, 0, ".str.0", i8_ptr);
+        ir_build_call(&builder, ir_register(2, i32), i32, "printf", &i8_ptr, 1,
+                      1, &format, 1);
+        ir_build_br(&builder, 2);
+        ir_builder_set_block(&builder, 2);
+        IRValue incoming[2] = {ir_constant(1, i1), ir_constant(0, i1)};
+        int predecessors[2] = {0, 1};
+        ir_build_phi(&builder, ir_register(3, i1), i1, incoming, predecessors,
+                     2);
+        ir_build_cast(&builder, IR_ZEXT, ir_register(4, i32),
+                      ir_register(3, i1), i32);
+        ir_build_ret(&builder, i32, ir_register(4, i32));
+
+        IRBuffer out;
+        ir_buffer_init(&out, NULL);
+        ir_print_function(&out, function, 0);
+        size_t length = 0;
+        char* text = ir_buffer_release(&out, &length);
+        REQUIRE(std::string(text, length) ==
+                "define internal i32 @f(i32 %n) {\n"
+                "  %x = alloca i32\n"
+                "  store i32 %n, i32* %x\n"
+                "  %1 = icmp sgt i32 %n, 0\n"
+                "  br i1 %1, label %bb1, label %bb2\n"
+                "bb1:\n"
+                "  %2 = call i32 (i8*, ...) @printf(i8* @.str.0)\n"
+                "  br label %bb2\n"
+                "bb2:\n"
+                "  %3 = phi i1 [ true, %0 ], [ false, %bb1 ]\n"
+                "  %4 = zext i1 %3 to i32\n"
+                "  ret i32 %4\n"
+                "  }\n\n");
+        free(text);
+
+        /* Pointer types become ptr; compact output drops the comment and
+         * the layout */
+        ir_build_comment(&builder, "done");
+        ir_print_function(&out, function,
+                          IR_PRINT_OPAQUE_POINTERS | IR_PRINT_COMPACT);
+        text = ir_buffer_release(&out, &length);
+        REQUIRE(std::string(text, length) ==
+                "define internal i32 @f(i32 %n) {\n"
+                "%x = alloca i32\n"
+                "store i32 %n, ptr %x\n"
+                "%1 = icmp sgt i32 %n, 0\n"
+                "br i1 %1, label %bb1, label %bb2\n"
+                "bb1:\n"
+                "%2 = call i32 (ptr, ...) @printf(ptr @.str.0)\n"
+                "br label %bb2\n"
+                "bb2:\n"
+                "%3 = phi i1 [ true, %0 ], [ false, %bb1 ]\n"
+                "%4 = zext i1 %3 to i32\n"
+                "ret i32 %4\n"
+                "}\n");
+        free(text);
+
+        /* Resetting drops the function; the arena is reused */
+        ir_builder_reset(&builder);
+        REQUIRE(builder.function == nullptr);
+        ir_build_comment(&builder, "loose");
+        REQUIRE(builder.function->name == nullptr);
+        ir_print_function(&out, builder.function, 0);
+        text = ir_buffer_release(&out, &length);
+        REQUIRE(std::string(text, length) == "  ; loose\n");
+        free(text);
+
+        ir_buffer_free(&out);
+        ir_builder_free(&builder);
+        type_table_free(&types);
+    }
+
+    SECTION("Allocas are hoisted to the entry block") {
+        TypeTable types = {};
+        TypeInfo* i32 = type_table_basic(&types, TYPE_INT);
+        TypeInfo* i32_ptr = type_table_pointer(&types, i32);
+
+        IRBuilder builder;
+        ir_builder_init(&builder);
+        IRFunction* function =
+            ir_builder_begin_function(&builder, "g", "", i32, NULL, 0);
+        IRValue x = ir_value(IR_VALUE_LOCAL, 0, "x", i32_ptr);
+        IRValue y = ir_value(IR_VALUE_LOCAL, 0, "y", i32_ptr);
+        ir_build_alloca(&builder, x, i32);
+        ir_build_store(&builder, i32, ir_constant(1, i32), x);
+        ir_build_br(&builder, 1);
+        ir_builder_set_block(&builder, 1);
+        ir_build_alloca(&builder, y, i32);
+        ir_build_store(&builder, i32, ir_constant(2, i32), y);
+        ir_build_ret(&builder, i32, ir_constant(0, i32));
+
+        IRBuffer out;
+        ir_buffer_init(&out, NULL);
+        ir_print_function(&out, function, IR_PRINT_COMPACT);
+        size_t length = 0;
+        char* text = ir_buffer_release(&out, &length);
+        REQUIRE(std::string(text, length) ==
+                "define i32 @g() {\n"
+                "%x = alloca i32\n"
+                "%y = alloca i32\n"
+                "store i32 1, i32* %x\n"
+                "br label %bb1\n"
+                "bb1:\n"
+                "store i32 2, i32* %y\n"
+                "ret i32 0\n"
+                "}\n");
+        free(text);
+
+        ir_buffer_free(&out);
+        ir_builder_free(&builder);
+        type_table_free(&types);
+    }
+
+    SECTION("Switches branch to a block per case") {
+        TypeTable types = {};
+        TypeInfo* i32 = type_table_basic(&types, TYPE_INT);
+        TypeInfo* i32_ptr = type_table_pointer(&types, i32);
+
+        IRBuilder builder;
+        ir_builder_init(&builder);
+        IRValue n = ir_value(IR_VALUE_LOCAL, 0, "n", i32);
+        IRFunction* function =
+            ir_builder_begin_function(&builder, "f", "", i32, &n, 1);
+        IRValue r = ir_value(IR_VALUE_LOCAL, 0, "r", i32_ptr);
+        IRValue values[2] = {ir_constant(1, i32), ir_constant(2, i32)};
+        int blocks[2] = {1, 2};
+        ir_build_alloca(&builder, r, i32);
+        ir_build_store(&builder, i32, ir_constant(0, i32), r);
+        ir_build_switch(&builder, n, 3, values, blocks, 2);
+        ir_builder_set_block(&builder, 1);
+        ir_build_store(&builder, i32, ir_constant(10, i32), r);
+        ir_build_br(&builder, 2); /* Falls through into case 2 */
+        ir_builder_set_block(&builder, 2);
+        ir_build_store(&builder, i32, ir_constant(20, i32), r);
+        ir_build_br(&builder, 3);
+        ir_builder_set_block(&builder, 3);
+        ir_build_load(&builder, ir_register(1, i32), i32, r);
+        ir_build_ret(&builder, i32, ir_register(1, i32));
+        REQUIRE(ssa_promote_locals(&builder) == 1);
+
+        IRBuffer out;
+        ir_buffer_init(&out, NULL);
+        ir_print_function(&out, function, IR_PRINT_COMPACT);
+        size_t length = 0;
+        char* text = ir_buffer_release(&out, &length);
+        REQUIRE(std::string(text, length) ==
+                "define i32 @f(i32 %n) {\n"
+                "switch i32 %n, label %bb3 [ i32 1, label %bb1 "
+                "i32 2, label %bb2 ]\n"
+                "bb1:\n"
+                "br label %bb2\n"
+                "bb2:\n"
+                "br label %bb3\n"
+                "bb3:\n"
+                "%1 = phi i32 [ 0, %0 ], [ 20, %bb2 ]\n"
+                "ret i32 %1\n"
+                "}\n");
+        free(text);
+
+        ir_buffer_free(&out);
+        ir_builder_free(&builder);
+        type_table_free(&types);
+    }
+
+    SECTION("Scalar locals are promoted to SSA values") {
+        TypeTable types = {};
+        TypeInfo* i32 = type_table_basic(&types, TYPE_INT);
+        TypeInfo* i1 = type_table_basic(&types, TYPE_BOOL);
+
+        IRBuilder builder;
+        ir_builder_init(&builder);
+        IRValue n = ir_value(IR_VALUE_LOCAL, 0, "n", i32);
+        IRFunction* function =
+            ir_builder_begin_function(&builder, "f", "", i32, &n, 1);
+
+        /* int x; if (n > 0) x = 1; else x = n; while (x < 10) x = x + 1;
+         * return x; with an unreachable tail after the return */
+        IRValue slot = ir_value(IR_VALUE_LOCAL, 0, "x",
+                                type_table_pointer(&types, i32));
+        ir_build_alloca(&builder, slot, i32);
+        ir_build_icmp(&builder, IR_ICMP_SGT, ir_register(1, i1), i32, n,
+                      ir_constant(0, i32));
+        ir_build_cond_br(&builder, ir_register(1, i1), 1, 2);
+        ir_builder_set_block(&builder, 1);
+        ir_build_store(&builder, i32, ir_constant(1, i32), slot);
+        ir_build_br(&builder, 3);
+        ir_builder_set_block(&builder, 2);
+        ir_build_store(&builder, i32, n, slot);
+        ir_builder_set_block(&builder, 3);
+        ir_build_load(&builder, ir_register(2, i32), i32, slot);
+        ir_build_icmp(&builder, IR_ICMP_SLT, ir_register(3, i1), i32,
+                      ir_register(2, i32), ir_constant(10, i32));
+        ir_build_cond_br(&builder, ir_register(3, i1), 4, 5);
+        ir_builder_set_block(&builder, 4);
+        ir_build_load(&builder, ir_register(4, i32), i32, slot);
+        ir_build_binary(&builder, IR_ADD, ir_register(5, i32), i32,
+                        ir_register(4, i32), ir_constant(1, i32));
+        ir_build_store(&builder, i32, ir_register(5, i32), slot);
+        ir_build_br(&builder, 3);
+        ir_builder_set_block(&builder, 5);
+        ir_build_load(&builder, ir_register(6, i32), i32, slot);
+        ir_build_ret(&builder, i32, ir_register(6, i32));
+        ir_build_br(&builder, 6);
+        ir_builder_set_block(&builder, 6);
+        ir_build_ret(&builder, i32, ir_constant(0, i32));
+
+        REQUIRE(ssa_promote_locals(&builder) == 1);
+
+        IRBuffer out;
+        ir_buffer_init(&out, NULL);
+        ir_print_function(&out, function, IR_PRINT_COMPACT);
+        size_t length = 0;
+        char* text = ir_buffer_release(&out, &length);
+        REQUIRE(std::string(text, length) ==
+                "define i32 @f(i32 %n) {\n"
+                "%1 = icmp sgt i32 %n, 0\n"
+                "br i1 %1, label %bb1, label %bb2\n"
+                "bb1:\n"
+                "br label %bb3\n"
+                "bb2:\n"
+                "br label %bb3\n"
+                "bb3:\n"
+                "%2 = phi i32 [ 1, %bb1 ], [ %n, %bb2 ], [ %4, %bb4 ]\n"
+                "%3 = icmp slt i32 %2, 10\n"
+                "br i1 %3, label %bb4, label %bb5\n"
+                "bb4:\n"
+                "%4 = add i32 %2, 1\n"
+                "br label %bb3\n"
+                "bb5:\n"
+                "ret i32 %2\n"
+                "}\n");
+        free(text);
+
+        ir_buffer_free(&out);
+        ir_builder_free(&builder);
+        type_table_free(&types);
+    }
+
+    SECTION("Identical string literals share one constant") {
+        CodeGenContext* ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+
+        char hello[] = "\"hi \\\"there\\\"\\n\"";
+        char other[] = "\"bye\"";
+        ASTNode* literals[] = {create_string_literal_node(hello),
+                               create_string_literal_node(other),
+                               create_string_literal_node(hello)};
+        std::string names[3];
+        for (int i = 0; i < 3; i++) {
+            LLVMValue value = generate_string_literal(ctx, literals[i]);
+            names[i] = value.name;
+            free_ast_node(literals[i]);
+        }
+
+        REQUIRE(names[0] == ".str.0");
+        REQUIRE(names[1] == ".str.1");
+        REQUIRE(names[2] == names[0]);
+        REQUIRE(ctx->constants.count == 2);
+        REQUIRE(std::string(ctx->constants.head->declaration) ==
+                "@.str.0 = private unnamed_addr constant [12 x i8] "
+                "c\"hi \\22there\\22\\0A\\00\"");
+        free_codegen_context(ctx);
+    }
+
+    SECTION("Struct sizes are reported as unsupported") {
+        CodeGenContext* ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+        ctx->quiet_diagnostics = 1;
+
+        TypeInfo* point = create_type_info(TYPE_STRUCT);
+        point->struct_name = strdup("Point");
+        TypeInfo* number = create_type_info(TYPE_INT);
+        REQUIRE(get_type_size(ctx, number) == 4);
+        REQUIRE(ctx->error_count == 0);
+        REQUIRE(get_type_size(ctx, point) == 0);
+        REQUIRE(ctx->error_count == 1);
+        REQUIRE(strstr(ctx->diagnostics->message, "Struct layout unsupported") !=
+                nullptr);
+
+        free_type_info(point);
+        free_type_info(number);
+        free_codegen_context(ctx);
+    }
+
+    SECTION("Global declarations keep their order and full length") {
+        CodeGenContext* ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+
+        std::string long_value(5000, 'x');
+        for (int i = 0; i < 3; i++) {
+            emit_global_declaration(ctx, "@g%d = global i32 %d", i, i);
+        }
+        emit_global_declaration(ctx, "@long = constant [%d x i8] c\"%s\"",
+                                (int)long_value.size(), long_value.c_str());
+        REQUIRE(ctx->constants.count == 4);
+        REQUIRE(ctx->constants.tail->length ==
+                strlen(ctx->constants.tail->declaration));
+        REQUIRE(ctx->constants.tail->length > long_value.size());
+
+        constant_section_write(&ctx->constants, &ctx->out);
+        REQUIRE(ctx->constants.head == nullptr);
+        size_t length = 0;
+        char* text = ir_buffer_release(&ctx->out, &length);
+        REQUIRE(std::string(text, length) ==
+                "@g0 = global i32 0\n@g1 = global i32 1\n@g2 = global i32 2\n"
+                "@long = constant [5000 x i8] c\"" +
+                    long_value + "\"\n");
+        free(text);
+        free_codegen_context(ctx);
+    }
+
+    SECTION("Integer constant expressions follow C's types") {
+        CodeGenContext* ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+        ConstantValue value;
+
+        /* -1 < 0u compares as unsigned */
+        ASTNode* expr = create_binary_op_node(
+            OP_LT, create_unary_op_node(UOP_MINUS, create_constant_node(1, TYPE_INT)),
+            create_constant_node(0, TYPE_UNSIGNED));
+        REQUIRE(evaluate_constant_expression(ctx, expr, &value));
+        REQUIRE(value.value == 0);
+        free_ast_node(expr);
+
+        /* 1L << 40 is a 64-bit long */
+        expr = create_binary_op_node(OP_LSHIFT, create_constant_node(1, TYPE_LONG),
+                                     create_constant_node(40, TYPE_INT));
+        REQUIRE(evaluate_constant_expression(ctx, expr, &value));
+        REQUIRE(value.bits == 64);
+        REQUIRE(value.value == (1LL << 40));
+        free_ast_node(expr);
+
+        /* Division by zero is not constant, unless its arm is not taken */
+        ASTNode* quotient = create_binary_op_node(
+            OP_DIV, create_constant_node(1, TYPE_INT), create_constant_node(0, TYPE_INT));
+        REQUIRE_FALSE(evaluate_constant_expression(ctx, quotient, &value));
+        expr = create_ast_node(AST_CONDITIONAL);
+        expr->data.conditional_expr.condition = create_constant_node(0, TYPE_INT);
+        expr->data.conditional_expr.then_expr = quotient;
+        expr->data.conditional_expr.else_expr = create_constant_node(2, TYPE_INT);
+        REQUIRE(evaluate_constant_expression(ctx, expr, &value));
+        REQUIRE(value.value == 2);
+        free_ast_node(expr);
+
+        /* Enumerators count up from the last explicit value */
+        char name_a[] = "A", name_b[] = "B";
+        ASTNode* enumerators = create_binary_op_node(
+            OP_ASSIGN, create_identifier_node(name_a), create_constant_node(5, TYPE_INT));
+        enumerators->next = create_identifier_node(name_b);
+        ASTNode* decl = create_ast_node(AST_ENUM_DECL);
+        decl->data.enum_decl.enumerators = enumerators;
+        decl->next = build_stub_function("stub", 0);
+        generate_llvm_ir(ctx, decl);
+        ASTNode* b = create_identifier_node(name_b);
+        REQUIRE(evaluate_constant_expression(ctx, b, &value));
+        REQUIRE(value.value == 6);
+        free_ast_node(b);
+        free_ast_node(decl);
+        free_codegen_context(ctx);
+    }
+
+    SECTION("Conditions branch on i1 without widening it") {
+        CodeGenContext* ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+        char name[] = "x";
+        Symbol* x = create_symbol(name, create_type_info(TYPE_INT));
+        x->is_global = 1;
+        add_global_symbol(ctx, x);
+
+        /* if (x < 3 && !(x == 7)) {} */
+        ASTNode* condition = create_binary_op_node(
+            OP_AND,
+            create_binary_op_node(OP_LT, create_identifier_node(name),
+                                  create_constant_node(3, TYPE_INT)),
+            create_unary_op_node(
+                UOP_NOT,
+                create_binary_op_node(OP_EQ, create_identifier_node(name),
+                                      create_constant_node(7, TYPE_INT))));
+        ASTNode* stmt = create_if_stmt_node(
+            condition, create_compound_stmt_node(NULL), NULL);
+        generate_statement(ctx, stmt);
+        free_ast_node(stmt);
+
+        REQUIRE(codegen_flush_output(ctx) == 0);
+        char* ir = ir_buffer_release(&ctx->out, NULL);
+        /* The && chains the comparisons and the ! only swaps the targets */
+        REQUIRE(std::string(ir) ==
+                "  ; if statement\n"
+                "  %1 = load i32, i32* @x\n"
+                "  %2 = icmp slt i32 %1, 3\n"
+                "  br i1 %2, label %bb4, label %bb2\n"
+                "bb4:\n"
+                "  %3 = load i32, i32* @x\n"
+                "  %4 = icmp eq i32 %3, 7\n"
+                "  br i1 %4, label %bb2, label %bb1\n"
+                "bb1:\n"
+                "  br label %bb3\n"
+                "bb2:\n"
+                "  br label %bb3\n"
+                "bb3:\n");
+        free(ir);
+        free_codegen_context(ctx);
+
+        /* for (; x < 3;) {} */
+        ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+        x = create_symbol(name, create_type_info(TYPE_INT));
+        x->is_global = 1;
+        add_global_symbol(ctx, x);
+        ASTNode* header = create_ast_node(AST_EXPRESSION_STMT);
+        header->data.return_stmt.expression =
+            create_binary_op_node(OP_LT, create_identifier_node(name),
+                                  create_constant_node(3, TYPE_INT));
+        stmt = create_for_stmt_node(NULL, header, NULL,
+                                    create_compound_stmt_node(NULL));
+        generate_statement(ctx, stmt);
+        free_ast_node(stmt);
+
+        REQUIRE(codegen_flush_output(ctx) == 0);
+        ir = ir_buffer_release(&ctx->out, NULL);
+        REQUIRE(std::string(ir) ==
+                "  ; for statement\n"
+                "  br label %bb1\n"
+                "bb1:\n"
+                "  %1 = load i32, i32* @x\n"
+                "  %2 = icmp slt i32 %1, 3\n"
+                "  br i1 %2, label %bb2, label %bb4\n"
+                "bb2:\n"
+                "  br label %bb3\n"
+                "bb3:\n"
+                "  br label %bb1\n"
+                "bb4:\n");
+        free(ir);
+        free_codegen_context(ctx);
+    }
+
+    SECTION("Streamed constants precede the function bodies") {
+        CodeGenContext* ctx = create_buffered_codegen_context();
+        REQUIRE(ctx != nullptr);
+        ctx->stream_constants = 1;
+
+        ASTNode* program = build_stub_function("stub", 3);
+        generate_llvm_ir(ctx, program);
+        free_ast_node(program);
+
+        size_t length = 0;
+        char* text = ir_buffer_release(&ctx->out, &length);
+        std::string ir(text, length);
+        free(text);
+        REQUIRE(ir.find("declare i32 @printf") < ir.find("define i32 @stub"));
+        REQUIRE(ir.find("; Global constants") == std::string::npos);
+        free_codegen_context(ctx);
+    }
+}
+
+TEST_CASE("IR Output Buffer") {
+    SECTION("Formats integers and strings without stdio") {
+        IRBuffer buffer;
+        ir_buffer_init(&buffer, NULL);
+        ir_buffer_format(&buffer, "%%%s = add i32 %d, %d", "x", -2147483647 - 1,
+                         42);
+        ir_buffer_append_char(&buffer, ' ');
+        ir_buffer_append_uint(&buffer, 18446744073709551615ULL);
+        ir_buffer_format(&buffer, " %zu %lld %c", (size_t)7, -5LL, 'z');
+        ir_buffer_format(&buffer, " %.2f", 1.5); /* vsnprintf fallback */
+
+        size_t length = 0;
+        char* text = ir_buffer_release(&buffer, &length);
+        REQUIRE(std::string(text) ==
+                "%x = add i32 -2147483648, 42 18446744073709551615 7 -5 z 1.50");
+        REQUIRE(length == strlen(text));
+        free(text);
+        ir_buffer_free(&buffer);
+    }
+
+    SECTION("Spans and large output reach the file in order") {
+        FILE* output = tmpfile();
+        REQUIRE(output != nullptr);
+        IRBuffer buffer;
+        ir_buffer_init(&buffer, output);
+
+        std::string expected;
+        for (int i = 0; i < 200000; i++) {
+            ir_buffer_format(&buffer, "  %%%d = add i32 %%a, %d\n", i, i);
+            expected += "  %" + std::to_string(i) + " = add i32 %a, " +
+                        std::to_string(i) + "\n";
+        }
+        char first[] = "span one\n";
+        char second[] = "span two\n";
+        struct iovec spans[] = {{first, strlen(first)},
+                                {second, strlen(second)}};
+        ir_buffer_append_spans(&buffer, spans, 2);
+        ir_buffer_append_str(&buffer, "tail\n");
+        expected += "span one\nspan two\ntail\n";
+
+        REQUIRE(ir_buffer_flush(&buffer) == 0);
+        REQUIRE(read_tmp_file(output) == expected);
+        ir_buffer_free(&buffer);
+        fclose(output);
+    }
+
+    SECTION("Mapped output file is trimmed to the text") {
+        const char* path = "unit_mapped.ll";
+        IRBuffer buffer;
+        ir_buffer_init(&buffer, NULL);
+        REQUIRE(ir_buffer_map_file(&buffer, path) == 0);
+        std::string expected;
+        for (int i = 0; i < 20000; i++) {
+            ir_buffer_format(&buffer, "line %d\n", i);
+            expected += "line " + std::to_string(i) + "\n";
+        }
+        ir_buffer_free(&buffer);
+        REQUIRE(buffer.error == 0);
+
+        FILE* file = fopen(path, "r");
+        REQUIRE(file != nullptr);
+        REQUIRE(read_tmp_file(file) == expected);
+        fclose(file);
+        remove(path);
+    }
 }
 
 TEST_CASE("Error Handling") {
@@ -37,15 +37,14 @@ TEST_CASE("Pointer Features") {
         addr_expr->data.unary_op.op = UOP_ADDR;
         addr_expr->data.unary_op.operand = create_identifier_node(safe_strdup("x"));
         
-        LLVMValue* result = generate_unary_op(ctx, addr_expr);
+        LLVMValue result = generate_unary_op(ctx, addr_expr);
         
-        REQUIRE(result != nullptr);
-        REQUIRE(result->type == LLVM_VALUE_REGISTER);
-        REQUIRE(result->llvm_type != nullptr);
-        REQUIRE(result->llvm_type->base_type == TYPE_POINTER);
+        REQUIRE(result.type != LLVM_VALUE_NONE);
+        REQUIRE(result.type == LLVM_VALUE_REGISTER);
+        REQUIRE(result.llvm_type != nullptr);
+        REQUIRE(result.llvm_type->base_type == TYPE_POINTER);
         
         free_ast_node(addr_expr);
-        if (result) free_llvm_value(result);
         free_codegen_context(ctx);
         fclose(output);
     }
@@ -65,15 +64,14 @@ TEST_CASE("Pointer Features") {
         deref_expr->data.unary_op.op = UOP_DEREF;
         deref_expr->data.unary_op.operand = create_identifier_node(safe_strdup("ptr"));
         
-        LLVMValue* result = generate_unary_op(ctx, deref_expr);
+        LLVMValue result = generate_unary_op(ctx, deref_expr);
         
-        REQUIRE(result != nullptr);
-        REQUIRE(result->type == LLVM_VALUE_REGISTER);
-        REQUIRE(result->llvm_type != nullptr);
-        REQUIRE(result->llvm_type->base_type == TYPE_INT);
+        REQUIRE(result.type != LLVM_VALUE_NONE);
+        REQUIRE(result.type == LLVM_VALUE_REGISTER);
+        REQUIRE(result.llvm_type != nullptr);
+        REQUIRE(result.llvm_type->base_type == TYPE_INT);
         
         free_ast_node(deref_expr);
-        if (result) free_llvm_value(result);
         free_codegen_context(ctx);
         fclose(output);
     }
@@ -94,15 +92,14 @@ TEST_CASE("Pointer Features") {
         add_expr->data.binary_op.left = create_identifier_node(safe_strdup("ptr"));
         add_expr->data.binary_op.right = create_constant_node(1, TYPE_INT);
         
-        LLVMValue* result = generate_binary_op(ctx, add_expr);
+        LLVMValue result = generate_binary_op(ctx, add_expr);
         
-        REQUIRE(result != nullptr);
-        REQUIRE(result->type == LLVM_VALUE_REGISTER);
-        REQUIRE(result->llvm_type != nullptr);
-        REQUIRE(result->llvm_type->base_type == TYPE_POINTER);
+        REQUIRE(result.type != LLVM_VALUE_NONE);
+        REQUIRE(result.type == LLVM_VALUE_REGISTER);
+        REQUIRE(result.llvm_type != nullptr);
+        REQUIRE(result.llvm_type->base_type == TYPE_POINTER);
         
         free_ast_node(add_expr);
-        if (result) free_llvm_value(result);
         free_codegen_context(ctx);
         fclose(output);
     }
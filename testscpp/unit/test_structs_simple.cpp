@@ -61,9 +61,9 @@ void test_struct_member_access() {
     member_access->data.member_access.is_pointer_access = 0; // dot operator
     
     // This should generate proper member access (expected to be incomplete initially)
-    LLVMValue* result = generate_member_access(ctx, member_access);
+    LLVMValue result = generate_member_access(ctx, member_access);
     
-    if (result && result->type == LLVM_VALUE_REGISTER) {
+    if (result.type == LLVM_VALUE_REGISTER) {
         std::cout << "✓ Struct member access test passed (basic implementation)\n";
         struct_tests_passed++;
     } else {
@@ -72,7 +72,6 @@ void test_struct_member_access() {
     }
     
     free_ast_node(member_access);
-    if (result) free_llvm_value(result);
     free_codegen_context(ctx);
     fclose(output);
 }
@@ -99,9 +98,9 @@ void test_struct_pointer_access() {
     member_access->data.member_access.is_pointer_access = 1; // arrow operator
     
     // This should generate proper pointer member access (expected to be incomplete initially)
-    LLVMValue* result = generate_member_access(ctx, member_access);
+    LLVMValue result = generate_member_access(ctx, member_access);
     
-    if (result && result->type == LLVM_VALUE_REGISTER) {
+    if (result.type == LLVM_VALUE_REGISTER) {
         std::cout << "✓ Struct pointer access test passed (basic implementation)\n";
         struct_tests_passed++;
     } else {
@@ -110,7 +109,6 @@ void test_struct_pointer_access() {
     }
     
     free_ast_node(member_access);
-    if (result) free_llvm_value(result);
     free_codegen_context(ctx);
     fclose(output);
 }
@@ -142,9 +140,9 @@ void test_struct_assignment() {
     assign_expr->data.binary_op.right = create_identifier_node(safe_strdup("p2"));
     
     // This should generate proper struct assignment (expected to be incomplete initially)
-    LLVMValue* result = generate_binary_op(ctx, assign_expr);
+    LLVMValue result = generate_binary_op(ctx, assign_expr);
     
-    if (result && result->type == LLVM_VALUE_REGISTER) {
+    if (result.type == LLVM_VALUE_REGISTER) {
         std::cout << "✓ Struct assignment test passed (may not be memberwise copy yet)\n";
         struct_tests_passed++;
     } else {
@@ -153,7 +151,6 @@ void test_struct_assignment() {
     }
     
     free_ast_node(assign_expr);
-    if (result) free_llvm_value(result);
     free_codegen_context(ctx);
     fclose(output);
 }
@@ -37,13 +37,12 @@ TEST_CASE("Struct Features") {
         member_access->data.member_access.member = safe_strdup("x");
         member_access->data.member_access.is_pointer_access = 0; // dot operator
         
-        LLVMValue* result = generate_member_access(ctx, member_access);
+        LLVMValue result = generate_member_access(ctx, member_access);
         
-        REQUIRE(result != nullptr);
-        REQUIRE(result->type == LLVM_VALUE_REGISTER);
+        REQUIRE(result.type != LLVM_VALUE_NONE);
+        REQUIRE(result.type == LLVM_VALUE_REGISTER);
         
         free_ast_node(member_access);
-        if (result) free_llvm_value(result);
         free_codegen_context(ctx);
         fclose(output);
     }
@@ -68,13 +67,12 @@ TEST_CASE("Struct Features") {
         member_access->data.member_access.member = safe_strdup("x");
         member_access->data.member_access.is_pointer_access = 1; // arrow operator
         
-        LLVMValue* result = generate_member_access(ctx, member_access);
+        LLVMValue result = generate_member_access(ctx, member_access);
         
-        REQUIRE(result != nullptr);
-        REQUIRE(result->type == LLVM_VALUE_REGISTER);
+        REQUIRE(result.type != LLVM_VALUE_NONE);
+        REQUIRE(result.type == LLVM_VALUE_REGISTER);
         
         free_ast_node(member_access);
-        if (result) free_llvm_value(result);
         free_codegen_context(ctx);
         fclose(output);
     }
@@ -0,0 +1,317 @@
+#include "catch2/catch.hpp"
+
+#include "../../srccpp/tinyc.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char* k_program =
+    "int add(int a, int b) { return a + b; }\n"
+    "int main() { return add(2, 3); }\n";
+
+TEST_CASE("Library API compiles from memory") {
+    SECTION("Valid program produces IR and no errors") {
+        tc_result result;
+        int status = tc_compile(k_program, strlen(k_program), NULL, &result);
+
+        REQUIRE(status == 0);
+        REQUIRE(result.ir != nullptr);
+        REQUIRE(result.ir_length == strlen(result.ir));
+        REQUIRE(strstr(result.ir, "define i32 @add(") != nullptr);
+        REQUIRE(strstr(result.ir, "define i32 @main(") != nullptr);
+        REQUIRE(result.error_count == 0);
+
+        tc_result_free(&result);
+        REQUIRE(result.ir == nullptr);
+        REQUIRE(result.diagnostic_count == 0);
+    }
+
+    SECTION("Syntax error is reported as a diagnostic") {
+        const char* source = "int main() {\n  return 1 +;\n}\n";
+        tc_options options = {"broken.c", 0, NULL, 0, NULL, 0, 0};
+        tc_result result;
+        int status = tc_compile(source, strlen(source), &options, &result);
+
+        REQUIRE(status != 0);
+        REQUIRE(result.error_count > 0);
+        REQUIRE(result.diagnostic_count > 0);
+        REQUIRE(result.diagnostics[0].severity == TC_SEVERITY_ERROR);
+        REQUIRE(result.diagnostics[0].line == 2);
+        REQUIRE(strcmp(result.diagnostics[0].file_name, "broken.c") == 0);
+
+        tc_result_free(&result);
+    }
+
+    SECTION("Repeated calls are independent") {
+        const char* broken = "int main( {";
+        tc_result result;
+        tc_compile(broken, strlen(broken), NULL, &result);
+        tc_result_free(&result);
+
+        REQUIRE(tc_compile(k_program, strlen(k_program), NULL, &result) == 0);
+        REQUIRE(result.diagnostic_count == 0);
+        tc_result_free(&result);
+    }
+
+    SECTION("Target triple selects the module layout") {
+        const char* source = "int main() { return sizeof(long); }\n";
+        tc_options options = {"target.c", 0, NULL, 0, "arm64-apple-darwin",
+                              0, 0};
+        tc_result result;
+        REQUIRE(tc_compile(source, strlen(source), &options, &result) == 0);
+        REQUIRE(strstr(result.ir, "target datalayout = \"e-m:o-i64:64-i128:"
+                                  "128-n32:64-S128\"") != nullptr);
+        REQUIRE(strstr(result.ir, "target triple = \"arm64-apple-darwin\"") !=
+                nullptr);
+        REQUIRE(strstr(result.ir, "ret i32 8") != nullptr);
+        tc_result_free(&result);
+
+        options.target = "sparc-sun-solaris";
+        REQUIRE(tc_compile(source, strlen(source), &options, &result) != 0);
+        tc_result_free(&result);
+    }
+
+    SECTION("SSA option promotes scalar locals") {
+        const char* source =
+            "int main() { int x = 2; x = x * 3; return x + 1; }\n";
+        tc_options options = {"ssa.c", 0, NULL, 0, NULL, 0, 0};
+        tc_result result;
+        REQUIRE(tc_compile(source, strlen(source), &options, &result) == 0);
+        REQUIRE(strstr(result.ir, "alloca") != nullptr);
+        tc_result_free(&result);
+
+        options.ssa = 1;
+        REQUIRE(tc_compile(source, strlen(source), &options, &result) == 0);
+        REQUIRE(strstr(result.ir, "alloca") == nullptr);
+        tc_result_free(&result);
+    }
+
+    SECTION("IR flags select the text form") {
+        const char* source = "int main() { int x = 1; int* p = &x; "
+                             "return *p; }\n";
+        tc_options options = {"flags.c", 0, NULL, 0, NULL, 0,
+                              TC_IR_OPAQUE_POINTERS | TC_IR_COMPACT};
+        tc_result result;
+        REQUIRE(tc_compile(source, strlen(source), &options, &result) == 0);
+        REQUIRE(strstr(result.ir, "i32*") == nullptr);
+        REQUIRE(strstr(result.ir, "ptr") != nullptr);
+        REQUIRE(strstr(result.ir, "; ") == nullptr);
+        tc_result_free(&result);
+    }
+
+    SECTION("Global initializers keep their full width") {
+        const char* source = "long big = 1L << 40;\n"
+                             "unsigned u = 4000000000u;\n"
+                             "char c = 300;\n"
+                             "int main() { return 0; }\n";
+        tc_result result;
+        REQUIRE(tc_compile(source, strlen(source), NULL, &result) == 0);
+        REQUIRE(strstr(result.ir, "@big = global i64 1099511627776\n") !=
+                nullptr);
+        REQUIRE(strstr(result.ir, "@u = global i32 -294967296\n") != nullptr);
+        REQUIRE(strstr(result.ir, "@c = global i8 44\n") != nullptr);
+        tc_result_free(&result);
+    }
+
+    SECTION("Increments number their values in order") {
+        const char* source = "int main() { int i = 1; int j = ++i; "
+                             "int k = i--; return j + k; }\n";
+        tc_result result;
+        REQUIRE(tc_compile(source, strlen(source), NULL, &result) == 0);
+        REQUIRE(strstr(result.ir, "  %1 = load i32, i32* %i\n"
+                                  "  %2 = add i32 %1, 1\n"
+                                  "  store i32 %2, i32* %i\n"
+                                  "  store i32 %2, i32* %j\n"
+                                  "  %3 = load i32, i32* %i\n"
+                                  "  %4 = sub i32 %3, 1\n"
+                                  "  store i32 %4, i32* %i\n"
+                                  "  store i32 %3, i32* %k\n") != nullptr);
+        tc_result_free(&result);
+    }
+
+    SECTION("Missing result is rejected") {
+        REQUIRE(tc_compile(k_program, strlen(k_program), NULL, NULL) != 0);
+    }
+}
+
+TEST_CASE("Parallel codegen matches in-order codegen") {
+    std::string source;
+    for (int i = 0; i < 40; i++) {
+        source += "int f" + std::to_string(i) +
+                  "(int x) { printf(\"f%d\\n\", x); return x + " +
+                  std::to_string(i) + "; }\n";
+    }
+    source += "int main() { return f0(1) + f39(2); }\n";
+
+    tc_options sequential = {"many.c", 1, NULL, 0, NULL, 0, 0};
+    tc_result expected;
+    REQUIRE(tc_compile(source.c_str(), source.size(), &sequential,
+                       &expected) == 0);
+
+    /* Numbering restarts in every function */
+    REQUIRE(strstr(expected.ir, "define i32 @f39(i32 %x) {\n  %1 =") !=
+            nullptr);
+    REQUIRE(strstr(expected.ir, "@.str.f39.0") != nullptr);
+
+    for (int jobs = 2; jobs <= 8; jobs *= 2) {
+        tc_options parallel = {"many.c", jobs, NULL, 0, NULL, 0, 0};
+        tc_result result;
+        REQUIRE(tc_compile(source.c_str(), source.size(), &parallel,
+                           &result) == 0);
+        REQUIRE(std::string(result.ir, result.ir_length) ==
+                std::string(expected.ir, expected.ir_length));
+        tc_result_free(&result);
+    }
+    tc_result_free(&expected);
+}
+
+TEST_CASE("Constant section scales to many string literals") {
+    const int function_count = 1000;
+    const int strings_per_function = 100;
+    std::string source;
+    for (int f = 0; f < function_count; f++) {
+        source += "int f" + std::to_string(f) + "() {\n";
+        for (int i = 0; i < strings_per_function; i++) {
+            source += "  printf(\"s" + std::to_string(f) + "_" +
+                      std::to_string(i) + "\\n\");\n";
+        }
+        source += "  return 0;\n}\n";
+    }
+
+    tc_result result;
+    REQUIRE(tc_compile(source.c_str(), source.size(), NULL, &result) == 0);
+    std::string ir(result.ir, result.ir_length);
+    tc_result_free(&result);
+
+    size_t count = 0;
+    for (size_t at = ir.find("private unnamed_addr constant");
+         at != std::string::npos;
+         at = ir.find("private unnamed_addr constant", at + 1)) {
+        count++;
+    }
+    REQUIRE(count == (size_t)function_count * strings_per_function);
+
+    /* Constants follow the bodies in source order */
+    size_t first = ir.find("@.str.f0.0 = ");
+    size_t last = ir.find("@.str.f999.99 = ");
+    REQUIRE(first != std::string::npos);
+    REQUIRE(last != std::string::npos);
+    REQUIRE(first > ir.rfind("define i32 @f999()"));
+    REQUIRE(first < ir.find("@.str.f0.1 = "));
+    REQUIRE(ir.find("@.str.f998.99 = ") < last);
+}
+
+TEST_CASE("Library API is safe to call from multiple threads") {
+    tc_result reference;
+    REQUIRE(tc_compile(k_program, strlen(k_program), NULL, &reference) == 0);
+    std::string expected(reference.ir, reference.ir_length);
+    tc_result_free(&reference);
+
+    const int thread_count = 4;
+    const int iterations = 25;
+    std::vector<int> mismatches(thread_count, 0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < iterations; i++) {
+                tc_result result;
+                if (tc_compile(k_program, strlen(k_program), NULL, &result) !=
+                        0 ||
+                    expected != std::string(result.ir, result.ir_length)) {
+                    mismatches[t]++;
+                }
+                tc_result_free(&result);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 0; t < thread_count; t++) {
+        REQUIRE(mismatches[t] == 0);
+    }
+}
+
+TEST_CASE("Whole-program compilation merges translation units") {
+    const char* lib_source =
+        "int counter = 5;\n"
+        "int helper(int x) { printf(\"value %d\\n\", x); return x * 2; }\n"
+        "int api_entry(int x) { return helper(x) + counter; }\n";
+    const char* main_source =
+        "int helper(int x);\n"
+        "extern int counter;\n"
+        "int main() { printf(\"value %d\\n\", counter); return helper(3); }\n";
+    tc_unit units[] = {{"lib.c", lib_source, strlen(lib_source)},
+                       {"main.c", main_source, strlen(main_source)}};
+    const char* exports[] = {"api_entry"};
+    tc_options options = {"all.ll", 0, exports, 1, NULL, 0, 0};
+
+    tc_result result;
+    REQUIRE(tc_compile_program(units, 2, &options, &result) == 0);
+    std::string ir(result.ir, result.ir_length);
+    tc_result_free(&result);
+
+    SECTION("Only main and exported symbols stay external") {
+        REQUIRE(ir.find("define internal i32 @helper(") != std::string::npos);
+        REQUIRE(ir.find("define i32 @api_entry(") != std::string::npos);
+        REQUIRE(ir.find("define i32 @main(") != std::string::npos);
+        REQUIRE(ir.find("@counter = internal global i32 5") !=
+                std::string::npos);
+    }
+
+    SECTION("Declarations and strings are emitted once") {
+        REQUIRE(ir.find("declare i32 @helper") == std::string::npos);
+        REQUIRE(ir.find("@counter = ") == ir.rfind("@counter = "));
+        REQUIRE(ir.find("@.str.main.0 = private unnamed_addr alias [10 x i8], "
+                        "[10 x i8]* @.str.helper.0") != std::string::npos);
+    }
+}
+
+TEST_CASE("Whole-program compilation reports conflicts per unit") {
+    const char* first = "int twice(int x) { return x + x; }\n";
+    const char* second = "int twice(int x) { return 2 * x; }\n"
+                         "int main() { return twice(1); }\n";
+    const char* broken = "int main( {";
+
+    tc_unit units[] = {{"a.c", first, strlen(first)},
+                       {"b.c", second, strlen(second)}};
+    tc_result result;
+    REQUIRE(tc_compile_program(units, 2, NULL, &result) != 0);
+    REQUIRE(result.error_count == 1);
+    REQUIRE(strstr(result.diagnostics[0].message, "'twice'") != nullptr);
+    tc_result_free(&result);
+
+    tc_unit bad_units[] = {{"a.c", first, strlen(first)},
+                           {"broken.c", broken, strlen(broken)}};
+    REQUIRE(tc_compile_program(bad_units, 2, NULL, &result) != 0);
+    REQUIRE(result.diagnostic_count > 0);
+    REQUIRE(strcmp(result.diagnostics[0].file_name, "broken.c") == 0);
+    tc_result_free(&result);
+}
+
+TEST_CASE("Whole-program compilation keeps static names per unit") {
+    const char* first = "static int h() { return 1; }\n"
+                        "static int count = 2;\n"
+                        "int first() { return h() + count; }\n";
+    const char* second = "static int h(void);\n"
+                         "int first(void);\n"
+                         "int main() { int count = 3; return h() + count + "
+                         "first(); }\n"
+                         "static int h() { return 4; }\n";
+
+    tc_unit units[] = {{"a.c", first, strlen(first)},
+                       {"b.c", second, strlen(second)}};
+    tc_result result;
+    REQUIRE(tc_compile_program(units, 2, NULL, &result) == 0);
+    REQUIRE(result.error_count == 0);
+    std::string ir(result.ir, result.ir_length);
+    REQUIRE(ir.find("define internal i32 @h.0(") != std::string::npos);
+    REQUIRE(ir.find("define internal i32 @h.1(") != std::string::npos);
+    REQUIRE(ir.find("@count.0 = internal global i32 2") != std::string::npos);
+    REQUIRE(ir.find("call i32 @h.1(") != std::string::npos);
+    REQUIRE(ir.find("declare i32 @h") == std::string::npos);
+    tc_result_free(&result);
+}